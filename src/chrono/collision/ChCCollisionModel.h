@@ -239,6 +239,11 @@ class ChApi ChCollisionModel {
     /// By default it uses GetCsysForCollisionModel 
     virtual void SyncPosition() =0;
 
+    /// Mark the model as sleeping (or awake again), when its owner falls asleep.
+    /// A collision system can then skip the update of its bounding box and the
+    /// narrow phase between two sleeping models. Default: no effect.
+    virtual void SetSleeping(bool state) {}
+
     /// By default, all collision objects belong to family n.0,
     /// but you can set family in range 0..15. This is used when
     /// the objects collided with another: the contact is created
@@ -19,11 +19,13 @@
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChProximityContainer.h"
+#include "chrono/utils/ChTraceProfiler.h"
 #include "chrono/collision/bullet/LinearMath/btPoolAllocator.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/btSphereShape.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/btCylinderShape.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/bt2DShape.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/btCEtriangleShape.h"
+#include "chrono/collision/bullet/BulletCollision/CollisionShapes/btCEtriangleBvhShape.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionDispatch/btEmptyCollisionAlgorithm.h"
 
 extern btScalar gContactBreakingThreshold;
@@ -1186,6 +1188,9 @@ ChCollisionSystemBullet::ChCollisionSystemBullet(unsigned int max_objects, doubl
 
     bt_collision_world = new btCollisionWorld(bt_dispatcher, bt_broadphase, bt_collision_configuration);
 
+    // Do not update the bounding boxes of the deactivated (sleeping) models, which do not move
+    bt_collision_world->setForceUpdateAllAabbs(false);
+
     // custom collision for sphere-sphere case ***OBSOLETE*** // already registered by btDefaultCollisionConfiguration
     // bt_dispatcher->registerCollisionCreateFunc(SPHERE_SHAPE_PROXYTYPE,SPHERE_SHAPE_PROXYTYPE,new
     // btSphereSphereCollisionAlgorithm::CreateFunc);
@@ -1261,11 +1266,26 @@ void ChCollisionSystemBullet::Remove(ChCollisionModel* model) {
 }
 
 void ChCollisionSystemBullet::Run() {
+    CH_TRACE("ChCollisionSystemBullet::Run");
     if (bt_collision_world) {
         bt_collision_world->performDiscreteCollisionDetection();
     }
 }
 
+// For a collision object made of a BVH of triangle proxies, return the model of the triangle that
+// generated a contact, given the child index stored in the manifold point. Otherwise return the
+// model owning the collision object.
+static ChCollisionModel* GetContactingModel(btCollisionObject* ob, int child_index) {
+    btCollisionShape* shape = ob->getCollisionShape();
+    if (child_index >= 0 && shape->getShapeType() == COMPOUND_SHAPE_PROXYTYPE) {
+        if (btCEtriangleBvhShape* bvh = dynamic_cast<btCEtriangleBvhShape*>(shape)) {
+            if (child_index < bvh->getNumChildShapes())
+                return (ChCollisionModel*)bvh->getChildShape(child_index)->getUserPointer();
+        }
+    }
+    return (ChCollisionModel*)ob->getUserPointer();
+}
+
 void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontainer) {
     // This should remove all old contacts (or at least rewind the index)
     mcontactcontainer->BeginAddContact();
@@ -1284,6 +1304,14 @@ void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontain
         icontact.modelA = (ChCollisionModel*)obA->getUserPointer();
         icontact.modelB = (ChCollisionModel*)obB->getUserPointer();
 
+        // Each child pair of a compound has its own manifold, so the triangle of a BVH mesh
+        // can be identified once per manifold, from its first point.
+        if (contactManifold->getNumContacts() > 0) {
+            const btManifoldPoint& pt0 = contactManifold->getContactPoint(0);
+            icontact.modelA = GetContactingModel(obA, pt0.m_index0);
+            icontact.modelB = GetContactingModel(obB, pt0.m_index1);
+        }
+
         double envelopeA = icontact.modelA->GetEnvelope();
         double envelopeB = icontact.modelB->GetEnvelope();
 
@@ -1404,35 +1432,41 @@ bool ChCollisionSystemBullet::RayHit(const ChVector<>& from,
     btVector3 btfrom((btScalar)from.x(), (btScalar)from.y(), (btScalar)from.z());
     btVector3 btto((btScalar)to.x(), (btScalar)to.y(), (btScalar)to.z());
 
-    btCollisionWorld::AllHitsRayResultCallback rayCallback(btfrom, btto);
+    // Test the ray against the specified model only, without traversing the broadphase.
+    // This does not modify the collision world, so it can be called concurrently.
+    btCollisionObject* object = static_cast<ChModelBullet*>(model)->GetBulletModel();
+    if (!object->getCollisionShape()) {
+        mresult.hit = false;
+        return false;
+    }
 
-    this->bt_collision_world->rayTest(btfrom, btto, rayCallback);
+    btTransform from_trans;
+    btTransform to_trans;
+    from_trans.setIdentity();
+    from_trans.setOrigin(btfrom);
+    to_trans.setIdentity();
+    to_trans.setOrigin(btto);
 
-    // Find the closest hit result on the specified model (if any)
-    int hit = -1;
-    btScalar fraction = 1;
-    for (int i = 0; i < rayCallback.m_collisionObjects.size(); ++i) {
-        if (rayCallback.m_collisionObjects[i]->getUserPointer() == model && rayCallback.m_hitFractions[i] < fraction) {
-            hit = i;
-            fraction = rayCallback.m_hitFractions[i];
-        }
-    }
+    btCollisionWorld::ClosestRayResultCallback rayCallback(btfrom, btto);
+
+    btCollisionWorld::rayTestSingle(from_trans, to_trans, object, object->getCollisionShape(),
+                                    object->getWorldTransform(), rayCallback);
 
     // Ray does not hit specified model
-    if (hit == -1) {
+    if (!rayCallback.hasHit()) {
         mresult.hit = false;
         return false;
     }
 
     // Return the closest hit on the specified model
     mresult.hit = true;
-    mresult.hitModel = static_cast<ChCollisionModel*>(rayCallback.m_collisionObjects[hit]->getUserPointer());
-    mresult.abs_hitPoint.Set(rayCallback.m_hitPointWorld[hit].x(), rayCallback.m_hitPointWorld[hit].y(),
-                             rayCallback.m_hitPointWorld[hit].z());
-    mresult.abs_hitNormal.Set(rayCallback.m_hitNormalWorld[hit].x(), rayCallback.m_hitNormalWorld[hit].y(),
-                              rayCallback.m_hitNormalWorld[hit].z());
+    mresult.hitModel = model;
+    mresult.abs_hitPoint.Set(rayCallback.m_hitPointWorld.x(), rayCallback.m_hitPointWorld.y(),
+                             rayCallback.m_hitPointWorld.z());
+    mresult.abs_hitNormal.Set(rayCallback.m_hitNormalWorld.x(), rayCallback.m_hitNormalWorld.y(),
+                              rayCallback.m_hitNormalWorld.z());
     mresult.abs_hitNormal.Normalize();
-    mresult.dist_factor = fraction;
+    mresult.dist_factor = rayCallback.m_closestHitFraction;
     mresult.abs_hitPoint = mresult.abs_hitPoint - mresult.abs_hitNormal * mresult.hitModel->GetEnvelope();
     return true;
 }
@@ -22,6 +22,7 @@
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/bt2DShape.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/btBarrelShape.h"
 #include "chrono/collision/bullet/BulletCollision/CollisionShapes/btCEtriangleShape.h"
+#include "chrono/collision/bullet/BulletCollision/CollisionShapes/btCEtriangleBvhShape.h"
 #include "chrono/collision/bullet/BulletWorldImporter/btBulletWorldImporter.h"
 #include "chrono/collision/bullet/btBulletCollisionCommon.h"
 #include "chrono/collision/gimpact/GIMPACT/Bullet/btGImpactCollisionAlgorithm.h"
@@ -693,6 +694,38 @@ bool ChModelBullet::AddTriangleMeshConcaveDecomposed(ChConvexDecomposition& myde
     return true;
 }
 
+bool ChModelBullet::AddTriangleProxyBVH(const std::vector<ChCollisionModel*>& triangle_models) {
+    this->shapes.clear();
+
+    btCEtriangleBvhShape* mcompound = new btCEtriangleBvhShape;
+    mcompound->setUserPointer(this);
+    this->shapes.push_back(std::shared_ptr<btCollisionShape>(mcompound));
+
+    btTransform mtransform;
+    mtransform.setIdentity();
+
+    for (auto model : triangle_models) {
+        ChModelBullet* tri_model = (ChModelBullet*)model;
+        if (tri_model->shapes.size() != 1 || tri_model->shapes[0]->getShapeType() != CE_TRIANGLE_SHAPE_PROXYTYPE)
+            throw ChException("Error! AddTriangleProxyBVH: models must contain a single triangle proxy.");
+        // the child keeps its user pointer to the triangle model, used when reporting contacts
+        mcompound->addChildShape(mtransform, tri_model->shapes[0].get());
+        this->shapes.push_back(tri_model->shapes[0]);
+    }
+
+    mcompound->buildTree();
+    this->bt_collision_object->setCollisionShape(mcompound);
+
+    return true;
+}
+
+void ChModelBullet::RefitTriangleProxyBVH() {
+    if (this->shapes.size() == 0)
+        return;
+    if (btCEtriangleBvhShape* mcompound = dynamic_cast<btCEtriangleBvhShape*>(this->shapes[0].get()))
+        mcompound->refitTree();
+}
+
 bool ChModelBullet::AddCopyOfAnotherModel(ChCollisionModel* another) {
     // this->ClearModel();
     this->shapes.clear();  // this will also delete owned shapes, if any, thank to shared pointers in 'shapes' vector
@@ -801,6 +834,9 @@ void ChModelBullet::SyncPosition()
     bt_collision_object->getWorldTransform().setBasis(basisA);
 }
 
+void ChModelBullet::SetSleeping(bool state) {
+    bt_collision_object->forceActivationState(state ? ISLAND_SLEEPING : ACTIVE_TAG);
+}
 
 bool ChModelBullet::SetSphereRadius(double coll_radius, double out_envelope) {
     if (this->shapes.size() != 1)
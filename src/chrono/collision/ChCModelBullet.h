@@ -230,6 +230,20 @@ class ChApi ChModelBullet : public ChCollisionModel {
         double msphereswept_rad = 0  ///< sphere swept triangle ('fat' triangle, improves robustness)
     );
 
+    /// CUSTOM for this class only: group the triangle proxies of the given models, each
+    /// previously built with a single AddTriangleProxy(), into one collision shape with a
+    /// bounding volume hierarchy. This way a whole deformable mesh is a single object in the
+    /// broadphase; the hierarchy is built here only once, then it must be refit to the moved
+    /// vertexes with RefitTriangleProxyBVH() before each collision detection.
+    /// Shapes are shared (not copied) with the triangle models, that must outlive this one;
+    /// contacts are still reported per triangle, referencing the triangle models.
+    /// Previous shapes of this model, if any, are removed.
+    virtual bool AddTriangleProxyBVH(const std::vector<ChCollisionModel*>& triangle_models);
+
+    /// Refit the bounding volume hierarchy built with AddTriangleProxyBVH() to the current
+    /// position of the triangle vertexes. The topology of the hierarchy is not changed.
+    void RefitTriangleProxyBVH();
+
     /// Add all shapes already contained in another model.
     /// Thank to the adoption of shared pointers, underlying shapes are
     /// shared (not copied) among the models; this will save memory when you must
@@ -263,6 +277,11 @@ class ChApi ChModelBullet : public ChCollisionModel {
     /// model as the current position of the corresponding ChContactable
     virtual void SyncPosition();
 
+    /// Mark the model as sleeping (or awake again). The Bullet object is deactivated:
+    /// its bounding box is not updated and no narrow phase is done against other
+    /// deactivated objects.
+    virtual void SetSleeping(bool state);
+
     /// If the collision shape is a sphere, resize it and return true (if no
     /// sphere is found in this collision shape, return false).
     /// It can also change the outward envelope; the inward margin is automatically the radius of the sphere.
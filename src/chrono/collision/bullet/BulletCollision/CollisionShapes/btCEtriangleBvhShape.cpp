@@ -0,0 +1,102 @@
+/*
+*** ALEX ***
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2006 Erwin Coumans  http://continuousphysics.com/Bullet/
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it freely,
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "btCEtriangleBvhShape.h"
+#include "BulletCollision/BroadphaseCollision/btDbvt.h"
+
+btCEtriangleBvhShape::btCEtriangleBvhShape()
+    : btCompoundShape(true),
+      m_refitAabbMin(btScalar(0.), btScalar(0.), btScalar(0.)),
+      m_refitAabbMax(btScalar(0.), btScalar(0.), btScalar(0.))
+{
+}
+
+void btCEtriangleBvhShape::buildTree()
+{
+    btDbvt* tree = getDynamicAabbTree();
+    if (tree)
+        tree->optimizeTopDown();
+    refitTree();
+}
+
+void btCEtriangleBvhShape::refitTree()
+{
+    btDbvt* tree = getDynamicAabbTree();
+    int numChildren = getNumChildShapes();
+
+    if (!tree || !tree->m_root || numChildren == 0)
+    {
+        m_refitAabbMin.setValue(0, 0, 0);
+        m_refitAabbMax.setValue(0, 0, 0);
+        return;
+    }
+
+    // update leaves, from the current position of the triangle vertexes
+    btCompoundShapeChild* children = getChildList();
+    btVector3 aabbMin, aabbMax;
+    for (int i = 0; i < numChildren; i++)
+    {
+        children[i].m_childShape->getAabb(children[i].m_transform, aabbMin, aabbMax);
+        children[i].m_node->volume = btDbvtVolume::FromMM(aabbMin, aabbMax);
+    }
+
+    // collect internal nodes so that parents always precede their children...
+    m_refitStack.resize(0);
+    if (tree->m_root->isinternal())
+        m_refitStack.push_back(tree->m_root);
+    for (int k = 0; k < m_refitStack.size(); k++)
+    {
+        btDbvtNode* node = m_refitStack[k];
+        if (node->childs[0]->isinternal())
+            m_refitStack.push_back(node->childs[0]);
+        if (node->childs[1]->isinternal())
+            m_refitStack.push_back(node->childs[1]);
+    }
+
+    // ...then merge volumes walking the list backward, i.e. bottom-up
+    for (int k = m_refitStack.size() - 1; k >= 0; k--)
+    {
+        btDbvtNode* node = m_refitStack[k];
+        Merge(node->childs[0]->volume, node->childs[1]->volume, node->volume);
+    }
+
+    m_refitAabbMin = tree->m_root->volume.Mins();
+    m_refitAabbMax = tree->m_root->volume.Maxs();
+}
+
+void btCEtriangleBvhShape::recalculateLocalAabb()
+{
+    btCompoundShape::recalculateLocalAabb();
+    refitTree();
+}
+
+void btCEtriangleBvhShape::getAabb(const btTransform& trans,btVector3& aabbMin,btVector3& aabbMax) const
+{
+    btVector3 localHalfExtents = btScalar(0.5)*(m_refitAabbMax-m_refitAabbMin);
+    btVector3 localCenter = btScalar(0.5)*(m_refitAabbMax+m_refitAabbMin);
+
+    localHalfExtents += btVector3(getMargin(),getMargin(),getMargin());
+
+    btMatrix3x3 abs_b = trans.getBasis().absolute();
+
+    btVector3 center = trans(localCenter);
+
+    btVector3 extent = btVector3(abs_b[0].dot(localHalfExtents),
+        abs_b[1].dot(localHalfExtents),
+        abs_b[2].dot(localHalfExtents));
+    aabbMin = center-extent;
+    aabbMax = center+extent;
+}
@@ -0,0 +1,58 @@
+/*
+*** ALEX ***
+Bullet Continuous Collision Detection and Physics Library
+Copyright (c) 2003-2006 Erwin Coumans  http://continuousphysics.com/Bullet/
+
+This software is provided 'as-is', without any express or implied warranty.
+In no event will the authors be held liable for any damages arising from the use of this software.
+Permission is granted to anyone to use this software for any purpose,
+including commercial applications, and to alter it and redistribute it freely,
+subject to the following restrictions:
+
+1. The origin of this software must not be misrepresented; you must not claim that you wrote the original software. If you use this software in a product, an acknowledgment in the product documentation would be appreciated but is not required.
+2. Altered source versions must be plainly marked as such, and must not be misrepresented as being the original software.
+3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef BT_CE_TRIANGLE_BVH_SHAPE_H
+#define BT_CE_TRIANGLE_BVH_SHAPE_H
+
+#include "btCompoundShape.h"
+
+/// btCEtriangleBvhShape groups many btCEtriangleShape children of a deformable mesh
+/// into a single collision shape, so that the whole mesh enters the broadphase as one object.
+/// The dynamic AABB tree of the compound is built only once, when the children are added;
+/// afterwards it is just refit to the moved vertexes by calling refitTree(), that is
+/// much cheaper than removing and re-inserting leaves.
+/// The child shapes are not owned by this compound.
+
+ATTRIBUTE_ALIGNED16(class) btCEtriangleBvhShape : public btCompoundShape
+{
+private:
+    btVector3 m_refitAabbMin;
+    btVector3 m_refitAabbMax;
+    btAlignedObjectArray<struct btDbvtNode*> m_refitStack;
+
+public:
+	BT_DECLARE_ALIGNED_ALLOCATOR();
+
+	btCEtriangleBvhShape();
+
+    /// Rebalance the tree once all the triangles have been added, and compute the initial bounds.
+    void buildTree();
+
+    /// Update the leaf volumes from the current vertex positions of the children,
+    /// then update the internal nodes bottom-up. The topology of the tree is not changed.
+    void refitTree();
+
+	virtual void getAabb(const btTransform& t,btVector3& aabbMin,btVector3& aabbMax) const;
+
+	virtual void recalculateLocalAabb();
+
+	virtual const char*	getName()const
+	{
+		return "CEtriangleBvhShape";
+	}
+};
+
+#endif
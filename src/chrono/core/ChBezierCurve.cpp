@@ -25,12 +25,15 @@
 //    piece-wise 3D curve (using the Bernstein polynomial representation of
 //    Bezier curves). In addition, it provides a method for calculating the
 //    closest point on a specified interval of the curve to a specified
-//    location.
+//    location. A bounding volume hierarchy over the curve intervals is used
+//    for closest-point queries on the entire curve, and a table of arc lengths
+//    for conversions between arc length and curve parameter.
 //
 // ChBezierCurveTracker
 //    This utility class implements a tracker for a given path. It uses time
 //    coherence in order to provide an appropriate initial guess for the
-//    iterative (Newton) root finder.
+//    iterative (Newton) root finder. On reset, the tracker is located with a
+//    global closest-point query.
 //
 // =============================================================================
 
@@ -38,6 +41,7 @@
 #include <iostream>
 #include <sstream>
 #include <fstream>
+#include <limits>
 
 #include "chrono/core/ChBezierCurve.h"
 #include "chrono/core/ChMathematics.h"
@@ -51,6 +55,8 @@ const size_t ChBezierCurve::m_maxNumIters = 50;
 const double ChBezierCurve::m_sqrDistTol = 1e-4;
 const double ChBezierCurve::m_cosAngleTol = 1e-4;
 const double ChBezierCurve::m_paramTol = 1e-4;
+const size_t ChBezierCurve::m_numLengthSamples = 16;
+const size_t ChBezierCurve::m_maxLeafSize = 4;
 
 // -----------------------------------------------------------------------------
 // ChBezierCurve::ChBezierCurve()
@@ -67,6 +73,7 @@ ChBezierCurve::ChBezierCurve(const std::vector<ChVector<> >& points,
     assert(points.size() > 1);
     assert(points.size() == inCV.size());
     assert(points.size() == outCV.size());
+    buildIndex();
 }
 
 ChBezierCurve::ChBezierCurve(const std::vector<ChVector<> >& points) : m_points(points) {
@@ -84,6 +91,7 @@ ChBezierCurve::ChBezierCurve(const std::vector<ChVector<> >& points) : m_points(
     if (numPoints == 2) {
         m_outCV[0] = (2.0 * points[0] + points[1]) / 3.0;
         m_inCV[1] = (points[0] + 2.0 * points[1]) / 3.0;
+        buildIndex();
         return;
     }
 
@@ -129,6 +137,8 @@ ChBezierCurve::ChBezierCurve(const std::vector<ChVector<> >& points) : m_points(
     delete[] x;
     delete[] y;
     delete[] z;
+
+    buildIndex();
 }
 
 void ChBezierCurve::setPoints(const std::vector<ChVector<> >& points,
@@ -140,6 +150,7 @@ void ChBezierCurve::setPoints(const std::vector<ChVector<> >& points,
     m_points = points;
     m_inCV = inCV;
     m_outCV = outCV;
+    buildIndex();
 }
 
 // Utility function for solving the tridiagonal system for one of the
@@ -401,53 +412,283 @@ ChVector<> ChBezierCurve::calcClosestPoint(const ChVector<>& loc, size_t i, doub
 }
 
 // -----------------------------------------------------------------------------
-// ChBezierCurveTracker::reset()
+// ChBezierCurve::buildIndex()
 //
-// This function reinitializes the pathTracker at the specified location. It
-// calculates an appropriate initial guess for the curve segment and sets the
-// curve parameter to 0.5.
+// This function builds the search structures for queries on the entire curve:
+//  - a bounding volume hierarchy over the curve intervals. By the convex hull
+//    property, each interval is contained in the axis-aligned bounding box of
+//    its 4 control points. The hierarchy is built top-down, splitting the
+//    intervals at the median of their box centers along the largest extent.
+//    Nodes are stored in depth-first order, with the first child of an inner
+//    node immediately following it.
+//  - a table of arc lengths at m_numLengthSamples equally spaced values of the
+//    curve parameter in each interval.
 // -----------------------------------------------------------------------------
-class PointSpec {
-  public:
-    PointSpec() {}
-    PointSpec(size_t index, double dist2) : m_index(index), m_dist2(dist2) {}
+void ChBezierCurve::buildIndex() {
+    m_bvh.clear();
+    m_bvhIntervals.clear();
+    m_arcLengths.clear();
+    m_totalLength = 0;
 
-    size_t m_index;
-    double m_dist2;
-};
+    if (m_points.size() < 2)
+        return;
 
-static bool comparePoints(const PointSpec& p1, const PointSpec& p2) {
-    return p1.m_dist2 < p2.m_dist2;
+    size_t numIntervals = getNumPoints() - 1;
+
+    // Bounding boxes of the control polygons.
+    std::vector<ChVector<> > boxMin(numIntervals);
+    std::vector<ChVector<> > boxMax(numIntervals);
+    for (size_t i = 0; i < numIntervals; i++) {
+        const ChVector<>* cv[4] = {&m_points[i], &m_outCV[i], &m_inCV[i + 1], &m_points[i + 1]};
+        boxMin[i] = *cv[0];
+        boxMax[i] = *cv[0];
+        for (int k = 1; k < 4; k++) {
+            for (int j = 0; j < 3; j++) {
+                boxMin[i][j] = std::min(boxMin[i][j], (*cv[k])[j]);
+                boxMax[i][j] = std::max(boxMax[i][j], (*cv[k])[j]);
+            }
+        }
+    }
+
+    m_bvhIntervals.resize(numIntervals);
+    for (size_t i = 0; i < numIntervals; i++)
+        m_bvhIntervals[i] = i;
+    m_bvh.reserve(2 * numIntervals);
+
+    // Pending ranges of intervals, with the index of the parent node whose
+    // second child they form (numIntervals for the root and first children).
+    struct Range {
+        size_t first;
+        size_t count;
+        size_t parent;
+    };
+    std::vector<Range> stack(1, Range{0, numIntervals, numIntervals});
+
+    while (!stack.empty()) {
+        Range range = stack.back();
+        stack.pop_back();
+
+        size_t node = m_bvh.size();
+        if (range.parent != numIntervals)
+            m_bvh[range.parent].second = node;
+
+        BVHNode n;
+        n.aabb_min = boxMin[m_bvhIntervals[range.first]];
+        n.aabb_max = boxMax[m_bvhIntervals[range.first]];
+        ChVector<> cmin = boxMin[m_bvhIntervals[range.first]] + boxMax[m_bvhIntervals[range.first]];
+        ChVector<> cmax = cmin;
+        for (size_t k = range.first + 1; k < range.first + range.count; k++) {
+            size_t i = m_bvhIntervals[k];
+            ChVector<> c = boxMin[i] + boxMax[i];
+            for (int j = 0; j < 3; j++) {
+                n.aabb_min[j] = std::min(n.aabb_min[j], boxMin[i][j]);
+                n.aabb_max[j] = std::max(n.aabb_max[j], boxMax[i][j]);
+                cmin[j] = std::min(cmin[j], c[j]);
+                cmax[j] = std::max(cmax[j], c[j]);
+            }
+        }
+        n.first = range.first;
+        n.second = 0;
+        n.count = range.count;
+        m_bvh.push_back(n);
+
+        if (range.count <= m_maxLeafSize)
+            continue;
+
+        // Inner node: split at the median along the axis of largest extent of the box centers.
+        ChVector<> extent = cmax - cmin;
+        int axis = (extent.x() > extent.y()) ? (extent.x() > extent.z() ? 0 : 2) : (extent.y() > extent.z() ? 1 : 2);
+        size_t half = range.count / 2;
+        auto begin = m_bvhIntervals.begin() + range.first;
+        std::nth_element(begin, begin + half, begin + range.count, [&](size_t a, size_t b) {
+            return boxMin[a][axis] + boxMax[a][axis] < boxMin[b][axis] + boxMax[b][axis];
+        });
+        m_bvh[node].count = 0;
+
+        // Push the second child first, so that the first child is built next.
+        stack.push_back(Range{range.first + half, range.count - half, node});
+        stack.push_back(Range{range.first, half, numIntervals});
+    }
+
+    // Cumulative arc lengths.
+    m_arcLengths.resize(numIntervals * m_numLengthSamples + 1);
+    m_arcLengths[0] = 0;
+    double dt = 1.0 / m_numLengthSamples;
+    for (size_t i = 0; i < numIntervals; i++) {
+        for (size_t k = 0; k < m_numLengthSamples; k++) {
+            size_t j = i * m_numLengthSamples + k;
+            m_arcLengths[j + 1] = m_arcLengths[j] + integrateLength(i, k * dt, (k + 1) * dt);
+        }
+    }
+    m_totalLength = m_arcLengths.back();
 }
 
-void ChBezierCurveTracker::reset(const ChVector<>& loc) {
-    // Walk all curve points and calculate the distance to the specified reset
-    // location, then sort them in increasing order.
-    std::vector<PointSpec> points;
+// Arc length of the specified interval between curve parameters t0 and t1,
+// using a 3-point Gauss-Legendre quadrature of the norm of the tangent.
+double ChBezierCurve::integrateLength(size_t i, double t0, double t1) const {
+    static const double x1 = 0.774596669241483377;
+    static const double w0 = 8.0 / 9.0;
+    static const double w1 = 5.0 / 9.0;
 
-    for (size_t i = 0; i < m_path->getNumPoints(); i++)
-        points.push_back(PointSpec(i, (loc - m_path->m_points[i]).Length2()));
+    double h = (t1 - t0) / 2;
+    double m = (t1 + t0) / 2;
 
-    std::sort(points.begin(), points.end(), comparePoints);
+    return h * (w0 * evalD(i, m).Length() + w1 * (evalD(i, m - h * x1).Length() + evalD(i, m + h * x1).Length()));
+}
 
-    // Set the initial guess to be at t=0.5 in either the interval starting at
-    // the point with minimum distance or in the previous interval.
-    m_curParam = 0.5f;
-    m_curInterval = points[0].m_index;
+// -----------------------------------------------------------------------------
+// ChBezierCurve::findClosestPoint()
+//
+// This function calculates and returns the closest point on this curve to the
+// specified location. On return, 'i' and 't' contain the interval and curve
+// parameter of the closest point.
+//
+// The bounding volume hierarchy is traversed depth-first, visiting the nearest
+// child first and skipping all nodes whose bounding box is farther than the
+// closest point found so far. In each leaf interval, an initial guess is
+// obtained by sampling the curve and is then refined with calcClosestPoint.
+// -----------------------------------------------------------------------------
+ChVector<> ChBezierCurve::findClosestPoint(const ChVector<>& loc, size_t& i, double& t) const {
+    static const int numSamples = 8;
+
+    // Squared distance from the specified location to the bounding box of a node.
+    auto boxDist2 = [&loc](const BVHNode& node) {
+        double d2 = 0;
+        for (int j = 0; j < 3; j++) {
+            double d = std::max(std::max(node.aabb_min[j] - loc[j], loc[j] - node.aabb_max[j]), 0.0);
+            d2 += d * d;
+        }
+        return d2;
+    };
 
-    if (m_curInterval == 0)
-        return;
+    i = 0;
+    t = 0;
+
+    // A curve with less than 2 points has no interval (and no hierarchy).
+    if (m_bvh.empty())
+        return m_points.empty() ? loc : m_points[0];
+
+    double best2 = std::numeric_limits<double>::max();
+    ChVector<> best = m_points[0];
+
+    std::vector<size_t> stack;
+    stack.reserve(64);
+    stack.push_back(0);
+
+    while (!stack.empty()) {
+        size_t node = stack.back();
+        stack.pop_back();
+
+        const BVHNode& n = m_bvh[node];
+        if (boxDist2(n) >= best2)
+            continue;
+
+        if (n.count > 0) {
+            // Leaf node: check all its intervals.
+            for (size_t k = n.first; k < n.first + n.count; k++) {
+                size_t interval = m_bvhIntervals[k];
+
+                double tk = 0;
+                double d2min = std::numeric_limits<double>::max();
+                for (int j = 0; j <= numSamples; j++) {
+                    double tj = (double)j / numSamples;
+                    double d2 = (eval(interval, tj) - loc).Length2();
+                    if (d2 < d2min) {
+                        d2min = d2;
+                        tk = tj;
+                    }
+                }
+
+                ChVector<> Q = calcClosestPoint(loc, interval, tk);
+                double d2 = (Q - loc).Length2();
+                if (d2 < best2) {
+                    best2 = d2;
+                    best = Q;
+                    i = interval;
+                    t = tk;
+                }
+            }
+            continue;
+        }
 
-    if (m_curInterval == m_path->getNumPoints() - 1) {
-        m_curInterval--;
-        return;
+        // Inner node: push the farther child first, so that the nearer one is visited next.
+        size_t first = node + 1;
+        size_t second = n.second;
+        if (boxDist2(m_bvh[first]) < boxDist2(m_bvh[second])) {
+            stack.push_back(second);
+            stack.push_back(first);
+        } else {
+            stack.push_back(first);
+            stack.push_back(second);
+        }
     }
 
-    ChVector<> loc2cur = m_path->m_points[m_curInterval] - loc;
-    ChVector<> loc2prev = m_path->m_points[m_curInterval - 1] - loc;
+    return best;
+}
+
+// -----------------------------------------------------------------------------
+// ChBezierCurve::calcArcLength()
+// ChBezierCurve::calcParameter()
+//
+// Conversions between curve parameter (interval index and parameter value in
+// that interval) and arc length from the first point of the curve. Both use the
+// table of arc lengths at equally spaced parameter values, with a quadrature
+// (and, for the inverse map, Newton iterations) in the sub-interval of interest.
+// -----------------------------------------------------------------------------
+double ChBezierCurve::calcArcLength(size_t i, double t) const {
+    assert(i + 1 < getNumPoints());
+
+    ChClampValue(t, 0.0, 1.0);
+    size_t k = std::min(static_cast<size_t>(t * m_numLengthSamples), m_numLengthSamples - 1);
+    double t0 = (double)k / m_numLengthSamples;
+
+    return m_arcLengths[i * m_numLengthSamples + k] + integrateLength(i, t0, t);
+}
+
+void ChBezierCurve::calcParameter(double s, size_t& i, double& t) const {
+    i = 0;
+    t = 0;
+    if (m_arcLengths.size() < 2)
+        return;
+
+    ChClampValue(s, 0.0, m_totalLength);
+
+    // Find the sub-interval containing the specified arc length.
+    auto it = std::upper_bound(m_arcLengths.begin(), m_arcLengths.end(), s);
+    size_t j = (it == m_arcLengths.begin()) ? 0 : (it - m_arcLengths.begin()) - 1;
+    j = std::min(j, m_arcLengths.size() - 2);
 
-    if (Vdot(loc2cur, loc2prev) < 0)
-        m_curInterval--;
+    i = j / m_numLengthSamples;
+    size_t k = j % m_numLengthSamples;
+    double t0 = (double)k / m_numLengthSamples;
+    double t1 = (double)(k + 1) / m_numLengthSamples;
+
+    // Newton iterations on the arc length within the sub-interval, starting
+    // from a linear interpolation of the tabulated values.
+    double s0 = m_arcLengths[j];
+    double ds = m_arcLengths[j + 1] - s0;
+    t = (ds > 0) ? t0 + (t1 - t0) * (s - s0) / ds : t0;
+
+    for (size_t iter = 0; iter < m_maxNumIters; iter++) {
+        double speed = evalD(i, t).Length();
+        if (speed == 0)
+            break;
+        double dt = (s0 + integrateLength(i, t0, t) - s) / speed;
+        t = ChClamp(t - dt, t0, t1);
+        if (std::abs(dt) < 1e-12)
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// ChBezierCurveTracker::reset()
+//
+// This function reinitializes the pathTracker at the specified location. The
+// curve interval and curve parameter are set to those of the closest point on
+// the entire path, so that tracking can resume after an arbitrary jump.
+// -----------------------------------------------------------------------------
+void ChBezierCurveTracker::reset(const ChVector<>& loc) {
+    m_path->findClosestPoint(loc, m_curInterval, m_curParam);
 }
 
 // -----------------------------------------------------------------------------
@@ -25,7 +25,9 @@
 //    piece-wise 3D curve (using the Bernstein polynomial representation of
 //    Bezier curves). In addition, it provides a method for calculating the
 //    closest point on a specified interval of the curve to a specified
-//    location.
+//    location. A bounding volume hierarchy over the curve intervals and a
+//    table of arc lengths support global closest-point queries and arc-length
+//    parameterization on long curves.
 //
 // ChBezierCurveTracker
 //    This utility class implements a tracker for a given path. It uses time
@@ -76,7 +78,7 @@ class ChApi ChBezierCurve {
     ChBezierCurve(const std::vector<ChVector<> >& points);
 
     /// Default constructor (required by serialization)
-    ChBezierCurve() {}
+    ChBezierCurve() : m_totalLength(0) {}
 
     /// Destructor for ChBezierCurve.
     ~ChBezierCurve() {}
@@ -129,6 +131,28 @@ class ChApi ChBezierCurve {
     /// to the closest point.
     ChVector<> calcClosestPoint(const ChVector<>& loc, size_t i, double& t) const;
 
+    /// Calculate the closest point on the entire curve to the given location.
+    /// The search uses a bounding volume hierarchy over the curve intervals (each
+    /// interval is contained in the bounding box of its control polygon), so that
+    /// its cost grows logarithmically with the number of intervals. On return, 'i'
+    /// and 't' contain the interval and the curve parameter of the closest point.
+    /// A curve with a single point returns that point (an empty curve returns 'loc'),
+    /// with i = 0 and t = 0.
+    ChVector<> findClosestPoint(const ChVector<>& loc, size_t& i, double& t) const;
+
+    /// Return the total arc length of the curve.
+    double getLength() const { return m_totalLength; }
+
+    /// Return the arc length from the first point of the curve to the point with
+    /// curve parameter 't' in the specified interval.
+    double calcArcLength(size_t i, double t) const;
+
+    /// Find the point at the specified arc length from the first point of the curve.
+    /// On return, 'i' and 't' contain the interval and the curve parameter of that
+    /// point. Arc lengths outside [0, getLength()] are clamped. A curve with less than
+    /// 2 points returns i = 0 and t = 0.
+    void calcParameter(double s, size_t& i, double& t) const;
+
     /// Write the knots and control points to the specified file.
     void write(const std::string& filename);
 
@@ -178,6 +202,8 @@ class ChApi ChBezierCurve {
         marchive >> CHNVP(m_sqrDistTol);
         marchive >> CHNVP(m_cosAngleTol);
         marchive >> CHNVP(m_paramTol);
+
+        buildIndex();
     }
 
   private:
@@ -187,15 +213,40 @@ class ChApi ChBezierCurve {
     /// resulting Bezier curve is a spline interpolant of the knots.
     static void solveTriDiag(size_t n, double* rhs, double* x);
 
+    /// Build the bounding volume hierarchy of the curve intervals and the arc-length table.
+    void buildIndex();
+
+    /// Calculate the arc length of the specified interval between curve parameters t0 and t1.
+    double integrateLength(size_t i, double t0, double t1) const;
+
+    /// Node of the bounding volume hierarchy of the curve intervals.
+    /// An inner node is followed by its first child; 'second' is the index of its second
+    /// child. A leaf node covers m_bvhIntervals[first, first + count).
+    struct BVHNode {
+        ChVector<> aabb_min;
+        ChVector<> aabb_max;
+        size_t first;
+        size_t second;
+        size_t count;
+    };
+
     std::vector<ChVector<> > m_points;  ///< set of knot points
     std::vector<ChVector<> > m_inCV;    ///< set on "incident" control points
     std::vector<ChVector<> > m_outCV;   ///< set of "outgoing" control points
 
+    std::vector<BVHNode> m_bvh;           ///< bounding volume hierarchy of the curve intervals
+    std::vector<size_t> m_bvhIntervals;   ///< curve intervals, in the order of the BVH leaves
+    std::vector<double> m_arcLengths;     ///< arc length at the start of each sub-interval
+    double m_totalLength;                 ///< total arc length of the curve
+
     static const size_t m_maxNumIters;  ///< maximum number of Newton iterations
     static const double m_sqrDistTol;   ///< tolerance on squared distance
     static const double m_cosAngleTol;  ///< tolerance for orthogonality test
     static const double m_paramTol;     ///< tolerance for change in parameter value
 
+    static const size_t m_numLengthSamples;  ///< number of arc-length table entries per interval
+    static const size_t m_maxLeafSize;       ///< maximum number of intervals in a BVH leaf
+
     friend class ChBezierCurveTracker;
 };
 
@@ -216,9 +267,8 @@ class ChApi ChBezierCurveTracker {
     ~ChBezierCurveTracker() {}
 
     /// Reset the tracker at the specified location.
-    /// This function reinitializes the pathTracker at the specified location. It
-    /// calculates an appropriate initial guess for the curve segment and sets the
-    /// curve parameter to 0.5.
+    /// This function reinitializes the pathTracker at the closest point on the
+    /// entire curve to the specified location.
     void reset(const ChVector<>& loc);
 
     /// Calculate the closest point on the underlying curve to the specified location.
@@ -242,6 +292,9 @@ class ChApi ChBezierCurveTracker {
     /// Set if the path is treated as an open loop or a closed loop for tracking
     void setIsClosedPath(bool isClosedPath);
 
+    /// Return the arc length from the first point of the path to the last closest point.
+    double getArcLength() const { return m_path->calcArcLength(m_curInterval, m_curParam); }
+
   private:
     std::shared_ptr<ChBezierCurve> m_path;  ///< associated Bezier curve
     size_t m_curInterval;                   ///< current search interval
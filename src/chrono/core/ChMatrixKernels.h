@@ -0,0 +1,227 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Matrix product kernels for sizes known at compile time, used by ChMatrixNM
+// (and ChMatrix33). Matrices are dense, row-major arrays.
+// Small products are written as loops with constant trip counts, which the
+// compiler unrolls and vectorizes; for double precision and larger sizes, if
+// AVX is available, register-blocked AVX kernels are used.
+//
+// =============================================================================
+
+#ifndef CHMATRIXKERNELS_H
+#define CHMATRIXKERNELS_H
+
+#include "chrono/ChConfig.h"
+
+#include <type_traits>
+
+#ifdef CHRONO_HAS_AVX
+#include <immintrin.h>
+#endif
+
+namespace chrono {
+
+/// Generic fixed-size matrix products: C (MxN) = A*B, A*B' or A'*B, with inner dimension K.
+/// The result must not overlap the operands.
+template <class Real, int M, int K, int N>
+struct ChMatrixKernelsGeneric {
+    /// C = A*B, with A (MxK) and B (KxN).
+    static void Multiply(const Real* A, const Real* B, Real* C) {
+        for (int i = 0; i < M; ++i) {
+            Real row[N];
+            for (int j = 0; j < N; ++j)
+                row[j] = 0;
+            for (int k = 0; k < K; ++k) {
+                Real a = A[i * K + k];
+                for (int j = 0; j < N; ++j)
+                    row[j] += a * B[k * N + j];
+            }
+            for (int j = 0; j < N; ++j)
+                C[i * N + j] = row[j];
+        }
+    }
+
+    /// C = A*B', with A (MxK) and B (NxK).
+    static void MultiplyT(const Real* A, const Real* B, Real* C) {
+        for (int i = 0; i < M; ++i) {
+            for (int j = 0; j < N; ++j) {
+                Real sum = 0;
+                for (int k = 0; k < K; ++k)
+                    sum += A[i * K + k] * B[j * K + k];
+                C[i * N + j] = sum;
+            }
+        }
+    }
+
+    /// C = A'*B, with A (KxM) and B (KxN).
+    static void TMultiply(const Real* A, const Real* B, Real* C) {
+        for (int i = 0; i < M; ++i) {
+            Real row[N];
+            for (int j = 0; j < N; ++j)
+                row[j] = 0;
+            for (int k = 0; k < K; ++k) {
+                Real a = A[k * M + i];
+                for (int j = 0; j < N; ++j)
+                    row[j] += a * B[k * N + j];
+            }
+            for (int j = 0; j < N; ++j)
+                C[i * N + j] = row[j];
+        }
+    }
+};
+
+/// Fixed-size matrix products (see ChMatrixKernelsGeneric), as used by ChMatrixNM.
+template <class Real, int M, int K, int N>
+struct ChMatrixKernels : public ChMatrixKernelsGeneric<Real, M, K, N> {};
+
+#ifdef CHRONO_HAS_AVX
+
+namespace avx_kernels {
+
+// Rows [i, i+R) of C = A*B (or A'*B if TRANSPOSED), columns in blocks of 8 and 4, then one by one.
+// Each element is accumulated in order of k, as in the scalar product.
+template <int M, int K, int N, bool TRANSPOSED, int R>
+inline void MultiplyRows(const double* A, const double* B, double* C, int i) {
+    auto a = [A, i](int r, int k) { return TRANSPOSED ? A[k * M + i + r] : A[(i + r) * K + k]; };
+    int j = 0;
+    for (; j + 8 <= N; j += 8) {
+        __m256d c0[R], c1[R];
+        for (int r = 0; r < R; ++r)
+            c0[r] = c1[r] = _mm256_setzero_pd();
+        for (int k = 0; k < K; ++k) {
+            __m256d b0 = _mm256_loadu_pd(B + k * N + j);
+            __m256d b1 = _mm256_loadu_pd(B + k * N + j + 4);
+            for (int r = 0; r < R; ++r) {
+                __m256d ar = _mm256_set1_pd(a(r, k));
+                c0[r] = _mm256_add_pd(c0[r], _mm256_mul_pd(ar, b0));
+                c1[r] = _mm256_add_pd(c1[r], _mm256_mul_pd(ar, b1));
+            }
+        }
+        for (int r = 0; r < R; ++r) {
+            _mm256_storeu_pd(C + (i + r) * N + j, c0[r]);
+            _mm256_storeu_pd(C + (i + r) * N + j + 4, c1[r]);
+        }
+    }
+    for (; j + 4 <= N; j += 4) {
+        __m256d c0[R];
+        for (int r = 0; r < R; ++r)
+            c0[r] = _mm256_setzero_pd();
+        for (int k = 0; k < K; ++k) {
+            __m256d b0 = _mm256_loadu_pd(B + k * N + j);
+            for (int r = 0; r < R; ++r)
+                c0[r] = _mm256_add_pd(c0[r], _mm256_mul_pd(_mm256_set1_pd(a(r, k)), b0));
+        }
+        for (int r = 0; r < R; ++r)
+            _mm256_storeu_pd(C + (i + r) * N + j, c0[r]);
+    }
+    for (; j < N; ++j) {
+        for (int r = 0; r < R; ++r) {
+            double sum = 0;
+            for (int k = 0; k < K; ++k)
+                sum += a(r, k) * B[k * N + j];
+            C[(i + r) * N + j] = sum;
+        }
+    }
+}
+
+template <int M, int K, int N, bool TRANSPOSED>
+inline void Multiply(const double* A, const double* B, double* C) {
+    int i = 0;
+    for (; i + 2 <= M; i += 2)
+        MultiplyRows<M, K, N, TRANSPOSED, 2>(A, B, C, i);
+    if (i < M)
+        MultiplyRows<M, K, N, TRANSPOSED, 1>(A, B, C, i);
+}
+
+// C = A*B': dot products of rows of A and B, four elements of C at a time.
+template <int M, int K, int N>
+inline void MultiplyT(const double* A, const double* B, double* C) {
+    const int K4 = (K / 4) * 4;
+    const int N4 = (N / 4) * 4;
+    for (int i = 0; i < M; ++i) {
+        const double* a = A + i * K;
+        for (int j = 0; j < N4; j += 4) {
+            const double* b = B + j * K;
+            __m256d s0 = _mm256_setzero_pd();
+            __m256d s1 = _mm256_setzero_pd();
+            __m256d s2 = _mm256_setzero_pd();
+            __m256d s3 = _mm256_setzero_pd();
+            for (int k = 0; k < K4; k += 4) {
+                __m256d ak = _mm256_loadu_pd(a + k);
+                s0 = _mm256_add_pd(s0, _mm256_mul_pd(ak, _mm256_loadu_pd(b + k)));
+                s1 = _mm256_add_pd(s1, _mm256_mul_pd(ak, _mm256_loadu_pd(b + K + k)));
+                s2 = _mm256_add_pd(s2, _mm256_mul_pd(ak, _mm256_loadu_pd(b + 2 * K + k)));
+                s3 = _mm256_add_pd(s3, _mm256_mul_pd(ak, _mm256_loadu_pd(b + 3 * K + k)));
+            }
+            // Horizontal sums of s0..s3, as the 4 lanes of one vector
+            __m256d s01 = _mm256_hadd_pd(s0, s1);
+            __m256d s23 = _mm256_hadd_pd(s2, s3);
+            __m256d sum =
+                _mm256_add_pd(_mm256_permute2f128_pd(s01, s23, 0x20), _mm256_permute2f128_pd(s01, s23, 0x31));
+            double tail[4] = {0, 0, 0, 0};
+            for (int k = K4; k < K; ++k) {
+                for (int jj = 0; jj < 4; ++jj)
+                    tail[jj] += a[k] * b[jj * K + k];
+            }
+            _mm256_storeu_pd(C + i * N + j, _mm256_add_pd(sum, _mm256_loadu_pd(tail)));
+        }
+        for (int j = N4; j < N; ++j) {
+            double sum = 0;
+            for (int k = 0; k < K; ++k)
+                sum += a[k] * B[j * K + k];
+            C[i * N + j] = sum;
+        }
+    }
+}
+
+}  // end namespace avx_kernels
+
+/// Specialization for double precision: AVX kernels for products with at least 4 columns
+/// and 256 multiply-adds (and, for A*B', an inner dimension of at least 8), the generic ones
+/// otherwise. The choice is made at compile time.
+template <int M, int K, int N>
+struct ChMatrixKernels<double, M, K, N> {
+    static void Multiply(const double* A, const double* B, double* C) { Multiply(A, B, C, UseAVX<1>()); }
+    static void MultiplyT(const double* A, const double* B, double* C) { MultiplyT(A, B, C, UseAVX<8>()); }
+    static void TMultiply(const double* A, const double* B, double* C) { TMultiply(A, B, C, UseAVX<1>()); }
+
+  private:
+    typedef ChMatrixKernelsGeneric<double, M, K, N> Generic;
+    template <int MIN_K>
+    using UseAVX = std::integral_constant<bool, (N >= 4 && K >= MIN_K && M * K * N >= 256)>;
+
+    static void Multiply(const double* A, const double* B, double* C, std::true_type) {
+        avx_kernels::Multiply<M, K, N, false>(A, B, C);
+    }
+    static void Multiply(const double* A, const double* B, double* C, std::false_type) {
+        Generic::Multiply(A, B, C);
+    }
+    static void MultiplyT(const double* A, const double* B, double* C, std::true_type) {
+        avx_kernels::MultiplyT<M, K, N>(A, B, C);
+    }
+    static void MultiplyT(const double* A, const double* B, double* C, std::false_type) {
+        Generic::MultiplyT(A, B, C);
+    }
+    static void TMultiply(const double* A, const double* B, double* C, std::true_type) {
+        avx_kernels::Multiply<M, K, N, true>(A, B, C);
+    }
+    static void TMultiply(const double* A, const double* B, double* C, std::false_type) {
+        Generic::TMultiply(A, B, C);
+    }
+};
+
+#endif
+
+}  // end namespace chrono
+
+#endif
@@ -16,6 +16,7 @@
 #include "chrono/core/ChCoordsys.h"
 #include "chrono/core/ChException.h"
 #include "chrono/core/ChMatrix.h"
+#include "chrono/core/ChMatrixKernels.h"
 
 namespace chrono {
 
@@ -156,6 +157,35 @@ class ChMatrixNM : public ChMatrix<Real> {
     // FUNCTIONS
     //
 
+    // The products of generic matrices are inherited; those below are used when the sizes
+    // of the operands are also known at compile time (fixed-size kernels, see ChMatrixKernels).
+    using ChMatrix<Real>::MatrMultiply;
+    using ChMatrix<Real>::MatrMultiplyT;
+    using ChMatrix<Real>::MatrTMultiply;
+
+    /// Multiplies two fixed-size matrices, and stores the result in "this" matrix: [this]=[A]*[B].
+    template <int K>
+    void MatrMultiply(const ChMatrixNM<Real, preall_rows, K>& matra, const ChMatrixNM<Real, K, preall_columns>& matrb) {
+        ChMatrixKernels<Real, preall_rows, K, preall_columns>::Multiply(matra.GetAddress(), matrb.GetAddress(),
+                                                                        this->address);
+    }
+
+    /// Multiplies two fixed-size matrices (the second is considered transposed): [this]=[A]*[B]'
+    template <int K>
+    void MatrMultiplyT(const ChMatrixNM<Real, preall_rows, K>& matra,
+                       const ChMatrixNM<Real, preall_columns, K>& matrb) {
+        ChMatrixKernels<Real, preall_rows, K, preall_columns>::MultiplyT(matra.GetAddress(), matrb.GetAddress(),
+                                                                         this->address);
+    }
+
+    /// Multiplies two fixed-size matrices (the first is considered transposed): [this]=[A]'*[B]
+    template <int K>
+    void MatrTMultiply(const ChMatrixNM<Real, K, preall_rows>& matra,
+                       const ChMatrixNM<Real, K, preall_columns>& matrb) {
+        ChMatrixKernels<Real, preall_rows, K, preall_columns>::TMultiply(matra.GetAddress(), matrb.GetAddress(),
+                                                                         this->address);
+    }
+
     /// Resize for this matrix is NOT SUPPORTED ! DO NOTHING!
     virtual inline void Resize(int nrows, int ncols) { assert((nrows == this->rows) && (ncols == this->columns)); }
 };
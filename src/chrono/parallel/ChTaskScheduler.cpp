@@ -0,0 +1,351 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Persistent, work-stealing task scheduler shared by the core modules.
+//
+// =============================================================================
+
+#include <deque>
+
+#include "chrono/core/ChException.h"
+#include "chrono/parallel/ChTaskScheduler.h"
+
+namespace chrono {
+
+// Index of the queue used by the current thread: 0 (the injection queue) for
+// threads outside the pool, the worker index for pool threads.
+static thread_local int t_queue = 0;
+
+// Concurrency limit for the work started from the current thread (0: no limit).
+static thread_local int t_concurrency = 0;
+
+// Number of times an idle worker polls the queues before going to sleep. Keeping
+// the workers awake for a short while avoids a wake-up at each of a sequence of
+// closely spaced parallel stages.
+static const int num_idle_polls = 256;
+
+struct ChTaskScheduler::WorkQueue {
+    std::mutex mutex;
+    std::deque<Task> tasks;
+};
+
+// -----------------------------------------------------------------------------
+
+ChTaskGroup::ChTaskGroup() : m_scheduler(ChTaskScheduler::GetInstance()), m_pending(0) {}
+
+ChTaskGroup::~ChTaskGroup() {
+    // Tasks refer to this group; never leave them behind.
+    while (m_pending.load(std::memory_order_acquire) > 0) {
+        if (!m_scheduler.TryExecute())
+            std::this_thread::yield();
+    }
+}
+
+void ChTaskGroup::Run(std::function<void()> task) {
+    m_pending.fetch_add(1, std::memory_order_relaxed);
+    m_scheduler.Submit(ChTaskScheduler::Task{std::move(task), this});
+}
+
+void ChTaskGroup::Wait() {
+    while (m_pending.load(std::memory_order_acquire) > 0) {
+        if (!m_scheduler.TryExecute())
+            std::this_thread::yield();
+    }
+
+    std::exception_ptr exception;
+    {
+        std::lock_guard<std::mutex> lock(m_exception_mutex);
+        std::swap(exception, m_exception);
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+// -----------------------------------------------------------------------------
+
+ChTaskScheduler& ChTaskScheduler::GetInstance() {
+    static ChTaskScheduler scheduler;
+    return scheduler;
+}
+
+ChTaskScheduler::ChTaskScheduler() : m_num_threads(0), m_num_queued(0), m_stop(false) {
+    Start(std::max(1, (int)std::thread::hardware_concurrency()));
+}
+
+ChTaskScheduler::~ChTaskScheduler() {
+    Stop();
+}
+
+void ChTaskScheduler::SetNumThreads(int num_threads) {
+    num_threads = std::max(1, num_threads);
+    if (num_threads == m_num_threads)
+        return;
+    Stop();
+    Start(num_threads);
+}
+
+void ChTaskScheduler::SetLocalConcurrency(int max_tasks) {
+    t_concurrency = std::max(0, max_tasks);
+}
+
+int ChTaskScheduler::GetLocalConcurrency() {
+    return t_concurrency;
+}
+
+int ChTaskScheduler::GetConcurrency(int max_tasks) const {
+    int n = m_num_threads;
+    if (t_concurrency > 0)
+        n = std::min(n, t_concurrency);
+    if (max_tasks > 0)
+        n = std::min(n, max_tasks);
+    return std::max(1, n);
+}
+
+void ChTaskScheduler::Start(int num_threads) {
+    // Keep any task still queued (there should be none) in the injection queue.
+    std::vector<std::unique_ptr<WorkQueue>> queues;
+    for (int i = 0; i < num_threads; i++)
+        queues.push_back(std::unique_ptr<WorkQueue>(new WorkQueue));
+    for (auto& queue : m_queues)
+        for (auto& task : queue->tasks)
+            queues[0]->tasks.push_back(std::move(task));
+    m_queues = std::move(queues);
+
+    m_num_threads = num_threads;
+    m_stop = false;
+    for (int i = 1; i < num_threads; i++)
+        m_workers.push_back(std::thread(&ChTaskScheduler::WorkerLoop, this, i));
+}
+
+void ChTaskScheduler::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_wake_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    for (auto& worker : m_workers)
+        worker.join();
+    m_workers.clear();
+}
+
+void ChTaskScheduler::WorkerLoop(int index) {
+    t_queue = index;
+
+    while (true) {
+        if (TryExecute())
+            continue;
+
+        // Poll for a while before going to sleep.
+        for (int k = 0; k < num_idle_polls && m_num_queued.load(std::memory_order_relaxed) == 0; k++)
+            std::this_thread::yield();
+        if (m_num_queued.load(std::memory_order_relaxed) > 0)
+            continue;
+
+        std::unique_lock<std::mutex> lock(m_wake_mutex);
+        m_wake.wait(lock, [this]() { return m_stop || m_num_queued.load() > 0; });
+        if (m_stop && m_num_queued.load() == 0)
+            return;
+    }
+}
+
+void ChTaskScheduler::Submit(Task&& task) {
+    WorkQueue& queue = *m_queues[t_queue];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+    }
+    m_num_queued.fetch_add(1);
+
+    // Taking the lock orders this notification after the check made by a worker about to sleep.
+    if (!m_workers.empty()) {
+        { std::lock_guard<std::mutex> lock(m_wake_mutex); }
+        m_wake.notify_one();
+    }
+}
+
+bool ChTaskScheduler::TryExecute() {
+    int num_queues = (int)m_queues.size();
+    int self = t_queue;
+    Task task;
+    bool found = false;
+
+    // Most recent task of the own queue first, then the oldest task of the others.
+    {
+        WorkQueue& queue = *m_queues[self];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+            found = true;
+        }
+    }
+    for (int k = 1; !found && k < num_queues; k++) {
+        WorkQueue& queue = *m_queues[(self + k) % num_queues];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            found = true;
+        }
+    }
+
+    if (!found)
+        return false;
+
+    m_num_queued.fetch_sub(1);
+    Execute(task);
+    return true;
+}
+
+void ChTaskScheduler::Execute(Task& task) {
+    ChTaskGroup* group = task.group;
+    try {
+        task.func();
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(group->m_exception_mutex);
+        if (!group->m_exception)
+            group->m_exception = std::current_exception();
+    }
+    // Release the task resources before signaling completion: the group (and
+    // anything captured by the task) may be destroyed as soon as it completes.
+    task.func = nullptr;
+    group->m_pending.fetch_sub(1, std::memory_order_release);
+}
+
+void ChTaskScheduler::ParallelFor(int begin,
+                                  int end,
+                                  const std::function<void(int, int)>& body,
+                                  int grain,
+                                  int max_tasks) {
+    if (end <= begin)
+        return;
+
+    int count = end - begin;
+    int concurrency = GetConcurrency(max_tasks);
+    if (grain <= 0)
+        grain = DefaultGrain(count, concurrency);
+    int num_chunks = (count + grain - 1) / grain;
+    int num_tasks = std::min(concurrency, num_chunks);
+
+    if (num_tasks <= 1) {
+        body(begin, end);
+        return;
+    }
+
+    // Each task repeatedly takes the next unprocessed chunk. After an exception,
+    // the remaining chunks are abandoned.
+    std::atomic<int> next(0);
+    auto runner = [&]() {
+        int c;
+        while ((c = next.fetch_add(1)) < num_chunks) {
+            try {
+                body(begin + c * grain, std::min(begin + (c + 1) * grain, end));
+            } catch (...) {
+                next.store(num_chunks);
+                throw;
+            }
+        }
+    };
+
+    ChTaskGroup group;
+    for (int i = 1; i < num_tasks; i++)
+        group.Run(runner);
+
+    std::exception_ptr exception;
+    try {
+        runner();
+    } catch (...) {
+        exception = std::current_exception();
+    }
+
+    if (exception) {
+        try {
+            group.Wait();
+        } catch (...) {
+        }
+        std::rethrow_exception(exception);
+    }
+    group.Wait();
+}
+
+// -----------------------------------------------------------------------------
+
+int ChTaskGraph::AddTask(std::function<void()> task, const std::vector<int>& dependencies) {
+    int id = (int)m_nodes.size();
+    for (auto dep : dependencies) {
+        if (dep < 0 || dep >= id)
+            throw ChException("ChTaskGraph::AddTask: a task can only depend on previously added tasks.");
+    }
+
+    Node node;
+    node.func = std::move(task);
+    node.num_dependencies = (int)dependencies.size();
+    m_nodes.push_back(std::move(node));
+    for (auto dep : dependencies)
+        m_nodes[dep].successors.push_back(id);
+
+    return id;
+}
+
+void ChTaskGraph::Run() {
+    int num_nodes = (int)m_nodes.size();
+    if (num_nodes == 0)
+        return;
+
+    // Tasks are added after their dependencies, so the insertion order is a valid serial order.
+    if (ChTaskScheduler::GetInstance().GetConcurrency() <= 1) {
+        std::exception_ptr exception;
+        for (auto& node : m_nodes) {
+            try {
+                node.func();
+            } catch (...) {
+                if (!exception)
+                    exception = std::current_exception();
+            }
+        }
+        if (exception)
+            std::rethrow_exception(exception);
+        return;
+    }
+
+    std::unique_ptr<std::atomic<int>[]> remaining(new std::atomic<int>[num_nodes]);
+    for (int i = 0; i < num_nodes; i++)
+        remaining[i].store(m_nodes[i].num_dependencies);
+
+    // A completed task launches the successors for which it was the last missing
+    // dependency, before itself completing, so the group cannot run empty early.
+    ChTaskGroup group;
+    std::function<void(int)> launch = [&](int i) {
+        group.Run([&, i]() {
+            std::exception_ptr exception;
+            try {
+                m_nodes[i].func();
+            } catch (...) {
+                exception = std::current_exception();
+            }
+            for (auto succ : m_nodes[i].successors) {
+                if (remaining[succ].fetch_sub(1) == 1)
+                    launch(succ);
+            }
+            if (exception)
+                std::rethrow_exception(exception);
+        });
+    };
+
+    for (int i = 0; i < num_nodes; i++) {
+        if (m_nodes[i].num_dependencies == 0)
+            launch(i);
+    }
+    group.Wait();
+}
+
+}  // end namespace chrono
@@ -0,0 +1,212 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Persistent, work-stealing task scheduler shared by the core modules.
+//
+// The scheduler owns a pool of worker threads that live for the duration of the
+// program and sleep when there is no work. Each worker has its own task queue:
+// a worker pushes and pops tasks at the back of its queue (most recent first, for
+// cache reuse) and, once its queue is empty, steals from the front of the queues
+// of the other threads. Tasks submitted from threads that are not part of the
+// pool go to a shared injection queue. A thread waiting for a group of tasks
+// executes pending tasks instead of blocking, so parallel loops can be nested.
+//
+// On top of task groups, the scheduler provides parallel loops (ParallelFor),
+// deterministic parallel reductions (ParallelReduce) and, with ChTaskGraph,
+// graphs of tasks with dependencies.
+//
+// =============================================================================
+
+#ifndef CHTASKSCHEDULER_H
+#define CHTASKSCHEDULER_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+
+class ChTaskScheduler;
+
+/// Group of tasks submitted to the task scheduler, which can be waited for.
+/// If a task throws, the first exception is rethrown by Wait() (once all tasks
+/// of the group have completed).
+class ChApi ChTaskGroup {
+  public:
+    ChTaskGroup();
+    ~ChTaskGroup();
+
+    /// Submit a task to the scheduler as part of this group.
+    void Run(std::function<void()> task);
+
+    /// Wait for all tasks of this group to complete, executing pending tasks in
+    /// the meantime. Rethrows the first exception thrown by a task of the group.
+    void Wait();
+
+  private:
+    ChTaskScheduler& m_scheduler;
+    std::atomic<int> m_pending;
+    std::mutex m_exception_mutex;
+    std::exception_ptr m_exception;
+
+    friend class ChTaskScheduler;
+};
+
+/// Persistent work-stealing thread pool.
+/// Use the unique instance returned by GetInstance(). The number of threads is
+/// only set with SetNumThreads() and includes the thread calling into the
+/// scheduler, so a scheduler with N threads has N-1 workers; with a single thread,
+/// all work runs on the calling thread. Individual callers limit their share of
+/// the pool with the 'max_tasks' arguments or SetLocalConcurrency() (e.g. a
+/// ChSystem uses at most GetParallelThreadNumber() concurrent tasks).
+/// Submitting and waiting for tasks is thread-safe.
+class ChApi ChTaskScheduler {
+  public:
+    /// Return the scheduler instance. The pool is created on first use, with as
+    /// many threads as hardware threads.
+    static ChTaskScheduler& GetInstance();
+
+    /// Set the number of threads (including the calling thread) and restart the pool.
+    /// Must not be called while parallel work is in progress.
+    void SetNumThreads(int num_threads);
+
+    /// Return the number of threads (including the calling thread).
+    int GetNumThreads() const { return m_num_threads; }
+
+    /// Limit the number of concurrent tasks of the parallel loops and task graphs
+    /// started from the calling thread (default: 0, no limit). With a limit of 1,
+    /// these run serially on the calling thread; this is meant for threads that
+    /// are themselves part of an outer level of parallelism.
+    static void SetLocalConcurrency(int max_tasks);
+
+    /// Return the concurrency limit of the calling thread (0 if none).
+    static int GetLocalConcurrency();
+
+    /// Return the number of tasks that can usefully run concurrently for work
+    /// started from the calling thread, given an optional upper bound.
+    int GetConcurrency(int max_tasks = 0) const;
+
+    /// Execute body(first, last) over sub-ranges of [begin, end).
+    /// The range is split in chunks of 'grain' indices (if 0, chosen to give a few
+    /// chunks per thread), which are handed out dynamically to at most 'max_tasks'
+    /// concurrent tasks (if 0, as many as threads). Returns once the whole range
+    /// has been processed; rethrows the first exception thrown by the body.
+    void ParallelFor(int begin,
+                     int end,
+                     const std::function<void(int, int)>& body,
+                     int grain = 0,
+                     int max_tasks = 0);
+
+    /// Reduce over [begin, end): the range is split in chunks of 'grain' indices (if 0,
+    /// chosen automatically), each chunk is mapped to a value with map(first, last), and
+    /// the chunk values are combined, in order, with combine(accumulated, value).
+    /// The result only depends on the grain, not on the number of threads.
+    template <typename T, typename MAP, typename COMBINE>
+    T ParallelReduce(int begin,
+                     int end,
+                     const T& identity,
+                     const MAP& map,
+                     const COMBINE& combine,
+                     int grain = 0,
+                     int max_tasks = 0) {
+        if (end <= begin)
+            return identity;
+        if (grain <= 0)
+            grain = DefaultGrain(end - begin, GetConcurrency(max_tasks));
+        int num_chunks = (end - begin + grain - 1) / grain;
+        std::vector<T> partial(num_chunks, identity);
+        ParallelFor(0, num_chunks,
+                    [&](int first, int last) {
+                        for (int c = first; c < last; c++)
+                            partial[c] = map(begin + c * grain, std::min(begin + (c + 1) * grain, end));
+                    },
+                    1, max_tasks);
+        T result = identity;
+        for (const auto& value : partial)
+            result = combine(result, value);
+        return result;
+    }
+
+    ~ChTaskScheduler();
+
+  private:
+    struct Task {
+        std::function<void()> func;
+        ChTaskGroup* group;
+    };
+    struct WorkQueue;
+
+    ChTaskScheduler();
+
+    void Start(int num_threads);
+    void Stop();
+    void WorkerLoop(int index);
+
+    void Submit(Task&& task);
+    bool TryExecute();
+    void Execute(Task& task);
+
+    static int DefaultGrain(int count, int concurrency) { return std::max(1, count / (8 * concurrency)); }
+
+    int m_num_threads;
+    std::vector<std::unique_ptr<WorkQueue>> m_queues;  ///< injection queue, then one queue per worker
+    std::vector<std::thread> m_workers;
+    std::atomic<int> m_num_queued;  ///< number of tasks in all queues
+    std::mutex m_wake_mutex;
+    std::condition_variable m_wake;
+    bool m_stop;
+
+    friend class ChTaskGroup;
+};
+
+/// Graph of tasks with dependencies, executed on the task scheduler.
+/// The graph is built once and can be run any number of times. A task starts as
+/// soon as all the tasks it depends on have completed.
+class ChApi ChTaskGraph {
+  public:
+    ChTaskGraph() {}
+
+    /// Add a task that depends on the specified (previously added) tasks.
+    /// Returns the task identifier.
+    int AddTask(std::function<void()> task, const std::vector<int>& dependencies = std::vector<int>());
+
+    /// Return the number of tasks in the graph.
+    int GetNumTasks() const { return (int)m_nodes.size(); }
+
+    /// Remove all tasks.
+    void Clear() { m_nodes.clear(); }
+
+    /// Execute all tasks, respecting their dependencies, and return once all have completed.
+    /// Rethrows the first exception thrown by a task (the tasks depending on it still run).
+    void Run();
+
+  private:
+    struct Node {
+        std::function<void()> func;
+        std::vector<int> successors;
+        int num_dependencies;
+    };
+
+    std::vector<Node> m_nodes;
+};
+
+}  // end namespace chrono
+
+#endif
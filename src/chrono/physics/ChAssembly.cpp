@@ -424,9 +424,11 @@ void ChAssembly::Update(double mytime, bool update_assets) {
 //   ALSO UPDATING THEIR AUXILIARY VARIABLES (ROT.MATRICES, ETC.).
 // - UPDATES ALL FORCES  (AUTOMATIC, AS CHILDREN OF BODIES)
 // - UPDATES ALL MARKERS (AUTOMATIC, AS CHILDREN OF BODIES).
+// - SLEEPING BODIES, WHICH DO NOT MOVE, ARE SKIPPED.
 void ChAssembly::Update(bool update_assets) {
     for (int ip = 0; ip < bodylist.size(); ++ip) {
-        bodylist[ip]->Update(ChTime, update_assets);
+        if (!bodylist[ip]->GetSleeping())
+            bodylist[ip]->Update(ChTime, update_assets);
     }
     for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
         otherphysicslist[ip]->Update(ChTime, update_assets);
@@ -656,6 +658,46 @@ void ChAssembly::IntLoadResidual_Mv(const unsigned int off,      ///< offset in
     }
 }
 
+void ChAssembly::IntLoadLumpedMass_Md(const unsigned int off,  ///< offset in Md vector
+                                      ChVectorDynamic<>& Md,   ///< result: Md vector, diagonal of the lumped mass matrix
+                                      const double c           ///< a scaling factor
+) {
+    unsigned int displ_v = off - this->offset_w;
+
+    for (unsigned int ip = 0; ip < bodylist.size(); ++ip) {
+        std::shared_ptr<ChBody> Bpointer = bodylist[ip];
+        if (Bpointer->IsActive())
+            Bpointer->IntLoadLumpedMass_Md(displ_v + Bpointer->GetOffset_w(), Md, c);
+    }
+    for (unsigned int ip = 0; ip < linklist.size(); ++ip) {
+        std::shared_ptr<ChLink> Lpointer = linklist[ip];
+        if (Lpointer->IsActive())
+            Lpointer->IntLoadLumpedMass_Md(displ_v + Lpointer->GetOffset_w(), Md, c);
+    }
+    for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
+        std::shared_ptr<ChPhysicsItem> Ppointer = otherphysicslist[ip];
+        Ppointer->IntLoadLumpedMass_Md(displ_v + Ppointer->GetOffset_w(), Md, c);
+    }
+}
+
+double ChAssembly::ComputeCriticalTimeStep() {
+    double dt_crit = std::numeric_limits<double>::max();
+
+    for (unsigned int ip = 0; ip < bodylist.size(); ++ip) {
+        if (bodylist[ip]->IsActive())
+            dt_crit = std::min(dt_crit, bodylist[ip]->ComputeCriticalTimeStep());
+    }
+    for (unsigned int ip = 0; ip < linklist.size(); ++ip) {
+        if (linklist[ip]->IsActive())
+            dt_crit = std::min(dt_crit, linklist[ip]->ComputeCriticalTimeStep());
+    }
+    for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
+        dt_crit = std::min(dt_crit, otherphysicslist[ip]->ComputeCriticalTimeStep());
+    }
+
+    return dt_crit;
+}
+
 void ChAssembly::IntLoadResidual_CqL(const unsigned int off_L,    ///< offset in L multipliers
                                      ChVectorDynamic<>& R,        ///< result: the R residual, R += c*Cq'*L
                                      const ChVectorDynamic<>& L,  ///< the L vector
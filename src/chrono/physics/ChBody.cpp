@@ -68,6 +68,7 @@ ChBody::ChBody(ChMaterialSurface::ContactMethod contact_method) {
 
     sleep_time = 0.6f;
     sleep_starttime = 0;
+    sleep_island = 0;
     sleep_minspeed = 0.1f;
     sleep_minwvel = 0.04f;
     SetUseSleeping(true);
@@ -112,6 +113,7 @@ ChBody::ChBody(std::shared_ptr<collision::ChCollisionModel> new_collision_model,
 
     sleep_time = 0.6f;
     sleep_starttime = 0;
+    sleep_island = 0;
     sleep_minspeed = 0.1f;
     sleep_minwvel = 0.04f;
     SetUseSleeping(true);
@@ -151,6 +153,7 @@ ChBody::ChBody(const ChBody& other) : ChPhysicsItem(other), ChBodyFrame(other) {
 
     sleep_time = other.sleep_time;
     sleep_starttime = other.sleep_starttime;
+    sleep_island = other.sleep_island;
     sleep_minspeed = other.sleep_minspeed;
     sleep_minwvel = other.sleep_minwvel;
 }
@@ -252,6 +255,19 @@ void ChBody::IntLoadResidual_Mv(const unsigned int off,      // offset in R resi
     R.PasteSumVector(Iw, off + 3, 0);
 }
 
+void ChBody::IntLoadLumpedMass_Md(const unsigned int off,  // offset in Md vector
+                                  ChVectorDynamic<>& Md,   // result: Md vector, diagonal of the lumped mass matrix
+                                  const double c           // a scaling factor
+                                  ) {
+    Md(off + 0) += c * GetMass();
+    Md(off + 1) += c * GetMass();
+    Md(off + 2) += c * GetMass();
+    // products of inertia are neglected
+    Md(off + 3) += c * GetInertia()(0, 0);
+    Md(off + 4) += c * GetInertia()(1, 1);
+    Md(off + 5) += c * GetInertia()(2, 2);
+}
+
 void ChBody::IntToDescriptor(const unsigned int off_v,
                              const ChStateDelta& v,
                              const ChVectorDynamic<>& R,
@@ -274,6 +290,10 @@ void ChBody::IntFromDescriptor(const unsigned int off_v,  // offset in v
 void ChBody::InjectVariables(ChSystemDescriptor& mdescriptor) {
     this->variables.SetDisabled(!this->IsActive());
 
+    // Sleeping bodies are left out of the descriptor
+    if (this->GetSleeping())
+        return;
+
     mdescriptor.InsertVariables(&this->variables);
 }
 
@@ -771,7 +791,17 @@ bool ChBody::GetUseSleeping() const {
 }
 
 void ChBody::SetSleeping(bool state) {
+    if (state == BFlagGet(BodyFlag::SLEEPING))
+        return;
+
     BFlagSet(BodyFlag::SLEEPING, state);
+
+    // Freeze (or thaw) the collision model in the broadphase
+    collision_model->SetSleeping(state);
+
+    // A woken body must stay at rest for 'sleep_time' before sleeping again
+    if (!state)
+        sleep_starttime = float(GetChTime());
 }
 
 bool ChBody::GetSleeping() const {
@@ -829,7 +859,8 @@ bool ChBody::RecomputeCollisionModel() {
 }
 
 void ChBody::SyncCollisionModels() {
-    if (this->GetCollide())
+    // The collision model of a sleeping body is frozen
+    if (this->GetCollide() && !this->GetSleeping())
         this->GetCollisionModel()->SyncPosition();
 }
 
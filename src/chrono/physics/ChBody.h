@@ -82,6 +82,7 @@ class ChApi ChBody : public ChPhysicsItem, public ChBodyFrame, public ChContacta
     float sleep_minspeed;
     float sleep_minwvel;
     float sleep_starttime;
+    int sleep_island;  ///< identifier of the island of bodies this body went to sleep with
 
   public:
     /// Build a rigid body.
@@ -171,6 +172,9 @@ class ChApi ChBody : public ChPhysicsItem, public ChBodyFrame, public ChContacta
 
     /// Force the body in sleeping mode or not (usually this state change is not
     /// handled by users, anyway, because it is mostly automatic).
+    /// A sleeping body is not updated, is not part of the system descriptor, and its
+    /// collision model is frozen (its position is not synchronized with the body).
+    /// Wake the body before moving it.
     void SetSleeping(bool state);
 
     /// Return true if this body is currently in 'sleep' mode.
@@ -196,6 +200,13 @@ class ChApi ChBody : public ChPhysicsItem, public ChBodyFrame, public ChContacta
     /// Get the global body index (internal use only)
     unsigned int GetGid() const { return body_gid; }
 
+    /// Set the identifier of the sleeping island of this body (internal use only).
+    void SetSleepIsland(int id) { sleep_island = id; }
+
+    /// Get the identifier of the island of bodies this body went to sleep with
+    /// (internal use only, meaningless if the body is not sleeping).
+    int GetSleepIsland() const { return sleep_island; }
+
     //
     // FUNCTIONS
     //
@@ -239,6 +250,7 @@ class ChApi ChBody : public ChPhysicsItem, public ChBodyFrame, public ChContacta
                                     ChVectorDynamic<>& R,
                                     const ChVectorDynamic<>& w,
                                     const double c) override;
+    virtual void IntLoadLumpedMass_Md(const unsigned int off, ChVectorDynamic<>& Md, const double c) override;
     virtual void IntToDescriptor(const unsigned int off_v,
                                  const ChStateDelta& v,
                                  const ChVectorDynamic<>& R,
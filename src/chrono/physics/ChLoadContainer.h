@@ -47,6 +47,10 @@ class ChApi ChLoadContainer : public ChPhysicsItem {
 
     virtual void Update(double mytime, bool update_assets = true) override;
 
+    /// Loads only read the state of the loaded objects, so they can be
+    /// updated concurrently with collision detection.
+    virtual bool CanUpdateDuringCollision() const override { return true; }
+
     virtual void IntLoadResidual_F(const unsigned int off,  ///< offset in R residual
                                    ChVectorDynamic<>& R,    ///< result: the R residual, R += c*F
                                    const double c           ///< a scaling factor
@@ -87,6 +87,7 @@ class ChApi ChNodeBase {
                                         ChVectorDynamic<>& R,
                                         const ChVectorDynamic<>& w,
                                         const double c) {}
+    virtual void NodeIntLoadLumpedMass_Md(const unsigned int off, ChVectorDynamic<>& Md, const double c) {}
     virtual void NodeIntToDescriptor(const unsigned int off_v, const ChStateDelta& v, const ChVectorDynamic<>& R) {}
     virtual void NodeIntFromDescriptor(const unsigned int off_v, ChStateDelta& v) {}
 
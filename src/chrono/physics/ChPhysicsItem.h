@@ -15,6 +15,8 @@
 #ifndef CHPHYSICSITEM_H
 #define CHPHYSICSITEM_H
 
+#include <limits>
+
 #include "chrono/assets/ChAsset.h"
 #include "chrono/collision/ChCCollisionModel.h"
 #include "chrono/core/ChFrame.h"
@@ -97,6 +99,12 @@ class ChApi ChPhysicsItem : public ChObj {
     /// Only for interface; child classes may override this, using internal flags.
     virtual bool GetCollide() const { return false; }
 
+    /// Tell if Update() of this item can run concurrently with collision detection, in
+    /// the pipelined step of the system (see ChSystem::SetUsePipelining). This requires
+    /// that Update() neither depends on the contacts nor modifies anything read by the
+    /// collision system (the frames of collision models and of the contactable objects).
+    virtual bool CanUpdateDuringCollision() const { return false; }
+
     /// If this physical item contains one or more collision models,
     /// synchronize their coordinates and bounding boxes to the state of the item.
     virtual void SyncCollisionModels() {}
@@ -269,6 +277,18 @@ class ChApi ChPhysicsItem : public ChObj {
                                     const double c               ///< a scaling factor
     ) {}
 
+    /// Adds the diagonal of the lumped mass matrix, scaled, to Md at given offset:
+    ///    Md += c*diag(M_lumped)
+    /// Items that do not implement this cannot be integrated by lumped-mass explicit timesteppers.
+    virtual void IntLoadLumpedMass_Md(const unsigned int off,  ///< offset in Md vector
+                                      ChVectorDynamic<>& Md,   ///< result: Md vector, diagonal of the lumped mass matrix
+                                      const double c           ///< a scaling factor
+    ) {}
+
+    /// Estimate the largest stable time step for explicit integration
+    /// of this item. By default, no limit.
+    virtual double ComputeCriticalTimeStep() { return std::numeric_limits<double>::max(); }
+
     /// Takes the term Cq'*L, scale and adds to R at given offset:
     ///    R += c*Cq'*L
     virtual void IntLoadResidual_CqL(const unsigned int off_L,    ///< offset in L multipliers
@@ -115,6 +115,13 @@ void ChShaft::IntLoadResidual_Mv(const unsigned int off,      // offset in R res
     R(off) += c * inertia * w(off);
 }
 
+void ChShaft::IntLoadLumpedMass_Md(const unsigned int off,  // offset in Md vector
+                                   ChVectorDynamic<>& Md,   // result: Md vector, diagonal of the lumped mass matrix
+                                   const double c           // a scaling factor
+                                   ) {
+    Md(off) += c * inertia;
+}
+
 void ChShaft::IntToDescriptor(const unsigned int off_v,  // offset in v, R
                               const ChStateDelta& v,
                               const ChVectorDynamic<>& R,
@@ -13,10 +13,14 @@
 // =============================================================================
 
 #include <algorithm>
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "chrono/collision/ChCCollisionSystemBullet.h"
 #include "chrono/collision/ChCModelBullet.h"
 #include "chrono/parallel/ChOpenMP.h"
+#include "chrono/parallel/ChTaskScheduler.h"
 #include "chrono/physics/ChProximityContainer.h"
 #include "chrono/physics/ChSystem.h"
 #include "chrono/solver/ChSolverAPGD.h"
@@ -55,6 +59,8 @@ ChSystem::ChSystem()
       min_bounce_speed(0.15),
       max_penetration_recovery_speed(0.6),
       use_sleeping(false),
+      nsleep_islands(0),
+      use_pipelining(false),
       G_acc(ChVector<>(0, -9.8, 0)),
       stepcount(0),
       solvecount(0),
@@ -101,6 +107,8 @@ ChSystem::ChSystem(const ChSystem& other) : ChAssembly(other) {
     SetSolverType(GetSolverType());
     parallel_thread_number = other.parallel_thread_number;
     use_sleeping = other.use_sleeping;
+    nsleep_islands = other.nsleep_islands;
+    use_pipelining = other.use_pipelining;
 
     ncontacts = other.ncontacts;
 
@@ -271,6 +279,10 @@ void ChSystem::SetParallelThreadNumber(int mthreads) {
 
     descriptor->SetNumThreads(mthreads);
 
+    // The task pool is shared by all systems and is not resized here: the parallel work of this
+    // system (multithreaded solver, FEA meshes, collision queries) runs as at most 'mthreads'
+    // concurrent tasks of the pool.
+
     if (solver_speed->GetType() == ChSolver::Type::SOR_MULTITHREAD) {
         std::static_pointer_cast<ChSolverSORmultithread>(solver_speed)->ChangeNumberOfThreads(mthreads);
         std::static_pointer_cast<ChSolverSORmultithread>(solver_stab)->ChangeNumberOfThreads(mthreads);
@@ -471,6 +483,9 @@ void ChSystem::SetTimestepperType(ChTimestepper::Type type) {
         case ChTimestepper::Type::NEWMARK:
             timestepper = std::make_shared<ChTimestepperNewmark>(this);
             break;
+        case ChTimestepper::Type::CENTRAL_DIFFERENCE:
+            timestepper = std::make_shared<ChTimestepperCentralDifference>(this);
+            break;
         default:
             throw ChException("SetTimestepperType: timestepper not supported");
     }
@@ -489,12 +504,48 @@ bool ChSystem::ManageSleepingBodies() {
     }
 
     // STEP 2:
-    // See if some sleeping or potential sleeping body is touching a non sleeping one,
-    // if so, set to no sleep.
+    // Find the islands of bodies connected by contacts, links, or by having fallen asleep
+    // together (the contacts between sleeping bodies are not reported). Fixed bodies do not
+    // connect islands.
 
-    // Make this class for iterating through contacts
+    std::unordered_map<ChBody*, int> body_index;
+    std::vector<int> island(bodylist.size());
+    for (int ip = 0; ip < bodylist.size(); ++ip) {
+        island[ip] = ip;
+        if (!bodylist[ip]->GetBodyFixed())
+            body_index[bodylist[ip].get()] = ip;
+    }
 
-    class _wakeup_reporter_class : public ChContactContainer::ReportContactCallback {
+    // Union-find on the body indexes
+    auto find_root = [&island](int i) {
+        while (island[i] != i) {
+            island[i] = island[island[i]];
+            i = island[i];
+        }
+        return i;
+    };
+    auto join = [&](ChBody* bodyA, ChBody* bodyB) {
+        auto iA = body_index.find(bodyA);
+        auto iB = body_index.find(bodyB);
+        if (iA != body_index.end() && iB != body_index.end())
+            island[find_root(iA->second)] = find_root(iB->second);
+    };
+
+    // Sleeping bodies with the same island identifier (0 if put to sleep by the user)
+    std::unordered_map<int, int> sleeping_island_body;
+    for (int ip = 0; ip < bodylist.size(); ++ip) {
+        if (bodylist[ip]->GetSleeping() && !bodylist[ip]->GetBodyFixed() && bodylist[ip]->GetSleepIsland()) {
+            auto first = sleeping_island_body.insert(std::make_pair(bodylist[ip]->GetSleepIsland(), ip)).first;
+            join(bodylist[ip].get(), bodylist[first->second].get());
+        }
+    }
+
+    for (unsigned int ip = 0; ip < linklist.size(); ++ip) {
+        if (linklist[ip]->IsRequiringWaking())
+            join(dynamic_cast<ChBody*>(linklist[ip]->GetBody1()), dynamic_cast<ChBody*>(linklist[ip]->GetBody2()));
+    }
+
+    class _island_reporter_class : public ChContactContainer::ReportContactCallback {
       public:
         // Callback, used to report contact points already added to the container.
         // If returns false, the contact scanning will be stopped.
@@ -509,102 +560,67 @@ bool ChSystem::ManageSleepingBodies() {
             ChContactable* contactobjA,  // get model A (note: some containers may not support it and could be zero!)
             ChContactable* contactobjB   // get model B (note: some containers may not support it and could be zero!)
             ) override {
-            if (!(contactobjA && contactobjB))
-                return true;
-            ChBody* b1 = dynamic_cast<ChBody*>(contactobjA);
-            ChBody* b2 = dynamic_cast<ChBody*>(contactobjB);
-            if (!(b1 && b2))
-                return true;
-            bool sleep1 = b1->GetSleeping();
-            bool sleep2 = b2->GetSleeping();
-            bool could_sleep1 = b1->BFlagGet(ChBody::BodyFlag::COULDSLEEP);
-            bool could_sleep2 = b2->BFlagGet(ChBody::BodyFlag::COULDSLEEP);
-            bool ground1 = b1->GetBodyFixed();
-            bool ground2 = b2->GetBodyFixed();
-            if (sleep1 && !(sleep2 || could_sleep2) && !ground2) {
-                b1->SetSleeping(false);
-                need_Setup_A = true;
-            }
-            if (sleep2 && !(sleep1 || could_sleep1) && !ground1) {
-                b2->SetSleeping(false);
-                need_Setup_A = true;
-            }
-            if (could_sleep1 && !(sleep2 || could_sleep2) && !ground2) {
-                b1->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
-            }
-            if (could_sleep2 && !(sleep1 || could_sleep1) && !ground1) {
-                b2->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
-            }
-            someone_sleeps = sleep1 | sleep2 | someone_sleeps;
-
+            if (contactobjA && contactobjB)
+                join(dynamic_cast<ChBody*>(contactobjA), dynamic_cast<ChBody*>(contactobjB));
             return true;  // to continue scanning contacts
         }
 
         // Data
-        bool someone_sleeps;
-        bool need_Setup_A;
+        std::function<void(ChBody*, ChBody*)> join;
     };
 
-    _wakeup_reporter_class my_waker;
-    my_waker.need_Setup_A = false;
+    _island_reporter_class my_reporter;
+    my_reporter.join = join;
+    contact_container->ReportAllContacts(&my_reporter);
 
-    bool need_Setup_L = false;
+    // STEP 3:
+    // An island with some awake body (neither sleeping nor sleep candidate) must be awake:
+    // wake its sleeping bodies. Otherwise, if it has some sleep candidate, put it to sleep.
 
-    for (int i = 0; i < 1; i++)  //***TO DO*** reconfigurable number of wakeup cycles
-    {
-        my_waker.someone_sleeps = false;
+    std::vector<char> island_awake(bodylist.size(), 0);
+    std::vector<int> island_id(bodylist.size(), 0);
+    for (int ip = 0; ip < bodylist.size(); ++ip) {
+        if (bodylist[ip]->IsActive() && !bodylist[ip]->BFlagGet(ChBody::BodyFlag::COULDSLEEP))
+            island_awake[find_root(ip)] = 1;
+    }
 
-        // scan all links and wake connected bodies
-        for (unsigned int ip = 0; ip < linklist.size(); ++ip)  // ITERATE on links
-        {
-            std::shared_ptr<ChLink> Lpointer = linklist[ip];
-
-            if (Lpointer->IsRequiringWaking()) {
-                ChBody* b1 = dynamic_cast<ChBody*>(Lpointer->GetBody1());
-                ChBody* b2 = dynamic_cast<ChBody*>(Lpointer->GetBody2());
-                if (b1 && b2) {
-                    bool sleep1 = b1->GetSleeping();
-                    bool sleep2 = b2->GetSleeping();
-                    bool could_sleep1 = b1->BFlagGet(ChBody::BodyFlag::COULDSLEEP);
-                    bool could_sleep2 = b2->BFlagGet(ChBody::BodyFlag::COULDSLEEP);
-                    if (sleep1 && !(sleep2 || could_sleep2)) {
-                        b1->SetSleeping(false);
-                        need_Setup_L = true;
-                    }
-                    if (sleep2 && !(sleep1 || could_sleep1)) {
-                        b2->SetSleeping(false);
-                        need_Setup_L = true;
-                    }
-                    if (could_sleep1 && !(sleep2 || could_sleep2)) {
-                        b1->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
-                    }
-                    if (could_sleep2 && !(sleep1 || could_sleep1)) {
-                        b2->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
-                    }
-                }
+    std::unordered_set<ChContactable*> woken;
+    int nasleep = 0;
+    for (int ip = 0; ip < bodylist.size(); ++ip) {
+        ChBody* body = bodylist[ip].get();
+        if (body->GetBodyFixed())
+            continue;
+        int root = find_root(ip);
+        if (island_awake[root]) {
+            if (body->GetSleeping()) {
+                body->SetSleeping(false);
+                woken.insert(body);
             }
+        } else if (body->BFlagGet(ChBody::BodyFlag::COULDSLEEP)) {
+            if (!island_id[root])
+                island_id[root] = ++nsleep_islands;
+            body->SetSleeping(true);
+            ++nasleep;
         }
-
-        // scan all contacts and wake neighboring bodies
-        contact_container->ReportAllContacts(&my_waker);
-
-        // bailout wakeup cycle prematurely, if all bodies are not sleeping
-        if (!my_waker.someone_sleeps)
-            break;
+        body->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
     }
 
-    /// If some body still must change from no sleep-> sleep, do it
-    int need_Setup_B = 0;
-    for (int ip = 0; ip < bodylist.size(); ++ip) {
-        if (bodylist[ip]->BFlagGet(ChBody::BodyFlag::COULDSLEEP)) {
-            bodylist[ip]->SetSleeping(true);
-            ++need_Setup_B;
+    // Islands falling asleep, possibly joining sleeping bodies: give all their bodies the same identifier
+    if (nasleep) {
+        for (int ip = 0; ip < bodylist.size(); ++ip) {
+            int id = island_id[find_root(ip)];
+            if (id && bodylist[ip]->GetSleeping())
+                bodylist[ip]->SetSleepIsland(id);
         }
     }
 
     // if some body has been activated/deactivated because of sleep state changes,
     // the offsets and DOF counts must be updated:
-    if (my_waker.need_Setup_A || need_Setup_B || need_Setup_L) {
+    if (!woken.empty() || nasleep) {
+        // The contacts of the woken bodies that were not reported while they were sleeping
+        // are still in the collision system, since sleeping bodies do not move.
+        if (!woken.empty())
+            ReportWokenContacts(woken);
         Setup();
         return true;
     }
@@ -719,6 +735,42 @@ void ChSystem::Update(bool update_assets) {
     timer_update.stop();
 }
 
+void ChSystem::UpdateDuringCollision() {
+    CH_TRACE("UpdateDuringCollision");
+
+    timer_update.start();
+
+    for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
+        if (otherphysicslist[ip]->CanUpdateDuringCollision())
+            otherphysicslist[ip]->Update(ChTime, false);
+    }
+
+    timer_update.stop();
+}
+
+void ChSystem::UpdateAfterCollision(bool update_assets) {
+    CH_PROFILE( "Update");
+
+    timer_update.start();
+
+    // Same as ChAssembly::Update, skipping the items already updated
+    for (int ip = 0; ip < bodylist.size(); ++ip) {
+        if (!bodylist[ip]->GetSleeping())
+            bodylist[ip]->Update(ChTime, update_assets);
+    }
+    for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
+        if (!otherphysicslist[ip]->CanUpdateDuringCollision())
+            otherphysicslist[ip]->Update(ChTime, update_assets);
+    }
+    for (unsigned int ip = 0; ip < linklist.size(); ++ip) {
+        linklist[ip]->Update(ChTime, update_assets);
+    }
+
+    contact_container->Update(ChTime, update_assets);
+
+    timer_update.stop();
+}
+
 void ChSystem::IntStateGather(const unsigned int off_x,  // offset in x state vector
                               ChState& x,                // state vector, position part
                               const unsigned int off_v,  // offset in v state vector
@@ -810,6 +862,7 @@ void ChSystem::IntLoadResidual_F(const unsigned int off,  // offset in R residua
                                  ChVectorDynamic<>& R,    // result: the R residual, R += c*F
                                  const double c           // a scaling factor
                                  ) {
+    CH_TRACE("ChSystem::IntLoadResidual_F");
     unsigned int displ_v = off - offset_w;
 
     // Inherit: operate parent method on sub objects (bodies, links, etc.)
@@ -1015,6 +1068,7 @@ void ChSystem::InjectKRMmatrices(ChSystemDescriptor& mdescriptor) {
 }
 
 void ChSystem::KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) {
+    CH_TRACE("ChSystem::KRMmatricesLoad");
     // Inherit: operate parent method on sub objects (bodies, links, etc.)
     ChAssembly::KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
     // Use also on contact container:
@@ -1195,6 +1249,18 @@ void ChSystem::LoadResidual_Mv(ChVectorDynamic<>& R,        ///< result: the R r
     IntLoadResidual_Mv(0, R, w, c);
 }
 
+// Increment a vector Md with the diagonal of the lumped mass matrix:
+//    Md += c*diag(M_lumped)
+void ChSystem::LoadLumpedMass_Md(ChVectorDynamic<>& Md,  ///< result: Md vector, diagonal of the lumped mass matrix
+                                 const double c          ///< a scaling factor
+                                 ) {
+    IntLoadLumpedMass_Md(0, Md, c);
+}
+
+double ChSystem::ComputeCriticalTimeStep() {
+    return ChAssembly::ComputeCriticalTimeStep();
+}
+
 // Increment a vectorR with the term Cq'*L:
 //    R += c*Cq'*L
 void ChSystem::LoadResidual_CqL(ChVectorDynamic<>& R,        ///< result: the R residual, R += c*Cq'*L
@@ -1249,37 +1315,90 @@ double ChSystem::ComputeCollisions() {
     // Perform the collision detection ( broadphase and narrowphase )
     collision_system->Run();
 
+    // Report and store contacts and/or proximities
+    ReportContacts();
+
+    // Invoke the custom collision callbacks (if any). These can potentially add
+    // additional contacts to the contact container.
+    for (size_t ic = 0; ic < collision_callbacks.size(); ic++)
+        collision_callbacks[ic]->OnCustomCollision(this);
+
+    // Count the contacts of body-body type.
+    ncontacts = contact_container->GetNcontacts();
+
+    timer_collision_broad.stop();
+
+    return mretC;
+}
+
+void ChSystem::ReportContacts() {
     // Report and store contacts and/or proximities, if there are some
     // containers in the physic system. The default contact container
     // for ChBody and ChParticles is used always.
 
-    {
-        CH_PROFILE( "ReportContacts");
+    CH_PROFILE( "ReportContacts");
 
-        collision_system->ReportContacts(contact_container.get());
+    collision_system->ReportContacts(contact_container.get());
 
-        for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
-            if (auto mcontactcontainer = std::dynamic_pointer_cast<ChContactContainer>(otherphysicslist[ip])) {
-                collision_system->ReportContacts(mcontactcontainer.get());
-            }
+    for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
+        if (auto mcontactcontainer = std::dynamic_pointer_cast<ChContactContainer>(otherphysicslist[ip])) {
+            collision_system->ReportContacts(mcontactcontainer.get());
+        }
 
-            if (auto mproximitycontainer = std::dynamic_pointer_cast<ChProximityContainer>(otherphysicslist[ip])) {
-                collision_system->ReportProximities(mproximitycontainer.get());
-            }
+        if (auto mproximitycontainer = std::dynamic_pointer_cast<ChProximityContainer>(otherphysicslist[ip])) {
+            collision_system->ReportProximities(mproximitycontainer.get());
         }
     }
+}
 
-    // Invoke the custom collision callbacks (if any). These can potentially add
-    // additional contacts to the contact container.
-    for (size_t ic = 0; ic < collision_callbacks.size(); ic++)
-        collision_callbacks[ic]->OnCustomCollision(this);
+namespace {
 
-    // Count the contacts of body-body type.
-    ncontacts = contact_container->GetNcontacts();
+// Contact container passed to the collision system to add to another container, without removing
+// the contacts it already has (including those added by the custom collision callbacks), only the
+// contacts skipped because both objects were inactive and that involve some woken object.
+class ChWokenContactFilter : public ChContactContainer {
+  public:
+    ChWokenContactFilter(ChContactContainer* target, const std::unordered_set<ChContactable*>& woken)
+        : m_target(target), m_woken(woken) {}
 
-    timer_collision_broad.stop();
+    virtual ChWokenContactFilter* Clone() const override { return new ChWokenContactFilter(*this); }
 
-    return mretC;
+    virtual int GetNcontacts() const override { return m_target->GetNcontacts(); }
+    virtual void RemoveAllContacts() override {}
+    virtual void BeginAddContact() override {}
+    virtual void EndAddContact() override { m_target->EndAddContact(); }
+
+    virtual void AddContact(const collision::ChCollisionInfo& mcontact) override {
+        ChContactable* contactableA = mcontact.modelA->GetContactable();
+        ChContactable* contactableB = mcontact.modelB->GetContactable();
+        bool wokenA = m_woken.count(contactableA) > 0;
+        bool wokenB = m_woken.count(contactableB) > 0;
+        if ((wokenA || wokenB) && (wokenA || !contactableA->IsContactActive()) &&
+            (wokenB || !contactableB->IsContactActive()))
+            m_target->AddContact(mcontact);
+    }
+
+  private:
+    ChContactContainer* m_target;
+    const std::unordered_set<ChContactable*>& m_woken;
+};
+
+}  // end anonymous namespace
+
+void ChSystem::ReportWokenContacts(const std::unordered_set<ChContactable*>& woken) {
+    CH_PROFILE( "ReportContacts");
+
+    ChWokenContactFilter filter(contact_container.get(), woken);
+    collision_system->ReportContacts(&filter);
+
+    for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
+        if (auto mcontactcontainer = std::dynamic_pointer_cast<ChContactContainer>(otherphysicslist[ip])) {
+            ChWokenContactFilter container_filter(mcontactcontainer.get(), woken);
+            collision_system->ReportContacts(&container_filter);
+        }
+    }
+
+    ncontacts = contact_container->GetNcontacts();
 }
 
 // =============================================================================
@@ -1387,6 +1506,7 @@ void ChSystem::DumpSystemMatrices(bool save_M, bool save_K, bool save_R, bool sa
 // -----------------------------------------------------------------------------
 
 int ChSystem::DoStepDynamics(double m_step) {
+    CH_TRACE("ChSystem::DoStepDynamics");
     step = m_step;
     return Integrate_Y();
 }
@@ -1409,15 +1529,26 @@ bool ChSystem::Integrate_Y() {
     solvecount = 0;
     setupcount = 0;
 
-    // Compute contacts and create contact constraints
-    ComputeCollisions();
-
-    // Counts dofs, statistics, etc. (not needed because already in Advance()...? )
-    Setup();
+    if (use_pipelining && controlslist.empty() && parallel_thread_number > 1) {
+        // Same phases as below, as a task graph: the collision detection and the update of
+        // the items that do not depend on contacts run concurrently.
+        ChTaskGraph graph;
+        int collide = graph.AddTask([this]() { ComputeCollisions(); });
+        int update = graph.AddTask([this]() { UpdateDuringCollision(); });
+        int setup = graph.AddTask([this]() { Setup(); }, {collide, update});
+        graph.AddTask([this]() { UpdateAfterCollision(false); }, {setup});
+        graph.Run();
+    } else {
+        // Compute contacts and create contact constraints
+        ComputeCollisions();
+
+        // Counts dofs, statistics, etc. (not needed because already in Advance()...? )
+        Setup();
 
-    // Update everything - and put to sleep bodies that need it (not needed because already in Advance()...? )
-    // No need to update visualization assets here.
-    Update(false);
+        // Update everything - and put to sleep bodies that need it (not needed because already in Advance()...? )
+        // No need to update visualization assets here.
+        Update(false);
+    }
 
     // Re-wake the bodies that cannot sleep because they are in contact with
     // some body that is not in sleep state.
@@ -22,6 +22,7 @@
 #include <cstring>
 #include <iostream>
 #include <list>
+#include <unordered_set>
 
 #include "chrono/collision/ChCCollisionSystem.h"
 #include "chrono/core/ChLog.h"
@@ -259,6 +260,8 @@ class ChApi ChSystem : public ChAssembly, public ChIntegrableIIorder {
     /// Changes the number of parallel threads (by default is n.of cores).
     /// Note that not all solvers use parallel computation.
     /// If you have a N-core processor, this should be set at least =N for maximum performance.
+    /// This limits the number of concurrent tasks used by this system on the task pool shared by all
+    /// systems; it does not change the size of that pool (see ChTaskScheduler::SetNumThreads).
     void SetParallelThreadNumber(int mthreads = 2);
     /// Get the number of parallel threads.
     /// Note that not all solvers use parallel computation.
@@ -515,6 +518,16 @@ class ChApi ChSystem : public ChAssembly, public ChIntegrableIIorder {
                                  const double c               ///< a scaling factor
                                  ) override;
 
+    /// Increment a vector Md with the diagonal of the lumped mass matrix:
+    ///    Md += c*diag(M_lumped)
+    virtual void LoadLumpedMass_Md(ChVectorDynamic<>& Md,  ///< result: Md vector, diagonal of the lumped mass matrix
+                                   const double c          ///< a scaling factor
+                                   ) override;
+
+    /// Estimate the largest stable time step for explicit integrators,
+    /// as the minimum of the critical time steps of the contained items.
+    virtual double ComputeCriticalTimeStep() override;
+
     /// Increment a vectorR with the term Cq'*L:
     ///    R += c*Cq'*L
     virtual void LoadResidual_CqL(ChVectorDynamic<>& R,        ///< result: the R residual, R += c*Cq'*L
@@ -602,18 +615,45 @@ class ChApi ChSystem : public ChAssembly, public ChIntegrableIIorder {
     /// motion has almost come to a rest. This feature will allow faster simulation
     /// of large scenarios for real-time purposes, but it will affect the precision!
     /// This functionality can be turned off selectively for specific ChBodies.
+    /// Bodies sleep by islands (groups of bodies connected by contacts or links, not
+    /// counting fixed bodies): an island falls asleep when all its bodies have been at
+    /// rest long enough, and is woken as a whole when an awake body touches it.
     void SetUseSleeping(bool ms) { use_sleeping = ms; }
 
     /// Tell if the system will put to sleep the bodies whose motion has almost come to a rest.
     bool GetUseSleeping() const { return use_sleeping; }
 
+    /// Turn on this feature to run, at each step, the collision detection concurrently with the
+    /// update of the items that do not depend on contacts (such as FEA meshes and load containers,
+    /// see ChPhysicsItem::CanUpdateDuringCollision), on the threads of the ChTaskScheduler pool.
+    /// The results are the same as with the sequential step. Not used if there are 'controls' objects
+    /// or if the system uses a single thread (see SetParallelThreadNumber).
+    void SetUsePipelining(bool mp) { use_pipelining = mp; }
+
+    /// Tell if the system overlaps collision detection and the update of independent items.
+    bool GetUsePipelining() const { return use_pipelining; }
+
   private:
-    /// Put bodies to sleep if possible. Also awakens sleeping bodies, if needed.
+    /// Put islands of bodies to sleep if possible. Also awakens sleeping islands, if needed.
     /// Returns true if some body changed from sleep to no sleep or viceversa,
     /// returns false if nothing changed. In the former case, also performs Setup()
     /// because the sleeping policy changed the totalDOFs and offsets.
     bool ManageSleepingBodies();
 
+    /// Report the contacts and proximities found by the collision system to the containers.
+    void ReportContacts();
+
+    /// Add to the contact containers the contacts found by the collision system that were not
+    /// reported because the specified (just woken) bodies were sleeping. The contacts already in
+    /// the containers are kept, and the custom collision callbacks are not invoked again.
+    void ReportWokenContacts(const std::unordered_set<ChContactable*>& woken);
+
+    /// Update the items that can be updated concurrently with collision detection.
+    void UpdateDuringCollision();
+
+    /// Update all other items (to be called after UpdateDuringCollision and collision detection).
+    void UpdateAfterCollision(bool update_assets);
+
     /// Performs a single dynamical simulation step, according to
     /// current values of:  Y, time, step  (and other minor settings)
     /// Depending on the integration type, it switches to one of the following:
@@ -656,6 +696,9 @@ class ChApi ChSystem : public ChAssembly, public ChIntegrableIIorder {
     /// Reset to 0 the total number of time steps.
     void ResetStepcount() { stepcount = 0; }
 
+    /// Set the total number of time steps (e.g. when restarting from a checkpoint).
+    void SetStepcount(size_t n) { stepcount = n; }
+
     /// Return the number of calls to the solver's Solve() function.
     /// This counter is reset at each timestep.
     int GetSolverCallsCount() const { return solvecount; }
@@ -802,6 +845,8 @@ class ChApi ChSystem : public ChAssembly, public ChIntegrableIIorder {
     int maxiter;  ///< max iterations for nonlinear convergence in DoAssembly()
 
     bool use_sleeping;  ///< if true, put to sleep objects that come to rest
+    int nsleep_islands;  ///< number of islands put to sleep so far (gives their identifiers)
+    bool use_pipelining;  ///< if true, overlap collision detection and updates of independent items
 
     std::shared_ptr<ChSystemDescriptor> descriptor;  ///< the system descriptor
     std::shared_ptr<ChSolver> solver_speed;          ///< the solver for speed problem
@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverBB.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 
@@ -21,6 +22,7 @@ CH_FACTORY_REGISTER(ChSolverBB)
 
 double ChSolverBB::Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
                          ) {
+    CH_TRACE("ChSolverBB::Solve");
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
 
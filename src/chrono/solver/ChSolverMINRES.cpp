@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverMINRES.h"
+#include "chrono/utils/ChTraceProfiler.h"
 #include "chrono/solver/ChConstraintTwoTuplesFrictionT.h"
 
 namespace chrono {
@@ -22,6 +23,7 @@ CH_FACTORY_REGISTER(ChSolverMINRES)
 
 double ChSolverMINRES::Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
                              ) {
+    CH_TRACE("ChSolverMINRES::Solve");
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
 
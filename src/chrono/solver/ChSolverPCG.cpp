@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverPCG.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 
@@ -21,6 +22,7 @@ CH_FACTORY_REGISTER(ChSolverPCG)
 
 double ChSolverPCG::Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
                           ) {
+    CH_TRACE("ChSolverPCG::Solve");
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
 
@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverPMINRES.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 
@@ -21,6 +22,7 @@ CH_FACTORY_REGISTER(ChSolverPMINRES)
 
 double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd  ///< system description with constraints and variables
                               ) {
+    CH_TRACE("ChSolverPMINRES::Solve");
     bool do_preconditioning = this->diag_preconditioning;
 
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
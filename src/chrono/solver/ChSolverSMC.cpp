@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverSMC.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 
@@ -20,6 +21,7 @@ namespace chrono {
 CH_FACTORY_REGISTER(ChSolverSMC)
 
 double ChSolverSMC::Solve(ChSystemDescriptor& sysd) {
+    CH_TRACE("ChSolverSMC::Solve");
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
 
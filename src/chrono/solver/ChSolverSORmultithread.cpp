@@ -19,6 +19,7 @@
 #include "chrono/solver/ChConstraintTwoTuplesRollingN.h"
 #include "chrono/solver/ChConstraintTwoTuplesRollingT.h"
 #include "chrono/solver/ChSolverSORmultithread.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 
@@ -47,23 +48,17 @@ struct thread_data {
     std::vector<ChVariables*>* mvariables;
 };
 
-// Don't create local store memory, just return 0
+// The following is the function which will be executed on
+// each slice, for each stage of Solve()
 
-void* SolverMemoryFunc() {
-    return 0;
-}
-
-// The following is the function which will be executed by
-// each thread, when threads are launched at each Solve()
+void SolverStageFunc(thread_data* tdata) {
+    CH_TRACE("ChSolverSORmultithread::ThreadFunc");
 
-void SolverThreadFunc(void* userPtr, void* lsMemory) {
     double maxviolation = 0.;
     double maxdeltalambda = 0.;
     int i_friction_comp = 0;
     double old_lambda_friction[3];
 
-    thread_data* tdata = (thread_data*)userPtr;
-
     std::vector<ChConstraint*>* mconstraints = tdata->mconstraints;
     std::vector<ChVariables*>* mvariables = tdata->mvariables;
 
@@ -248,38 +243,24 @@ void SolverThreadFunc(void* userPtr, void* lsMemory) {
     }  // end stage  switching
 }
 
-// When the solver object is created, threads are also
-// created and initialized, in 'wait' mode.
-
 ChSolverSORmultithread::ChSolverSORmultithread(const char* uniquename,
                                                int nthreads,
                                                int mmax_iters,
                                                bool mwarm_start,
                                                double mtolerance,
                                                double momega)
-    : ChIterativeSolver(mmax_iters, mwarm_start, mtolerance, momega) {
-    ChThreadConstructionInfo create_args(uniquename, SolverThreadFunc, SolverMemoryFunc, nthreads);
-
-    solver_threads = new ChThreads(create_args);
-}
-
-ChSolverSORmultithread::~ChSolverSORmultithread() {
-    if (solver_threads) {
-        solver_threads->flush();
-        delete (solver_threads);
-        solver_threads = 0;
-    }
-}
+    : ChIterativeSolver(mmax_iters, mwarm_start, mtolerance, momega), num_threads(ChMax(nthreads, 1)) {}
 
 // The SOR solver process has been modified so that some
-// parallelizable code has been moved to the SolverThreadFunc().
-// So, the N threads must be started (each executing SolverThreadFunc() )
-// and, after waiting for all them to be completed, with flush(), the
-// solution is done.
+// parallelizable code has been moved to the SolverStageFunc().
+// So, for each stage, the N slices are processed as tasks of the
+// shared scheduler and, after waiting for all them to be completed,
+// the next stage is started.
 
 double ChSolverSORmultithread::Solve(
     ChSystemDescriptor& sysd  ///< system description with constraints and variables
     ) {
+    CH_TRACE("ChSolverSORmultithread::Solve");
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
 
@@ -295,7 +276,7 @@ double ChSolverSORmultithread::Solve(
     // --0--  preparation:
     //        subdivide the workload to the threads and prepare their 'thread_data':
 
-    int numthreads = this->solver_threads->getNumberOfThreads();
+    int numthreads = this->num_threads;
     std::vector<thread_data> mdataN(numthreads);
 
     int var_slice = 0;
@@ -335,32 +316,29 @@ double ChSolverSORmultithread::Solve(
 
     // LAUNCH THE PARALLEL COMPUTATION ON THREADS !!!!
 
+    auto run_stage = [&](thread_data::solver_stage stage) {
+        for (int nth = 0; nth < numthreads; nth++)
+            mdataN[nth].stage = stage;
+        //... returns when all the slices finished their stage
+        ChTaskScheduler::GetInstance().ParallelFor(0, numthreads,
+                                                   [&](int first, int last) {
+                                                       for (int nth = first; nth < last; nth++)
+                                                           SolverStageFunc(&mdataN[nth]);
+                                                   },
+                                                   1, numthreads);
+    };
+
     // --1--  stage:
     //        precompute aux variables in constraints.
-    for (int nth = 0; nth < numthreads; nth++) {
-        mdataN[nth].stage = thread_data::STAGE1_PREPARE;
-        solver_threads->sendRequest(1, &mdataN[nth], nth);
-    }
-    //... must wait that the all the threads finished their stage!!!
-    solver_threads->flush();
+    run_stage(thread_data::STAGE1_PREPARE);
 
     // --2--  stage:
     //        add external forces and mass effects, on variables.
-    for (int nth = 0; nth < numthreads; nth++) {
-        mdataN[nth].stage = thread_data::STAGE2_ADDFORCES;
-        solver_threads->sendRequest(1, &mdataN[nth], nth);
-    }
-    //... must wait that the all the threads finished their stage!!!
-    solver_threads->flush();
+    run_stage(thread_data::STAGE2_ADDFORCES);
 
     // --3--  stage:
     //        loop on constraints.
-    for (int nth = 0; nth < numthreads; nth++) {
-        mdataN[nth].stage = thread_data::STAGE3_LOOPCONSTRAINTS;
-        solver_threads->sendRequest(1, &mdataN[nth], nth);
-    }
-    //... must wait that the all the threads finished their stage!!!
-    solver_threads->flush();
+    run_stage(thread_data::STAGE3_LOOPCONSTRAINTS);
 
     return 0;
 }
@@ -369,16 +347,7 @@ void ChSolverSORmultithread::ChangeNumberOfThreads(int mthreads) {
     if (mthreads < 1)
         mthreads = 1;
 
-    char mname[100];
-    strncpy(mname, solver_threads->getUniqueName().c_str(), sizeof(mname)-1);
-
-    solver_threads->flush();
-    delete (solver_threads);
-    solver_threads = 0;
-
-    ChThreadConstructionInfo create_args(mname, SolverThreadFunc, SolverMemoryFunc, mthreads);
-
-    solver_threads = new ChThreads(create_args);
+    num_threads = mthreads;
 }
 
 } // end namespace chrono
@@ -16,21 +16,23 @@
 #define CHSOLVERSORMULTITHREAD_H
 
 #include "chrono/solver/ChIterativeSolver.h"
-#include "chrono/parallel/ChThreads.h"
+#include "chrono/parallel/ChTaskScheduler.h"
 
 namespace chrono {
 /// An iterative solver based on projective fixed point method, with overrelaxation
 /// and immediate variable update as in SOR methods. Multi-threaded.\n
+/// The constraints and variables are split in as many slices as threads, processed
+/// as tasks of the shared ChTaskScheduler pool.\n
 /// See ChSystemDescriptor for more information about the problem formulation and the data structures
 /// passed to the solver.
 
 class ChApi ChSolverSORmultithread : public ChIterativeSolver {
 
   protected:
-    ChThreads* solver_threads;
+    int num_threads;
 
   public:
-    ChSolverSORmultithread(const char* uniquename = "solver",  ///< this name must be unique.
+    ChSolverSORmultithread(const char* uniquename = "solver",  ///< solver name (unused)
                            int nthreads = 2,                   ///< number of threads
                            int mmax_iters = 50,                ///< max.number of iterations
                            bool mwarm_start = false,           ///< uses warm start?
@@ -38,7 +40,7 @@ class ChApi ChSolverSORmultithread : public ChIterativeSolver {
                            double momega = 1.0                 ///< overrelaxation criterion
                            );
 
-    virtual ~ChSolverSORmultithread();
+    virtual ~ChSolverSORmultithread() {}
 
     /// Return type of the solver.
     virtual Type GetType() const override { return Type::SOR_MULTITHREAD; }
@@ -50,6 +52,9 @@ class ChApi ChSolverSORmultithread : public ChIterativeSolver {
 
     /// Changes the number of threads which run in parallel (should be > 1 )
     void ChangeNumberOfThreads(int mthreads = 2);
+
+    /// Return the number of threads (slices of the problem).
+    int GetNumberOfThreads() const { return num_threads; }
 };
 
 }  // end namespace chrono
@@ -16,6 +16,7 @@
 #define CHINTEGRABLE_H
 
 #include <cstdlib>
+#include <limits>
 
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChMath.h"
@@ -337,6 +338,21 @@ class ChApi ChIntegrableIIorder : public ChIntegrable {
         throw ChException("LoadResidual_Mv() not implemented, implicit integrators cannot be used. ");
     };
 
+    /// Assuming   M*a = F(x,v,t) + Cq'*L
+    /// increment a vector Md with the diagonal of a lumped (diagonal) approximation of M:
+    ///    Md += c*diag(M_lumped)
+    /// This is used by explicit integrators that avoid solving a linear system.
+    virtual void LoadLumpedMass_Md(ChVectorDynamic<>& Md,  ///< result: Md vector, diagonal of the lumped mass matrix
+                                   const double c          ///< a scaling factor
+                                   ) {
+        throw ChException("LoadLumpedMass_Md() not implemented, lumped mass explicit integrators cannot be used. ");
+    };
+
+    /// Estimate the largest time step that an explicit integrator can take
+    /// while remaining stable (for example the minimum of the critical time
+    /// steps of the finite elements). By default, no limit.
+    virtual double ComputeCriticalTimeStep() { return std::numeric_limits<double>::max(); }
+
     /// Assuming   M*a = F(x,v,t) + Cq'*L
     ///         C(x,t) = 0
     /// increment a vectorR (usually the residual in a Newton Raphson iteration
@@ -15,6 +15,7 @@
 #include <cmath>
 
 #include "chrono/timestepper/ChTimestepper.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 
@@ -36,6 +37,7 @@ class my_enum_mappers : public ChTimestepper {
     CH_ENUM_VAL(Type::EULER_EXPLICIT);
     CH_ENUM_VAL(Type::LEAPFROG);
     CH_ENUM_VAL(Type::NEWMARK);
+    CH_ENUM_VAL(Type::CENTRAL_DIFFERENCE);
     CH_ENUM_VAL(Type::CUSTOM);
     CH_ENUM_MAPPER_END(Type);
 };
@@ -73,6 +75,7 @@ CH_FACTORY_REGISTER(ChTimestepperEulerExpl)
 // Euler explicit timestepper.
 // This performs the typical  y_new = y+ dy/dt * dt integration with Euler formula.
 void ChTimestepperEulerExpl::Advance(const double dt) {
+    CH_TRACE("ChTimestepperEulerExpl::Advance");
     // setup main vectors
     GetIntegrable()->StateSetup(Y, dYdt);
 
@@ -109,6 +112,7 @@ CH_FACTORY_REGISTER(ChTimestepperEulerExplIIorder)
 //    v_new = v + a * dt
 // integration with Euler formula.
 void ChTimestepperEulerExplIIorder::Advance(const double dt) {
+    CH_TRACE("ChTimestepperEulerExplIIorder::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -147,6 +151,7 @@ CH_FACTORY_REGISTER(ChTimestepperEulerSemiImplicit)
 //    x_new = x + v_new * dt
 // integration with Euler semi-implicit formula.
 void ChTimestepperEulerSemiImplicit::Advance(const double dt) {
+    CH_TRACE("ChTimestepperEulerSemiImplicit::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -180,6 +185,7 @@ CH_FACTORY_REGISTER(ChTimestepperRungeKuttaExpl)
 
 // Performs a step of a 4th order explicit Runge-Kutta integration scheme.
 void ChTimestepperRungeKuttaExpl::Advance(const double dt) {
+    CH_TRACE("ChTimestepperRungeKuttaExpl::Advance");
     // setup main vectors
     GetIntegrable()->StateSetup(Y, dYdt);
 
@@ -224,6 +230,7 @@ CH_FACTORY_REGISTER(ChTimestepperHeun)
 
 // Performs a step of a Heun explicit integrator. It is like a 2nd Runge Kutta.
 void ChTimestepperHeun::Advance(const double dt) {
+    CH_TRACE("ChTimestepperHeun::Advance");
     // setup main vectors
     GetIntegrable()->StateSetup(Y, dYdt);
 
@@ -266,6 +273,7 @@ CH_FACTORY_REGISTER(ChTimestepperLeapfrog)
 // Suggestion: use the ChTimestepperEulerSemiImplicit, it gives
 // the same accuracy with a bit of faster performance.
 void ChTimestepperLeapfrog::Advance(const double dt) {
+    CH_TRACE("ChTimestepperLeapfrog::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -298,11 +306,83 @@ void ChTimestepperLeapfrog::Advance(const double dt) {
 
 // -----------------------------------------------------------------------------
 
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChTimestepperCentralDifference)
+
+// Performs a step of the explicit central difference integrator, with lumped mass.
+// Speeds are staggered at half steps, so that only one force evaluation per step is needed.
+void ChTimestepperCentralDifference::Advance(const double dt) {
+    CH_TRACE("ChTimestepperCentralDifference::Advance");
+    // downcast
+    ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
+
+    if (mintegrable->GetNconstr() > 0)
+        throw ChException("ChTimestepperCentralDifference does not support constraints.");
+
+    // setup main vectors
+    mintegrable->StateSetup(X, V, A);
+
+    // setup auxiliary vectors
+    L.Reset(0);
+    R.Reset(mintegrable->GetNcoords_v());
+
+    // lumped mass and critical step are computed only once, or if the n. of coordinates changed
+    bool first_step = false;
+    if (!setup_done || Md.GetRows() != mintegrable->GetNcoords_v()) {
+        Md.Reset(mintegrable->GetNcoords_v());
+        Minv.Reset(mintegrable->GetNcoords_v());
+        mintegrable->LoadLumpedMass_Md(Md, 1.0);
+        for (int i = 0; i < Md.GetRows(); ++i) {
+            if (Md(i) <= 0)
+                throw ChException("ChTimestepperCentralDifference: some coordinates have no lumped mass.");
+            Minv(i) = 1.0 / Md(i);
+        }
+        dt_crit = mintegrable->ComputeCriticalTimeStep();
+        setup_done = true;
+        first_step = true;
+    }
+
+    mintegrable->StateGather(X, V, T);  // state <- system
+
+    // split in substeps if the step is not stable
+    num_substeps = 1;
+    if (dt > courant * dt_crit)
+        num_substeps = (int)std::ceil(dt / (courant * dt_crit));
+    double h = dt / num_substeps;
+
+    for (int is = 0; is < num_substeps; ++is) {
+        // a = Md^-1 * F(x,v,t)
+        R.Reset(mintegrable->GetNcoords_v());
+        mintegrable->StateScatter(X, V, T);  // state -> system, also updates forces
+        mintegrable->LoadResidual_F(R, 1.0);
+        for (int i = 0; i < R.GetRows(); ++i)
+            A(i) = R(i) * Minv(i);
+
+        // advance V to the half step (the very first step starts from v_0, so only half a step)
+        if (first_step && is == 0)
+            V = V + A * (0.5 * h);
+        else
+            V = V + A * h;
+
+        // advance X
+        X = X + V * h;
+
+        T += h;
+    }
+
+    mintegrable->StateScatter(X, V, T);        // state -> system
+    mintegrable->StateScatterAcceleration(A);  // -> system auxiliary data
+    mintegrable->StateScatterReactions(L);     // -> system auxiliary data
+}
+
+// -----------------------------------------------------------------------------
+
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChTimestepperEulerImplicit)
 
 // Performs a step of Euler implicit for II order systems
 void ChTimestepperEulerImplicit::Advance(const double dt) {
+    CH_TRACE("ChTimestepperEulerImplicit::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -394,6 +474,7 @@ CH_FACTORY_REGISTER(ChTimestepperEulerImplicitLinearized)
 // If the solver in StateSolveCorrection is a CCP complementarity
 // solver, this is the typical Anitescu stabilized timestepper for DVIs.
 void ChTimestepperEulerImplicitLinearized::Advance(const double dt) {
+    CH_TRACE("ChTimestepperEulerImplicitLinearized::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -463,6 +544,7 @@ CH_FACTORY_REGISTER(ChTimestepperEulerImplicitProjected)
 // If the solver in StateSolveCorrection is a CCP complementarity
 // solver, this is the Tasora stabilized timestepper for DVIs.
 void ChTimestepperEulerImplicitProjected::Advance(const double dt) {
+    CH_TRACE("ChTimestepperEulerImplicitProjected::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -554,6 +636,7 @@ CH_FACTORY_REGISTER(ChTimestepperTrapezoidal)
 // order in constraint reactions. Use damped HHT or damped Newmark for
 // more advanced options.
 void ChTimestepperTrapezoidal::Advance(const double dt) {
+    CH_TRACE("ChTimestepperTrapezoidal::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -647,6 +730,7 @@ CH_FACTORY_REGISTER(ChTimestepperTrapezoidalLinearized)
 
 // Performs a step of trapezoidal implicit linearized for II order systems
 void ChTimestepperTrapezoidalLinearized::Advance(const double dt) {
+    CH_TRACE("ChTimestepperTrapezoidalLinearized::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -727,6 +811,7 @@ CH_FACTORY_REGISTER(ChTimestepperTrapezoidalLinearized2)
 // Performs a step of trapezoidal implicit linearized for II order systems
 //*** SIMPLIFIED VERSION -DOES NOT WORK - PREFER ChTimestepperTrapezoidalLinearized
 void ChTimestepperTrapezoidalLinearized2::Advance(const double dt) {
+    CH_TRACE("ChTimestepperTrapezoidalLinearized2::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -811,6 +896,7 @@ void ChTimestepperNewmark::SetGammaBeta(double mgamma, double mbeta) {
 
 // Performs a step of Newmark constrained implicit for II order DAE systems
 void ChTimestepperNewmark::Advance(const double dt) {
+    CH_TRACE("ChTimestepperNewmark::Advance");
     // downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
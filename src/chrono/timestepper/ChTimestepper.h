@@ -16,6 +16,8 @@
 #define CHTIMESTEPPER_H
 
 #include <cstdlib>
+#include <vector>
+
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChMath.h"
 #include "chrono/core/ChVectorDynamic.h"
@@ -46,6 +48,7 @@ class ChApi ChTimestepper {
           EULER_EXPLICIT = 8,
           LEAPFROG = 9,
           NEWMARK = 10,
+          CENTRAL_DIFFERENCE = 11,
           CUSTOM = 20
       };
 
@@ -94,6 +97,14 @@ class ChApi ChTimestepper {
     /// Turn on/off clamping on the Qcterm.
     void SetQcClamping(double mcl) { Qc_clamping = mcl; }
 
+    /// Get the internal variables carried by the integrator from one step to the next, besides
+    /// the state of the integrable object (e.g. the current internal step size), as needed to
+    /// restart a simulation from a checkpoint. The default implementation has none.
+    virtual void GetHistory(std::vector<double>& history) const { history.clear(); }
+
+    /// Restore the internal variables obtained with GetHistory.
+    virtual void SetHistory(const std::vector<double>& history) {}
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& marchive);
 
@@ -376,6 +387,58 @@ class ChApi ChTimestepperLeapfrog : public ChTimestepperIIorder {
                          ) override;
 };
 
+/// Performs a step of the explicit central difference integrator with lumped mass,
+/// the usual choice for explicit FEA dynamics (impacts, wave propagation, crash).
+/// The lumped (diagonal) mass is assembled once via LoadLumpedMass_Md, so each step
+/// needs only one evaluation of F and no linear solver:
+///    a_n = Md^-1 * F(x_n, v_n-1/2, t_n),  v_n+1/2 = v_n-1/2 + a_n*dt,  x_n+1 = x_n + v_n+1/2*dt
+/// hence the speeds in the state are at half steps. This is stable only if the step is
+/// smaller than the critical step 2/w_max, estimated via ComputeCriticalTimeStep; if the
+/// step passed to Advance() is larger than the critical step times the Courant factor,
+/// it is automatically split in substeps.
+/// Constraints are not supported (use penalty, i.e. SMC, contacts).
+/// Note: if items are added or masses change after the first step, call ResetSetup().
+class ChApi ChTimestepperCentralDifference : public ChTimestepperIIorder {
+
+  protected:
+    ChVectorDynamic<> Md;     ///< lumped mass, diagonal
+    ChVectorDynamic<> Minv;   ///< inverse of lumped mass, diagonal
+    ChVectorDynamic<> R;      ///< force residual
+    double courant;           ///< safety factor on the critical step
+    double dt_crit;           ///< estimated critical step
+    int num_substeps;         ///< number of substeps taken in last Advance
+    bool setup_done;          ///< true if lumped mass and critical step are up to date
+
+  public:
+    /// Constructors (default empty)
+    ChTimestepperCentralDifference(ChIntegrableIIorder* mintegrable = nullptr)
+        : ChTimestepperIIorder(mintegrable),
+          courant(0.9),
+          dt_crit(std::numeric_limits<double>::max()),
+          num_substeps(1),
+          setup_done(false) {}
+
+    virtual Type GetType() const override { return Type::CENTRAL_DIFFERENCE; }
+
+    /// Set the safety factor applied to the critical time step, in (0,1]. Default 0.9.
+    void SetCourantFactor(double mc) { courant = ChMax(1e-6, ChMin(1.0, mc)); }
+    double GetCourantFactor() const { return courant; }
+
+    /// Get the critical time step estimated at setup (no limit if the integrable does not provide it).
+    double GetCriticalTimeStep() const { return dt_crit; }
+
+    /// Get the number of substeps taken in the last Advance.
+    int GetNumSubsteps() const { return num_substeps; }
+
+    /// Force the recomputation of the lumped mass and of the critical time step,
+    /// and the restart of the staggered speeds, at the next Advance.
+    void ResetSetup() { setup_done = false; }
+
+    /// Performs an integration timestep
+    virtual void Advance(const double dt  ///< timestep to advance
+                         ) override;
+};
+
 /// Performs a step of Euler implicit for II order systems.
 class ChApi ChTimestepperEulerImplicit : public ChTimestepperIIorder, public ChImplicitIterativeTimestepper {
 
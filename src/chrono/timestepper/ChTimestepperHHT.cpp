@@ -15,6 +15,7 @@
 #include <cmath>
 
 #include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 namespace chrono {
 
@@ -50,6 +51,7 @@ void ChTimestepperHHT::SetAlpha(double malpha) {
 
 // Performs a step of HHT (generalized alpha) implicit for II order systems
 void ChTimestepperHHT::Advance(const double dt) {
+    CH_TRACE("ChTimestepperHHT::Advance");
     // Downcast
     ChIntegrableIIorder* mintegrable = (ChIntegrableIIorder*)this->integrable;
 
@@ -238,6 +240,20 @@ void ChTimestepperHHT::Advance(const double dt) {
     mintegrable->StateScatterReactions(L);
 }
 
+// Internal variables carried between steps (used for step size control).
+void ChTimestepperHHT::GetHistory(std::vector<double>& history) const {
+    history.resize(2);
+    history[0] = h;
+    history[1] = num_successful_steps;
+}
+
+void ChTimestepperHHT::SetHistory(const std::vector<double>& history) {
+    if (history.size() != 2)
+        return;
+    h = history[0];
+    num_successful_steps = static_cast<int>(history[1]);
+}
+
 // Prepare attempting a step of size h (assuming a converged state at the current time t):
 // - Initialize residual vector with terms at current time
 // - Obtain a prediction at T+h for NR using extrapolation from solution at current time.
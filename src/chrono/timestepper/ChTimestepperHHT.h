@@ -122,6 +122,12 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     virtual void Advance(const double dt  ///< timestep to advance
                          ) override;
 
+    /// Get the internal step size and the count of successful steps (used for step size control).
+    virtual void GetHistory(std::vector<double>& history) const override;
+
+    /// Restore the internal step size and the count of successful steps.
+    virtual void SetHistory(const std::vector<double>& history) override;
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& marchive) override;
 
@@ -0,0 +1,257 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Infrastructure for performance benchmarks of simulation scenarios.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+#include "chrono/ChVersion.h"
+#include "chrono/core/ChTimer.h"
+#include "chrono/parallel/ChOpenMP.h"
+#include "chrono/utils/ChBenchmark.h"
+
+namespace chrono {
+namespace utils {
+
+ChBenchmarkTest::ChBenchmarkTest() {
+    ResetTimers();
+}
+
+void ChBenchmarkTest::ResetTimers() {
+    m_timer_total = 0;
+    m_timer_step = 0;
+    m_timer_collision_broad = 0;
+    m_timer_collision_narrow = 0;
+    m_timer_setup = 0;
+    m_timer_solver = 0;
+    m_timer_update = 0;
+}
+
+void ChBenchmarkTest::Simulate(int num_steps) {
+    ChTimer<double> timer;
+    for (int i = 0; i < num_steps; i++) {
+        timer.reset();
+        timer.start();
+        ExecuteStep();
+        timer.stop();
+        m_timer_total += timer();
+
+        // The system timers are reset at each step, so they hold the times of the last one.
+        if (ChSystem* system = GetSystem()) {
+            m_timer_step += system->GetTimerStep();
+            m_timer_collision_broad += system->GetTimerCollisionBroad();
+            m_timer_collision_narrow += system->GetTimerCollisionNarrow();
+            m_timer_setup += system->GetTimerSetup();
+            m_timer_solver += system->GetTimerSolver();
+            m_timer_update += system->GetTimerUpdate();
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+ChBenchmarkSuite& ChBenchmarkSuite::GetInstance() {
+    static ChBenchmarkSuite suite;
+    return suite;
+}
+
+bool ChBenchmarkSuite::Register(const std::string& name, Factory factory, int num_steps, int repetitions) {
+    Entry entry;
+    entry.name = name;
+    entry.factory = factory;
+    entry.num_steps = std::max(num_steps, 1);
+    entry.repetitions = std::max(repetitions, 1);
+    m_entries.push_back(entry);
+    return true;
+}
+
+std::vector<ChBenchmarkResult> ChBenchmarkSuite::Run(const std::string& filter, int repetitions, std::ostream& os) {
+    std::vector<ChBenchmarkResult> results;
+
+    for (const auto& entry : m_entries) {
+        if (!filter.empty() && entry.name.find(filter) == std::string::npos)
+            continue;
+
+        ChBenchmarkResult result;
+        result.name = entry.name;
+        result.num_steps = entry.num_steps;
+        result.repetitions = repetitions > 0 ? repetitions : entry.repetitions;
+        result.step = 0;
+        result.collision_broad = 0;
+        result.collision_narrow = 0;
+        result.setup = 0;
+        result.solver = 0;
+        result.update = 0;
+
+        // Each repetition runs on a new instance of the scenario; construction is not timed.
+        std::vector<double> times;
+        for (int r = 0; r < result.repetitions; r++) {
+            std::unique_ptr<ChBenchmarkTest> test(entry.factory());
+            test->Simulate(entry.num_steps);
+
+            times.push_back(test->m_timer_total / entry.num_steps);
+            result.step += test->m_timer_step;
+            result.collision_broad += test->m_timer_collision_broad;
+            result.collision_narrow += test->m_timer_collision_narrow;
+            result.setup += test->m_timer_setup;
+            result.solver += test->m_timer_solver;
+            result.update += test->m_timer_update;
+            for (const auto& c : test->m_counters)
+                result.counters[c.first] += c.second / result.repetitions;
+        }
+
+        double total_steps = (double)entry.num_steps * result.repetitions;
+        result.step /= total_steps;
+        result.collision_broad /= total_steps;
+        result.collision_narrow /= total_steps;
+        result.setup /= total_steps;
+        result.solver /= total_steps;
+        result.update /= total_steps;
+
+        double sum = 0;
+        for (auto t : times)
+            sum += t;
+        result.mean = sum / times.size();
+        result.min = *std::min_element(times.begin(), times.end());
+        result.max = *std::max_element(times.begin(), times.end());
+        double var = 0;
+        for (auto t : times)
+            var += (t - result.mean) * (t - result.mean);
+        result.stddev = times.size() > 1 ? std::sqrt(var / (times.size() - 1)) : 0;
+
+        os << std::left << std::setw(40) << result.name << std::right << std::setw(12) << std::setprecision(4)
+           << 1e3 * result.mean << " ms/step" << std::endl;
+
+        results.push_back(result);
+    }
+
+    return results;
+}
+
+int ChBenchmarkSuite::Main(int argc, char* argv[]) {
+    std::string filter;
+    std::string json_file;
+    int repetitions = 0;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg(argv[i]);
+        if (arg.compare(0, 9, "--filter=") == 0) {
+            filter = arg.substr(9);
+        } else if (arg.compare(0, 14, "--repetitions=") == 0) {
+            repetitions = std::atoi(arg.substr(14).c_str());
+        } else if (arg.compare(0, 7, "--json=") == 0) {
+            json_file = arg.substr(7);
+        } else if (arg == "--list") {
+            for (const auto& entry : m_entries)
+                std::cout << entry.name << std::endl;
+            return 0;
+        } else {
+            std::cerr << "Unknown option: " << arg << std::endl;
+            std::cerr << "Usage: " << argv[0] << " [--filter=<string>] [--repetitions=<n>] [--json=<filename>] [--list]"
+                      << std::endl;
+            return 1;
+        }
+    }
+
+    auto results = Run(filter, repetitions, std::cout);
+    std::cout << std::endl;
+    WriteReport(results, std::cout);
+
+    if (!json_file.empty()) {
+        std::ofstream ofile(json_file);
+        if (!ofile.is_open()) {
+            std::cerr << "Cannot open output file " << json_file << std::endl;
+            return 1;
+        }
+        WriteJSON(results, ofile);
+    }
+
+    return 0;
+}
+
+// -----------------------------------------------------------------------------
+
+void ChBenchmarkSuite::WriteReport(const std::vector<ChBenchmarkResult>& results, std::ostream& os) {
+    size_t width = 12;
+    for (const auto& r : results)
+        width = std::max(width, r.name.size() + 2);
+
+    os << std::left << std::setw(width) << "Benchmark" << std::right << std::setw(8) << "Steps" << std::setw(6)
+       << "Reps" << std::setw(11) << "Mean" << std::setw(11) << "Min" << std::setw(11) << "Max" << std::setw(11)
+       << "StdDev" << std::setw(11) << "Step" << std::setw(11) << "Broad" << std::setw(11) << "Narrow"
+       << std::setw(11) << "Setup" << std::setw(11) << "Solver" << std::setw(11) << "Update" << std::endl;
+    os << std::fixed << std::setprecision(4);
+    for (const auto& r : results) {
+        os << std::left << std::setw(width) << r.name << std::right << std::setw(8) << r.num_steps << std::setw(6)
+           << r.repetitions << std::setw(11) << 1e3 * r.mean << std::setw(11) << 1e3 * r.min << std::setw(11)
+           << 1e3 * r.max << std::setw(11) << 1e3 * r.stddev << std::setw(11) << 1e3 * r.step << std::setw(11)
+           << 1e3 * r.collision_broad << std::setw(11) << 1e3 * r.collision_narrow << std::setw(11) << 1e3 * r.setup
+           << std::setw(11) << 1e3 * r.solver << std::setw(11) << 1e3 * r.update << std::endl;
+        for (const auto& c : r.counters)
+            os << "    " << c.first << " = " << std::defaultfloat << c.second << std::fixed << std::endl;
+    }
+    os << std::defaultfloat << "(times per step, in ms)" << std::endl;
+}
+
+void ChBenchmarkSuite::WriteJSON(const std::vector<ChBenchmarkResult>& results, std::ostream& os) {
+    char date[64];
+    std::time_t now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+    os << std::setprecision(9);
+    os << "{\n";
+    os << "  \"context\": {\n";
+    os << "    \"date\": \"" << date << "\",\n";
+    os << "    \"chrono_version\": \"" << CHRONO_VERSION << "\",\n";
+    os << "    \"num_threads\": " << CHOMPfunctions::GetMaxThreads() << ",\n";
+    os << "    \"time_unit\": \"s\"\n";
+    os << "  },\n";
+    os << "  \"benchmarks\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto& r = results[i];
+        os << (i == 0 ? "\n" : ",\n");
+        os << "    {\n";
+        os << "      \"name\": \"" << r.name << "\",\n";
+        os << "      \"steps\": " << r.num_steps << ",\n";
+        os << "      \"repetitions\": " << r.repetitions << ",\n";
+        os << "      \"time_per_step\": " << r.mean << ",\n";
+        os << "      \"time_per_step_min\": " << r.min << ",\n";
+        os << "      \"time_per_step_max\": " << r.max << ",\n";
+        os << "      \"time_per_step_stddev\": " << r.stddev << ",\n";
+        os << "      \"phases\": {\"step\": " << r.step << ", \"collision_broad\": " << r.collision_broad
+           << ", \"collision_narrow\": " << r.collision_narrow << ", \"setup\": " << r.setup
+           << ", \"solver\": " << r.solver << ", \"update\": " << r.update << "},\n";
+        os << "      \"counters\": {";
+        bool first = true;
+        for (const auto& c : r.counters) {
+            os << (first ? "" : ", ") << "\"" << c.first << "\": " << c.second;
+            first = false;
+        }
+        os << "}\n";
+        os << "    }";
+    }
+    os << "\n  ]\n";
+    os << "}" << std::endl;
+}
+
+}  // end namespace utils
+}  // end namespace chrono
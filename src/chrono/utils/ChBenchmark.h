@@ -0,0 +1,163 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Infrastructure for performance benchmarks of simulation scenarios.
+//
+// A benchmark scenario is a class derived from ChBenchmarkTest which sets up a
+// system in its constructor and implements ExecuteStep(). Scenarios are
+// registered with the CH_BM_SIMULATION macro, with a fixed number of steps and
+// repetitions; each repetition runs on a freshly constructed scenario, so that
+// results are reproducible. For each benchmark, the time per step (mean, min,
+// max, and standard deviation over repetitions) is reported, together with the
+// breakdown over the phases timed by ChSystem and any scenario-specific
+// counters. Results can also be written in JSON format for regression tracking.
+//
+// A benchmark program is typically:
+//
+//   class MyTest : public utils::ChBenchmarkTest { ... };
+//   CH_BM_SIMULATION(MyBenchmark, MyTest, 100, 5);
+//   CH_BM_MAIN();
+//
+// and accepts the command line options
+//   --filter=<string>      run only benchmarks whose name contains the string
+//   --repetitions=<n>      override the number of repetitions
+//   --json=<filename>      also write the results in JSON format
+//   --list                 list the registered benchmarks and exit
+//
+// =============================================================================
+
+#ifndef CHBENCHMARK_H
+#define CHBENCHMARK_H
+
+#include <functional>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+namespace utils {
+
+/// Base class for a benchmark scenario.
+/// Derived classes construct the scenario in their constructor and implement ExecuteStep().
+class ChApi ChBenchmarkTest {
+  public:
+    ChBenchmarkTest();
+    virtual ~ChBenchmarkTest() {}
+
+    /// Advance the scenario by one step.
+    virtual void ExecuteStep() = 0;
+
+    /// Return the system whose phase timers are collected after each step.
+    /// Scenarios which do not advance a system may return nullptr.
+    virtual ChSystem* GetSystem() = 0;
+
+    /// Execute the specified number of steps, accumulating the wall clock time of
+    /// each step and the phase timers of the system.
+    void Simulate(int num_steps);
+
+    /// Reset all accumulated timers.
+    void ResetTimers();
+
+    double m_timer_total;             ///< total wall clock time spent in ExecuteStep [s]
+    double m_timer_step;              ///< total time of the system steps [s]
+    double m_timer_collision_broad;   ///< total time of the broad phase collision detection [s]
+    double m_timer_collision_narrow;  ///< total time of the narrow phase collision detection [s]
+    double m_timer_setup;             ///< total time of the solver setup [s]
+    double m_timer_solver;            ///< total time of the solver [s]
+    double m_timer_update;            ///< total time of the system updates [s]
+
+    /// Scenario-specific counters (e.g. number of contacts, bytes processed), reported with the results.
+    std::map<std::string, double> m_counters;
+};
+
+/// Results of a benchmark, over all repetitions.
+/// Times are per step, in seconds.
+struct ChBenchmarkResult {
+    std::string name;      ///< benchmark name
+    int num_steps;         ///< number of steps per repetition
+    int repetitions;       ///< number of repetitions
+    double mean;           ///< mean time per step
+    double min;            ///< minimum (over repetitions) time per step
+    double max;            ///< maximum (over repetitions) time per step
+    double stddev;         ///< standard deviation (over repetitions) of the time per step
+    double step;           ///< mean time per system step
+    double collision_broad;   ///< mean time per step for the broad phase
+    double collision_narrow;  ///< mean time per step for the narrow phase
+    double setup;             ///< mean time per step for the solver setup
+    double solver;            ///< mean time per step for the solver
+    double update;            ///< mean time per step for the system updates
+    std::map<std::string, double> counters;  ///< scenario counters (mean over repetitions)
+};
+
+/// Registry and driver for benchmarks.
+class ChApi ChBenchmarkSuite {
+  public:
+    typedef std::function<ChBenchmarkTest*()> Factory;
+
+    /// Return the suite of the benchmarks registered in this program.
+    static ChBenchmarkSuite& GetInstance();
+
+    /// Register a benchmark running the specified number of steps in each repetition.
+    /// Always returns true (for use in static initializers).
+    bool Register(const std::string& name, Factory factory, int num_steps, int repetitions);
+
+    /// Run all benchmarks whose name contains the specified string (all if empty).
+    /// If repetitions is positive, it overrides the registered number of repetitions.
+    /// A one-line summary of each benchmark is written to the specified stream as it completes.
+    std::vector<ChBenchmarkResult> Run(const std::string& filter, int repetitions, std::ostream& os);
+
+    /// Parse the command line options, run the selected benchmarks, and write the results.
+    /// Return 0 on success, 1 if the command line is invalid.
+    int Main(int argc, char* argv[]);
+
+    /// Write a table with the results (times in milliseconds).
+    static void WriteReport(const std::vector<ChBenchmarkResult>& results, std::ostream& os);
+
+    /// Write the results in JSON format (times in seconds).
+    static void WriteJSON(const std::vector<ChBenchmarkResult>& results, std::ostream& os);
+
+  private:
+    struct Entry {
+        std::string name;
+        Factory factory;
+        int num_steps;
+        int repetitions;
+    };
+
+    std::vector<Entry> m_entries;
+};
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#define CH_BM_CONCAT_(a, b) a##b
+#define CH_BM_CONCAT(a, b) CH_BM_CONCAT_(a, b)
+
+/// Register a benchmark with the specified name, running the scenario TEST (a class
+/// derived from ChBenchmarkTest, default constructible) for SIM_STEPS steps in each
+/// of REPETITIONS repetitions.
+#define CH_BM_SIMULATION(NAME, TEST, SIM_STEPS, REPETITIONS)                                       \
+    static bool CH_BM_CONCAT(ch_bm_registered_, NAME) =                                           \
+        ::chrono::utils::ChBenchmarkSuite::GetInstance().Register(                                \
+            #NAME, []() -> ::chrono::utils::ChBenchmarkTest* { return new TEST(); }, SIM_STEPS, REPETITIONS)
+
+/// Define the main function of a benchmark program.
+#define CH_BM_MAIN()                                                           \
+    int main(int argc, char* argv[]) {                                         \
+        return ::chrono::utils::ChBenchmarkSuite::GetInstance().Main(argc, argv); \
+    }
+
+#endif
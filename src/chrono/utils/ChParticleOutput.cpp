@@ -0,0 +1,832 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Compact binary output of the bodies of particle-heavy simulations.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+#include "chrono/assets/ChBoxShape.h"
+#include "chrono/assets/ChCapsuleShape.h"
+#include "chrono/assets/ChColorAsset.h"
+#include "chrono/assets/ChConeShape.h"
+#include "chrono/assets/ChEllipsoidShape.h"
+#include "chrono/assets/ChSphereShape.h"
+#include "chrono/core/ChException.h"
+#include "chrono/parallel/ChTaskScheduler.h"
+#include "chrono/utils/ChParticleOutput.h"
+#include "chrono/utils/ChUtilsInputOutput.h"
+
+namespace chrono {
+namespace utils {
+
+namespace {
+
+const char particle_file_tag[8] = {'C', 'H', 'P', 'A', 'R', 'T', 'B', '1'};
+const char particle_frame_tag[4] = {'C', 'H', 'P', 'F'};
+const uint32_t particle_file_version = 1;
+const uint32_t particle_file_byte_order = 0x01020304;
+const uint32_t particle_frame_keyframe = 1;
+
+struct FileHeader {
+    char tag[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint32_t fields;
+    uint32_t keyframe_interval;
+    double resolution;
+};
+
+struct FrameHeader {
+    char tag[4];
+    uint32_t flags;
+    uint64_t size;
+    uint64_t num_particles;
+    double time;
+};
+
+// Shape types, with the values used by WriteShapesPovray.
+enum ParticleShapeType { SHAPE_SPHERE = 0, SHAPE_ELLIPSOID = 1, SHAPE_BOX = 2, SHAPE_CAPSULE = 7, SHAPE_CONE = 8 };
+
+// Size of a stored shape: type (int8), dimensions and color (6 floats).
+const size_t shape_size = 1 + 6 * sizeof(float);
+
+// -----------------------------------------------------------------------------
+// Variable-length integers (7 bits per byte) of zigzag-mapped differences.
+
+inline uint64_t ZigZag(int64_t v) {
+    return ((uint64_t)v << 1) ^ (uint64_t)(v >> 63);
+}
+
+inline int64_t UnZigZag(uint64_t u) {
+    return (int64_t)(u >> 1) ^ -(int64_t)(u & 1);
+}
+
+inline void PutVarint(std::vector<char>& buffer, uint64_t u) {
+    while (u >= 0x80) {
+        buffer.push_back((char)(u | 0x80));
+        u >>= 7;
+    }
+    buffer.push_back((char)u);
+}
+
+inline uint64_t GetVarint(const char*& ptr, const char* end) {
+    uint64_t u = 0;
+    for (int shift = 0; ptr < end && shift < 64; shift += 7) {
+        uint8_t byte = (uint8_t)*ptr++;
+        u |= (uint64_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+            return u;
+    }
+    throw ChException("ERROR in particle output file, invalid column data.\n");
+}
+
+template <typename T>
+inline void PutRaw(std::vector<char>& buffer, const T* data, size_t count) {
+    size_t offset = buffer.size();
+    buffer.resize(offset + count * sizeof(T));
+    std::memcpy(buffer.data() + offset, data, count * sizeof(T));
+}
+
+// A column is stored as its size in bytes, followed by the data.
+inline size_t BeginColumn(std::vector<char>& buffer) {
+    size_t offset = buffer.size();
+    buffer.resize(offset + sizeof(uint64_t));
+    return offset;
+}
+
+inline void EndColumn(std::vector<char>& buffer, size_t offset) {
+    uint64_t size = buffer.size() - offset - sizeof(uint64_t);
+    std::memcpy(buffer.data() + offset, &size, sizeof(size));
+}
+
+// Return the data range of the next column and advance past it.
+inline const char* NextColumn(const char*& ptr, const char* end, const char*& column_end) {
+    uint64_t size;
+    if (end - ptr < (ptrdiff_t)sizeof(size))
+        throw ChException("ERROR in particle output file, invalid frame data.\n");
+    std::memcpy(&size, ptr, sizeof(size));
+    ptr += sizeof(size);
+    if ((uint64_t)(end - ptr) < size)
+        throw ChException("ERROR in particle output file, invalid frame data.\n");
+    const char* column = ptr;
+    ptr += size;
+    column_end = ptr;
+    return column;
+}
+
+// -----------------------------------------------------------------------------
+// Rotations: smallest-three encoding. The largest component (in absolute value)
+// is dropped and made positive by changing the sign of the quaternion; the other
+// three, in [-1/sqrt(2), 1/sqrt(2)], are quantized on 10 bits each.
+
+const double quat_range = 0.70710678118654752;
+
+inline uint32_t EncodeQuaternion(const ChQuaternion<>& q) {
+    double c[4] = {q.e0(), q.e1(), q.e2(), q.e3()};
+    int largest = 0;
+    for (int i = 1; i < 4; i++) {
+        if (std::abs(c[i]) > std::abs(c[largest]))
+            largest = i;
+    }
+    double sign = c[largest] < 0 ? -1 : 1;
+    double norm = std::sqrt(c[0] * c[0] + c[1] * c[1] + c[2] * c[2] + c[3] * c[3]);
+    if (norm == 0)
+        return 0;
+
+    uint32_t word = (uint32_t)largest << 30;
+    int shift = 20;
+    for (int i = 0; i < 4; i++) {
+        if (i == largest)
+            continue;
+        double v = sign * c[i] / norm;
+        long k = std::lround((v / quat_range + 1) * 0.5 * 1023);
+        word |= (uint32_t)std::min(std::max(k, 0L), 1023L) << shift;
+        shift -= 10;
+    }
+    return word;
+}
+
+inline ChQuaternion<> DecodeQuaternion(uint32_t word) {
+    int largest = (int)(word >> 30);
+    double c[4];
+    double sum = 0;
+    int shift = 20;
+    for (int i = 0; i < 4; i++) {
+        if (i == largest)
+            continue;
+        c[i] = (((word >> shift) & 0x3FF) / 1023.0 * 2 - 1) * quat_range;
+        sum += c[i] * c[i];
+        shift -= 10;
+    }
+    c[largest] = std::sqrt(std::max(0.0, 1 - sum));
+    ChQuaternion<> q(c[0], c[1], c[2], c[3]);
+    q.Normalize();
+    return q;
+}
+
+// First supported visualization shape of a body, and its color.
+ChParticleShape GetShape(ChBody& body) {
+    ChParticleShape shape;
+    shape.type = -1;
+    shape.dims[0] = shape.dims[1] = shape.dims[2] = 0;
+    shape.color = ChColor(0.8f, 0.8f, 0.8f);
+
+    bool found = false;
+    for (auto asset : body.GetAssets()) {
+        if (auto color_asset = std::dynamic_pointer_cast<ChColorAsset>(asset)) {
+            shape.color = color_asset->GetColor();
+        } else if (found) {
+            continue;
+        } else if (auto sphere = std::dynamic_pointer_cast<ChSphereShape>(asset)) {
+            shape.type = SHAPE_SPHERE;
+            shape.dims[0] = (float)sphere->GetSphereGeometry().rad;
+            found = true;
+        } else if (auto ellipsoid = std::dynamic_pointer_cast<ChEllipsoidShape>(asset)) {
+            const ChVector<>& size = ellipsoid->GetEllipsoidGeometry().rad;
+            shape.type = SHAPE_ELLIPSOID;
+            shape.dims[0] = (float)size.x();
+            shape.dims[1] = (float)size.y();
+            shape.dims[2] = (float)size.z();
+            found = true;
+        } else if (auto box = std::dynamic_pointer_cast<ChBoxShape>(asset)) {
+            const ChVector<>& size = box->GetBoxGeometry().Size;
+            shape.type = SHAPE_BOX;
+            shape.dims[0] = (float)size.x();
+            shape.dims[1] = (float)size.y();
+            shape.dims[2] = (float)size.z();
+            found = true;
+        } else if (auto capsule = std::dynamic_pointer_cast<ChCapsuleShape>(asset)) {
+            shape.type = SHAPE_CAPSULE;
+            shape.dims[0] = (float)capsule->GetCapsuleGeometry().rad;
+            shape.dims[1] = (float)capsule->GetCapsuleGeometry().hlen;
+            found = true;
+        } else if (auto cone = std::dynamic_pointer_cast<ChConeShape>(asset)) {
+            shape.type = SHAPE_CONE;
+            shape.dims[0] = (float)cone->GetConeGeometry().rad.x();
+            shape.dims[1] = (float)cone->GetConeGeometry().rad.y();
+            found = true;
+        }
+    }
+
+    return shape;
+}
+
+// Number of dimensions written by WriteShapesPovray for a shape type.
+int NumShapeDims(int type) {
+    switch (type) {
+        case SHAPE_SPHERE:
+            return 1;
+        case SHAPE_ELLIPSOID:
+        case SHAPE_BOX:
+            return 3;
+        case SHAPE_CAPSULE:
+        case SHAPE_CONE:
+            return 2;
+        default:
+            return 0;
+    }
+}
+
+}  // end anonymous namespace
+
+// -----------------------------------------------------------------------------
+// ChParticleWriter
+// -----------------------------------------------------------------------------
+
+// State of the bodies for one frame, in columns. Identifiers and shapes are
+// only gathered for key frames.
+struct ChParticleWriter::Frame {
+    double time;
+    bool keyframe;
+    size_t count;
+    size_t bytes;
+    std::vector<int> identifiers;
+    std::vector<char> active;
+    std::vector<int64_t> pos;
+    std::vector<uint32_t> rot;
+    std::vector<float> vel;
+    std::vector<float> wvel;
+    std::vector<ChParticleShape> shapes;
+};
+
+ChParticleWriter::ChParticleWriter(const std::string& filename,
+                                   int fields,
+                                   double resolution,
+                                   int keyframe_interval,
+                                   size_t max_buffered)
+    : m_fields(fields & PARTICLE_ALL),
+      m_resolution(resolution),
+      m_keyframe_interval(std::max(keyframe_interval, 1)),
+      m_max_buffered(max_buffered),
+      m_num_frames(0),
+      m_last_count(0),
+      m_buffered(0),
+      m_closing(false),
+      m_num_bytes(0) {
+    if (!(resolution > 0))
+        throw ChException("ERROR in particle output, the position resolution must be positive.\n");
+
+    m_file.open(filename, std::ios::binary);
+    if (!m_file.good())
+        throw ChException("ERROR opening particle output file for writing: " + filename + "\n");
+
+    FileHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.tag, particle_file_tag, sizeof(header.tag));
+    header.version = particle_file_version;
+    header.byte_order = particle_file_byte_order;
+    header.fields = (uint32_t)m_fields;
+    header.keyframe_interval = (uint32_t)m_keyframe_interval;
+    header.resolution = m_resolution;
+    m_file.write((const char*)&header, sizeof(header));
+    if (!m_file.good())
+        throw ChException("ERROR writing particle output file: " + filename + "\n");
+    m_num_bytes = sizeof(header);
+
+    m_thread = std::thread(&ChParticleWriter::WriterLoop, this);
+}
+
+ChParticleWriter::~ChParticleWriter() {
+    try {
+        Close();
+    } catch (...) {
+    }
+}
+
+void ChParticleWriter::WriteFrame(ChSystem* system, bool active_only) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_error)
+            std::rethrow_exception(m_error);
+        if (m_closing)
+            throw ChException("ERROR in particle output, the file is closed.\n");
+    }
+
+    std::vector<ChBody*> bodies;
+    bodies.reserve(system->Get_bodylist().size());
+    for (auto& body : system->Get_bodylist()) {
+        if (!active_only || body->IsActive())
+            bodies.push_back(body.get());
+    }
+
+    size_t n = bodies.size();
+    std::unique_ptr<Frame> frame(new Frame);
+    frame->time = system->GetChTime();
+    frame->count = n;
+    frame->pos.resize(3 * n);
+    if (m_fields & PARTICLE_ACTIVE)
+        frame->active.resize(n);
+    if (m_fields & PARTICLE_ROTATION)
+        frame->rot.resize(n);
+    if (m_fields & PARTICLE_LIN_VEL)
+        frame->vel.resize(3 * n);
+    if (m_fields & PARTICLE_ANG_VEL)
+        frame->wvel.resize(3 * n);
+    std::vector<int> identifiers(n);
+
+    double scale = 1 / m_resolution;
+    ChTaskScheduler::GetInstance().ParallelFor(0, (int)n, [&](int first, int last) {
+        for (int i = first; i < last; i++) {
+            ChBody* body = bodies[i];
+            identifiers[i] = body->GetIdentifier();
+            const ChVector<>& pos = body->GetPos();
+            frame->pos[i] = std::llround(pos.x() * scale);
+            frame->pos[n + i] = std::llround(pos.y() * scale);
+            frame->pos[2 * n + i] = std::llround(pos.z() * scale);
+            if (m_fields & PARTICLE_ACTIVE)
+                frame->active[i] = body->IsActive() ? 1 : 0;
+            if (m_fields & PARTICLE_ROTATION)
+                frame->rot[i] = EncodeQuaternion(body->GetRot());
+            if (m_fields & PARTICLE_LIN_VEL) {
+                const ChVector<>& vel = body->GetPos_dt();
+                frame->vel[i] = (float)vel.x();
+                frame->vel[n + i] = (float)vel.y();
+                frame->vel[2 * n + i] = (float)vel.z();
+            }
+            if (m_fields & PARTICLE_ANG_VEL) {
+                const ChVector<>& wvel = body->GetWvel_loc();
+                frame->wvel[i] = (float)wvel.x();
+                frame->wvel[n + i] = (float)wvel.y();
+                frame->wvel[2 * n + i] = (float)wvel.z();
+            }
+        }
+    });
+
+    // The positions of a frame are encoded relative to those of the previous frame,
+    // which requires the same particles, in the same order.
+    frame->keyframe =
+        (m_num_frames % m_keyframe_interval == 0) || n != m_last_count || identifiers != m_last_identifiers;
+    if (frame->keyframe) {
+        if (m_fields & PARTICLE_IDENTIFIER)
+            frame->identifiers = identifiers;
+        if (m_fields & PARTICLE_SHAPE) {
+            frame->shapes.resize(n);
+            ChTaskScheduler::GetInstance().ParallelFor(0, (int)n, [&](int first, int last) {
+                for (int i = first; i < last; i++)
+                    frame->shapes[i] = GetShape(*bodies[i]);
+            });
+        }
+    }
+    m_last_count = n;
+    m_last_identifiers.swap(identifiers);
+
+    frame->bytes = sizeof(Frame) + frame->identifiers.size() * sizeof(int) + frame->active.size() +
+                   frame->pos.size() * sizeof(int64_t) + frame->rot.size() * sizeof(uint32_t) +
+                   (frame->vel.size() + frame->wvel.size()) * sizeof(float) +
+                   frame->shapes.size() * sizeof(ChParticleShape);
+
+    // Wait for room in the queue (a single frame is always accepted).
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cond.wait(lock, [&]() { return m_error || m_queue.empty() || m_buffered + frame->bytes <= m_max_buffered; });
+    if (m_error)
+        std::rethrow_exception(m_error);
+    m_buffered += frame->bytes;
+    m_queue.push_back(std::move(frame));
+    m_num_frames++;
+    lock.unlock();
+    m_cond.notify_all();
+}
+
+void ChParticleWriter::Close() {
+    if (m_thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_closing = true;
+        }
+        m_cond.notify_all();
+        m_thread.join();
+        m_file.close();
+    }
+
+    std::exception_ptr error;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::swap(error, m_error);
+    }
+    if (error)
+        std::rethrow_exception(error);
+}
+
+void ChParticleWriter::WriterLoop() {
+    std::vector<char> buffer;
+
+    while (true) {
+        Frame* frame;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cond.wait(lock, [this]() { return m_closing || !m_queue.empty(); });
+            if (m_queue.empty())
+                return;
+            frame = m_queue.front().get();
+        }
+
+        try {
+            Encode(*frame, buffer);
+            m_file.write(buffer.data(), buffer.size());
+            if (!m_file.good())
+                throw ChException("ERROR writing particle output file.\n");
+            m_num_bytes += buffer.size();
+        } catch (...) {
+            // Drop the pending frames; the error is reported to the caller.
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_error = std::current_exception();
+            m_queue.clear();
+            m_buffered = 0;
+            m_cond.notify_all();
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_buffered -= frame->bytes;
+            m_queue.pop_front();
+        }
+        m_cond.notify_all();
+    }
+}
+
+void ChParticleWriter::Encode(Frame& frame, std::vector<char>& buffer) {
+    size_t n = frame.count;
+
+    FrameHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.tag, particle_frame_tag, sizeof(header.tag));
+    header.flags = frame.keyframe ? particle_frame_keyframe : 0;
+    header.num_particles = n;
+    header.time = frame.time;
+
+    buffer.clear();
+    buffer.reserve(sizeof(header) + n * 32);
+    buffer.resize(sizeof(header));
+
+    if (frame.keyframe && (m_fields & PARTICLE_IDENTIFIER)) {
+        size_t column = BeginColumn(buffer);
+        int64_t previous = 0;
+        for (size_t i = 0; i < n; i++) {
+            PutVarint(buffer, ZigZag(frame.identifiers[i] - previous));
+            previous = frame.identifiers[i];
+        }
+        EndColumn(buffer, column);
+    }
+
+    if (m_fields & PARTICLE_ACTIVE) {
+        size_t column = BeginColumn(buffer);
+        size_t offset = buffer.size();
+        buffer.resize(offset + (n + 7) / 8, 0);
+        for (size_t i = 0; i < n; i++) {
+            if (frame.active[i])
+                buffer[offset + i / 8] |= (char)(1 << (i % 8));
+        }
+        EndColumn(buffer, column);
+    }
+
+    // Key frames: differences between consecutive particles; other frames: differences
+    // from the previous frame.
+    for (size_t c = 0; c < 3; c++) {
+        size_t column = BeginColumn(buffer);
+        const int64_t* pos = &frame.pos[c * n];
+        if (frame.keyframe) {
+            int64_t previous = 0;
+            for (size_t i = 0; i < n; i++) {
+                PutVarint(buffer, ZigZag(pos[i] - previous));
+                previous = pos[i];
+            }
+        } else {
+            const int64_t* previous = &m_previous[c * n];
+            for (size_t i = 0; i < n; i++)
+                PutVarint(buffer, ZigZag(pos[i] - previous[i]));
+        }
+        EndColumn(buffer, column);
+    }
+    m_previous.swap(frame.pos);
+
+    if (m_fields & PARTICLE_ROTATION) {
+        size_t column = BeginColumn(buffer);
+        PutRaw(buffer, frame.rot.data(), n);
+        EndColumn(buffer, column);
+    }
+
+    if (m_fields & PARTICLE_LIN_VEL) {
+        size_t column = BeginColumn(buffer);
+        PutRaw(buffer, frame.vel.data(), 3 * n);
+        EndColumn(buffer, column);
+    }
+
+    if (m_fields & PARTICLE_ANG_VEL) {
+        size_t column = BeginColumn(buffer);
+        PutRaw(buffer, frame.wvel.data(), 3 * n);
+        EndColumn(buffer, column);
+    }
+
+    if (frame.keyframe && (m_fields & PARTICLE_SHAPE)) {
+        size_t column = BeginColumn(buffer);
+        for (const auto& shape : frame.shapes) {
+            buffer.push_back((char)shape.type);
+            float data[6] = {shape.dims[0], shape.dims[1], shape.dims[2],
+                             shape.color.R,  shape.color.G,  shape.color.B};
+            PutRaw(buffer, data, 6);
+        }
+        EndColumn(buffer, column);
+    }
+
+    header.size = buffer.size() - sizeof(header);
+    std::memcpy(buffer.data(), &header, sizeof(header));
+}
+
+// -----------------------------------------------------------------------------
+// ChParticleReader
+// -----------------------------------------------------------------------------
+
+ChParticleReader::ChParticleReader(const std::string& filename) : m_filename(filename) {
+    m_file.open(filename, std::ios::binary | std::ios::ate);
+    if (!m_file.good())
+        throw ChException("ERROR opening particle output file: " + filename + "\n");
+    uint64_t file_size = (uint64_t)m_file.tellg();
+    m_file.seekg(0, std::ios::beg);
+
+    FileHeader header;
+    if (file_size < sizeof(header) || !m_file.read((char*)&header, sizeof(header)))
+        throw ChException("ERROR in particle output file, unexpected end of file: " + filename + "\n");
+    if (std::memcmp(header.tag, particle_file_tag, sizeof(header.tag)) != 0 ||
+        header.version != particle_file_version || header.byte_order != particle_file_byte_order)
+        throw ChException("ERROR in particle output file, unsupported format: " + filename + "\n");
+    m_fields = (int)header.fields;
+    m_resolution = header.resolution;
+
+    // Index the frames, stopping at an incomplete one.
+    uint64_t offset = sizeof(header);
+    while (offset + sizeof(FrameHeader) <= file_size) {
+        FrameHeader frame_header;
+        m_file.seekg(offset, std::ios::beg);
+        if (!m_file.read((char*)&frame_header, sizeof(frame_header)))
+            break;
+        if (std::memcmp(frame_header.tag, particle_frame_tag, sizeof(frame_header.tag)) != 0)
+            throw ChException("ERROR in particle output file, invalid frame: " + filename + "\n");
+        if (offset + sizeof(frame_header) + frame_header.size > file_size)
+            break;
+
+        FrameInfo info;
+        info.offset = offset + sizeof(frame_header);
+        info.size = frame_header.size;
+        info.num_particles = frame_header.num_particles;
+        info.time = frame_header.time;
+        info.keyframe = (frame_header.flags & particle_frame_keyframe) != 0;
+        m_frames.push_back(info);
+
+        offset = info.offset + info.size;
+    }
+    m_file.clear();
+
+    if (!m_frames.empty() && !m_frames[0].keyframe)
+        throw ChException("ERROR in particle output file, missing key frame: " + filename + "\n");
+    m_current = m_frames.size();
+}
+
+void ChParticleReader::ReadFrame(size_t frame, ChParticleFrame& data, int fields) {
+    if (frame >= m_frames.size())
+        throw ChException("ERROR in particle output file, invalid frame number: " + m_filename + "\n");
+
+    // Decode from the previous key frame, or continue from the last decoded frame.
+    size_t start = frame;
+    while (!m_frames[start].keyframe)
+        start--;
+    if (m_current < m_frames.size() && m_current >= start && m_current < frame)
+        start = m_current + 1;
+
+    for (size_t f = start; f < frame; f++)
+        Decode(f, nullptr, 0);
+    Decode(frame, &data, fields);
+}
+
+void ChParticleReader::Decode(size_t frame, ChParticleFrame* data, int fields) {
+    const FrameInfo& info = m_frames[frame];
+    size_t n = (size_t)info.num_particles;
+
+    // A frame that is not a key frame has the particles of the previous one.
+    if (!info.keyframe && m_previous.size() != 3 * n)
+        throw ChException("ERROR in particle output file, invalid frame data: " + m_filename + "\n");
+
+    m_buffer.resize((size_t)info.size);
+    m_file.seekg(info.offset, std::ios::beg);
+    if (!m_file.read(m_buffer.data(), m_buffer.size()))
+        throw ChException("ERROR reading particle output file: " + m_filename + "\n");
+    const char* ptr = m_buffer.data();
+    const char* end = ptr + m_buffer.size();
+    const char* column_end;
+
+    fields &= m_fields;
+    m_current = m_frames.size();
+
+    if (info.keyframe) {
+        m_identifiers.clear();
+        m_shapes.clear();
+    }
+
+    if (info.keyframe && (m_fields & PARTICLE_IDENTIFIER)) {
+        const char* p = NextColumn(ptr, end, column_end);
+        m_identifiers.resize(n);
+        int64_t previous = 0;
+        for (size_t i = 0; i < n; i++) {
+            previous += UnZigZag(GetVarint(p, column_end));
+            m_identifiers[i] = (int)previous;
+        }
+    }
+
+    if (m_fields & PARTICLE_ACTIVE) {
+        const char* p = NextColumn(ptr, end, column_end);
+        if (data && (fields & PARTICLE_ACTIVE)) {
+            if ((size_t)(column_end - p) < (n + 7) / 8)
+                throw ChException("ERROR in particle output file, invalid frame data: " + m_filename + "\n");
+            data->active.resize(n);
+            for (size_t i = 0; i < n; i++)
+                data->active[i] = (p[i / 8] >> (i % 8)) & 1;
+        }
+    }
+
+    m_previous.resize(3 * n);
+    for (size_t c = 0; c < 3; c++) {
+        const char* p = NextColumn(ptr, end, column_end);
+        int64_t* pos = &m_previous[c * n];
+        if (info.keyframe) {
+            int64_t previous = 0;
+            for (size_t i = 0; i < n; i++) {
+                previous += UnZigZag(GetVarint(p, column_end));
+                pos[i] = previous;
+            }
+        } else {
+            for (size_t i = 0; i < n; i++)
+                pos[i] += UnZigZag(GetVarint(p, column_end));
+        }
+    }
+
+    const char* rot = nullptr;
+    const char* vel = nullptr;
+    const char* wvel = nullptr;
+    if (m_fields & PARTICLE_ROTATION) {
+        rot = NextColumn(ptr, end, column_end);
+        if ((size_t)(column_end - rot) != n * sizeof(uint32_t))
+            throw ChException("ERROR in particle output file, invalid frame data: " + m_filename + "\n");
+    }
+    if (m_fields & PARTICLE_LIN_VEL) {
+        vel = NextColumn(ptr, end, column_end);
+        if ((size_t)(column_end - vel) != 3 * n * sizeof(float))
+            throw ChException("ERROR in particle output file, invalid frame data: " + m_filename + "\n");
+    }
+    if (m_fields & PARTICLE_ANG_VEL) {
+        wvel = NextColumn(ptr, end, column_end);
+        if ((size_t)(column_end - wvel) != 3 * n * sizeof(float))
+            throw ChException("ERROR in particle output file, invalid frame data: " + m_filename + "\n");
+    }
+
+    if (info.keyframe && (m_fields & PARTICLE_SHAPE)) {
+        const char* p = NextColumn(ptr, end, column_end);
+        if ((size_t)(column_end - p) != n * shape_size)
+            throw ChException("ERROR in particle output file, invalid frame data: " + m_filename + "\n");
+        m_shapes.resize(n);
+        for (size_t i = 0; i < n; i++, p += shape_size) {
+            float values[6];
+            std::memcpy(values, p + 1, sizeof(values));
+            m_shapes[i].type = (signed char)p[0];
+            m_shapes[i].dims[0] = values[0];
+            m_shapes[i].dims[1] = values[1];
+            m_shapes[i].dims[2] = values[2];
+            m_shapes[i].color = ChColor(values[3], values[4], values[5]);
+        }
+    }
+
+    m_current = frame;
+    if (!data)
+        return;
+
+    data->time = info.time;
+    data->pos.resize(n);
+    for (size_t i = 0; i < n; i++) {
+        data->pos[i] = ChVector<>(m_previous[i] * m_resolution, m_previous[n + i] * m_resolution,
+                                  m_previous[2 * n + i] * m_resolution);
+    }
+
+    if (fields & PARTICLE_IDENTIFIER)
+        data->identifiers = m_identifiers;
+    else
+        data->identifiers.clear();
+    if (!(fields & PARTICLE_ACTIVE))
+        data->active.clear();
+
+    data->rot.clear();
+    if (fields & PARTICLE_ROTATION) {
+        data->rot.resize(n);
+        for (size_t i = 0; i < n; i++) {
+            uint32_t word;
+            std::memcpy(&word, rot + i * sizeof(word), sizeof(word));
+            data->rot[i] = DecodeQuaternion(word);
+        }
+    }
+
+    const char* vectors[2] = {vel, wvel};
+    std::vector<ChVector<>>* outputs[2] = {&data->vel, &data->wvel};
+    int flags[2] = {PARTICLE_LIN_VEL, PARTICLE_ANG_VEL};
+    for (int k = 0; k < 2; k++) {
+        outputs[k]->clear();
+        if (!(fields & flags[k]))
+            continue;
+        std::vector<float> values(3 * n);
+        std::memcpy(values.data(), vectors[k], values.size() * sizeof(float));
+        outputs[k]->resize(n);
+        for (size_t i = 0; i < n; i++)
+            (*outputs[k])[i] = ChVector<>(values[i], values[n + i], values[2 * n + i]);
+    }
+
+    if (fields & PARTICLE_SHAPE)
+        data->shapes = m_shapes;
+    else
+        data->shapes.clear();
+}
+
+// -----------------------------------------------------------------------------
+// Conversion to the CSV output files
+// -----------------------------------------------------------------------------
+
+void WriteParticlesCSV(const ChParticleFrame& frame, const std::string& filename, bool dump_vel, const std::string& delim) {
+    CSV_writer csv(delim);
+
+    for (size_t i = 0; i < frame.GetNumParticles(); i++) {
+        csv << frame.pos[i] << (frame.rot.empty() ? QUNIT : frame.rot[i]);
+        if (dump_vel && (!frame.vel.empty() || !frame.wvel.empty()))
+            csv << (frame.vel.empty() ? VNULL : frame.vel[i]) << (frame.wvel.empty() ? VNULL : frame.wvel[i]);
+        csv << std::endl;
+    }
+
+    csv.write_to_file(filename);
+}
+
+void WriteParticlesPovray(const ChParticleFrame& frame,
+                          const std::string& filename,
+                          bool body_info,
+                          const std::string& delim) {
+    CSV_writer csv(delim);
+    size_t n = frame.GetNumParticles();
+
+    int b_count = 0;
+    if (body_info) {
+        for (size_t i = 0; i < n; i++) {
+            csv << (frame.identifiers.empty() ? 0 : frame.identifiers[i])
+                << (frame.active.empty() ? true : frame.active[i] != 0) << frame.pos[i]
+                << (frame.rot.empty() ? QUNIT : frame.rot[i]) << std::endl;
+            b_count++;
+        }
+    }
+
+    int a_count = 0;
+    for (size_t i = 0; i < frame.shapes.size(); i++) {
+        const ChParticleShape& shape = frame.shapes[i];
+        if (shape.type < 0)
+            continue;
+        csv << (frame.identifiers.empty() ? 0 : frame.identifiers[i])
+            << (frame.active.empty() ? true : frame.active[i] != 0) << frame.pos[i]
+            << (frame.rot.empty() ? QUNIT : frame.rot[i]) << shape.color << shape.type;
+        for (int k = 0; k < NumShapeDims(shape.type); k++)
+            csv << shape.dims[k];
+        csv << std::endl;
+        a_count++;
+    }
+
+    std::stringstream header;
+    header << b_count << delim << a_count << delim << 0 << delim << std::endl;
+
+    csv.write_to_file(filename, header.str());
+}
+
+size_t ConvertParticleOutput(const std::string& filename, const std::string& prefix, bool povray) {
+    ChParticleReader reader(filename);
+    ChParticleFrame frame;
+
+    for (size_t f = 0; f < reader.GetNumFrames(); f++) {
+        reader.ReadFrame(f, frame);
+        std::ostringstream out_filename;
+        out_filename << prefix << "_" << std::setw(4) << std::setfill('0') << f << ".dat";
+        if (povray)
+            WriteParticlesPovray(frame, out_filename.str());
+        else
+            WriteParticlesCSV(frame, out_filename.str(), true);
+    }
+
+    return reader.GetNumFrames();
+}
+
+}  // end namespace utils
+}  // end namespace chrono
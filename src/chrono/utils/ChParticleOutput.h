@@ -0,0 +1,230 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Compact binary output of the bodies of particle-heavy simulations.
+//
+// ChParticleWriter appends one frame per call to a single binary file. A frame
+// is stored column by column (identifiers, active flags, x, y and z positions,
+// rotations, velocities, shapes), and only the selected columns are written:
+//  - positions are quantized to a fixed resolution and stored as variable-length
+//    integers: in key frames, as differences between consecutive particles; in
+//    the other frames, as differences from the previous frame;
+//  - rotations are stored in 32 bits (the three smallest quaternion components
+//    with 10 bits each, plus the index of the largest one);
+//  - velocities are stored in single precision;
+//  - identifiers and shapes are only stored in key frames. A key frame is written
+//    at a fixed interval and whenever the set of particles changes.
+// The state of the bodies is copied at each call and the frame is encoded and
+// written by a background thread; the memory used by the frames waiting to be
+// written is bounded.
+//
+// ChParticleReader gives random access to the frames of such a file, and the
+// WriteParticlesCSV / WriteParticlesPovray functions convert a frame to the files
+// written by WriteBodies and WriteShapesPovray, respectively.
+//
+// =============================================================================
+
+#ifndef CH_PARTICLE_OUTPUT_H
+#define CH_PARTICLE_OUTPUT_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "chrono/assets/ChColor.h"
+#include "chrono/core/ChApiCE.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+namespace utils {
+
+/// Fields stored in a particle output file (positions are always stored).
+enum ParticleField {
+    PARTICLE_IDENTIFIER = 1 << 0,  ///< body identifier
+    PARTICLE_ACTIVE = 1 << 1,      ///< body active flag
+    PARTICLE_ROTATION = 1 << 2,    ///< body orientation
+    PARTICLE_LIN_VEL = 1 << 3,     ///< linear velocity, in absolute frame
+    PARTICLE_ANG_VEL = 1 << 4,     ///< angular velocity, in body local frame
+    PARTICLE_SHAPE = 1 << 5,       ///< first visualization shape and color
+    PARTICLE_DEFAULT = PARTICLE_IDENTIFIER | PARTICLE_ACTIVE | PARTICLE_ROTATION | PARTICLE_SHAPE,
+    PARTICLE_ALL = 0x3F
+};
+
+/// Visualization shape of a particle, as stored in a particle output file.
+/// The shape type is as in the output of WriteShapesPovray (only spheres, ellipsoids,
+/// boxes, capsules and cones are stored: 0, 1, 2, 7, 8), or -1 if the body has no such shape.
+/// The position and orientation of the shape relative to the body are not stored.
+struct ChParticleShape {
+    int type;          ///< shape type, or -1
+    float dims[3];     ///< dimensions, as written by WriteShapesPovray
+    ChColor color;     ///< color (from the first color asset of the body)
+};
+
+/// One frame of a particle output file, as decoded by ChParticleReader.
+/// The vectors of the fields not stored in the file (or not requested) are empty.
+struct ChApi ChParticleFrame {
+    double time;
+    std::vector<int> identifiers;
+    std::vector<char> active;
+    std::vector<ChVector<>> pos;
+    std::vector<ChQuaternion<>> rot;
+    std::vector<ChVector<>> vel;
+    std::vector<ChVector<>> wvel;
+    std::vector<ChParticleShape> shapes;
+
+    size_t GetNumParticles() const { return pos.size(); }
+};
+
+/// Writer of compact binary particle output files.
+/// The file is in native byte order:
+///   ["CHPARTB1"] [version, byte order mark, fields, key frame interval (4 uint32)] [resolution (double)]
+/// followed by the frames:
+///   ["CHPF"] [flags (uint32)] [payload size, number of particles (2 uint64)] [time (double)]
+///   [columns, each as (size in bytes (uint64), data)]
+class ChApi ChParticleWriter {
+  public:
+    /// Create the output file and start the background writer thread.
+    ChParticleWriter(const std::string& filename,         ///< output file
+                     int fields = PARTICLE_DEFAULT,       ///< combination of ParticleField flags
+                     double resolution = 1e-5,            ///< quantization step of positions
+                     int keyframe_interval = 100,         ///< number of frames between key frames
+                     size_t max_buffered = 256 << 20      ///< bound on the memory of pending frames [bytes]
+                     );
+
+    /// Write the pending frames and close the file.
+    ~ChParticleWriter();
+
+    /// Add a frame with the state of the bodies of the system (optionally, only of the active ones).
+    /// Returns once the state is copied, unless the bound on pending frames is reached, in which
+    /// case it waits for the background thread to write some of them.
+    /// Throws an exception if a previous frame could not be written.
+    void WriteFrame(ChSystem* system, bool active_only = false);
+
+    /// Write the pending frames and close the file.
+    /// Throws an exception if a frame could not be written.
+    void Close();
+
+    /// Return the number of frames added so far.
+    size_t GetNumFrames() const { return m_num_frames; }
+
+    /// Return the number of bytes written to the file so far.
+    uint64_t GetNumBytes() const { return m_num_bytes; }
+
+  private:
+    struct Frame;
+
+    void WriterLoop();
+    void Encode(Frame& frame, std::vector<char>& buffer);
+
+    std::ofstream m_file;
+    int m_fields;
+    double m_resolution;
+    int m_keyframe_interval;
+    size_t m_max_buffered;
+
+    size_t m_num_frames;
+    std::vector<int> m_last_identifiers;  ///< particles of the previous frame
+    size_t m_last_count;
+
+    std::vector<int64_t> m_previous;  ///< quantized positions of the previous frame (writer thread)
+
+    std::thread m_thread;
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    std::deque<std::unique_ptr<Frame>> m_queue;
+    size_t m_buffered;
+    bool m_closing;
+    std::exception_ptr m_error;
+    std::atomic<uint64_t> m_num_bytes;
+};
+
+/// Reader of particle output files written by ChParticleWriter.
+/// The frames can be read in any order; reading them in sequence is the most
+/// efficient, as a frame is decoded from the previous key frame. An incomplete
+/// last frame (e.g. of a simulation still running) is ignored.
+class ChApi ChParticleReader {
+  public:
+    /// Open the file and index its frames.
+    /// Throws an exception if the file cannot be read or is not a particle output file.
+    ChParticleReader(const std::string& filename);
+
+    /// Return the fields stored in the file (combination of ParticleField flags).
+    int GetFields() const { return m_fields; }
+
+    /// Return the quantization step of the positions.
+    double GetResolution() const { return m_resolution; }
+
+    /// Return the number of frames.
+    size_t GetNumFrames() const { return m_frames.size(); }
+
+    /// Return the time of the specified frame.
+    double GetTime(size_t frame) const { return m_frames[frame].time; }
+
+    /// Decode the specified frame. Only the requested fields (among those stored) are
+    /// returned, in addition to the positions.
+    void ReadFrame(size_t frame, ChParticleFrame& data, int fields = PARTICLE_ALL);
+
+  private:
+    struct FrameInfo {
+        uint64_t offset;
+        uint64_t size;
+        uint64_t num_particles;
+        double time;
+        bool keyframe;
+    };
+
+    void Decode(size_t frame, ChParticleFrame* data, int fields);
+
+    std::string m_filename;
+    std::ifstream m_file;
+    int m_fields;
+    double m_resolution;
+    std::vector<FrameInfo> m_frames;
+
+    size_t m_current;                 ///< last decoded frame (or GetNumFrames() if none)
+    std::vector<int64_t> m_previous;  ///< quantized positions of the last decoded frame
+    std::vector<int> m_identifiers;   ///< identifiers of the last key frame
+    std::vector<ChParticleShape> m_shapes;  ///< shapes of the last key frame
+    std::vector<char> m_buffer;
+};
+
+/// Write a frame of a particle output file as a CSV file in the format of WriteBodies.
+/// Velocities are written only if stored in the frame.
+ChApi void WriteParticlesCSV(const ChParticleFrame& frame,
+                             const std::string& filename,
+                             bool dump_vel = false,
+                             const std::string& delim = ",");
+
+/// Write a frame of a particle output file as a CSV file in the format of WriteShapesPovray
+/// (without links). Particles without a stored shape only appear in the body information.
+ChApi void WriteParticlesPovray(const ChParticleFrame& frame,
+                                const std::string& filename,
+                                bool body_info = true,
+                                const std::string& delim = ",");
+
+/// Convert all frames of a particle output file to CSV files (as written by WriteBodies, if
+/// 'povray' is false, or by WriteShapesPovray otherwise) named "[prefix]_[frame number].dat",
+/// with frame numbers of 4 digits. Returns the number of frames converted.
+ChApi size_t ConvertParticleOutput(const std::string& filename, const std::string& prefix, bool povray);
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
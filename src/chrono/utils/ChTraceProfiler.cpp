@@ -0,0 +1,316 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Thread-safe, low-overhead scope profiler with per-thread timelines.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "chrono/utils/ChTraceProfiler.h"
+
+namespace chrono {
+namespace utils {
+
+namespace {
+
+struct Event {
+    const char* name;
+    uint64_t begin;
+    uint64_t end;
+    int depth;
+};
+
+// Event buffer of one thread. Only the owning thread writes events and the depth;
+// the buffer is never released, so that the events of finished threads can still
+// be exported.
+struct ThreadBuffer {
+    ThreadBuffer(int id, size_t capacity) : id(id), events(capacity), count(0), depth(0) {
+        name = "Thread " + std::to_string(id);
+    }
+
+    // Range [first, count) of the events currently held in the ring buffer.
+    uint64_t First() const { return count > events.size() ? count - events.size() : 0; }
+    const Event& Get(uint64_t i) const { return events[i % events.size()]; }
+
+    int id;
+    std::string name;
+    std::vector<Event> events;
+    std::atomic<uint64_t> count;
+    int depth;
+};
+
+std::mutex g_mutex;                                  // guards registration and the settings below
+std::vector<std::unique_ptr<ThreadBuffer>> g_buffers;  // buffers of all threads that recorded events
+size_t g_capacity = 65536;
+
+// Time origin and calibration of the time-stamp counter against the steady clock.
+uint64_t g_origin_ticks = 0;
+std::chrono::steady_clock::time_point g_origin_time;
+uint64_t g_stop_ticks = 0;
+std::chrono::steady_clock::time_point g_stop_time;
+bool g_stopped = false;
+
+thread_local ThreadBuffer* t_buffer = nullptr;
+
+ThreadBuffer* GetThreadBuffer() {
+    if (!t_buffer) {
+        std::lock_guard<std::mutex> lock(g_mutex);
+        g_buffers.push_back(std::unique_ptr<ThreadBuffer>(new ThreadBuffer((int)g_buffers.size(), g_capacity)));
+        t_buffer = g_buffers.back().get();
+    }
+    return t_buffer;
+}
+
+// Number of ticks per second.
+double GetTickRate() {
+#ifdef CH_TRACE_TSC
+    uint64_t ticks = g_stopped ? g_stop_ticks : ChTraceProfiler::GetTicks();
+    auto time = g_stopped ? g_stop_time : std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(time - g_origin_time).count();
+    if (seconds <= 0 || ticks <= g_origin_ticks)
+        return 1e9;
+    return (ticks - g_origin_ticks) / seconds;
+#else
+    return 1e9;
+#endif
+}
+
+void WriteJSONString(std::ostream& os, const char* str) {
+    os << '"';
+    for (const char* c = str; *c; c++) {
+        switch (*c) {
+            case '"':
+                os << "\\\"";
+                break;
+            case '\\':
+                os << "\\\\";
+                break;
+            case '\n':
+                os << "\\n";
+                break;
+            case '\t':
+                os << "\\t";
+                break;
+            default:
+                if ((unsigned char)*c < 0x20) {
+                    char buf[8];
+                    std::snprintf(buf, sizeof(buf), "\\u%04x", (unsigned char)*c);
+                    os << buf;
+                } else {
+                    os << *c;
+                }
+        }
+    }
+    os << '"';
+}
+
+}  // end anonymous namespace
+
+std::atomic<bool> ChTraceProfiler::s_enabled(false);
+
+// -----------------------------------------------------------------------------
+
+void ChTraceProfiler::Enable() {
+    Clear();
+    {
+        std::lock_guard<std::mutex> lock(g_mutex);
+        g_origin_time = std::chrono::steady_clock::now();
+        g_origin_ticks = GetTicks();
+        g_stopped = false;
+    }
+    s_enabled.store(true, std::memory_order_relaxed);
+}
+
+void ChTraceProfiler::Disable() {
+    s_enabled.store(false, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(g_mutex);
+    g_stop_ticks = GetTicks();
+    g_stop_time = std::chrono::steady_clock::now();
+    g_stopped = true;
+}
+
+void ChTraceProfiler::SetBufferSize(size_t num_events) {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    g_capacity = std::max<size_t>(num_events, 1);
+}
+
+void ChTraceProfiler::SetThreadName(const std::string& name) {
+    ThreadBuffer* buffer = GetThreadBuffer();
+    std::lock_guard<std::mutex> lock(g_mutex);
+    buffer->name = name;
+}
+
+void ChTraceProfiler::Clear() {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    for (auto& buffer : g_buffers)
+        buffer->count.store(0, std::memory_order_relaxed);
+}
+
+int ChTraceProfiler::GetNumThreads() {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    int num_threads = 0;
+    for (auto& buffer : g_buffers) {
+        if (buffer->count.load(std::memory_order_acquire) > 0)
+            num_threads++;
+    }
+    return num_threads;
+}
+
+size_t ChTraceProfiler::GetNumEvents() {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    size_t num_events = 0;
+    for (auto& buffer : g_buffers) {
+        uint64_t count = buffer->count.load(std::memory_order_acquire);
+        num_events += (size_t)std::min<uint64_t>(count, buffer->events.size());
+    }
+    return num_events;
+}
+
+// -----------------------------------------------------------------------------
+
+int ChTraceProfiler::BeginScope() {
+    return GetThreadBuffer()->depth++;
+}
+
+void ChTraceProfiler::EndScope(const char* name, uint64_t begin, int depth) {
+    uint64_t end = GetTicks();
+    ThreadBuffer* buffer = t_buffer;
+    buffer->depth = depth;
+
+    uint64_t count = buffer->count.load(std::memory_order_relaxed);
+    Event& event = buffer->events[count % buffer->events.size()];
+    event.name = name;
+    event.begin = begin;
+    event.end = end;
+    event.depth = depth;
+    buffer->count.store(count + 1, std::memory_order_release);
+}
+
+// -----------------------------------------------------------------------------
+
+void ChTraceProfiler::WriteChromeTrace(std::ostream& os) {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    double us_per_tick = 1e6 / GetTickRate();
+
+    os << "{\"traceEvents\":[";
+    bool first = true;
+    for (auto& buffer : g_buffers) {
+        uint64_t count = buffer->count.load(std::memory_order_acquire);
+        if (count == 0)
+            continue;
+
+        os << (first ? "\n" : ",\n");
+        first = false;
+        os << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->id << ",\"args\":{\"name\":";
+        WriteJSONString(os, buffer->name.c_str());
+        os << "}}";
+
+        for (uint64_t i = buffer->First(); i < count; i++) {
+            const Event& event = buffer->Get(i);
+            double ts = (double)(int64_t)(event.begin - g_origin_ticks) * us_per_tick;
+            double dur = (double)(event.end - event.begin) * us_per_tick;
+            os << ",\n{\"name\":";
+            WriteJSONString(os, event.name);
+            os << ",\"cat\":\"chrono\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->id << std::fixed
+               << std::setprecision(3) << ",\"ts\":" << ts << ",\"dur\":" << dur << std::defaultfloat << "}";
+        }
+    }
+    os << "\n],\"displayTimeUnit\":\"ms\"}" << std::endl;
+}
+
+bool ChTraceProfiler::WriteChromeTrace(const std::string& filename) {
+    std::ofstream ofile(filename);
+    if (!ofile.is_open())
+        return false;
+    WriteChromeTrace(ofile);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+// Events are recorded when a scope ends, so the nested scopes of an event are
+// the events of larger depth recorded immediately before it. Exclusive times are
+// obtained by accumulating, at each depth, the time of the enclosed scopes.
+// -----------------------------------------------------------------------------
+std::vector<ChTraceProfiler::ScopeStats> ChTraceProfiler::GetStatistics() {
+    std::lock_guard<std::mutex> lock(g_mutex);
+    double s_per_tick = 1 / GetTickRate();
+
+    std::map<std::string, ScopeStats> stats;
+    std::vector<double> nested;
+
+    for (auto& buffer : g_buffers) {
+        uint64_t count = buffer->count.load(std::memory_order_acquire);
+        nested.assign(1, 0.0);
+        for (uint64_t i = buffer->First(); i < count; i++) {
+            const Event& event = buffer->Get(i);
+            double time = (event.end - event.begin) * s_per_tick;
+            if (nested.size() < (size_t)event.depth + 2)
+                nested.resize(event.depth + 2, 0.0);
+
+            double self = std::max(time - nested[event.depth + 1], 0.0);
+            nested[event.depth + 1] = 0;
+            nested[event.depth] += time;
+
+            auto it = stats.find(event.name);
+            if (it == stats.end()) {
+                ScopeStats s = {event.name, 0, 0, 0, 0};
+                it = stats.insert(std::make_pair(std::string(event.name), s)).first;
+            }
+            ScopeStats& s = it->second;
+            s.calls++;
+            s.total += time;
+            s.self += self;
+            s.max = std::max(s.max, time);
+        }
+    }
+
+    std::vector<ScopeStats> result;
+    for (auto& s : stats)
+        result.push_back(s.second);
+    std::sort(result.begin(), result.end(), [](const ScopeStats& a, const ScopeStats& b) { return a.self > b.self; });
+    return result;
+}
+
+void ChTraceProfiler::WriteReport(std::ostream& os) {
+    auto stats = GetStatistics();
+
+    double total_self = 0;
+    size_t width = 8;
+    for (auto& s : stats) {
+        total_self += s.self;
+        width = std::max(width, std::strlen(s.name) + 2);
+    }
+
+    os << std::left << std::setw(width) << "Scope" << std::right << std::setw(10) << "Calls" << std::setw(14)
+       << "Total [ms]" << std::setw(14) << "Self [ms]" << std::setw(9) << "Self %" << std::setw(14) << "Mean [us]"
+       << std::setw(14) << "Max [us]" << std::endl;
+    os << std::fixed;
+    for (auto& s : stats) {
+        os << std::left << std::setw(width) << s.name << std::right << std::setw(10) << s.calls << std::setprecision(3)
+           << std::setw(14) << 1e3 * s.total << std::setw(14) << 1e3 * s.self << std::setprecision(1) << std::setw(9)
+           << (total_self > 0 ? 100 * s.self / total_self : 0.0) << std::setprecision(2) << std::setw(14)
+           << 1e6 * s.total / s.calls << std::setw(14) << 1e6 * s.max << std::endl;
+    }
+    os << std::defaultfloat;
+}
+
+}  // end namespace utils
+}  // end namespace chrono
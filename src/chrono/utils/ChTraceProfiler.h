@@ -0,0 +1,163 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Thread-safe, low-overhead scope profiler with per-thread timelines.
+//
+// Each thread records the scopes it executes into its own ring buffer, without
+// locking: an event holds the (static) scope name, the begin and end time stamps
+// read from the processor time-stamp counter, and the nesting depth. A thread's
+// buffer is allocated and registered the first time the thread records an event
+// while profiling is enabled. The recorded timelines can be exported in the
+// Chrome trace event format (viewable in chrome://tracing or Perfetto) or
+// aggregated into a flat report of inclusive and exclusive times per scope.
+//
+// When profiling is disabled at run time, a scope costs a single test of a flag.
+// Defining CH_NO_PROFILE removes all instrumentation at compile time.
+//
+// =============================================================================
+
+#ifndef CHTRACEPROFILER_H
+#define CHTRACEPROFILER_H
+
+#include <atomic>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define CH_TRACE_TSC
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define CH_TRACE_TSC
+#else
+#include <chrono>
+#endif
+
+namespace chrono {
+namespace utils {
+
+/// Thread-safe scope profiler recording per-thread timelines.
+/// All functions are static. Profiled scopes are marked with the CH_TRACE macro
+/// (the scopes marked with CH_PROFILE are also recorded). Scope names must be
+/// string literals (or otherwise outlive the profiler), as only pointers are stored.
+/// Export and report functions should be called while no thread is recording.
+class ChApi ChTraceProfiler {
+  public:
+    /// Aggregated statistics for all scopes with a given name.
+    struct ScopeStats {
+        const char* name;   ///< scope name
+        long calls;         ///< number of calls
+        double total;       ///< inclusive time [s]
+        double self;        ///< exclusive time, not spent in nested scopes [s]
+        double max;         ///< maximum inclusive time of a single call [s]
+    };
+
+    /// Enable recording. The buffers are cleared and the time origin is reset.
+    static void Enable();
+
+    /// Disable recording. The recorded events are kept for export.
+    static void Disable();
+
+    /// Return true if recording is enabled.
+    static bool IsEnabled() { return s_enabled.load(std::memory_order_relaxed); }
+
+    /// Set the capacity (number of events) of the ring buffer of each thread (default: 65536).
+    /// Once a buffer is full, the oldest events of that thread are overwritten.
+    /// Only affects the buffers of threads that have not yet recorded an event.
+    static void SetBufferSize(size_t num_events);
+
+    /// Set the name of the calling thread, as shown in the exported trace.
+    static void SetThreadName(const std::string& name);
+
+    /// Discard all recorded events.
+    static void Clear();
+
+    /// Get the number of threads that recorded events.
+    static int GetNumThreads();
+
+    /// Get the number of events currently held in the buffers of all threads.
+    static size_t GetNumEvents();
+
+    /// Write the recorded events in the Chrome trace event (JSON) format.
+    static void WriteChromeTrace(std::ostream& os);
+
+    /// Write the recorded events in the Chrome trace event (JSON) format to the specified file.
+    /// Return false if the file could not be opened.
+    static bool WriteChromeTrace(const std::string& filename);
+
+    /// Aggregate the recorded events of all threads by scope name.
+    /// The returned statistics are sorted by decreasing exclusive time.
+    static std::vector<ScopeStats> GetStatistics();
+
+    /// Write a flat report of the aggregated statistics.
+    static void WriteReport(std::ostream& os);
+
+    /// Read the time stamp used for events.
+    static uint64_t GetTicks() {
+#ifdef CH_TRACE_TSC
+        return __rdtsc();
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+#endif
+    }
+
+    /// Begin a scope on the calling thread; return its nesting depth.
+    static int BeginScope();
+
+    /// End a scope on the calling thread and record it.
+    static void EndScope(const char* name, uint64_t begin, int depth);
+
+  private:
+    static std::atomic<bool> s_enabled;
+};
+
+/// Utility class for recording the extent of a block with ChTraceProfiler.
+/// Use the CH_TRACE macro at the start of the scope to be recorded.
+class ChTraceScope {
+  public:
+    explicit ChTraceScope(const char* name) : m_name(nullptr) {
+        if (ChTraceProfiler::IsEnabled()) {
+            m_name = name;
+            m_depth = ChTraceProfiler::BeginScope();
+            m_begin = ChTraceProfiler::GetTicks();
+        }
+    }
+
+    ~ChTraceScope() {
+        if (m_name)
+            ChTraceProfiler::EndScope(m_name, m_begin, m_depth);
+    }
+
+  private:
+    const char* m_name;
+    uint64_t m_begin;
+    int m_depth;
+};
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#ifndef CH_NO_PROFILE
+#define CH_TRACE_CONCAT_(a, b) a##b
+#define CH_TRACE_CONCAT(a, b) CH_TRACE_CONCAT_(a, b)
+#define CH_TRACE(name) ::chrono::utils::ChTraceScope CH_TRACE_CONCAT(__ch_trace_, __LINE__)(name)
+#else
+#define CH_TRACE(name)
+#endif
+
+#endif
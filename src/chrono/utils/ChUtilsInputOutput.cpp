@@ -14,6 +14,16 @@
 //
 // =============================================================================
 
+#include <cstdint>
+#include <cstring>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "chrono/assets/ChColorAsset.h"
 #include "chrono/geometry/ChLineBezier.h"
 #include "chrono/utils/ChUtilsInputOutput.h"
@@ -291,6 +301,269 @@ void ReadCheckpoint(ChSystem* system, const std::string& filename) {
     }
 }
 
+// -----------------------------------------------------------------------------
+// Binary checkpoint files
+// -----------------------------------------------------------------------------
+
+namespace {
+
+const char binary_checkpoint_tag[8] = {'C', 'H', 'C', 'K', 'P', 'T', 'B', '1'};
+const uint32_t binary_checkpoint_version = 1;
+const uint32_t binary_checkpoint_byte_order = 0x01020304;
+
+struct CheckpointHeader {
+    char tag[8];
+    uint32_t version;
+    uint32_t byte_order;
+    double time;
+    double step;
+    uint64_t stepcount;
+    uint64_t nbodies;            // bodies in the system list
+    uint64_t nlinks;             // links in the system list
+    uint64_t nitems;             // other physics items
+    uint64_t ncoords_x;          // size of the position state
+    uint64_t ncoords_v;          // size of the velocity and acceleration states
+    uint64_t nconstr;            // number of Lagrange multipliers
+    uint64_t nconstr_contacts;   // number of Lagrange multipliers of contacts (last in L)
+    uint64_t nhistory;           // number of timestepper history values
+    int32_t timestepper_type;
+    uint32_t reserved;
+};
+
+uint64_t CheckpointSize(const CheckpointHeader& h) {
+    return sizeof(CheckpointHeader) +
+           sizeof(double) * (h.ncoords_x + 2 * h.ncoords_v + h.nconstr + h.nhistory + 21 * h.nbodies) + h.nbodies;
+}
+
+// Read-only image of a whole file: memory mapped where supported, otherwise read in a single block.
+class CheckpointFile {
+  public:
+    CheckpointFile(const std::string& filename) : m_data(nullptr), m_size(0) {
+#if !defined(_WIN32)
+        m_mapped = nullptr;
+        int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw ChException("ERROR opening checkpoint file: " + filename + "\n");
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            m_size = (size_t)st.st_size;
+            void* ptr = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (ptr != MAP_FAILED)
+                m_mapped = ptr;
+        }
+        close(fd);
+        if (!m_mapped)
+            throw ChException("ERROR mapping checkpoint file: " + filename + "\n");
+        m_data = static_cast<const char*>(m_mapped);
+#else
+        std::ifstream fin(filename, std::ios::binary | std::ios::ate);
+        if (!fin.good())
+            throw ChException("ERROR opening checkpoint file: " + filename + "\n");
+        m_size = (size_t)fin.tellg();
+        fin.seekg(0, std::ios::beg);
+        m_buffer.resize(m_size);
+        if (!fin.read(m_buffer.data(), m_size))
+            throw ChException("ERROR reading checkpoint file: " + filename + "\n");
+        m_data = m_buffer.data();
+#endif
+    }
+
+    ~CheckpointFile() {
+#if !defined(_WIN32)
+        if (m_mapped)
+            munmap(m_mapped, m_size);
+#endif
+    }
+
+    const char* data() const { return m_data; }
+    size_t size() const { return m_size; }
+
+  private:
+    const char* m_data;
+    size_t m_size;
+#if !defined(_WIN32)
+    void* m_mapped;
+#else
+    std::vector<char> m_buffer;
+#endif
+};
+
+// Frame coordinates of a body and their time derivatives (3 x 7 values).
+// The velocity state of a body holds the angular velocity, so scattering it
+// recomputes the quaternion derivatives with round-off; these are restored as well
+// so that a restarted simulation continues the original one exactly.
+void GetBodyFrames(const ChBody& body, double* data) {
+    const ChCoordsys<>* csys[3] = {&body.GetCoord(), &body.GetCoord_dt(), &body.GetCoord_dtdt()};
+    for (int i = 0; i < 3; i++) {
+        data[7 * i + 0] = csys[i]->pos.x();
+        data[7 * i + 1] = csys[i]->pos.y();
+        data[7 * i + 2] = csys[i]->pos.z();
+        data[7 * i + 3] = csys[i]->rot.e0();
+        data[7 * i + 4] = csys[i]->rot.e1();
+        data[7 * i + 5] = csys[i]->rot.e2();
+        data[7 * i + 6] = csys[i]->rot.e3();
+    }
+}
+
+void SetBodyFrames(ChBody& body, const double* data) {
+    ChCoordsys<> csys[3];
+    for (int i = 0; i < 3; i++) {
+        csys[i].pos = ChVector<>(data[7 * i + 0], data[7 * i + 1], data[7 * i + 2]);
+        csys[i].rot = ChQuaternion<>(data[7 * i + 3], data[7 * i + 4], data[7 * i + 5], data[7 * i + 6]);
+    }
+    body.SetCoord(csys[0]);
+    body.SetCoord_dt(csys[1]);
+    body.SetCoord_dtdt(csys[2]);
+}
+
+}  // end anonymous namespace
+
+// -----------------------------------------------------------------------------
+// WriteBinaryCheckpoint
+//
+// Write the state of the system, as gathered for the timestepper, in contiguous
+// blocks. The contact multipliers are stored last in L.
+// Side effects on the saved system: Setup() is called so that the counts and
+// offsets of coordinates and constraints are current, and the constraint
+// Jacobians are reloaded at the current configuration. The state is not
+// modified, but the next step starts from the reloaded Jacobians, as does the
+// restored system; this is what makes the two continue identically.
+// -----------------------------------------------------------------------------
+void WriteBinaryCheckpoint(ChSystem* system, const std::string& filename) {
+    system->Setup();
+    system->ConstraintsLoadJacobians();
+
+    CheckpointHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.tag, binary_checkpoint_tag, sizeof(header.tag));
+    header.version = binary_checkpoint_version;
+    header.byte_order = binary_checkpoint_byte_order;
+    header.step = system->GetStep();
+    header.stepcount = system->GetStepcount();
+    header.nbodies = system->Get_bodylist().size();
+    header.nlinks = system->Get_linklist().size();
+    header.nitems = system->Get_otherphysicslist().size();
+    header.ncoords_x = system->GetNcoords_x();
+    header.ncoords_v = system->GetNcoords_v();
+    header.nconstr = system->GetNconstr();
+    header.nconstr_contacts = system->GetContactContainer()->GetDOC();
+    header.timestepper_type = static_cast<int32_t>(system->GetTimestepperType());
+
+    ChState x((int)header.ncoords_x, system);
+    ChStateDelta v((int)header.ncoords_v, system);
+    ChStateDelta a((int)header.ncoords_v, system);
+    ChVectorDynamic<> L((int)header.nconstr);
+    system->StateGather(x, v, header.time);
+    system->StateGatherAcceleration(a);
+    system->StateGatherReactions(L);
+
+    std::vector<double> history;
+    system->GetTimestepper()->GetHistory(history);
+    header.nhistory = history.size();
+
+    std::vector<double> frames(21 * header.nbodies);
+    std::vector<uint8_t> sleeping(header.nbodies);
+    for (size_t i = 0; i < header.nbodies; i++) {
+        GetBodyFrames(*system->Get_bodylist()[i], &frames[21 * i]);
+        sleeping[i] = system->Get_bodylist()[i]->GetSleeping() ? 1 : 0;
+    }
+
+    std::ofstream fout(filename, std::ios::binary);
+    if (!fout.good())
+        throw ChException("ERROR opening checkpoint file for writing: " + filename + "\n");
+
+    fout.write((const char*)&header, sizeof(header));
+    fout.write((const char*)x.GetAddress(), header.ncoords_x * sizeof(double));
+    fout.write((const char*)v.GetAddress(), header.ncoords_v * sizeof(double));
+    fout.write((const char*)a.GetAddress(), header.ncoords_v * sizeof(double));
+    fout.write((const char*)L.GetAddress(), header.nconstr * sizeof(double));
+    fout.write((const char*)history.data(), history.size() * sizeof(double));
+    fout.write((const char*)frames.data(), frames.size() * sizeof(double));
+    fout.write((const char*)sleeping.data(), sleeping.size());
+
+    if (!fout.good())
+        throw ChException("ERROR writing checkpoint file: " + filename + "\n");
+}
+
+// -----------------------------------------------------------------------------
+// ReadBinaryCheckpoint
+//
+// Restore the state of a system with the same topology. After the positions
+// and velocities are scattered, collision detection is run to regenerate the
+// contacts, so that the contact multipliers can be restored (these also
+// initialize the reaction caches used for warm starting).
+// -----------------------------------------------------------------------------
+void ReadBinaryCheckpoint(ChSystem* system, const std::string& filename) {
+    CheckpointFile file(filename);
+
+    CheckpointHeader header;
+    if (file.size() < sizeof(header))
+        throw ChException("ERROR in checkpoint file, unexpected end of file: " + filename + "\n");
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (std::memcmp(header.tag, binary_checkpoint_tag, sizeof(header.tag)) != 0 ||
+        header.version != binary_checkpoint_version || header.byte_order != binary_checkpoint_byte_order)
+        throw ChException("ERROR in checkpoint file, unsupported format: " + filename + "\n");
+    if (file.size() != CheckpointSize(header))
+        throw ChException("ERROR in checkpoint file, unexpected file size: " + filename + "\n");
+
+    if (header.nbodies != system->Get_bodylist().size() || header.nlinks != system->Get_linklist().size() ||
+        header.nitems != system->Get_otherphysicslist().size())
+        throw ChException("ERROR in checkpoint file, the system topology does not match: " + filename + "\n");
+
+    const char* ptr = file.data() + sizeof(header);
+    const double* x_data = reinterpret_cast<const double*>(ptr);
+    const double* v_data = x_data + header.ncoords_x;
+    const double* a_data = v_data + header.ncoords_v;
+    const double* L_data = a_data + header.ncoords_v;
+    const double* history_data = L_data + header.nconstr;
+    const double* frames_data = history_data + header.nhistory;
+    const uint8_t* sleeping = reinterpret_cast<const uint8_t*>(frames_data + 21 * header.nbodies);
+
+    // Sleeping bodies are excluded from the state, so set them before counting coordinates.
+    for (size_t i = 0; i < header.nbodies; i++)
+        system->Get_bodylist()[i]->SetSleeping(sleeping[i] != 0);
+
+    system->Setup();
+    uint64_t nconstr_contacts = system->GetContactContainer()->GetDOC();
+    if (header.ncoords_x != (uint64_t)system->GetNcoords_x() || header.ncoords_v != (uint64_t)system->GetNcoords_v() ||
+        header.nconstr - header.nconstr_contacts != system->GetNconstr() - nconstr_contacts)
+        throw ChException("ERROR in checkpoint file, the system coordinates do not match: " + filename + "\n");
+
+    ChState x((int)header.ncoords_x, system);
+    ChStateDelta v((int)header.ncoords_v, system);
+    ChStateDelta a((int)header.ncoords_v, system);
+    std::memcpy(x.GetAddress(), x_data, header.ncoords_x * sizeof(double));
+    std::memcpy(v.GetAddress(), v_data, header.ncoords_v * sizeof(double));
+    std::memcpy(a.GetAddress(), a_data, header.ncoords_v * sizeof(double));
+    system->StateScatter(x, v, header.time);
+    system->StateScatterAcceleration(a);
+    for (size_t i = 0; i < header.nbodies; i++)
+        SetBodyFrames(*system->Get_bodylist()[i], frames_data + 21 * i);
+
+    // The frame derivatives were overwritten after the state was scattered: update all items with them.
+    system->Update(false);
+
+    // Regenerate the contacts at the restored configuration.
+    system->ComputeCollisions();
+    system->Setup();
+    system->ConstraintsLoadJacobians();
+
+    // Multipliers of the bilateral constraints always match; those of the contacts only if
+    // the same number of contacts was found (otherwise they are reset to zero).
+    ChVectorDynamic<> L(system->GetNconstr());
+    uint64_t nconstr_bilateral = header.nconstr - header.nconstr_contacts;
+    uint64_t ncopy = (system->GetNconstr() == header.nconstr) ? header.nconstr : nconstr_bilateral;
+    std::memcpy(L.GetAddress(), L_data, ncopy * sizeof(double));
+    system->StateScatterReactions(L);
+
+    system->SetStep(header.step);
+    system->SetStepcount((size_t)header.stepcount);
+    if (header.timestepper_type == static_cast<int32_t>(system->GetTimestepperType())) {
+        std::vector<double> history(history_data, history_data + header.nhistory);
+        system->GetTimestepper()->SetHistory(history);
+    }
+}
+
 // -----------------------------------------------------------------------------
 // WriteShapesPovray
 //
@@ -25,6 +25,15 @@
 //      contact geometry.
 //    - only a subset of contact shapes are currently supported
 //
+// WriteBinaryCheckpoint and ReadBinaryCheckpoint
+//  these functions write and restore, respectively, the complete state of an
+//  existing system in a binary checkpoint file.
+//  Limitations:
+//    - the system must be re-created with the same topology before restoring.
+//    - contacts are regenerated by collision detection at the restored
+//      configuration; their multipliers are restored only if the same number
+//      of contacts is found.
+//
 // WriteShapesPovray
 //  this function writes a CSV file appropriate for processing with a POV-Ray
 //  script.
@@ -143,6 +152,33 @@ bool WriteCheckpoint(ChSystem* system, const std::string& filename);
 ChApi
 void ReadCheckpoint(ChSystem* system, const std::string& filename);
 
+// Write a binary checkpoint file with the complete state of the system: positions,
+// velocities, accelerations, and Lagrange multipliers (including contact multipliers,
+// used for warm starting), plus the internal variables of the timestepper and the
+// frame coordinates and sleeping state of bodies. Each is stored as one contiguous
+// block of values, after a header with the time and the system topology (number of
+// bodies, links, other physics items, coordinates, and constraints). The file is in
+// native byte order:
+//   ["CHCKPTB1"] [version, byte order mark (2 uint32)] [time, step (2 doubles)] [step count (uint64)]
+//   [# of bodies, links, physics items, x, v, L, contact L, history values (8 uint64)]
+//   [timestepper type (int32)] [reserved (uint32)]
+//   [x (doubles)] [v (doubles)] [a (doubles)] [L (doubles)] [timestepper history (doubles)]
+//   [frame coordinates and their first and second derivatives for each body (21 doubles)]
+//   [sleeping flag for each body (uint8)]
+// The system is set up and its constraint Jacobians are reloaded at the current configuration
+// before writing; the state itself is not modified.
+ChApi
+void WriteBinaryCheckpoint(ChSystem* system, const std::string& filename);
+
+// Restore the state of a system from a binary checkpoint file written by WriteBinaryCheckpoint.
+// The system must have been constructed as the one that was saved (same bodies, links, and
+// physics items, in the same order), typically by the same program. The file is memory mapped
+// where supported and the state blocks are scattered directly to the system; the time, step
+// size, and step count are restored as well. An exception is thrown if the file is invalid or
+// the topology of the system does not match.
+ChApi
+void ReadBinaryCheckpoint(ChSystem* system, const std::string& filename);
+
 // Write CSV output file for PovRay.
 // Each line contains information about one visualization asset shape, as
 // follows:
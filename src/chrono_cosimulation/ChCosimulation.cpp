@@ -12,14 +12,107 @@
 // Authors: Alessandro Tasora
 // =============================================================================
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <thread>
 #include <vector>
 
 #include "chrono_cosimulation/ChCosimulation.h"
 #include "chrono_cosimulation/ChExceptionSocket.h"
 
+#ifdef UNIX
+#include <poll.h>
+#endif
+
 namespace chrono {
 namespace cosimul {
 
+// Messages exchanged on the TCP connection, just after it is established, to set up a
+// shared memory channel. The client sends a ShmHello; if the server receives it within
+// a short time, it replies with a ShmOffer with the name of a new shared memory segment,
+// the client opens it and sends back the token found there (0 on failure), and the
+// server replies with a status (1 if the channel is used).
+// A client that does not send a ShmHello (e.g. Simulink) is not affected, except for
+// the short wait before its first message is read.
+
+static const char shm_magic[8] = {'C', 'H', 'C', 'O', 'S', 'H', 'M', '1'};
+static const int shm_hello_timeout = 200;  // [ms]
+
+struct ShmHello {
+    char magic[8];
+    int32_t send_n;  ///< number of values sent by the client
+    int32_t recv_n;  ///< number of values received by the client
+};
+
+struct ShmOffer {
+    char magic[8];
+    int32_t status;  ///< 1 if a segment was created
+    char name[64];
+};
+
+#ifdef UNIX
+
+static void SendAll(int fd, const void* data, size_t size) {
+    const char* ptr = static_cast<const char*>(data);
+    while (size > 0) {
+        ssize_t n = send(fd, ptr, size, 0);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            throw ChExceptionSocket(0, "Error calling send() in shared memory set-up");
+        ptr += n;
+        size -= n;
+    }
+}
+
+static void RecvAll(int fd, void* data, size_t size) {
+    char* ptr = static_cast<char*>(data);
+    while (size > 0) {
+        ssize_t n = recv(fd, ptr, size, 0);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            throw ChExceptionSocket(0, "Error calling recv() in shared memory set-up");
+        ptr += n;
+        size -= n;
+    }
+}
+
+// Check, without consuming any data, if the client has sent a ShmHello.
+static bool PeekHello(int fd) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(shm_hello_timeout);
+    ShmHello hello;
+    while (true) {
+        auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+        if (left.count() <= 0)
+            return false;
+        struct pollfd pfd = {fd, POLLIN, 0};
+        if (poll(&pfd, 1, (int)left.count()) <= 0)
+            continue;
+        ssize_t n = recv(fd, &hello, sizeof(hello), MSG_PEEK);
+        if (n <= 0 || std::memcmp(&hello, shm_magic, std::min((size_t)n, sizeof(shm_magic))) != 0)
+            return false;
+        if (n == (ssize_t)sizeof(hello))
+            return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+// Return false if the other end has closed the TCP connection.
+static bool PeerAlive(int fd) {
+    struct pollfd pfd = {fd, POLLIN, 0};
+    if (poll(&pfd, 1, 0) <= 0)
+        return true;
+    if (pfd.revents & (POLLHUP | POLLERR))
+        return false;
+    char c;
+    return recv(fd, &c, 1, MSG_PEEK | MSG_DONTWAIT) != 0;
+}
+
+#endif
+
 ChCosimulation::ChCosimulation(ChSocketFramework& mframework,
                                int n_in_values,  /// number of scalar variables to receive each timestep
                                int n_out_values  /// number of scalar variables to send each timestep
@@ -29,9 +122,13 @@ ChCosimulation::ChCosimulation(ChSocketFramework& mframework,
     this->in_n = n_in_values;
     this->out_n = n_out_values;
     this->nport = 0;
+    this->use_shm = true;
+    this->channel = nullptr;
 }
 
 ChCosimulation::~ChCosimulation() {
+    delete this->channel;
+    this->channel = nullptr;
     if (this->myServer)
         delete this->myServer;
     this->myServer = 0;
@@ -59,9 +156,115 @@ bool ChCosimulation::WaitConnection(int aport) {
     if (!this->myClient)
         throw(ChExceptionSocket(0, "Server failed in getting the client socket"));
 
+    NegotiateServer();
+
+    return true;
+}
+
+bool ChCosimulation::ConnectToServer(const std::string& hostname, int aport) {
+    this->nport = aport;
+
+    // a client socket is created, and connected to the server
+    this->myClient = new ChSocketTCP(aport);
+    std::string host(hostname);
+    this->myClient->connectToServer(host, NAME);
+
+    NegotiateClient();
+
     return true;
 }
 
+void ChCosimulation::NegotiateServer() {
+#ifdef UNIX
+    // A ShmHello is answered even if shared memory is disabled on this end, so that it
+    // is not taken for data by ReceiveData().
+    int fd = this->myClient->getSocketId();
+    if (!PeekHello(fd))
+        return;
+
+    ShmHello hello;
+    RecvAll(fd, &hello, sizeof(hello));
+
+    ChSharedMemoryChannel* shm = nullptr;
+    if (this->use_shm && ChSharedMemoryChannel::IsSupported() && hello.send_n == this->in_n &&
+        hello.recv_n == this->out_n) {
+        try {
+            shm = ChSharedMemoryChannel::Create(this->out_n + 1, this->in_n + 1);
+        } catch (const ChExceptionSocket&) {
+            shm = nullptr;
+        }
+    }
+
+    ShmOffer offer;
+    std::memset(&offer, 0, sizeof(offer));
+    std::memcpy(offer.magic, shm_magic, sizeof(shm_magic));
+    offer.status = shm ? 1 : 0;
+    if (shm)
+        std::strncpy(offer.name, shm->GetName().c_str(), sizeof(offer.name) - 1);
+    SendAll(fd, &offer, sizeof(offer));
+    if (!shm)
+        return;
+
+    try {
+        uint64_t token;
+        RecvAll(fd, &token, sizeof(token));
+        int32_t ok = (token == shm->GetToken()) ? 1 : 0;
+        SendAll(fd, &ok, sizeof(ok));
+        shm->Unlink();
+        if (!ok) {
+            delete shm;
+            return;
+        }
+    } catch (...) {
+        delete shm;
+        throw;
+    }
+
+    shm->SetPeerCheck([fd]() { return PeerAlive(fd); });
+    this->channel = shm;
+#endif
+}
+
+void ChCosimulation::NegotiateClient() {
+#ifdef UNIX
+    int fd = this->myClient->getSocketId();
+    if (!this->use_shm || !ChSharedMemoryChannel::IsSupported())
+        return;
+
+    ShmHello hello;
+    std::memcpy(hello.magic, shm_magic, sizeof(shm_magic));
+    hello.send_n = this->out_n;
+    hello.recv_n = this->in_n;
+    SendAll(fd, &hello, sizeof(hello));
+
+    ShmOffer offer;
+    RecvAll(fd, &offer, sizeof(offer));
+    if (std::memcmp(offer.magic, shm_magic, sizeof(shm_magic)) != 0)
+        throw ChExceptionSocket(0, "Invalid reply of the server in shared memory set-up");
+    if (!offer.status)
+        return;
+
+    offer.name[sizeof(offer.name) - 1] = 0;
+    ChSharedMemoryChannel* shm = ChSharedMemoryChannel::Open(offer.name, this->out_n + 1, this->in_n + 1);
+    uint64_t token = shm ? shm->GetToken() : 0;
+    int32_t ok = 0;
+    try {
+        SendAll(fd, &token, sizeof(token));
+        RecvAll(fd, &ok, sizeof(ok));
+    } catch (...) {
+        delete shm;
+        throw;
+    }
+    if (!ok) {
+        delete shm;
+        return;
+    }
+
+    shm->SetPeerCheck([fd]() { return PeerAlive(fd); });
+    this->channel = shm;
+#endif
+}
+
 bool ChCosimulation::SendData(double mtime, ChMatrix<double>* out_data) {
     if (out_data->GetColumns() != 1)
         throw ChExceptionSocket(0, "Error. Sent data must be a matrix with 1 column");
@@ -70,6 +273,16 @@ bool ChCosimulation::SendData(double mtime, ChMatrix<double>* out_data) {
     if (!myClient)
         throw ChExceptionSocket(0, "Error. Attempted 'SendData' with no connected client.");
 
+    if (this->channel) {
+        // Write time and variables directly in the shared memory slot.
+        double* slot = this->channel->BeginSend();
+        slot[0] = mtime;
+        for (int i = 0; i < out_data->GetRows(); i++)
+            slot[i + 1] = out_data->Element(i, 0);
+        this->channel->EndSend();
+        return true;
+    }
+
     std::vector<char> mbuffer;                     // now zero length
     ChStreamOutBinaryVector stream_out(&mbuffer);  // wrap the buffer, for easy formatting
 
@@ -95,6 +308,16 @@ bool ChCosimulation::ReceiveData(double& mtime, ChMatrix<double>* in_data) {
     if (!myClient)
         throw ChExceptionSocket(0, "Error. Attempted 'ReceiveData' with no connected client.");
 
+    if (this->channel) {
+        // Read time and variables directly from the shared memory slot.
+        const double* slot = this->channel->BeginReceive();
+        mtime = slot[0];
+        for (int i = 0; i < in_data->GetRows(); i++)
+            in_data->Element(i, 0) = slot[i + 1];
+        this->channel->EndReceive();
+        return true;
+    }
+
     // Receive from the client
     int nbytes = sizeof(double) * (this->in_n + 1);
     std::vector<char> rbuffer;
@@ -15,6 +15,7 @@
 #ifndef CHCOSIMULATION_H
 #define CHCOSIMULATION_H
 
+#include "chrono_cosimulation/ChSharedMemoryChannel.h"
 #include "chrono_cosimulation/ChSocket.h"
 #include "chrono_cosimulation/ChSocketFramework.h"
 
@@ -34,6 +35,11 @@ namespace cosimul {
 /// back and forth.
 /// In this case, C::E will work as a server, waiting for
 /// a client to talk with.
+/// Two C::E programs can also be coupled, one of them connecting
+/// to the other as a client (see ConnectToServer). If both run on
+/// the same host, the values are then exchanged through shared
+/// memory instead of the TCP connection, which is only used to set
+/// it up (see SetUseSharedMemory).
 
 class ChApiCosimulation ChCosimulation {
   public:
@@ -50,6 +56,22 @@ class ChApiCosimulation ChCosimulation {
     /// \a aport is a free port number, for example 50009.
     bool WaitConnection(int aport);
 
+    /// Connect, as a client, to another co-simulation interface
+    /// waiting for a connection (see WaitConnection) on the given
+    /// host and port. The numbers of values to send and receive must
+    /// match the numbers of values received and sent by the server.
+    bool ConnectToServer(const std::string& hostname, int aport);
+
+    /// Enable or disable the use of shared memory when both ends of
+    /// the connection are C::E co-simulation interfaces on the same
+    /// host (default: enabled). Must be called before the connection;
+    /// the shared memory is used only if enabled on both ends.
+    /// Other clients (e.g. Simulink) always use the TCP connection.
+    void SetUseSharedMemory(bool use) { use_shm = use; }
+
+    /// Return true if the values are exchanged through shared memory.
+    bool IsUsingSharedMemory() const { return channel != nullptr; }
+
     /// Exchange data with the client, by sending a
     /// vector of floating point values over TCP socket
     /// connection (values are double precision, little endian, 4 bytes each)
@@ -63,10 +85,16 @@ class ChApiCosimulation ChCosimulation {
     bool ReceiveData(double& mtime, ChMatrix<double>* mdata);
 
   private:
+    void NegotiateServer();
+    void NegotiateClient();
+
     ChSocketTCP* myServer;
     ChSocketTCP* myClient;
     int nport;
 
+    bool use_shm;
+    ChSharedMemoryChannel* channel;
+
     int in_n;
     int out_n;
 };
@@ -0,0 +1,248 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <atomic>
+#include <chrono>
+#include <new>
+#include <random>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "chrono_cosimulation/ChExceptionSocket.h"
+#include "chrono_cosimulation/ChSharedMemoryChannel.h"
+
+namespace chrono {
+namespace cosimul {
+
+namespace {
+
+const uint64_t segment_magic = 0x314D485343484300ULL;  // "\0CHCSHM1"
+const int ring_capacity = 8;                           // messages per direction
+
+// Number of polls before yielding (no spinning on a single processor, where the other
+// end cannot progress meanwhile), and time after which the waiting thread sleeps
+// between polls (and the other end is checked).
+const int num_spins = std::thread::hardware_concurrency() > 1 ? 2000 : 0;
+const std::chrono::microseconds yield_time(1000);
+const std::chrono::microseconds sleep_time(50);
+const std::chrono::milliseconds check_interval(10);
+
+struct SegmentHeader {
+    uint64_t magic;
+    uint64_t token;
+    int32_t size_a;  ///< number of doubles in a message sent by the creator
+    int32_t size_b;  ///< number of doubles in a message sent by the other end
+    int32_t capacity;
+    int32_t reserved;
+    char padding[32];
+};
+
+}  // end anonymous namespace
+
+// Counters of the messages written and read, on separate cache lines.
+struct ChSharedMemoryChannel::Ring {
+    alignas(64) std::atomic<uint64_t> head;
+    alignas(64) std::atomic<uint64_t> tail;
+};
+
+static_assert(sizeof(SegmentHeader) == 64, "unexpected segment header size");
+
+ChSharedMemoryChannel::ChSharedMemoryChannel()
+    : m_owner(false),
+      m_memory(nullptr),
+      m_size(0),
+      m_send(nullptr),
+      m_recv(nullptr),
+      m_send_slots(nullptr),
+      m_recv_slots(nullptr),
+      m_send_size(0),
+      m_recv_size(0) {}
+
+ChSharedMemoryChannel::~ChSharedMemoryChannel() {
+#if !defined(_WIN32)
+    Unlink();
+    if (m_memory)
+        munmap(m_memory, m_size);
+#endif
+}
+
+bool ChSharedMemoryChannel::IsSupported() {
+#if !defined(_WIN32)
+    return std::atomic<uint64_t>().is_lock_free();
+#else
+    return false;
+#endif
+}
+
+ChSharedMemoryChannel* ChSharedMemoryChannel::Create(int send_size, int recv_size) {
+    if (!IsSupported())
+        throw ChExceptionSocket(0, "Shared memory channels are not supported on this platform");
+
+    static std::atomic<int> counter(0);
+    std::random_device device;
+    auto now = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+    uint64_t token = ((uint64_t)device() << 32) ^ (uint64_t)device() ^ (uint64_t)now;
+
+    ChSharedMemoryChannel* channel = new ChSharedMemoryChannel;
+#if !defined(_WIN32)
+    channel->m_name = "/chrono_cosim_" + std::to_string((long)getpid()) + "_" + std::to_string(counter++);
+#endif
+    channel->m_owner = true;
+    try {
+        channel->Map(true, send_size, recv_size);
+    } catch (...) {
+        delete channel;
+        throw;
+    }
+
+    SegmentHeader* header = static_cast<SegmentHeader*>(channel->m_memory);
+    header->token = token == 0 ? 1 : token;
+    header->size_a = send_size;
+    header->size_b = recv_size;
+    header->capacity = ring_capacity;
+    std::atomic_thread_fence(std::memory_order_release);
+    header->magic = segment_magic;
+
+    return channel;
+}
+
+ChSharedMemoryChannel* ChSharedMemoryChannel::Open(const std::string& name, int send_size, int recv_size) {
+    if (!IsSupported())
+        return nullptr;
+
+    ChSharedMemoryChannel* channel = new ChSharedMemoryChannel;
+    channel->m_name = name;
+    try {
+        channel->Map(false, recv_size, send_size);
+    } catch (...) {
+        delete channel;
+        return nullptr;
+    }
+
+    const SegmentHeader* header = static_cast<const SegmentHeader*>(channel->m_memory);
+    if (header->magic != segment_magic || header->size_a != recv_size || header->size_b != send_size ||
+        header->capacity != ring_capacity) {
+        delete channel;
+        return nullptr;
+    }
+
+    return channel;
+}
+
+// Map the segment: header, the two rings, then the slots of the messages sent by
+// the creator (size_a doubles each) and by the other end (size_b doubles each).
+void ChSharedMemoryChannel::Map(bool create, int size_a, int size_b) {
+#if !defined(_WIN32)
+    size_t rings_offset = sizeof(SegmentHeader);
+    size_t slots_offset = rings_offset + 2 * sizeof(Ring);
+    m_size = slots_offset + (size_t)ring_capacity * (size_a + size_b) * sizeof(double);
+
+    int fd = shm_open(m_name.c_str(), create ? (O_CREAT | O_EXCL | O_RDWR) : O_RDWR, 0600);
+    if (fd < 0)
+        throw ChExceptionSocket(0, "Cannot open shared memory segment " + m_name);
+    if (create && ftruncate(fd, (off_t)m_size) != 0) {
+        close(fd);
+        shm_unlink(m_name.c_str());
+        throw ChExceptionSocket(0, "Cannot size shared memory segment " + m_name);
+    }
+    void* ptr = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (ptr == MAP_FAILED) {
+        if (create)
+            shm_unlink(m_name.c_str());
+        throw ChExceptionSocket(0, "Cannot map shared memory segment " + m_name);
+    }
+    m_memory = ptr;
+
+    char* base = static_cast<char*>(ptr);
+    Ring* ring_a = reinterpret_cast<Ring*>(base + rings_offset);
+    Ring* ring_b = ring_a + 1;
+    if (create) {
+        new (ring_a) Ring();
+        new (ring_b) Ring();
+        ring_a->head = ring_a->tail = 0;
+        ring_b->head = ring_b->tail = 0;
+    }
+    double* slots_a = reinterpret_cast<double*>(base + slots_offset);
+    double* slots_b = slots_a + (size_t)ring_capacity * size_a;
+
+    m_send = create ? ring_a : ring_b;
+    m_recv = create ? ring_b : ring_a;
+    m_send_slots = create ? slots_a : slots_b;
+    m_recv_slots = create ? slots_b : slots_a;
+    m_send_size = create ? size_a : size_b;
+    m_recv_size = create ? size_b : size_a;
+#endif
+}
+
+uint64_t ChSharedMemoryChannel::GetToken() const {
+    return static_cast<const SegmentHeader*>(m_memory)->token;
+}
+
+void ChSharedMemoryChannel::Unlink() {
+#if !defined(_WIN32)
+    if (m_owner && m_memory)
+        shm_unlink(m_name.c_str());
+#endif
+    m_owner = false;
+}
+
+void ChSharedMemoryChannel::Wait(const std::function<bool()>& ready) {
+    for (int k = 0; k < num_spins; k++) {
+        if (ready())
+            return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto last_check = start;
+    while (!ready()) {
+        auto now = std::chrono::steady_clock::now();
+        if (now - start < yield_time) {
+            std::this_thread::yield();
+            continue;
+        }
+        if (m_peer_check && now - last_check > check_interval) {
+            if (!m_peer_check())
+                throw ChExceptionSocket(0, "Shared memory channel: the other end has disconnected");
+            last_check = now;
+        }
+        std::this_thread::sleep_for(sleep_time);
+    }
+}
+
+double* ChSharedMemoryChannel::BeginSend() {
+    uint64_t head = m_send->head.load(std::memory_order_relaxed);
+    Wait([&]() { return head - m_send->tail.load(std::memory_order_acquire) < (uint64_t)ring_capacity; });
+    return m_send_slots + (size_t)(head % ring_capacity) * m_send_size;
+}
+
+void ChSharedMemoryChannel::EndSend() {
+    m_send->head.store(m_send->head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+const double* ChSharedMemoryChannel::BeginReceive() {
+    uint64_t tail = m_recv->tail.load(std::memory_order_relaxed);
+    Wait([&]() { return m_recv->head.load(std::memory_order_acquire) != tail; });
+    return m_recv_slots + (size_t)(tail % ring_capacity) * m_recv_size;
+}
+
+void ChSharedMemoryChannel::EndReceive() {
+    m_recv->tail.store(m_recv->tail.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+}  // end namespace cosimul
+}  // end namespace chrono
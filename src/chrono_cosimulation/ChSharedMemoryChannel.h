@@ -0,0 +1,107 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#ifndef CHSHAREDMEMORYCHANNEL_H
+#define CHSHAREDMEMORYCHANNEL_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include "chrono_cosimulation/ChApiCosimulation.h"
+
+namespace chrono {
+namespace cosimul {
+
+/// @addtogroup cosimulation_module
+/// @{
+
+/// Channel for the exchange of fixed-size messages (vectors of doubles) between
+/// two processes on the same host, through a shared memory segment.
+/// The segment holds two lock-free single-producer/single-consumer rings, one per
+/// direction; messages are written and read in place in the ring slots. Waiting for
+/// a slot is done by polling (spinning, then yielding, then sleeping briefly).
+/// Used by ChCosimulation, which sets it up through its TCP connection; only
+/// available on POSIX systems.
+class ChApiCosimulation ChSharedMemoryChannel {
+  public:
+    /// Return true if shared memory channels are supported on this platform.
+    static bool IsSupported();
+
+    /// Create a new shared memory segment (first end). This end sends messages of
+    /// 'send_size' doubles and receives messages of 'recv_size' doubles.
+    static ChSharedMemoryChannel* Create(int send_size, int recv_size);
+
+    /// Open the shared memory segment created by the other end, with the given name.
+    /// Returns a null pointer if the segment does not exist or does not match the sizes.
+    static ChSharedMemoryChannel* Open(const std::string& name, int send_size, int recv_size);
+
+    /// Unmap the segment (and remove its name, if created by this end and not removed yet).
+    ~ChSharedMemoryChannel();
+
+    /// Return the name of the segment, to be passed to the other end.
+    const std::string& GetName() const { return m_name; }
+
+    /// Return the random token stored in the segment by the end that created it.
+    /// The other end can send it back to prove that it has opened the same segment.
+    uint64_t GetToken() const;
+
+    /// Remove the name of the segment (the mapping stays valid for both ends).
+    /// Call once the other end has opened the segment.
+    void Unlink();
+
+    /// Set a function called periodically while waiting for the other end; if it
+    /// returns false (e.g. the other process has terminated), the wait is abandoned
+    /// with an exception.
+    void SetPeerCheck(std::function<bool()> check) { m_peer_check = check; }
+
+    /// Return the slot for the next message to send, waiting if the ring is full.
+    /// Fill it with 'send_size' values, then call EndSend().
+    double* BeginSend();
+
+    /// Publish the message written in the slot returned by BeginSend().
+    void EndSend();
+
+    /// Return the next received message ('recv_size' values), waiting for it if needed.
+    /// Call EndReceive() once the values are read.
+    const double* BeginReceive();
+
+    /// Release the slot of the message returned by BeginReceive().
+    void EndReceive();
+
+  private:
+    struct Ring;
+
+    ChSharedMemoryChannel();
+
+    void Map(bool create, int size_a, int size_b);
+    void Wait(const std::function<bool()>& ready);
+
+    std::string m_name;
+    bool m_owner;
+    void* m_memory;
+    size_t m_size;
+    Ring* m_send;
+    Ring* m_recv;
+    double* m_send_slots;
+    double* m_recv_slots;
+    int m_send_size;
+    int m_recv_size;
+    std::function<bool()> m_peer_check;
+};
+
+/// @} cosimulation_module
+
+}  // end namespace cosimul
+}  // end namespace chrono
+
+#endif
@@ -42,6 +42,7 @@ ChCommDistributed::ChCommDistributed(ChSystemDistributed* my_sys) {
     this->data_manager = my_sys->data_manager;
 
     ddm = my_sys->ddm;
+    exchange_pending = false;
 
     /* Create and Commit all custom MPI Data Types */
     // Exchange
@@ -241,31 +242,31 @@ void ChCommDistributed::ProcessShapes(int num_recv, Shape* buf) {
 
 // Handle all necessary communication
 void ChCommDistributed::Exchange() {
+    ExchangeBegin();
+    ExchangeEnd();
+}
+
+void ChCommDistributed::ExchangeBegin() {
     int my_rank = my_sys->my_rank;
     int num_ranks = my_sys->num_ranks;
+
+    ResetNeighbor(neighbor_up, (my_rank != num_ranks - 1) ? my_rank + 1 : -1);
+    ResetNeighbor(neighbor_down, (my_rank != 0) ? my_rank - 1 : -1);
+
+    // Post the receives of the message sizes first, so that they can arrive while packing.
+    // Messages sent down use the tag of the corresponding message sent up, plus one.
+    if (neighbor_up.rank != -1)
+        MPI_Irecv(neighbor_up.recv_counts, 4, MPI_INT, neighbor_up.rank, TAG_COUNTS + 1, my_sys->world,
+                  &neighbor_up.rq_recv_counts);
+    if (neighbor_down.rank != -1)
+        MPI_Irecv(neighbor_down.recv_counts, 4, MPI_INT, neighbor_down.rank, TAG_COUNTS, my_sys->world,
+                  &neighbor_down.rq_recv_counts);
+
     std::forward_list<int> exchanges_up;
     std::forward_list<int> exchanges_down;
 
     // Saves a reference copy for consistency in the threads.
     ddm->curr_status = ddm->comm_status;
-    std::vector<BodyExchange> exchange_up_buf;
-    std::vector<BodyExchange> exchange_down_buf;
-    std::vector<BodyUpdate> update_up_buf;
-    std::vector<BodyUpdate> update_down_buf;
-    std::vector<Shape> shapes_up;
-    std::vector<Shape> shapes_down;
-    std::vector<uint> update_take_up;
-    std::vector<uint> update_take_down;
-
-    // Send Counts
-    int num_exchange_up = 0;
-    int num_exchange_down = 0;
-    int num_update_up = 0;
-    int num_update_down = 0;
-    int num_shapes_up = 0;
-    int num_shapes_down = 0;
-    int num_take_up = 0;
-    int num_take_down = 0;
 
 #pragma omp parallel sections
     {
@@ -285,9 +286,8 @@ void ChCommDistributed::Exchange() {
                 if ((location == distributed::GHOST_UP || location == distributed::SHARED_UP)) {
                     BodyExchange b_ex = {};
                     PackExchange(&b_ex, i);
-                    exchange_up_buf.push_back(b_ex);
+                    neighbor_up.send_exchange.push_back(b_ex);
 
-                    num_exchange_up++;  // TODO might be able to eliminate
                     ddm->comm_status[i] = distributed::SHARED_UP;
                     exchanges_up.push_front(i);
                 }
@@ -299,13 +299,21 @@ void ChCommDistributed::Exchange() {
                 else if ((location == distributed::GHOST_DOWN || location == distributed::SHARED_DOWN)) {
                     BodyExchange b_ex = {};
                     PackExchange(&b_ex, i);
-                    exchange_down_buf.push_back(b_ex);
+                    neighbor_down.send_exchange.push_back(b_ex);
 
-                    num_exchange_down++;  // TODO might be able to eliminate
                     ddm->comm_status[i] = distributed::SHARED_DOWN;
                     exchanges_down.push_front(i);
                 }
             }
+
+            // The shapes of the new ghosts travel with the bodies: the receiver processes
+            // the exchanges before the shapes, so no extra round of messages is needed.
+            for (auto itr_up = exchanges_up.begin(); itr_up != exchanges_up.end(); itr_up++) {
+                PackShapes(&neighbor_up.send_shapes, *itr_up);
+            }
+            for (auto itr_down = exchanges_down.begin(); itr_down != exchanges_down.end(); itr_down++) {
+                PackShapes(&neighbor_down.send_shapes, *itr_down);
+            }
         }  // end of exchange section
 
         // Update Loop
@@ -325,16 +333,13 @@ void ChCommDistributed::Exchange() {
                 if (location == distributed::SHARED_UP && curr_status == distributed::SHARED_UP) {
                     BodyUpdate b_upd = {};
                     PackUpdate(&b_upd, i, distributed::UPDATE);
-                    update_up_buf.push_back(b_upd);
-
-                    num_update_up++;  // TODO might be able to eliminate
+                    neighbor_up.send_update.push_back(b_upd);
                 } else if (location == distributed::GHOST_UP && curr_status == distributed::SHARED_UP) {
                     BodyUpdate b_upd = {};
                     PackUpdate(&b_upd, i, distributed::UPDATE_TRANSFER_SHARE);
-                    update_up_buf.push_back(b_upd);
+                    neighbor_up.send_update.push_back(b_upd);
 
                     ddm->comm_status[i] = distributed::GHOST_UP;
-                    num_update_up++;  // TODO might be able to eliminate
                 }
 
                 // If the body has already been shared, it need only update its
@@ -342,16 +347,13 @@ void ChCommDistributed::Exchange() {
                 else if (location == distributed::SHARED_DOWN && curr_status == distributed::SHARED_DOWN) {
                     BodyUpdate b_upd = {};
                     PackUpdate(&b_upd, i, distributed::UPDATE);
-                    update_down_buf.push_back(b_upd);
-
-                    num_update_down++;  // TODO might be able to eliminate
+                    neighbor_down.send_update.push_back(b_upd);
                 } else if (location == distributed::GHOST_DOWN && curr_status == distributed::SHARED_DOWN) {
                     BodyUpdate b_upd = {};
                     PackUpdate(&b_upd, i, distributed::UPDATE_TRANSFER_SHARE);
-                    update_down_buf.push_back(b_upd);
+                    neighbor_down.send_update.push_back(b_upd);
 
                     ddm->comm_status[i] = distributed::GHOST_DOWN;
-                    num_update_down++;  // TODO might be able to eliminate
                 }
                 // If is shared up/down AND
                 // If the body is no longer involved with this rank, it must be removed from
@@ -359,22 +361,16 @@ void ChCommDistributed::Exchange() {
                 else if ((location == distributed::UNOWNED_UP || location == distributed::UNOWNED_DOWN) &&
                          (ddm->comm_status[i] == distributed::SHARED_UP ||
                           ddm->comm_status[i] == distributed::SHARED_DOWN)) {
-                    int up;
                     if (location == distributed::UNOWNED_UP && my_rank != num_ranks - 1) {
                         GetLog() << "GIVE " << ddm->global_id[i] << " from rank " << my_rank << "\n";
                         BodyUpdate b_upd = {};
                         PackUpdate(&b_upd, i, distributed::FINAL_UPDATE_GIVE);
-                        update_up_buf.push_back(b_upd);
-                        num_update_up++;  // TODO might be able to eliminate
-                        up = 1;
+                        neighbor_up.send_update.push_back(b_upd);
                     } else if (location == distributed::UNOWNED_DOWN && my_rank != 0) {
                         GetLog() << "GIVE " << ddm->global_id[i] << " from rank " << my_rank << "\n";
                         BodyUpdate b_upd = {};
                         PackUpdate(&b_upd, i, distributed::FINAL_UPDATE_GIVE);
-                        update_down_buf.push_back(b_upd);
-
-                        num_update_down++;  // TODO might be able to eliminate
-                        up = -1;
+                        neighbor_down.send_update.push_back(b_upd);
                     }
 
                     my_sys->RemoveBodyExchange(i);
@@ -400,14 +396,11 @@ void ChCommDistributed::Exchange() {
                     if (curr_status == distributed::SHARED_UP) {
                         uint b_ut;
                         PackUpdateTake(&b_ut, i);
-                        update_take_up.push_back(b_ut);
-                        num_take_up++;  // TODO might be able to eliminate
-
+                        neighbor_up.send_take.push_back(b_ut);
                     } else if (curr_status == distributed::SHARED_DOWN) {
                         uint b_ut;
                         PackUpdateTake(&b_ut, i);
-                        update_take_down.push_back(b_ut);
-                        num_take_down++;  // TODO might be able to eliminate
+                        neighbor_down.send_take.push_back(b_ut);
                     }
                     ddm->comm_status[i] = distributed::OWNED;
                 }
@@ -415,274 +408,128 @@ void ChCommDistributed::Exchange() {
         }      // End of update take loop
     }          // End of parallel sections
 
-    MPI_Status status_exchange_up;
-    MPI_Status status_exchange_down;
-    MPI_Status status_update_up;
-    MPI_Status status_update_down;
-    MPI_Status status_take_up;
-    MPI_Status status_take_down;
-    MPI_Status status_shapes_up;
-    MPI_Status status_shapes_down;
-
-    MPI_Request rq_exchange_up;
-    MPI_Request rq_exchange_down;
-    MPI_Request rq_update_up;
-    MPI_Request rq_update_down;
-    MPI_Request rq_take_up;
-    MPI_Request rq_take_down;
-    MPI_Request rq_shapes_up;
-    MPI_Request rq_shapes_down;
-
-    MPI_Status recv_status_exchange_up;
-    MPI_Status recv_status_exchange_down;
-    MPI_Status recv_status_update_up;
-    MPI_Status recv_status_update_down;
-    MPI_Status recv_status_take_up;
-    MPI_Status recv_status_take_down;
-    MPI_Status recv_status_shapes_up;
-    MPI_Status recv_status_shapes_down;
-
-    int num_recv_exchange_up;
-    int num_recv_exchange_down;
-    int num_recv_update_up;
-    int num_recv_update_down;
-    int num_recv_take_up;
-    int num_recv_take_down;
-    int num_recv_shapes_up;
-    int num_recv_shapes_down;
-
-    BodyExchange* recv_exchange_down = NULL;
-    BodyExchange* recv_exchange_up = NULL;
-    BodyUpdate* recv_update_down = NULL;
-    BodyUpdate* recv_update_up = NULL;
-    uint* recv_take_down = NULL;
-    uint* recv_take_up = NULL;
-    Shape* recv_shapes_down = NULL;
-    Shape* recv_shapes_up = NULL;
-
-#pragma omp parallel sections
-    {
-// Send/Recv
-#pragma omp section
-        {
-            // SENDING - TODO sequential for now
-
-            // Send empty message if there is nothing to send
-            if (num_exchange_up == 0) {
-                BodyExchange b_e = {};
-                b_e.gid = UINT_MAX;
-                exchange_up_buf.push_back(b_e);
-                num_exchange_up = 1;
-            }
-            if (num_exchange_down == 0) {
-                BodyExchange b_e = {};
-                b_e.gid = UINT_MAX;
-                exchange_down_buf.push_back(b_e);
-                num_exchange_down = 1;
-            }
-            if (num_update_up == 0) {
-                BodyUpdate b_u = {};
-                b_u.gid = UINT_MAX;
-                update_up_buf.push_back(b_u);
-                num_update_up = 1;
-            }
-            if (num_update_down == 0) {
-                BodyUpdate b_u = {};
-                b_u.gid = UINT_MAX;
-                update_down_buf.push_back(b_u);
-                num_update_down = 1;
-            }
-            if (num_take_up == 0) {
-                update_take_up.push_back(UINT_MAX);
-                num_take_up = 1;
-            }
-            if (num_take_down == 0) {
-                update_take_down.push_back(UINT_MAX);
-                num_take_down = 1;
-            }
-
-            // Send Exchanges
-            if (my_rank != num_ranks - 1) {
-                MPI_Isend(&(exchange_up_buf[0]), num_exchange_up, BodyExchangeType, my_rank + 1, 1, my_sys->world,
-                          &rq_exchange_up);
-            }
-            if (my_rank != 0) {
-                MPI_Isend(&(exchange_down_buf[0]), num_exchange_down, BodyExchangeType, my_rank - 1, 2, my_sys->world,
-                          &rq_exchange_down);
-            }
-
-            // Recv Exchanges
-            if (my_rank != 0) {
-                MPI_Probe(my_rank - 1, 1, my_sys->world, &recv_status_exchange_down);
-                MPI_Get_count(&recv_status_exchange_down, BodyExchangeType, &num_recv_exchange_down);
-                recv_exchange_down = new BodyExchange[num_recv_exchange_down];
-                MPI_Recv(recv_exchange_down, num_recv_exchange_down, BodyExchangeType, my_rank - 1, 1, my_sys->world,
-                         &recv_status_exchange_down);
-            }
-            if (my_rank != num_ranks - 1) {
-                MPI_Probe(my_rank + 1, 2, my_sys->world, &recv_status_exchange_up);
-                MPI_Get_count(&recv_status_exchange_up, BodyExchangeType, &num_recv_exchange_up);
-                recv_exchange_up = new BodyExchange[num_recv_exchange_up];
-                MPI_Recv(recv_exchange_up, num_recv_exchange_up, BodyExchangeType, my_rank + 1, 2, my_sys->world,
-                         &recv_status_exchange_up);
-            }
-
-            // Send Updates
-            if (my_rank != num_ranks - 1) {
-                MPI_Isend(&(update_up_buf[0]), num_update_up, BodyUpdateType, my_rank + 1, 3, my_sys->world,
-                          &rq_update_up);
-            }
-            if (my_rank != 0) {
-                MPI_Isend(&(update_down_buf[0]), num_update_down, BodyUpdateType, my_rank - 1, 4, my_sys->world,
-                          &rq_update_down);
-            }
-
-            // Recv Updates
-            if (my_rank != 0) {
-                MPI_Probe(my_rank - 1, 3, my_sys->world, &recv_status_update_down);
-                MPI_Get_count(&recv_status_update_down, BodyUpdateType, &num_recv_update_down);
-                recv_update_down = new BodyUpdate[num_recv_update_down];
-                MPI_Recv(recv_update_down, num_recv_update_down, BodyUpdateType, my_rank - 1, 3, my_sys->world,
-                         &recv_status_update_down);
-            }
-            if (my_rank != num_ranks - 1) {
-                MPI_Probe(my_rank + 1, 4, my_sys->world, &recv_status_update_up);
-                MPI_Get_count(&recv_status_update_up, BodyUpdateType, &num_recv_update_up);
-                recv_update_up = new BodyUpdate[num_recv_update_up];
-                MPI_Recv(recv_update_up, num_recv_update_up, BodyUpdateType, my_rank + 1, 4, my_sys->world,
-                         &recv_status_update_up);
-            }
+    // Send sizes and then all the non-empty messages, without waiting for the neighbors
+    if (neighbor_up.rank != -1)
+        PostSends(neighbor_up, 0);
+    if (neighbor_down.rank != -1)
+        PostSends(neighbor_down, 1);
 
-            // Send Takes
-            if (my_rank != num_ranks - 1) {
-                MPI_Isend(&(update_take_up[0]), num_take_up, MPI_UNSIGNED, my_rank + 1, 5, my_sys->world, &rq_take_up);
-            }
-            if (my_rank != 0) {
-                MPI_Isend(&(update_take_down[0]), num_take_down, MPI_UNSIGNED, my_rank - 1, 6, my_sys->world,
-                          &rq_take_down);
-            }
-
-            // Recv Takes
-            if (my_rank != 0) {
-                MPI_Probe(my_rank - 1, 5, my_sys->world, &recv_status_take_down);
-                MPI_Get_count(&recv_status_take_down, MPI_UNSIGNED, &num_recv_take_down);
-                recv_take_down = new uint[num_recv_take_down];
-                MPI_Recv(recv_take_down, num_recv_take_down, MPI_UNSIGNED, my_rank - 1, 5, my_sys->world,
-                         &recv_status_take_down);
-            }
-            if (my_rank != num_ranks - 1) {
-                MPI_Probe(my_rank + 1, 6, my_sys->world, &recv_status_take_up);
-                MPI_Get_count(&recv_status_take_up, MPI_UNSIGNED, &num_recv_take_up);
-                recv_take_up = new uint[num_recv_take_up];
-                MPI_Recv(recv_take_up, num_recv_take_up, MPI_UNSIGNED, my_rank + 1, 6, my_sys->world,
-                         &recv_status_take_up);
-            }
-
-            // Make sure all non-blocking communications are done.
-            if (my_rank != num_ranks - 1) {
-                MPI_Wait(&rq_exchange_up, MPI_STATUS_IGNORE);
-                MPI_Wait(&rq_update_up, MPI_STATUS_IGNORE);
-                MPI_Wait(&rq_take_up, MPI_STATUS_IGNORE);
-            }
-            if (my_rank != 0) {
-                MPI_Wait(&rq_exchange_down, MPI_STATUS_IGNORE);
-                MPI_Wait(&rq_update_down, MPI_STATUS_IGNORE);
-                MPI_Wait(&rq_take_down, MPI_STATUS_IGNORE);
-            }
-        }  // End of send/recv section
-
-// TODO could do in parallel if counting the spaces in the buffers in the first pass
-// Pack Shapes Up
-#pragma omp section
-        {
-            for (auto itr_up = exchanges_up.begin(); itr_up != exchanges_up.end(); itr_up++) {
-                num_shapes_up += PackShapes(&shapes_up, *itr_up);
-            }
+    exchange_pending = true;
+}
 
-            if (num_shapes_up == 0) {
-                Shape shape;
-                shape.gid = UINT_MAX;
-                shapes_up.push_back(shape);
-                num_shapes_up = 1;
-            }
-        }  // End of pack shapes up section
+void ChCommDistributed::ExchangeEnd() {
+    if (!exchange_pending)
+        return;
 
-// Pack Shapes Down
-#pragma omp section
-        {
-            for (auto itr_down = exchanges_down.begin(); itr_down != exchanges_down.end(); itr_down++) {
-                num_shapes_down += PackShapes(&shapes_down, *itr_down);
-            }
-            if (num_shapes_down == 0) {
-                Shape shape;
-                shape.gid = UINT_MAX;
-                shapes_down.push_back(shape);
-                num_shapes_down = 1;
-            }
-        }  // End of pack shapes down section
-    }      // End of parallel sections
-
-    // TODO sections?
-    if (my_rank != 0)
-        ProcessExchanges(num_recv_exchange_down, recv_exchange_down, 0);
-    if (my_rank != num_ranks - 1)
-        ProcessExchanges(num_recv_exchange_up, recv_exchange_up, 1);
-    if (my_rank != 0)
-        ProcessUpdates(num_recv_update_down, recv_update_down);
-    if (my_rank != num_ranks - 1)
-        ProcessUpdates(num_recv_update_up, recv_update_up);
-    if (my_rank != 0)
-        ProcessTakes(num_recv_take_down, recv_take_down);
-    if (my_rank != num_ranks - 1)
-        ProcessTakes(num_recv_take_up, recv_take_up);
-
-    // Send Shapes
-    if (my_rank != num_ranks - 1) {
-        MPI_Isend(&(shapes_up[0]), num_shapes_up, ShapeType, my_rank + 1, 7, my_sys->world, &rq_shapes_up);
-    }
-    if (my_rank != 0) {
-        MPI_Isend(&(shapes_down[0]), num_shapes_down, ShapeType, my_rank - 1, 8, my_sys->world, &rq_shapes_down);
+    // As soon as the sizes from a neighbor arrive, post the receives of its messages
+    MPI_Request rq_counts[2] = {MPI_REQUEST_NULL, MPI_REQUEST_NULL};
+    ChCommNeighbor* neighbors[2] = {&neighbor_up, &neighbor_down};
+    int dirs[2] = {1, 0};
+    if (neighbor_up.rank != -1)
+        rq_counts[0] = neighbor_up.rq_recv_counts;
+    if (neighbor_down.rank != -1)
+        rq_counts[1] = neighbor_down.rq_recv_counts;
+    for (int k = 0; k < 2; k++) {
+        int n;
+        MPI_Waitany(2, rq_counts, &n, MPI_STATUS_IGNORE);
+        if (n == MPI_UNDEFINED)
+            break;
+        PostRecvs(*neighbors[n], dirs[n]);
     }
 
-    // Recv Shapes
-    if (my_rank != 0) {
-        MPI_Probe(my_rank - 1, 7, my_sys->world, &recv_status_shapes_down);
-        MPI_Get_count(&recv_status_shapes_down, ShapeType, &num_recv_shapes_down);
-        recv_shapes_down = new Shape[num_recv_shapes_down];
-        MPI_Recv(recv_shapes_down, num_recv_shapes_down, ShapeType, my_rank - 1, 7, my_sys->world,
-                 &recv_status_shapes_down);
-    }
-    if (my_rank != num_ranks - 1) {
-        MPI_Probe(my_rank + 1, 8, my_sys->world, &recv_status_shapes_up);
-        MPI_Get_count(&recv_status_shapes_up, ShapeType, &num_recv_shapes_up);
-        ////GetLog() << "num_recv_shapes_up" << num_recv_shapes_up << "\n";
-        recv_shapes_up = new Shape[num_recv_shapes_up];
-        MPI_Recv(recv_shapes_up, num_recv_shapes_up, ShapeType, my_rank + 1, 8, my_sys->world, &recv_status_shapes_up);
+    // Wait for all messages, then process them in the same order as they are generated
+    MPI_Waitall(4, neighbor_down.rq_recv, MPI_STATUSES_IGNORE);
+    MPI_Waitall(4, neighbor_up.rq_recv, MPI_STATUSES_IGNORE);
+
+    if (!neighbor_down.recv_exchange.empty())
+        ProcessExchanges((int)neighbor_down.recv_exchange.size(), neighbor_down.recv_exchange.data(), 0);
+    if (!neighbor_up.recv_exchange.empty())
+        ProcessExchanges((int)neighbor_up.recv_exchange.size(), neighbor_up.recv_exchange.data(), 1);
+    if (!neighbor_down.recv_update.empty())
+        ProcessUpdates((int)neighbor_down.recv_update.size(), neighbor_down.recv_update.data());
+    if (!neighbor_up.recv_update.empty())
+        ProcessUpdates((int)neighbor_up.recv_update.size(), neighbor_up.recv_update.data());
+    if (!neighbor_down.recv_take.empty())
+        ProcessTakes((int)neighbor_down.recv_take.size(), neighbor_down.recv_take.data());
+    if (!neighbor_up.recv_take.empty())
+        ProcessTakes((int)neighbor_up.recv_take.size(), neighbor_up.recv_take.data());
+    if (!neighbor_down.recv_shapes.empty())
+        ProcessShapes((int)neighbor_down.recv_shapes.size(), neighbor_down.recv_shapes.data());
+    if (!neighbor_up.recv_shapes.empty())
+        ProcessShapes((int)neighbor_up.recv_shapes.size(), neighbor_up.recv_shapes.data());
+
+    // The send buffers can be reused only after the sends completed
+    MPI_Request rq_send[10];
+    int num_send = 0;
+    for (auto neighbor : neighbors) {
+        if (neighbor->rank == -1)
+            continue;
+        rq_send[num_send++] = neighbor->rq_send_counts;
+        for (int i = 0; i < 4; i++)
+            rq_send[num_send++] = neighbor->rq_send[i];
     }
+    MPI_Waitall(num_send, rq_send, MPI_STATUSES_IGNORE);
 
-    if (my_rank != 0)
-        ProcessShapes(num_recv_shapes_down, recv_shapes_down);
-    if (my_rank != num_ranks - 1)
-        ProcessShapes(num_recv_shapes_up, recv_shapes_up);
+    exchange_pending = false;
+}
 
-    if (my_rank != num_ranks - 1) {
-        MPI_Wait(&rq_shapes_up, MPI_STATUS_IGNORE);
-    }
-    if (my_rank != 0) {
-        MPI_Wait(&rq_shapes_down, MPI_STATUS_IGNORE);
+void ChCommDistributed::ResetNeighbor(ChCommNeighbor& neighbor, int rank) {
+    neighbor.rank = rank;
+    neighbor.send_exchange.clear();
+    neighbor.send_update.clear();
+    neighbor.send_take.clear();
+    neighbor.send_shapes.clear();
+    neighbor.recv_exchange.clear();
+    neighbor.recv_update.clear();
+    neighbor.recv_take.clear();
+    neighbor.recv_shapes.clear();
+    neighbor.rq_send_counts = MPI_REQUEST_NULL;
+    neighbor.rq_recv_counts = MPI_REQUEST_NULL;
+    for (int i = 0; i < 4; i++) {
+        neighbor.rq_send[i] = MPI_REQUEST_NULL;
+        neighbor.rq_recv[i] = MPI_REQUEST_NULL;
     }
+}
+
+void ChCommDistributed::PostSends(ChCommNeighbor& neighbor, int dir) {
+    neighbor.send_counts[0] = (int)neighbor.send_exchange.size();
+    neighbor.send_counts[1] = (int)neighbor.send_update.size();
+    neighbor.send_counts[2] = (int)neighbor.send_take.size();
+    neighbor.send_counts[3] = (int)neighbor.send_shapes.size();
+
+    MPI_Isend(neighbor.send_counts, 4, MPI_INT, neighbor.rank, TAG_COUNTS + dir, my_sys->world, &neighbor.rq_send_counts);
+    if (neighbor.send_counts[0] > 0)
+        MPI_Isend(neighbor.send_exchange.data(), neighbor.send_counts[0], BodyExchangeType, neighbor.rank,
+                  TAG_EXCHANGE + dir, my_sys->world, &neighbor.rq_send[0]);
+    if (neighbor.send_counts[1] > 0)
+        MPI_Isend(neighbor.send_update.data(), neighbor.send_counts[1], BodyUpdateType, neighbor.rank,
+                  TAG_UPDATE + dir, my_sys->world, &neighbor.rq_send[1]);
+    if (neighbor.send_counts[2] > 0)
+        MPI_Isend(neighbor.send_take.data(), neighbor.send_counts[2], MPI_UNSIGNED, neighbor.rank,
+                  TAG_TAKE + dir, my_sys->world, &neighbor.rq_send[2]);
+    if (neighbor.send_counts[3] > 0)
+        MPI_Isend(neighbor.send_shapes.data(), neighbor.send_counts[3], ShapeType, neighbor.rank,
+                  TAG_SHAPES + dir, my_sys->world, &neighbor.rq_send[3]);
+}
 
-    // Free all dynamic memory used for recving
-    delete[] recv_exchange_down;
-    delete[] recv_exchange_up;
-    delete[] recv_update_down;
-    delete[] recv_update_up;
-    delete[] recv_take_down;
-    delete[] recv_take_up;
-    delete[] recv_shapes_down;
-    delete[] recv_shapes_up;
-
-    MPI_Barrier(my_sys->world);
+void ChCommDistributed::PostRecvs(ChCommNeighbor& neighbor, int dir) {
+    neighbor.recv_exchange.resize(neighbor.recv_counts[0]);
+    neighbor.recv_update.resize(neighbor.recv_counts[1]);
+    neighbor.recv_take.resize(neighbor.recv_counts[2]);
+    neighbor.recv_shapes.resize(neighbor.recv_counts[3]);
+
+    if (neighbor.recv_counts[0] > 0)
+        MPI_Irecv(neighbor.recv_exchange.data(), neighbor.recv_counts[0], BodyExchangeType, neighbor.rank,
+                  TAG_EXCHANGE + dir, my_sys->world, &neighbor.rq_recv[0]);
+    if (neighbor.recv_counts[1] > 0)
+        MPI_Irecv(neighbor.recv_update.data(), neighbor.recv_counts[1], BodyUpdateType, neighbor.rank,
+                  TAG_UPDATE + dir, my_sys->world, &neighbor.rq_recv[1]);
+    if (neighbor.recv_counts[2] > 0)
+        MPI_Irecv(neighbor.recv_take.data(), neighbor.recv_counts[2], MPI_UNSIGNED, neighbor.rank,
+                  TAG_TAKE + dir, my_sys->world, &neighbor.rq_recv[2]);
+    if (neighbor.recv_counts[3] > 0)
+        MPI_Irecv(neighbor.recv_shapes.data(), neighbor.recv_counts[3], ShapeType, neighbor.rank,
+                  TAG_SHAPES + dir, my_sys->world, &neighbor.rq_recv[3]);
 }
 
 void ChCommDistributed::PackExchange(BodyExchange* buf, int index) {
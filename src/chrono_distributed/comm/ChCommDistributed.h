@@ -15,6 +15,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "chrono/physics/ChBody.h"
 
@@ -64,6 +65,29 @@ typedef struct Shape {
     double data[6];  // B C and shape-specific data
 } Shape;
 
+/// Messages exchanged with one neighbor rank during a call to Exchange.
+/// The four message kinds are, in order: exchanges, updates, takes and shapes.
+typedef struct ChCommNeighbor {
+    int rank;  ///< rank of the neighbor, -1 if none
+
+    std::vector<BodyExchange> send_exchange;
+    std::vector<BodyUpdate> send_update;
+    std::vector<uint> send_take;
+    std::vector<Shape> send_shapes;
+    int send_counts[4];
+
+    std::vector<BodyExchange> recv_exchange;
+    std::vector<BodyUpdate> recv_update;
+    std::vector<uint> recv_take;
+    std::vector<Shape> recv_shapes;
+    int recv_counts[4];
+
+    MPI_Request rq_send_counts;
+    MPI_Request rq_recv_counts;
+    MPI_Request rq_send[4];
+    MPI_Request rq_recv[4];
+} ChCommNeighbor;
+
 /// This class holds functions for processing the system's bodies to determine
 /// when a body needs to be sent to another rank for either an update or for
 /// creation of a ghost. The class also decides how to update the comm_status of
@@ -91,8 +115,17 @@ class CH_DISTR_API ChCommDistributed {
     ///	- need to update their comm_status
     /// Sends updates via mpi to the appropriate rank
     /// Processes incoming updates from other ranks
+    /// Equivalent to ExchangeBegin followed by ExchangeEnd.
     void Exchange();
 
+    /// Packs all outgoing messages and posts them, together with the receives
+    /// of the incoming messages, without blocking.
+    /// Work which does not depend on ghost bodies may be done before calling ExchangeEnd.
+    void ExchangeBegin();
+
+    /// Waits for the messages posted by ExchangeBegin and processes the incoming ones.
+    void ExchangeEnd();
+
   protected:
     ChSystemDistributed* my_sys;
 
@@ -104,7 +137,25 @@ class CH_DISTR_API ChCommDistributed {
     ChParallelDataManager* data_manager;
     ChDistributedDataManager* ddm;
 
+    /// Message tags. Messages sent down use the tag of the same message sent up, plus one.
+    enum { TAG_EXCHANGE = 1, TAG_UPDATE = 3, TAG_TAKE = 5, TAG_SHAPES = 7, TAG_COUNTS = 9 };
+
+    ChCommNeighbor neighbor_up;    ///< messages with rank my_rank + 1
+    ChCommNeighbor neighbor_down;  ///< messages with rank my_rank - 1
+    bool exchange_pending;         ///< true between ExchangeBegin and ExchangeEnd
+
   private:
+    /// Clears the buffers and requests of a neighbor for a new exchange.
+    void ResetNeighbor(ChCommNeighbor& neighbor, int rank);
+
+    /// Posts the sends of the sizes and of the non-empty messages to a neighbor.
+    /// dir is 0 when sending up, 1 when sending down.
+    void PostSends(ChCommNeighbor& neighbor, int dir);
+
+    /// Posts the receives of the non-empty messages from a neighbor, once their sizes are known.
+    /// dir is 0 when receiving from below, 1 when receiving from above.
+    void PostRecvs(ChCommNeighbor& neighbor, int dir);
+
     /// Helper function for processing incoming exchange messages.
     void ProcessExchanges(int num_recv, BodyExchange* buf, int updown);
 
@@ -23,6 +23,7 @@
 
 #include <mpi.h>
 #include <stdlib.h>
+#include <algorithm>
 #include <iostream>
 #include <memory>
 
@@ -33,6 +34,11 @@ ChDomainDistributed::ChDomainDistributed(ChSystemDistributed* sys) {
     split_axis = 0;
     split = false;
     axis_set = false;
+    balance_interval = 0;
+    balance_metric = BODY_COUNT;
+    balance_max_shift = 0.5;
+    balance_steps = 0;
+    balance_load = 0;
 }
 
 ChDomainDistributed::~ChDomainDistributed() {}
@@ -70,13 +76,21 @@ void ChDomainDistributed::SetSimDomain(double xlo, double xhi, double ylo, doubl
 }
 
 void ChDomainDistributed::SplitDomain() {
-    // Length of this subdomain along the long axis
-    double sub_len = (boxhi[split_axis] - boxlo[split_axis]) / my_sys->num_ranks;
+    int num_ranks = my_sys->num_ranks;
+
+    // Length of each subdomain along the long axis
+    double sub_len = (boxhi[split_axis] - boxlo[split_axis]) / num_ranks;
+
+    split_points.resize(num_ranks + 1);
+    for (int i = 0; i < num_ranks; i++) {
+        split_points[i] = boxlo[split_axis] + i * sub_len;
+    }
+    split_points[num_ranks] = boxhi[split_axis];
 
     for (int i = 0; i < 3; i++) {
         if (split_axis == i) {
-            sublo[i] = boxlo[i] + my_sys->my_rank * sub_len;
-            subhi[i] = sublo[i] + sub_len;
+            sublo[i] = split_points[my_sys->my_rank];
+            subhi[i] = split_points[my_sys->my_rank + 1];
         } else {
             sublo[i] = boxlo[i];
             subhi[i] = boxhi[i];
@@ -86,10 +100,95 @@ void ChDomainDistributed::SplitDomain() {
 }
 
 int ChDomainDistributed::GetRank(ChVector<double> pos) {
-    double sub_len = subhi[split_axis] - sublo[split_axis];
-    double pt = pos[split_axis] - boxlo[split_axis];
+    // First interior boundary above the position
+    auto it = std::upper_bound(split_points.begin() + 1, split_points.end() - 1, pos[split_axis]);
+
+    return (int)(it - (split_points.begin() + 1));
+}
+
+void ChDomainDistributed::SetLoadBalancing(int interval, BalanceMetric metric) {
+    balance_interval = interval;
+    balance_metric = metric;
+    balance_steps = 0;
+    balance_load = 0;
+}
+
+void ChDomainDistributed::Balance() {
+    int num_ranks = my_sys->num_ranks;
+    if (balance_interval <= 0 || num_ranks == 1)
+        return;
+
+    if (balance_metric == STEP_TIME) {
+        balance_load += my_sys->data_manager->system_timer.GetTime("step");
+    } else {
+        // Ghost bodies are integrated by their owner: counting them would charge the
+        // boundary layers twice and pull the boundaries towards dense interfaces
+        int count = 0;
+        for (int i = 0; i < my_sys->data_manager->num_rigid_bodies; i++) {
+            int status = my_sys->ddm->comm_status[i];
+            if (status == distributed::OWNED || status == distributed::SHARED_UP || status == distributed::SHARED_DOWN)
+                count++;
+        }
+        balance_load += count;
+    }
+
+    if (++balance_steps < balance_interval)
+        return;
+
+    std::vector<double> loads(num_ranks);
+    MPI_Allgather(&balance_load, 1, MPI_DOUBLE, loads.data(), 1, MPI_DOUBLE, my_sys->world);
+    balance_steps = 0;
+    balance_load = 0;
+
+    // All ranks compute the same boundaries from the same loads
+    ComputeSplitPoints(loads);
+
+    sublo[split_axis] = split_points[my_sys->my_rank];
+    subhi[split_axis] = split_points[my_sys->my_rank + 1];
+}
+
+void ChDomainDistributed::ComputeSplitPoints(const std::vector<double>& loads) {
+    int num_ranks = my_sys->num_ranks;
+
+    double total = 0;
+    for (int i = 0; i < num_ranks; i++) {
+        total += loads[i];
+    }
+    if (total <= 0)
+        return;
+
+    // Position of the boundary k where the cumulative load reaches k/num_ranks of the total,
+    // interpolating linearly within each current sub-domain
+    std::vector<double> target(split_points);
+    int i = 0;
+    double cumulative = 0;
+    for (int k = 1; k < num_ranks; k++) {
+        double goal = total * k / num_ranks;
+        while (i < num_ranks - 1 && cumulative + loads[i] < goal) {
+            cumulative += loads[i];
+            i++;
+        }
+        double frac = (loads[i] > 0) ? (goal - cumulative) / loads[i] : 1.0;
+        frac = std::min(std::max(frac, 0.0), 1.0);
+        target[k] = split_points[i] + frac * (split_points[i + 1] - split_points[i]);
+    }
+
+    // Move the boundaries towards the targets, by at most max_shift, keeping each sub-domain
+    // at least two ghost layers long so that bodies are only shared by neighbor ranks
+    double ghost_layer = my_sys->GetGhostLayer();
+    double max_shift = balance_max_shift * ghost_layer;
+    double min_len = 2 * ghost_layer;
+
+    std::vector<double> points(split_points);
+    for (int k = 1; k < num_ranks; k++) {
+        points[k] = std::min(std::max(target[k], split_points[k] - max_shift), split_points[k] + max_shift);
+        points[k] = std::max(points[k], points[k - 1] + min_len);
+    }
+    for (int k = num_ranks - 1; k > 0; k--) {
+        points[k] = std::min(points[k], points[k + 1] - min_len);
+    }
 
-    return (int)(pt / sub_len);
+    split_points = points;
 }
 
 distributed::COMM_STATUS ChDomainDistributed::GetRegion(double pos) {
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "chrono/core/ChVector.h"
 #include "chrono/physics/ChBody.h"
@@ -28,7 +29,15 @@ namespace chrono {
 class ChSystemDistributed;
 
 /// This class maps sub-domains of the global simulation domain to each MPI rank.
-/// The global domain is split along the longest axis.
+/// The global domain is split in slabs along the longest axis. Only slabs are supported: the exchange
+/// of ghost bodies (ChCommDistributed) assumes each rank has at most one neighbor up and one down.
+/// The slabs initially have equal length; if load balancing is enabled, their boundaries are
+/// periodically moved so that each rank carries about the same load (see SetLoadBalancing).
+///
+/// TODO: decomposition along two or three axes (grid or recursive bisection) is not implemented.
+/// It needs each rank to exchange with up to 26 neighbors, a body to be shared with several ranks
+/// at once (comm_status only distinguishes up and down) and InSub/GetRegion to test every axis.
+/// Until then, slabs must stay longer than two ghost layers, which bounds the number of ranks.
 /// Within each sub-domain, there are layers of ownership:
 ///
 ///
@@ -105,6 +114,12 @@ class ChSystemDistributed;
 
 class CH_DISTR_API ChDomainDistributed {
   public:
+    /// Measure of the load of a rank, used for load balancing.
+    enum BalanceMetric {
+        BODY_COUNT,  ///< number of bodies owned by the rank (owned and shared, not ghost)
+        STEP_TIME    ///< wall-clock time spent by the rank in the time steps
+    };
+
     ChDomainDistributed(ChSystemDistributed* sys);
     virtual ~ChDomainDistributed();
 
@@ -137,6 +152,25 @@ class CH_DISTR_API ChDomainDistributed {
     /// Returns the rank which has ownership of a body with the given position
     int GetRank(ChVector<double> pos);
 
+    /// Returns the coordinates, along the split axis, of the boundaries of all sub-domains.
+    /// Sub-domain i spans [points[i], points[i+1]).
+    const std::vector<double>& GetSplitPoints() const { return split_points; }
+
+    /// Enables load balancing: every interval steps, the boundaries between sub-domains are moved
+    /// so that the load, measured with the given metric, is evenly distributed among the ranks.
+    /// An interval of 0 disables load balancing (default).
+    void SetLoadBalancing(int interval, BalanceMetric metric = BODY_COUNT);
+
+    /// Sets the largest displacement of a sub-domain boundary at each balancing, as a fraction of the ghost layer
+    /// (default 0.5). Bodies change rank through the regular exchange of ghost bodies, which relies on bodies
+    /// moving less than the ghost layer in a step: the displacement of the boundaries adds to that of the bodies.
+    void SetBalanceMaxShift(double fraction) { balance_max_shift = fraction; }
+
+    /// Accumulates the load of this rank over the last step and, if load balancing is enabled and the
+    /// balancing interval is over, moves the sub-domain boundaries. Must be called on all ranks after
+    /// each step, before the exchange of bodies.
+    virtual void Balance();
+
     /// Returns true if the domain has been set.
     bool IsSplit() { return split; }
 
@@ -153,6 +187,8 @@ class CH_DISTR_API ChDomainDistributed {
 
     int split_axis;  ///< Index of the dimension of the longest edge of the global domain
 
+    std::vector<double> split_points;  ///< Boundaries of all sub-domains along the split axis
+
     /// Divides the domain into equal-volume, orthogonal, axis-aligned regions along
     /// the longest axis. Needs to be called right after the system is created so that
     /// bodies are added correctly.
@@ -160,6 +196,16 @@ class CH_DISTR_API ChDomainDistributed {
     bool split;     ///< Flag indicating that the domain has been divided into sub-domains.
     bool axis_set;  ///< Flag indicating that the splitting axis has been set.
 
+    /// Computes new sub-domain boundaries from the loads of all ranks, assuming the load of
+    /// each rank is uniformly distributed in its sub-domain.
+    virtual void ComputeSplitPoints(const std::vector<double>& loads);
+
+    int balance_interval;          ///< Number of steps between load balancing, 0 if disabled
+    BalanceMetric balance_metric;  ///< Measure of the load used for balancing
+    double balance_max_shift;      ///< Largest boundary displacement at each balancing, relative to the ghost layer
+    int balance_steps;             ///< Number of steps since the last balancing
+    double balance_load;           ///< Load accumulated since the last balancing
+
   private:
     /// Helper function that is called by the public GetRegion methods to get
     /// the region classification for a body based on the center position.
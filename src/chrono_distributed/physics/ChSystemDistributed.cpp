@@ -136,6 +136,7 @@ bool ChSystemDistributed::Integrate_Y() {
 
     bool ret = ChSystemParallelSMC::Integrate_Y();
     if (num_ranks != 1) {
+        domain->Balance();
         data_manager->system_timer.start("Exchange");
         comm->Exchange();
         data_manager->system_timer.stop("Exchange");
@@ -905,6 +905,11 @@ unsigned int ChContactSurfaceMesh::GetNumVertices() const {
 }
 
 void ChContactSurfaceMesh::SurfaceSyncCollisionModels() {
+    if (bvh_model) {
+        ((collision::ChModelBullet*)bvh_model)->RefitTriangleProxyBVH();
+        bvh_model->SyncPosition();
+        return;
+    }
     for (unsigned int j = 0; j < vfaces.size(); j++) {
         this->vfaces[j]->GetCollisionModel()->SyncPosition();
     }
@@ -915,6 +920,30 @@ void ChContactSurfaceMesh::SurfaceSyncCollisionModels() {
 
 void ChContactSurfaceMesh::SurfaceAddCollisionModelsToSystem(ChSystem* msys) {
     assert(msys);
+    if (use_bvh && GetNumTriangles() > 0) {
+        // Gather the triangle proxies in a single model. The model borrows the contactable of
+        // the first triangle: all triangles share the identity frame and the same owner mesh.
+        std::vector<collision::ChCollisionModel*> triangle_models;
+        triangle_models.reserve(GetNumTriangles());
+        for (unsigned int j = 0; j < vfaces.size(); j++)
+            triangle_models.push_back(this->vfaces[j]->GetCollisionModel());
+        for (unsigned int j = 0; j < vfaces_rot.size(); j++)
+            triangle_models.push_back(this->vfaces_rot[j]->GetCollisionModel());
+
+        delete bvh_model;
+        bvh_model = new collision::ChModelBullet;
+        if (vfaces.size())
+            bvh_model->SetContactable(vfaces[0].get());
+        else
+            bvh_model->SetContactable(vfaces_rot[0].get());
+        bvh_model->SetFamilyGroup(triangle_models[0]->GetFamilyGroup());
+        bvh_model->SetFamilyMask(triangle_models[0]->GetFamilyMask());
+        ((collision::ChModelBullet*)bvh_model)->AddTriangleProxyBVH(triangle_models);
+
+        SurfaceSyncCollisionModels();
+        msys->GetCollisionSystem()->Add(bvh_model);
+        return;
+    }
     SurfaceSyncCollisionModels();
     for (unsigned int j = 0; j < vfaces.size(); j++) {
         msys->GetCollisionSystem()->Add(this->vfaces[j]->GetCollisionModel());
@@ -926,6 +955,10 @@ void ChContactSurfaceMesh::SurfaceAddCollisionModelsToSystem(ChSystem* msys) {
 
 void ChContactSurfaceMesh::SurfaceRemoveCollisionModelsFromSystem(ChSystem* msys) {
     assert(msys);
+    if (bvh_model) {
+        msys->GetCollisionSystem()->Remove(bvh_model);
+        return;
+    }
     for (unsigned int j = 0; j < vfaces.size(); j++) {
         msys->GetCollisionSystem()->Remove(this->vfaces[j]->GetCollisionModel());
     }
@@ -675,9 +675,9 @@ class ChApiFea ChContactTriangleXYZROT : public ChContactable_3vars<6, 6, 6>, pu
 class ChApiFea ChContactSurfaceMesh : public ChContactSurface {
 
   public:
-    ChContactSurfaceMesh(ChMesh* parentmesh = 0) : ChContactSurface(parentmesh) {}
+    ChContactSurfaceMesh(ChMesh* parentmesh = 0) : ChContactSurface(parentmesh), use_bvh(false), bvh_model(0) {}
 
-    virtual ~ChContactSurfaceMesh() {}
+    virtual ~ChContactSurfaceMesh() { delete bvh_model; }
 
     //
     // FUNCTIONS
@@ -718,6 +718,18 @@ class ChApiFea ChContactSurfaceMesh : public ChContactSurface {
     /// Get the number of vertices.
     unsigned int GetNumVertices() const;
 
+    /// Enable a mesh-level bounding volume hierarchy for collision detection (default: false).
+    /// If enabled, all triangles of this surface enter the collision system as a single collision
+    /// object, whose hierarchy is built once and then refit to the node positions at each step,
+    /// instead of one collision object per triangle. This reduces broadphase work considerably
+    /// for large meshes (ex. tires on terrain); contacts are still reported per triangle.
+    /// Note that, in this mode, the triangles of this surface do not collide with each other.
+    /// Must be set before the mesh is added to the system.
+    void SetUseMeshBVH(bool mval) { use_bvh = mval; }
+
+    /// Tell if the mesh-level bounding volume hierarchy is used for collision detection.
+    bool GetUseMeshBVH() const { return use_bvh; }
+
     // Functions to interface this with ChPhysicsItem container
     virtual void SurfaceSyncCollisionModels();
     virtual void SurfaceAddCollisionModelsToSystem(ChSystem* msys);
@@ -727,6 +739,9 @@ class ChApiFea ChContactSurfaceMesh : public ChContactSurface {
     std::vector<std::shared_ptr<ChContactTriangleXYZ> > vfaces;  //  faces that collide
     std::vector<std::shared_ptr<ChContactTriangleXYZROT> >
         vfaces_rot;  //  faces that collide (for nodes with rotation too)
+
+    bool use_bvh;                             //  use a single collision model with BVH of all faces
+    collision::ChCollisionModel* bvh_model;  //  the mesh-level collision model, if use_bvh
 };
 
 }  // end namespace fea
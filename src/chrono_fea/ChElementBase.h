@@ -15,6 +15,8 @@
 #ifndef CHELEMENTBASE_H
 #define CHELEMENTBASE_H
 
+#include <limits>
+
 #include "chrono/physics/ChContinuumMaterial.h"
 #include "chrono/physics/ChLoadable.h"
 #include "chrono/core/ChMath.h"
@@ -109,6 +111,17 @@ class ChApiFea ChElementBase {
     ///   R += M * v * c
     virtual void EleIntLoadResidual_Mv(ChVectorDynamic<>& R, const ChVectorDynamic<>& w, const double c) {}
 
+    /// Adds the diagonal of the lumped element mass matrix (pasted at global nodes offsets) into
+    /// a global vector Md, multiplied by a scaling factor c, as
+    ///   Md += diag(M_lumped) * c
+    /// This is needed by lumped-mass explicit integrators.
+    virtual void EleIntLoadLumpedMass_Md(ChVectorDynamic<>& Md, const double c) {}
+
+    /// Estimate the critical time step of this element for explicit integration,
+    /// that is 2/w_max, being w_max the highest natural frequency of the free element
+    /// with lumped mass. By default, no limit.
+    virtual double ComputeCriticalTimeStep() { return std::numeric_limits<double>::max(); }
+
     //
     // Functions for interfacing to the solver
     //
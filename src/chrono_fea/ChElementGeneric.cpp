@@ -12,6 +12,8 @@
 // Authors: Alessandro Tasora
 // =============================================================================
 
+#include <cmath>
+
 #include "chrono_fea/ChElementGeneric.h"
 
 namespace chrono {
@@ -63,6 +65,84 @@ void ChElementGeneric::EleIntLoadResidual_Mv(ChVectorDynamic<>& R, const ChVecto
     }
 }
 
+void ChElementGeneric::ComputeLumpedMass(ChMatrixDynamic<>& Md) {
+    int ndofs = this->GetNdofs();
+    ChMatrixDynamic<> mMi(ndofs, ndofs);
+    this->ComputeMmatrixGlobal(mMi);
+
+    Md.Reset(ndofs, 1);
+    for (int i = 0; i < ndofs; i++) {
+        double rowsum = 0;
+        for (int j = 0; j < ndofs; j++)
+            rowsum += mMi(i, j);
+        Md(i) = (rowsum > 0) ? rowsum : mMi(i, i);
+    }
+}
+
+void ChElementGeneric::EleIntLoadLumpedMass_Md(ChVectorDynamic<>& Md, const double c) {
+    ChMatrixDynamic<> mMdi;
+    this->ComputeLumpedMass(mMdi);
+    mMdi.MatrScale(c);
+
+    int stride = 0;
+    for (int in = 0; in < this->GetNnodes(); in++) {
+        int nodedofs = GetNodeNdofs(in);
+        if (!GetNodeN(in)->GetFixed())
+            Md.PasteSumClippedMatrix(mMdi, stride, 0, nodedofs, 1, GetNodeN(in)->NodeGetOffset_w(), 0);
+        stride += nodedofs;
+    }
+}
+
+double ChElementGeneric::ComputeCriticalTimeStep() {
+    int ndofs = this->GetNdofs();
+
+    ChMatrixDynamic<> mMdi;
+    this->ComputeLumpedMass(mMdi);
+
+    ChMatrixDynamic<> mKi(ndofs, ndofs);
+    this->ComputeKRMmatricesGlobal(mKi, 1.0, 0, 0);
+
+    // Power iteration on the symmetric matrix A = Md^-1/2 * K * Md^-1/2, that has the same
+    // eigenvalues w^2 of Md^-1*K. Coordinates without mass are not considered.
+    ChMatrixDynamic<> invsqrtM(ndofs, 1);
+    for (int i = 0; i < ndofs; i++)
+        invsqrtM(i) = (mMdi(i) > 0) ? 1.0 / std::sqrt(mMdi(i)) : 0;
+
+    // start from a zig-zag vector, close to the highest modes
+    ChMatrixDynamic<> x(ndofs, 1);
+    ChMatrixDynamic<> Ax(ndofs, 1);
+    for (int i = 0; i < ndofs; i++)
+        x(i) = ((i % 2) ? -1.0 : 1.0) * (1.0 + 0.1 * i) * (invsqrtM(i) > 0 ? 1 : 0);
+
+    double lambda = 0;
+    for (int iter = 0; iter < 100; iter++) {
+        double norm = x.NormTwo();
+        if (norm == 0)
+            break;
+        x.MatrScale(1.0 / norm);
+
+        for (int i = 0; i < ndofs; i++) {
+            double sum = 0;
+            for (int j = 0; j < ndofs; j++)
+                sum += mKi(i, j) * invsqrtM(j) * x(j);
+            Ax(i) = invsqrtM(i) * sum;
+        }
+
+        double lambda_new = ChMatrix<>::MatrDot(x, Ax);  // Rayleigh quotient, x is normalized
+        x = Ax;
+        if (std::abs(lambda_new - lambda) <= 1e-6 * std::abs(lambda_new)) {
+            lambda = lambda_new;
+            break;
+        }
+        lambda = lambda_new;
+    }
+
+    if (lambda <= 0)
+        return std::numeric_limits<double>::max();
+
+    return 2.0 / std::sqrt(lambda);
+}
+
 void ChElementGeneric::VariablesFbLoadInternalForces(double factor) {
     throw(ChException("ChElementGeneric::VariablesFbLoadInternalForces is deprecated"));
     /*
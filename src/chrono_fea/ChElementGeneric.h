@@ -55,6 +55,22 @@ class ChApiFea ChElementGeneric : public ChElementBase {
     /// implementing this EleIntLoadResidual_Mv function, unless you need faster code.)
     virtual void EleIntLoadResidual_Mv(ChVectorDynamic<>& R, const ChVectorDynamic<>& w, const double c) override;
 
+    /// (This is a default (a bit unoptimal) book keeping that lumps the matrix
+    /// from ComputeMmatrixGlobal, see ComputeLumpedMass. Children classes
+    /// with a known lumped mass can override it for faster code.)
+    virtual void EleIntLoadLumpedMass_Md(ChVectorDynamic<>& Md, const double c) override;
+
+    /// (This is a default implementation that estimates the highest eigenvalue of
+    /// M_lumped^-1*K by power iteration, with K from ComputeKRMmatricesGlobal. Damping is
+    /// not taken into account, so use some safety factor on the result.)
+    virtual double ComputeCriticalTimeStep() override;
+
+    /// Compute the diagonal of the lumped mass matrix of the element, in the
+    /// local ordering of element coordinates. Rows of the mass matrix are summed
+    /// (row-sum lumping); rows whose sum is not positive, as may happen for
+    /// the slope coordinates of ANCF elements, just keep their diagonal term.
+    void ComputeLumpedMass(ChMatrixDynamic<>& Md);
+
     //
     // FEM functions
     //
@@ -409,6 +409,19 @@ class ChApiFea ChElementTetra_4 : public ChElementTetrahedron, public ChLoadable
         nodes[2]->m_TotalMass += this->GetVolume() * this->Material->Get_density() / 4.0;
         nodes[3]->m_TotalMass += this->GetVolume() * this->Material->Get_density() / 4.0;
     }
+
+    /// Lumped mass: a quarter of the element mass goes to each node.
+    virtual void EleIntLoadLumpedMass_Md(ChVectorDynamic<>& Md, const double c) override {
+        double nodemass = c * this->GetVolume() * this->Material->Get_density() / 4.0;
+        for (int in = 0; in < 4; in++) {
+            if (!nodes[in]->GetFixed()) {
+                unsigned int off = nodes[in]->NodeGetOffset_w();
+                Md(off + 0) += nodemass;
+                Md(off + 1) += nodemass;
+                Md(off + 2) += nodemass;
+            }
+        }
+    }
     //
     // Functions for interfacing to the solver
     //            (***not needed, thank to bookkeeping in parent class ChElementGeneric)
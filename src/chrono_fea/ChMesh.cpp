@@ -18,11 +18,14 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include "chrono/core/ChMath.h"
+#include "chrono/parallel/ChTaskScheduler.h"
 #include "chrono/physics/ChLoad.h"
 #include "chrono/physics/ChObject.h"
 #include "chrono/physics/ChSystem.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 #include "chrono_fea/ChElementTetra_4.h"
 #include "chrono_fea/ChMesh.h"
@@ -48,6 +51,8 @@ ChMesh::ChMesh(const ChMesh& other) : ChIndexedNodes(other) {
 
     ncalls_internal_forces = 0;
     ncalls_KRMload = 0;
+
+    element_colors_valid = false;
 }
 
 void ChMesh::SetupInitial() {
@@ -66,6 +71,9 @@ void ChMesh::SetupInitial() {
         //    - precompute matrices, such as the [Kl] local stiffness of each element, if needed, etc.
         velements[i]->SetupInitial(GetSystem());
     }
+
+    // The nodes of the elements may have been set after they were added
+    element_colors_valid = false;
 }
 
 void ChMesh::Relax() {
@@ -89,15 +97,18 @@ void ChMesh::AddNode(std::shared_ptr<ChNodeFEAbase> m_node) {
 
 void ChMesh::AddElement(std::shared_ptr<ChElementBase> m_elem) {
     velements.push_back(m_elem);
+    element_colors_valid = false;
 }
 
 void ChMesh::ClearElements() {
     velements.clear();
+    element_colors_valid = false;
     vcontactsurfaces.clear();
 }
 
 void ChMesh::ClearNodes() {
     velements.clear();
+    element_colors_valid = false;
     vnodes.clear();
     vcontactsurfaces.clear();
 }
@@ -116,6 +127,40 @@ void ChMesh::AddMeshSurface(std::shared_ptr<ChMeshSurface> m_surf) {
     vmeshsurfaces.push_back(m_surf);
 }
 
+int ChMesh::GetMaxTasks() const {
+    return system ? system->GetParallelThreadNumber() : 0;
+}
+
+void ChMesh::ColorElements() {
+    element_colors.clear();
+
+    // Greedy coloring, in the order of the elements: each element takes the first
+    // color which is not used yet by any of its nodes.
+    std::unordered_map<ChNodeFEAbase*, std::vector<int>> node_colors;
+    for (int ie = 0; ie < (int)velements.size(); ie++) {
+        int num_nodes = velements[ie]->GetNnodes();
+        int color = 0;
+        bool found = false;
+        while (!found) {
+            found = true;
+            for (int in = 0; in < num_nodes && found; in++) {
+                const auto& used = node_colors[velements[ie]->GetNodeN(in).get()];
+                found = std::find(used.begin(), used.end(), color) == used.end();
+            }
+            if (!found)
+                color++;
+        }
+
+        for (int in = 0; in < num_nodes; in++)
+            node_colors[velements[ie]->GetNodeN(in).get()].push_back(color);
+        if (color == (int)element_colors.size())
+            element_colors.push_back(std::vector<int>());
+        element_colors[color].push_back(ie);
+    }
+
+    element_colors_valid = true;
+}
+
 /// This recomputes the number of DOFs, constraints,
 /// as well as state offsets of contained items
 void ChMesh::Setup() {
@@ -137,13 +182,19 @@ void ChMesh::Setup() {
 // Updates all time-dependant variables, if any...
 // Ex: maybe the elasticity can increase in time, etc.
 void ChMesh::Update(double m_time, bool update_assets) {
+    CH_TRACE("ChMesh::Update");
+
     // Parent class update
     ChIndexedNodes::Update(m_time, update_assets);
 
-    for (unsigned int i = 0; i < velements.size(); i++) {
-        //    - update auxiliary stuff, ex. update element's rotation matrices if corotational..
-        velements[i]->Update();
-    }
+    ChTaskScheduler::GetInstance().ParallelFor(0, (int)velements.size(),
+                                               [&](int first, int last) {
+                                                   //    - update auxiliary stuff, ex. update element's
+                                                   //      rotation matrices if corotational..
+                                                   for (int i = first; i < last; i++)
+                                                       velements[i]->Update();
+                                               },
+                                               0, GetMaxTasks());
 }
 
 void ChMesh::SyncCollisionModels() {
@@ -251,6 +302,8 @@ void ChMesh::IntLoadResidual_F(const unsigned int off,
                                ChVectorDynamic<>& R,   
                                const double c          
                                ) {
+    CH_TRACE("ChMesh::IntLoadResidual_F");
+
     // applied nodal forces
     unsigned int local_off_v = 0;
     for (unsigned int j = 0; j < vnodes.size(); j++) {
@@ -261,10 +314,20 @@ void ChMesh::IntLoadResidual_F(const unsigned int off,
     }
 
     // internal forces
+    // Elements sharing a node add to the same entries of R: only the elements of one color
+    // run concurrently. The colors are processed in the same order whatever the number of
+    // tasks, so the result does not depend on it.
     timer_internal_forces.start();
-#pragma omp parallel for schedule(dynamic, 4)
-    for (int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_F(R, c);
+    if (!element_colors_valid)
+        ColorElements();
+    for (const auto& color : element_colors) {
+        ChTaskScheduler::GetInstance().ParallelFor(0, (int)color.size(),
+                                                   [&](int first, int last) {
+                                                       CH_TRACE("ChMesh::InternalForces");
+                                                       for (int i = first; i < last; i++)
+                                                           velements[color[i]]->EleIntLoadResidual_F(R, c);
+                                                   },
+                                                   4, GetMaxTasks());
     }
     timer_internal_forces.stop();
     ncalls_internal_forces++;
@@ -312,6 +375,14 @@ void ChMesh::ComputeMassProperties(double& mass,           // ChMesh object mass
         mass += vnodes[j]->m_TotalMass;
     }
 }
+double ChMesh::ComputeCriticalTimeStep() {
+    double dt_crit = std::numeric_limits<double>::max();
+    for (unsigned int ie = 0; ie < velements.size(); ie++) {
+        dt_crit = std::min(dt_crit, velements[ie]->ComputeCriticalTimeStep());
+    }
+    return dt_crit;
+}
+
 void ChMesh::IntLoadResidual_Mv(const unsigned int off,      ///< offset in R residual
                                 ChVectorDynamic<>& R,        ///< result: the R residual, R += c*M*v
                                 const ChVectorDynamic<>& w,  ///< the w vector
@@ -332,6 +403,25 @@ void ChMesh::IntLoadResidual_Mv(const unsigned int off,      ///< offset in R re
     }
 }
 
+void ChMesh::IntLoadLumpedMass_Md(const unsigned int off,  ///< offset in Md vector
+                                  ChVectorDynamic<>& Md,   ///< result: Md vector, diagonal of the lumped mass matrix
+                                  const double c           ///< a scaling factor
+                                  ) {
+    // nodal masses
+    unsigned int local_off_v = 0;
+    for (unsigned int j = 0; j < vnodes.size(); j++) {
+        if (!vnodes[j]->GetFixed()) {
+            vnodes[j]->NodeIntLoadLumpedMass_Md(off + local_off_v, Md, c);
+            local_off_v += vnodes[j]->Get_ndof_w();
+        }
+    }
+
+    // internal masses
+    for (unsigned int ie = 0; ie < velements.size(); ie++) {
+        velements[ie]->EleIntLoadLumpedMass_Md(Md, c);
+    }
+}
+
 void ChMesh::IntToDescriptor(const unsigned int off_v,
                              const ChStateDelta& v,
                              const ChVectorDynamic<>& R,
@@ -369,9 +459,13 @@ void ChMesh::InjectKRMmatrices(ChSystemDescriptor& mdescriptor) {
 
 void ChMesh::KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) {
     timer_KRMload.start();
-#pragma omp parallel for
-    for (int ie = 0; ie < velements.size(); ie++)
-        velements[ie]->KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
+    ChTaskScheduler::GetInstance().ParallelFor(0, (int)velements.size(),
+                                               [&](int first, int last) {
+                                                   CH_TRACE("ChMesh::KRMmatricesLoad");
+                                                   for (int ie = first; ie < last; ie++)
+                                                       velements[ie]->KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
+                                               },
+                                               0, GetMaxTasks());
     timer_KRMload.stop();
     ncalls_KRMload++;
 }
@@ -56,6 +56,9 @@ class ChApiFea ChMesh : public ChIndexedNodes {
     int ncalls_internal_forces;
     int ncalls_KRMload;
 
+    std::vector<std::vector<int>> element_colors;  ///< indices of elements with no node in common, per color
+    bool element_colors_valid;                     ///< false if the elements changed since the coloring
+
   public:
     ChMesh()
         : n_dofs(0),
@@ -63,7 +66,8 @@ class ChApiFea ChMesh : public ChIndexedNodes {
           automatic_gravity_load(true),
           num_points_gravity(1),
           ncalls_internal_forces(0),
-          ncalls_KRMload(0) {}
+          ncalls_KRMload(0),
+          element_colors_valid(false) {}
     ChMesh(const ChMesh& other);
     ~ChMesh() {}
 
@@ -72,6 +76,10 @@ class ChApiFea ChMesh : public ChIndexedNodes {
 
     void AddNode(std::shared_ptr<ChNodeFEAbase> m_node);
     void AddElement(std::shared_ptr<ChElementBase> m_elem);
+    /// Preallocate room for n more nodes, to avoid reallocations when adding many nodes.
+    void ReserveNodes(unsigned int n) { vnodes.reserve(vnodes.size() + n); }
+    /// Preallocate room for n more elements, to avoid reallocations when adding many elements.
+    void ReserveElements(unsigned int n) { velements.reserve(velements.size() + n); }
     void ClearNodes();
     void ClearElements();
 
@@ -99,6 +107,10 @@ class ChApiFea ChMesh : public ChIndexedNodes {
     /// Override default in ChPhysicsItem.
     virtual bool GetCollide() const override { return true; }
 
+    /// The mesh update only involves the elements (the nodes, read by the
+    /// collision system, are not modified), so it can overlap collision detection.
+    virtual bool CanUpdateDuringCollision() const override { return true; }
+
     /// Reset counters for internal force and Jacobian evaluations.
     void ResetCounters() {
         ncalls_internal_forces = 0;
@@ -178,6 +190,10 @@ class ChApiFea ChMesh : public ChIndexedNodes {
                                ChMatrix33<>& inertia  ///< ChMesh inertia tensor
                                );
 
+    /// Estimate the largest stable time step for explicit integration,
+    /// as the minimum of the critical time steps of the elements.
+    virtual double ComputeCriticalTimeStep() override;
+
     //
     // STATE FUNCTIONS
     //
@@ -205,6 +221,7 @@ class ChApiFea ChMesh : public ChIndexedNodes {
                                     ChVectorDynamic<>& R,
                                     const ChVectorDynamic<>& w,
                                     const double c) override;
+    virtual void IntLoadLumpedMass_Md(const unsigned int off, ChVectorDynamic<>& Md, const double c) override;
     virtual void IntToDescriptor(const unsigned int off_v,
                                  const ChStateDelta& v,
                                  const ChVectorDynamic<>& R,
@@ -269,6 +286,14 @@ class ChApiFea ChMesh : public ChIndexedNodes {
     virtual void InjectVariables(ChSystemDescriptor& mdescriptor) override;
 
   private:
+    /// Maximum number of concurrent tasks for loops over the elements
+    /// (the thread number of the owning system, if any).
+    int GetMaxTasks() const;
+
+    /// Group the elements in colors, such that the elements of a color do not share any node
+    /// and can add their contributions to a global vector concurrently.
+    void ColorElements();
+
     /// Initial setup (before analysis).
     /// This function is called from ChSystem::SetupInitial, marking a point where system
     /// construction is completed.
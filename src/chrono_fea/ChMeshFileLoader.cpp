@@ -15,11 +15,14 @@
 // =============================================================================
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <functional>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include "chrono/core/ChMath.h"
 #include "chrono/physics/ChSystem.h"
@@ -452,6 +455,267 @@ void ChMeshFileLoader::FromAbaqusFile(std::shared_ptr<ChMesh> mesh,
     }
 }
 
+// -----------------------------------------------------------------------------
+// Binary mesh files
+// -----------------------------------------------------------------------------
+
+namespace {
+
+const char binary_mesh_tag[8] = {'C', 'H', 'M', 'E', 'S', 'H', 'B', '1'};
+const uint32_t binary_mesh_version = 1;
+
+// Flag: tetrahedrons converted from an Abaqus file. Their nodes are stored in the order used by
+// FromAbaqusFile for ChElementTetra_4, so the first and last nodes must be swapped for ChElementTetra_4_P.
+const uint32_t binary_mesh_abaqus_order = 1;
+
+void WriteBinaryMesh(std::shared_ptr<ChMesh> mesh,
+                     const char* filename,
+                     const std::map<std::string, std::vector<std::shared_ptr<ChNodeFEAbase>>>& node_sets,
+                     uint32_t flags) {
+    uint64_t nnodes = mesh->GetNnodes();
+    uint64_t ntets = mesh->GetNelements();
+    uint64_t nsets = node_sets.size();
+
+    std::unordered_map<ChNodeFEAbase*, uint32_t> node_index;
+    node_index.reserve(nnodes);
+    std::vector<double> coords(3 * nnodes);
+    for (uint64_t i = 0; i < nnodes; ++i) {
+        const std::shared_ptr<ChNodeFEAbase>& node = mesh->GetNodes()[i];
+        ChVector<> pos;
+        if (auto mnode = std::dynamic_pointer_cast<ChNodeFEAxyz>(node))
+            pos = mnode->GetX0();
+        else if (auto mnode = std::dynamic_pointer_cast<ChNodeFEAxyzP>(node))
+            pos = mnode->GetPos();
+        else
+            throw ChException("ERROR saving binary mesh file, only ChNodeFEAxyz or ChNodeFEAxyzP nodes supported.\n");
+        coords[3 * i + 0] = pos.x();
+        coords[3 * i + 1] = pos.y();
+        coords[3 * i + 2] = pos.z();
+        node_index[node.get()] = (uint32_t)i;
+    }
+
+    std::vector<uint32_t> tets(4 * ntets);
+    for (uint64_t ie = 0; ie < ntets; ++ie) {
+        auto mel = mesh->GetElement((unsigned int)ie);
+        bool poisson_element = std::dynamic_pointer_cast<ChElementTetra_4_P>(mel) != nullptr;
+        if (!std::dynamic_pointer_cast<ChElementTetra_4>(mel) && !poisson_element)
+            throw ChException("ERROR saving binary mesh file, only 4-nodes tetrahedrons supported.\n");
+        for (int in = 0; in < 4; ++in)
+            tets[4 * ie + in] = node_index.at(mel->GetNodeN(in).get());
+        // Inverse of the swap done when loading
+        if (poisson_element && (flags & binary_mesh_abaqus_order))
+            std::swap(tets[4 * ie + 0], tets[4 * ie + 3]);
+    }
+
+    ofstream fout(filename, ios::binary);
+    if (!fout.good())
+        throw ChException("ERROR opening binary mesh file for writing: " + std::string(filename) + "\n");
+
+    fout.write(binary_mesh_tag, sizeof(binary_mesh_tag));
+    fout.write((const char*)&binary_mesh_version, sizeof(uint32_t));
+    fout.write((const char*)&flags, sizeof(uint32_t));
+    fout.write((const char*)&nnodes, sizeof(uint64_t));
+    fout.write((const char*)&ntets, sizeof(uint64_t));
+    fout.write((const char*)&nsets, sizeof(uint64_t));
+    fout.write((const char*)coords.data(), coords.size() * sizeof(double));
+    fout.write((const char*)tets.data(), tets.size() * sizeof(uint32_t));
+
+    for (auto& set : node_sets) {
+        uint32_t namelength = (uint32_t)set.first.size();
+        uint64_t nsetnodes = set.second.size();
+        std::vector<uint32_t> setnodes(nsetnodes);
+        for (uint64_t i = 0; i < nsetnodes; ++i)
+            setnodes[i] = node_index.at(set.second[i].get());
+        fout.write((const char*)&namelength, sizeof(uint32_t));
+        fout.write(set.first.data(), namelength);
+        fout.write((const char*)&nsetnodes, sizeof(uint64_t));
+        fout.write((const char*)setnodes.data(), setnodes.size() * sizeof(uint32_t));
+    }
+
+    if (!fout.good())
+        throw ChException("ERROR writing binary mesh file: " + std::string(filename) + "\n");
+}
+
+// Sequential reader from the in-memory image of the whole file, with bounds checking.
+class BinaryMeshBuffer {
+  public:
+    BinaryMeshBuffer(const char* filename) : name(filename), cursor(0) {
+        ifstream fin(filename, ios::binary | ios::ate);
+        if (!fin.good())
+            throw ChException("ERROR opening binary mesh file: " + name + "\n");
+        std::streamsize size = fin.tellg();
+        fin.seekg(0, ios::beg);
+        data.resize((size_t)size);
+        if (!fin.read(data.data(), size))
+            throw ChException("ERROR reading binary mesh file: " + name + "\n");
+    }
+
+    // Get a pointer to the next n bytes, and move past them.
+    const char* Take(uint64_t n) {
+        if (n > data.size() - cursor)
+            throw ChException("ERROR in binary mesh file, unexpected end of file: " + name + "\n");
+        const char* ptr = data.data() + cursor;
+        cursor += (size_t)n;
+        return ptr;
+    }
+
+    // Get a pointer to the next array of 'count' elements of 'size' bytes, and move past it.
+    // The size of the array is checked against the bytes left, so a corrupted count cannot overflow.
+    const char* TakeArray(uint64_t count, size_t size) {
+        if (count > (data.size() - cursor) / size)
+            throw ChException("ERROR in binary mesh file, unexpected end of file: " + name + "\n");
+        return Take(count * size);
+    }
+
+    template <typename T>
+    T Read() {
+        T val;
+        std::memcpy(&val, Take(sizeof(T)), sizeof(T));
+        return val;
+    }
+
+    std::string name;
+
+  private:
+    std::vector<char> data;
+    size_t cursor;
+};
+
+}  // end anonymous namespace
+
+void ChMeshFileLoader::FromBinaryFile(std::shared_ptr<ChMesh> mesh,
+                                      const char* filename,
+                                      std::shared_ptr<ChContinuumMaterial> my_material,
+                                      std::map<std::string, std::vector<std::shared_ptr<ChNodeFEAbase>>>& node_sets,
+                                      ChVector<> pos_transform,
+                                      ChMatrix33<> rot_transform,
+                                      bool* abaqus_order) {
+    auto elastic_material = std::dynamic_pointer_cast<ChContinuumElastic>(my_material);
+    auto poisson_material = std::dynamic_pointer_cast<ChContinuumPoisson3D>(my_material);
+    if (!elastic_material && !poisson_material)
+        throw ChException("ERROR in binary mesh loading. Material type not supported. \n");
+
+    BinaryMeshBuffer buffer(filename);
+
+    if (std::memcmp(buffer.Take(sizeof(binary_mesh_tag)), binary_mesh_tag, sizeof(binary_mesh_tag)) != 0)
+        throw ChException("ERROR in binary mesh file, not a Chrono binary mesh: " + buffer.name + "\n");
+    if (buffer.Read<uint32_t>() != binary_mesh_version)
+        throw ChException("ERROR in binary mesh file, unsupported version: " + buffer.name + "\n");
+    uint32_t flags = buffer.Read<uint32_t>();
+    uint64_t nnodes = buffer.Read<uint64_t>();
+    uint64_t ntets = buffer.Read<uint64_t>();
+    uint64_t nsets = buffer.Read<uint64_t>();
+    if (abaqus_order)
+        *abaqus_order = (flags & binary_mesh_abaqus_order) != 0;
+
+    const char* coords = buffer.TakeArray(nnodes, 3 * sizeof(double));
+    const char* tets = buffer.TakeArray(ntets, 4 * sizeof(uint32_t));
+
+    // Nodes
+    std::vector<std::shared_ptr<ChNodeFEAbase>> nodes(nnodes);
+    mesh->ReserveNodes((unsigned int)nnodes);
+    for (uint64_t i = 0; i < nnodes; ++i) {
+        double xyz[3];
+        std::memcpy(xyz, coords + i * 3 * sizeof(double), 3 * sizeof(double));
+
+        ChVector<> node_position(xyz[0], xyz[1], xyz[2]);
+        node_position = rot_transform * node_position;  // rotate/scale, if needed
+        node_position = pos_transform + node_position;  // move, if needed
+
+        if (elastic_material)
+            nodes[i] = std::make_shared<ChNodeFEAxyz>(node_position);
+        else
+            nodes[i] = std::make_shared<ChNodeFEAxyzP>(node_position);
+        mesh->AddNode(nodes[i]);
+    }
+
+    // Tetrahedrons
+    bool swap_first_last = poisson_material && (flags & binary_mesh_abaqus_order);
+    mesh->ReserveElements((unsigned int)ntets);
+    for (uint64_t ie = 0; ie < ntets; ++ie) {
+        uint32_t n[4];
+        std::memcpy(n, tets + ie * 4 * sizeof(uint32_t), 4 * sizeof(uint32_t));
+        for (int in = 0; in < 4; ++in)
+            if (n[in] >= nnodes)
+                throw ChException("ERROR in binary mesh file, node ID out of range in tetrahedron " +
+                                  std::to_string(ie) + "\n");
+        if (swap_first_last)
+            std::swap(n[0], n[3]);
+
+        if (elastic_material) {
+            auto mel = std::make_shared<ChElementTetra_4>();
+            mel->SetNodes(std::static_pointer_cast<ChNodeFEAxyz>(nodes[n[0]]),
+                          std::static_pointer_cast<ChNodeFEAxyz>(nodes[n[1]]),
+                          std::static_pointer_cast<ChNodeFEAxyz>(nodes[n[2]]),
+                          std::static_pointer_cast<ChNodeFEAxyz>(nodes[n[3]]));
+            mel->SetMaterial(elastic_material);
+            mesh->AddElement(mel);
+        } else {
+            auto mel = std::make_shared<ChElementTetra_4_P>();
+            mel->SetNodes(std::static_pointer_cast<ChNodeFEAxyzP>(nodes[n[0]]),
+                          std::static_pointer_cast<ChNodeFEAxyzP>(nodes[n[1]]),
+                          std::static_pointer_cast<ChNodeFEAxyzP>(nodes[n[2]]),
+                          std::static_pointer_cast<ChNodeFEAxyzP>(nodes[n[3]]));
+            mel->SetMaterial(poisson_material);
+            mesh->AddElement(mel);
+        }
+    }
+
+    // Node sets
+    for (uint64_t is = 0; is < nsets; ++is) {
+        uint32_t namelength = buffer.Read<uint32_t>();
+        std::string name(buffer.Take(namelength), namelength);
+        uint64_t nsetnodes = buffer.Read<uint64_t>();
+        const char* setnodes = buffer.TakeArray(nsetnodes, sizeof(uint32_t));
+
+        auto new_set = node_sets.insert(std::make_pair(name, std::vector<std::shared_ptr<ChNodeFEAbase>>()));
+        if (!new_set.second)
+            throw ChException("ERROR in binary mesh file, multiple node sets with same name: " + name + "\n");
+        std::vector<std::shared_ptr<ChNodeFEAbase>>& set_vector = new_set.first->second;
+        set_vector.reserve(nsetnodes);
+        for (uint64_t i = 0; i < nsetnodes; ++i) {
+            uint32_t idnode;
+            std::memcpy(&idnode, setnodes + i * sizeof(uint32_t), sizeof(uint32_t));
+            if (idnode >= nnodes)
+                throw ChException("ERROR in binary mesh file, node ID out of range in node set " + name + "\n");
+            set_vector.push_back(nodes[idnode]);
+        }
+    }
+}
+
+void ChMeshFileLoader::FromBinaryFile(std::shared_ptr<ChMesh> mesh,
+                                      const char* filename,
+                                      std::shared_ptr<ChContinuumMaterial> my_material,
+                                      ChVector<> pos_transform,
+                                      ChMatrix33<> rot_transform) {
+    std::map<std::string, std::vector<std::shared_ptr<ChNodeFEAbase>>> node_sets;
+    FromBinaryFile(mesh, filename, my_material, node_sets, pos_transform, rot_transform);
+}
+
+void ChMeshFileLoader::ToBinaryFile(
+    std::shared_ptr<ChMesh> mesh,
+    const char* filename,
+    const std::map<std::string, std::vector<std::shared_ptr<ChNodeFEAbase>>>& node_sets,
+    bool abaqus_order) {
+    WriteBinaryMesh(mesh, filename, node_sets, abaqus_order ? binary_mesh_abaqus_order : 0);
+}
+
+void ChMeshFileLoader::TetGenToBinaryFile(const char* filename_node,
+                                          const char* filename_ele,
+                                          const char* filename_bin) {
+    auto mesh = std::make_shared<ChMesh>();
+    FromTetGenFile(mesh, filename_node, filename_ele, std::make_shared<ChContinuumElastic>());
+    WriteBinaryMesh(mesh, filename_bin, std::map<std::string, std::vector<std::shared_ptr<ChNodeFEAbase>>>(), 0);
+}
+
+void ChMeshFileLoader::AbaqusToBinaryFile(const char* filename, const char* filename_bin, bool discard_unused_nodes) {
+    auto mesh = std::make_shared<ChMesh>();
+    std::map<std::string, std::vector<std::shared_ptr<ChNodeFEAbase>>> node_sets;
+    FromAbaqusFile(mesh, filename, std::make_shared<ChContinuumElastic>(), node_sets, VNULL, ChMatrix33<>(1),
+                   discard_unused_nodes);
+    WriteBinaryMesh(mesh, filename_bin, node_sets, binary_mesh_abaqus_order);
+}
+
 void ChMeshFileLoader::ANCFShellFromGMFFile(std::shared_ptr<ChMesh> mesh,
                                             const char* filename,
                                             std::shared_ptr<ChMaterialShellANCF> my_material,
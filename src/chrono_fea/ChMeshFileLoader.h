@@ -66,6 +66,60 @@ class ChApiFea ChMeshFileLoader {
             true  ///< if true, Abaqus nodes that are not used in elements or sets are not imported in C::E
     );
 
+    /// Load tetrahedrons, and optional node sets, from a binary mesh file as saved by ToBinaryFile,
+    /// TetGenToBinaryFile or AbaqusToBinaryFile. This is much faster than parsing the text formats:
+    /// the file is read in a single block and nodes and elements are created in bulk.
+    /// The binary format, in native byte order, is:
+    ///   ["CHMESHB1"] [version (uint32)] [flags (uint32)] [# of nodes (uint64)] [# of tets (uint64)] [# of sets (uint64)]
+    ///   [x y z (3 doubles)] for each node
+    ///   [node indexes, zero based (4 uint32)] for each tetrahedron
+    ///   [name length (uint32)] [name chars] [# of nodes (uint64)] [node indexes (uint32)] for each node set
+    /// As for the text loaders, the material decides the type of nodes and elements.
+    static void FromBinaryFile(
+        std::shared_ptr<ChMesh> mesh,                      ///< destination mesh
+        const char* filename,                              ///< input file name
+        std::shared_ptr<ChContinuumMaterial> my_material,  ///< material for the created tetahedrons
+        std::map<std::string, std::vector<std::shared_ptr<ChNodeFEAbase> > >&
+            node_sets,                                 ///< vect of vectors of 'marked'nodes
+        ChVector<> pos_transform = VNULL,              ///< optional displacement of imported mesh
+        ChMatrix33<> rot_transform = ChMatrix33<>(1),  ///< optional rotation/scaling of imported mesh
+        bool* abaqus_order = nullptr  ///< optional output: true if the file stores tetrahedrons in Abaqus node order
+    );
+
+    /// Load tetrahedrons from a binary mesh file, discarding node sets, if any.
+    static void FromBinaryFile(
+        std::shared_ptr<ChMesh> mesh,                      ///< destination mesh
+        const char* filename,                              ///< input file name
+        std::shared_ptr<ChContinuumMaterial> my_material,  ///< material for the created tetahedrons
+        ChVector<> pos_transform = VNULL,                  ///< optional displacement of imported mesh
+        ChMatrix33<> rot_transform = ChMatrix33<>(1)       ///< optional rotation/scaling of imported mesh
+    );
+
+    /// Save the nodes and the 4-nodes tetrahedrons of a mesh, plus optional node sets, in the
+    /// binary format read by FromBinaryFile. Only meshes of ChElementTetra_4 or ChElementTetra_4_P are supported.
+    /// To save again a mesh loaded from a file in Abaqus node order (see FromBinaryFile), pass the flag that
+    /// was read, so that the file can still be loaded with either type of material.
+    static void ToBinaryFile(
+        std::shared_ptr<ChMesh> mesh,  ///< mesh to save
+        const char* filename,          ///< output file name
+        const std::map<std::string, std::vector<std::shared_ptr<ChNodeFEAbase> > >& node_sets =
+            std::map<std::string, std::vector<std::shared_ptr<ChNodeFEAbase> > >(),  ///< optional node sets
+        bool abaqus_order = false  ///< store the tetrahedrons in Abaqus node order
+    );
+
+    /// Convert .node and .ele TetGen files into a binary mesh file, to be loaded later with FromBinaryFile.
+    static void TetGenToBinaryFile(const char* filename_node,  ///< name of the .node file
+                                   const char* filename_ele,   ///< name of the .ele  file
+                                   const char* filename_bin    ///< name of the output binary file
+    );
+
+    /// Convert an Abaqus .inp file, with its node sets, into a binary mesh file,
+    /// to be loaded later with FromBinaryFile.
+    static void AbaqusToBinaryFile(const char* filename,       ///< input .inp file name
+                                   const char* filename_bin,   ///< name of the output binary file
+                                   bool discard_unused_nodes = true  ///< as in FromAbaqusFile
+    );
+
     static void ANCFShellFromGMFFile(
         std::shared_ptr<ChMesh> mesh,                      ///< destination mesh
         const char* filename,                              ///< complete filename
@@ -159,6 +159,12 @@ void ChNodeFEAcurv::NodeIntLoadResidual_Mv(const unsigned int off,
     }
 }
 
+void ChNodeFEAcurv::NodeIntLoadLumpedMass_Md(const unsigned int off, ChVectorDynamic<>& Md, const double c) {
+    for (int i = 0; i < 9; i++) {
+        Md(off + i) += c * GetMassDiagonal()(i);
+    }
+}
+
 void ChNodeFEAcurv::NodeIntToDescriptor(const unsigned int off_v, const ChStateDelta& v, const ChVectorDynamic<>& R) {
     m_variables->Get_qb().PasteClippedMatrix(v, off_v, 0, 9, 1, 0, 0);
     m_variables->Get_fb().PasteClippedMatrix(R, off_v, 0, 9, 1, 0, 0);
@@ -124,6 +124,7 @@ class ChApiFea ChNodeFEAcurv : public ChNodeFEAbase {
                                         ChVectorDynamic<>& R,
                                         const ChVectorDynamic<>& w,
                                         const double c) override;
+    virtual void NodeIntLoadLumpedMass_Md(const unsigned int off, ChVectorDynamic<>& Md, const double c) override;
     virtual void NodeIntToDescriptor(const unsigned int off_v,
                                      const ChStateDelta& v,
                                      const ChVectorDynamic<>& R) override;
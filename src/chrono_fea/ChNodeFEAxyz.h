@@ -127,6 +127,12 @@ class ChApiFea ChNodeFEAxyz : public ChNodeFEAbase, public ChNodeXYZ, public ChV
         R(off + 2) += c * GetMass() * w(off + 2);
     }
 
+    virtual void NodeIntLoadLumpedMass_Md(const unsigned int off, ChVectorDynamic<>& Md, const double c) override {
+        Md(off + 0) += c * GetMass();
+        Md(off + 1) += c * GetMass();
+        Md(off + 2) += c * GetMass();
+    }
+
     virtual void NodeIntToDescriptor(const unsigned int off_v,
                                      const ChStateDelta& v,
                                      const ChVectorDynamic<>& R) override {
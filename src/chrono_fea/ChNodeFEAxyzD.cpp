@@ -129,6 +129,15 @@ void ChNodeFEAxyzD::NodeIntLoadResidual_Mv(const unsigned int off,
     R(off + 5) += c * GetMassDiagonal()(2) * w(off + 5);
 }
 
+void ChNodeFEAxyzD::NodeIntLoadLumpedMass_Md(const unsigned int off, ChVectorDynamic<>& Md, const double c) {
+    Md(off + 0) += c * GetMass();
+    Md(off + 1) += c * GetMass();
+    Md(off + 2) += c * GetMass();
+    Md(off + 3) += c * GetMassDiagonal()(0);
+    Md(off + 4) += c * GetMassDiagonal()(1);
+    Md(off + 5) += c * GetMassDiagonal()(2);
+}
+
 void ChNodeFEAxyzD::NodeIntToDescriptor(const unsigned int off_v, const ChStateDelta& v, const ChVectorDynamic<>& R) {
     ChNodeFEAxyz::NodeIntToDescriptor(off_v, v, R);
     variables_D->Get_qb().PasteClippedMatrix(v, off_v + 3, 0, 3, 1, 0, 0);
@@ -142,6 +142,18 @@ void ChNodeFEAxyzDD::NodeIntLoadResidual_Mv(const unsigned int off,
     R(off + 8) += c * GetMassDiagonalDD()(2) * w(off + 8);
 }
 
+void ChNodeFEAxyzDD::NodeIntLoadLumpedMass_Md(const unsigned int off, ChVectorDynamic<>& Md, const double c) {
+    Md(off + 0) += c * GetMass();
+    Md(off + 1) += c * GetMass();
+    Md(off + 2) += c * GetMass();
+    Md(off + 3) += c * GetMassDiagonal()(0);
+    Md(off + 4) += c * GetMassDiagonal()(1);
+    Md(off + 5) += c * GetMassDiagonal()(2);
+    Md(off + 6) += c * GetMassDiagonalDD()(0);
+    Md(off + 7) += c * GetMassDiagonalDD()(1);
+    Md(off + 8) += c * GetMassDiagonalDD()(2);
+}
+
 void ChNodeFEAxyzDD::NodeIntToDescriptor(const unsigned int off_v, const ChStateDelta& v, const ChVectorDynamic<>& R) {
     ChNodeFEAxyzD::NodeIntToDescriptor(off_v, v, R);
     variables_DD->Get_qb().PasteClippedMatrix(v, off_v + 6, 0, 3, 1, 0, 0);
@@ -128,6 +128,16 @@ void ChNodeFEAxyzrot::NodeIntLoadResidual_Mv(const unsigned int off,
     R.PasteSumVector(Iw, off + 3, 0);
 }
 
+void ChNodeFEAxyzrot::NodeIntLoadLumpedMass_Md(const unsigned int off, ChVectorDynamic<>& Md, const double c) {
+    Md(off + 0) += c * GetMass();
+    Md(off + 1) += c * GetMass();
+    Md(off + 2) += c * GetMass();
+    // products of inertia are neglected
+    Md(off + 3) += c * GetInertia()(0, 0);
+    Md(off + 4) += c * GetInertia()(1, 1);
+    Md(off + 5) += c * GetInertia()(2, 2);
+}
+
 void ChNodeFEAxyzrot::NodeIntToDescriptor(const unsigned int off_v, const ChStateDelta& v, const ChVectorDynamic<>& R) {
     variables.Get_qb().PasteClippedMatrix(v, off_v, 0, 6, 1, 0, 0);
     variables.Get_fb().PasteClippedMatrix(R, off_v, 0, 6, 1, 0, 0);
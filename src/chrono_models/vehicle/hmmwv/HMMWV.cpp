@@ -291,24 +291,40 @@ void HMMWV::Synchronize(double time,
 
     double driveshaft_speed = m_vehicle->GetDriveshaftSpeed();
 
-    m_tires[0]->Synchronize(time, wheel_states[0], terrain);
-    m_tires[1]->Synchronize(time, wheel_states[1], terrain);
-    m_tires[2]->Synchronize(time, wheel_states[2], terrain);
-    m_tires[3]->Synchronize(time, wheel_states[3], terrain);
+    ChRealtimeMonitor* monitor = m_vehicle->GetRealtimeMonitor();
+
+    {
+        ChRealtimeSection section(monitor, ChRealtimeMonitor::TIRES);
+        m_tires[0]->Synchronize(time, wheel_states[0], terrain);
+        m_tires[1]->Synchronize(time, wheel_states[1], terrain);
+        m_tires[2]->Synchronize(time, wheel_states[2], terrain);
+        m_tires[3]->Synchronize(time, wheel_states[3], terrain);
+    }
 
-    m_powertrain->Synchronize(time, throttle_input, driveshaft_speed);
+    {
+        ChRealtimeSection section(monitor, ChRealtimeMonitor::POWERTRAIN);
+        m_powertrain->Synchronize(time, throttle_input, driveshaft_speed);
+    }
 
     m_vehicle->Synchronize(time, steering_input, braking_input, powertrain_torque, tire_forces);
 }
 
 // -----------------------------------------------------------------------------
 void HMMWV::Advance(double step) {
-    m_tires[0]->Advance(step);
-    m_tires[1]->Advance(step);
-    m_tires[2]->Advance(step);
-    m_tires[3]->Advance(step);
+    ChRealtimeMonitor* monitor = m_vehicle->GetRealtimeMonitor();
+
+    {
+        ChRealtimeSection section(monitor, ChRealtimeMonitor::TIRES);
+        m_tires[0]->Advance(step);
+        m_tires[1]->Advance(step);
+        m_tires[2]->Advance(step);
+        m_tires[3]->Advance(step);
+    }
 
-    m_powertrain->Advance(step);
+    {
+        ChRealtimeSection section(monitor, ChRealtimeMonitor::POWERTRAIN);
+        m_powertrain->Advance(step);
+    }
 
     m_vehicle->Advance(step);
 }
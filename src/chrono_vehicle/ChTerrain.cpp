@@ -23,5 +23,23 @@ namespace vehicle {
 
 ChTerrain::ChTerrain() : m_friction_fun(nullptr) {}
 
+void ChTerrain::GetProperties(double x, double y, double& height, ChVector<>& normal, float& friction) const {
+    height = GetHeight(x, y);
+    normal = GetNormal(x, y);
+    friction = GetCoefficientFriction(x, y);
+}
+
+void ChTerrain::GetProperties(const std::vector<ChVector2<>>& loc,
+                              std::vector<double>& height,
+                              std::vector<ChVector<>>& normal,
+                              std::vector<float>& friction) const {
+    height.resize(loc.size());
+    normal.resize(loc.size());
+    friction.resize(loc.size());
+    for (size_t i = 0; i < loc.size(); i++) {
+        GetProperties(loc[i].x(), loc[i].y(), height[i], normal[i], friction[i]);
+    }
+}
+
 }  // end namespace vehicle
 }  // end namespace chrono
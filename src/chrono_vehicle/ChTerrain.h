@@ -19,7 +19,10 @@
 #ifndef CH_TERRAIN_H
 #define CH_TERRAIN_H
 
+#include <vector>
+
 #include "chrono/core/ChVector.h"
+#include "chrono/core/ChVector2.h"
 
 #include "chrono_vehicle/ChApiVehicle.h"
 
@@ -54,6 +57,24 @@ class CH_VEHICLE_API ChTerrain {
     /// with other objects (including tire models that do not explicitly use it).
     virtual float GetCoefficientFriction(double x, double y) const = 0;
 
+    /// Get the terrain height, normal, and coefficient of friction at the specified (x,y) location.
+    /// The default implementation calls GetHeight, GetNormal, and GetCoefficientFriction; derived
+    /// classes should override it if the three quantities can be obtained with a single search.
+    virtual void GetProperties(double x,            ///< [in] x coordinate
+                               double y,            ///< [in] y coordinate
+                               double& height,      ///< [out] terrain height
+                               ChVector<>& normal,  ///< [out] terrain normal
+                               float& friction      ///< [out] terrain coefficient of friction
+    ) const;
+
+    /// Get the terrain height, normal, and coefficient of friction at a set of (x,y) locations.
+    /// The output vectors are resized to the number of locations.
+    virtual void GetProperties(const std::vector<ChVector2<>>& loc,  ///< [in] (x,y) locations
+                               std::vector<double>& height,          ///< [out] terrain heights
+                               std::vector<ChVector<>>& normal,      ///< [out] terrain normals
+                               std::vector<float>& friction          ///< [out] coefficients of friction
+    ) const;
+
     /// Class to be used as a functor interface for location-dependent coefficient of friction.
     class ChApi FrictionFunctor {
       public:
@@ -17,11 +17,15 @@
 // =============================================================================
 
 #include <algorithm>
+#include <cmath>
 
 #include "chrono/ChConfig.h"
 
 #include "chrono/physics/ChSystemNSC.h"
 #include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChIterativeSolver.h"
+#include "chrono/timestepper/ChTimestepper.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 #include "chrono_vehicle/ChVehicle.h"
 
@@ -38,7 +42,15 @@ namespace vehicle {
 // Specify default step size and solver parameters.
 // -----------------------------------------------------------------------------
 ChVehicle::ChVehicle(const std::string& name, ChMaterialSurface::ContactMethod contact_method)
-    : m_name(name), m_ownsSystem(true), m_stepsize(1e-3), m_output(false), m_output_db(nullptr), m_next_output_time(0), m_output_frame(0) {
+    : m_name(name),
+      m_ownsSystem(true),
+      m_stepsize(1e-3),
+      m_output(false),
+      m_output_db(nullptr),
+      m_next_output_time(0),
+      m_output_frame(0),
+      m_rt_solve_cost(0),
+      m_rt_iter_cost(0) {
     m_system = (contact_method == ChMaterialSurface::NSC) ? static_cast<ChSystem*>(new ChSystemNSC)
                                                           : static_cast<ChSystem*>(new ChSystemSMC);
 
@@ -69,7 +81,9 @@ ChVehicle::ChVehicle(const std::string& name, ChSystem* system)
       m_output(false),
       m_output_db(nullptr),
       m_next_output_time(0),
-      m_output_frame(0) {}
+      m_output_frame(0),
+      m_rt_solve_cost(0),
+      m_rt_iter_cost(0) {}
 
 // -----------------------------------------------------------------------------
 // Destructor for ChVehicle
@@ -100,6 +114,12 @@ void ChVehicle::SetOutput(ChVehicleOutput::Type type,
         case ChVehicleOutput::HDF5:
 #ifdef CHRONO_HAS_HDF5
             m_output_db = new ChVehicleOutputHDF5(out_dir + "/" + out_name + ".h5");
+#endif
+            break;
+        case ChVehicleOutput::HDF5_CHANNELS:
+#ifdef CHRONO_HAS_HDF5
+            m_output_db =
+                new ChVehicleOutputHDF5(out_dir + "/" + out_name + ".h5", ChVehicleOutputHDF5::Mode::CHANNELS);
 #endif
             break;
     }
@@ -110,21 +130,110 @@ void ChVehicle::SetOutput(ChVehicleOutput::Type type,
 // reach the specified value 'step'.
 // ---------------------------------------------------------------------------- -
 void ChVehicle::Advance(double step) {
+    CH_TRACE("ChVehicle::Advance");
+
     if (m_output && m_system->GetChTime() >= m_next_output_time) {
         Output(m_output_frame, *m_output_db);
         m_next_output_time += m_output_step;
         m_output_frame++;
     }
 
-    if (!m_ownsSystem)
+    if (!m_ownsSystem) {
+        if (m_realtime)
+            m_realtime->EndFrame(m_system->GetChTime());
         return;
+    }
 
     double t = 0;
     while (t < step) {
         double h = std::min<>(m_stepsize, step - t);
+        if (m_realtime) {
+            SetRealtimeLimits(static_cast<int>(std::ceil((step - t) / m_stepsize - 1e-9)));
+            m_realtime->Start(ChRealtimeMonitor::DYNAMICS);
+        }
         m_system->DoStepDynamics(h);
+        if (m_realtime) {
+            m_realtime->Stop(ChRealtimeMonitor::DYNAMICS);
+            UpdateRealtimeCosts();
+        }
         t += h;
     }
+
+    if (m_realtime)
+        m_realtime->EndFrame(m_system->GetChTime());
+}
+
+// -----------------------------------------------------------------------------
+// Real-time mode
+//
+// The cost of an integration step is modeled as
+//    num_solves * (solve_cost + num_iterations * iter_cost)
+// where num_solves is the number of Newton iterations (1 for non-iterative
+// integrators) and num_iterations is the number of iterations of the iterative
+// solver in each solve. The two costs are estimated from the system timers,
+// with exponential smoothing. At each step, the iteration limits are set so that
+// the step is expected to complete within its share of the remaining budget,
+// reducing the solver iterations first and then the Newton iterations.
+// -----------------------------------------------------------------------------
+void ChVehicle::EnableRealtime(double budget, int min_solver_iterations) {
+    if (!m_realtime) {
+        m_rt_max_iters = m_system->GetMaxItersSolverSpeed();
+        auto integrator = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(m_system->GetTimestepper());
+        m_rt_max_newton = integrator ? static_cast<int>(integrator->GetMaxiters()) : 1;
+    }
+    m_rt_min_iters = std::min(std::max(min_solver_iterations, 1), m_rt_max_iters);
+    m_rt_solve_cost = 0;
+    m_rt_iter_cost = 0;
+    m_realtime = std::unique_ptr<ChRealtimeMonitor>(new ChRealtimeMonitor(budget));
+}
+
+void ChVehicle::DisableRealtime() {
+    if (!m_realtime)
+        return;
+    m_system->SetMaxItersSolverSpeed(m_rt_max_iters);
+    if (auto integrator = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(m_system->GetTimestepper()))
+        integrator->SetMaxiters(m_rt_max_newton);
+    m_realtime.reset();
+}
+
+void ChVehicle::SetRealtimeLimits(int num_steps) {
+    // No estimate before the first step: use the nominal limits.
+    if (m_rt_solve_cost <= 0)
+        return;
+
+    double step_budget = (m_realtime->GetBudget() - m_realtime->GetFrameTime()) / std::max(num_steps, 1);
+
+    int newton = m_rt_max_newton;
+    int iters = m_rt_max_iters;
+    while (true) {
+        double solve_budget = step_budget / newton - m_rt_solve_cost;
+        iters = (m_rt_iter_cost > 0) ? static_cast<int>(solve_budget / m_rt_iter_cost) : m_rt_max_iters;
+        if (iters >= m_rt_min_iters || newton == 1)
+            break;
+        newton--;
+    }
+    ChClampValue(iters, m_rt_min_iters, m_rt_max_iters);
+
+    m_system->SetMaxItersSolverSpeed(iters);
+    if (auto integrator = std::dynamic_pointer_cast<ChImplicitIterativeTimestepper>(m_system->GetTimestepper()))
+        integrator->SetMaxiters(newton);
+}
+
+void ChVehicle::UpdateRealtimeCosts() {
+    const double alpha = 0.2;
+
+    int num_solves = std::max(m_system->GetSolverCallsCount(), 1);
+    double step_time = m_system->GetTimerStep();
+    double solver_time = m_system->GetTimerSolver();
+
+    double solve_cost = std::max(step_time - solver_time, 0.0) / num_solves;
+    m_rt_solve_cost = (m_rt_solve_cost > 0) ? (1 - alpha) * m_rt_solve_cost + alpha * solve_cost : solve_cost;
+
+    auto solver = std::dynamic_pointer_cast<ChIterativeSolver>(m_system->GetSolver());
+    if (solver && solver->GetTotalIterations() > 0) {
+        double iter_cost = solver_time / (num_solves * solver->GetTotalIterations());
+        m_rt_iter_cost = (m_rt_iter_cost > 0) ? (1 - alpha) * m_rt_iter_cost + alpha * iter_cost : iter_cost;
+    }
 }
 
 // -----------------------------------------------------------------------------
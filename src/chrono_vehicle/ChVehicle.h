@@ -22,12 +22,14 @@
 #ifndef CH_VEHICLE_H
 #define CH_VEHICLE_H
 
+#include <memory>
 #include <numeric>
 
 #include "chrono_vehicle/ChApiVehicle.h"
 #include "chrono_vehicle/ChSubsysDefs.h"
 #include "chrono_vehicle/ChVehicleOutput.h"
 #include "chrono_vehicle/ChChassis.h"
+#include "chrono_vehicle/utils/ChRealtimeMonitor.h"
 
 namespace chrono {
 namespace vehicle {
@@ -152,6 +154,22 @@ class CH_VEHICLE_API ChVehicle {
     /// Get the current value of the integration step size for the vehicle system.
     double GetStepsize() const { return m_stepsize; }
 
+    /// Enable real-time mode, with the specified wall-clock budget for each frame [s].
+    /// A frame consists of the work timed through the real-time monitor since the previous call
+    /// to Advance (subsystem synchronization, tires, powertrain, terrain) and the integration of
+    /// the system in Advance. At each integration step, the maximum number of iterations of an
+    /// iterative solver (and of Newton iterations, for an implicit iterative integrator such as
+    /// HHT) is reduced as needed for the step to complete within the remaining budget, using the
+    /// cost per iteration measured at previous steps. The limits in effect when this function is
+    /// called are used as upper bounds; the solver is allowed at least 'min_solver_iterations'.
+    void EnableRealtime(double budget, int min_solver_iterations = 10);
+
+    /// Disable real-time mode and restore the nominal iteration limits.
+    void DisableRealtime();
+
+    /// Get the real-time monitor (nullptr if real-time mode is not enabled).
+    ChRealtimeMonitor* GetRealtimeMonitor() const { return m_realtime.get(); }
+
     /// Log current constraint violations.
     virtual void LogConstraintViolations() = 0;
 
@@ -186,6 +204,12 @@ class CH_VEHICLE_API ChVehicle {
         return val;
     }
 
+    /// Set the iteration limits for the next integration step, given the number of steps left in this frame.
+    void SetRealtimeLimits(int num_steps);
+
+    /// Update the estimated iteration costs from the timers of the last integration step.
+    void UpdateRealtimeCosts();
+
     std::string m_name;  ///< vehicle name
     ChSystem* m_system;  ///< pointer to the Chrono system
     bool m_ownsSystem;   ///< true if system created at construction
@@ -196,6 +220,13 @@ class CH_VEHICLE_API ChVehicle {
     double m_next_output_time;     ///< time for next output
     int m_output_frame;            ///< current output frame
 
+    std::unique_ptr<ChRealtimeMonitor> m_realtime;  ///< real-time monitor (real-time mode only)
+    int m_rt_max_iters;                             ///< nominal solver iteration limit
+    int m_rt_min_iters;                             ///< minimum solver iteration limit
+    int m_rt_max_newton;                            ///< nominal Newton iteration limit
+    double m_rt_solve_cost;                         ///< estimated cost of a solve, excluding solver iterations
+    double m_rt_iter_cost;                          ///< estimated cost of a solver iteration
+
     std::shared_ptr<ChChassis> m_chassis;  ///< handle to the chassis subsystem
 
     double m_stepsize;  ///< integration step-size for the vehicle system
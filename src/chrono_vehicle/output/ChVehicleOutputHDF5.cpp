@@ -16,6 +16,8 @@
 //
 // =============================================================================
 
+#include <algorithm>
+#include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <fstream>
@@ -218,7 +220,7 @@ const H5::CompType& ChVehicleOutputHDF5::getCoupleType() {
                 m_couple_type->insertMember("xd", HOFFSET(couple_info, xd), H5::PredType::NATIVE_DOUBLE);
                 m_couple_type->insertMember("xdd", HOFFSET(couple_info, xdd), H5::PredType::NATIVE_DOUBLE);
                 m_couple_type->insertMember("torque1", HOFFSET(couple_info, t1), H5::PredType::NATIVE_DOUBLE);
-                m_couple_type->insertMember("torque2", HOFFSET(couple_info, t1), H5::PredType::NATIVE_DOUBLE);
+                m_couple_type->insertMember("torque2", HOFFSET(couple_info, t2), H5::PredType::NATIVE_DOUBLE);
             }
         };
         static Initializer ListInitializationGuard;
@@ -279,13 +281,59 @@ const H5::CompType& ChVehicleOutputHDF5::getBodyLoadType() {
 
 // -----------------------------------------------------------------------------
 
-ChVehicleOutputHDF5::ChVehicleOutputHDF5(const std::string& filename)
-    : m_frame_group(nullptr), m_section_group(nullptr) {
+ChVehicleOutputHDF5::ChVehicleOutputHDF5(const std::string& filename, Mode mode, int buffer_frames)
+    : m_frame_group(nullptr),
+      m_section_group(nullptr),
+      m_mode(mode),
+      m_buffer_frames(std::max(buffer_frames, 1)),
+      m_front(&m_buffers[0]),
+      m_back(&m_buffers[1]),
+      m_back_ready(false),
+      m_done(false),
+      m_num_frames(0) {
     m_fileHDF5 = new H5::H5File(filename, H5F_ACC_TRUNC);
-    H5::Group frames_group(m_fileHDF5->createGroup("/Frames"));
+
+    if (m_mode == Mode::FRAMES) {
+        H5::Group frames_group(m_fileHDF5->createGroup("/Frames"));
+        return;
+    }
+
+    H5::Group channels_group(m_fileHDF5->createGroup("/Channels"));
+    m_time_dataset = CreateExtensible(*m_fileHDF5, "/Time", H5::PredType::NATIVE_DOUBLE, 0, m_buffer_frames);
+    m_frame_dataset = CreateExtensible(*m_fileHDF5, "/Frame", H5::PredType::NATIVE_INT, 0, m_buffer_frames);
+
+    // Create all data types now, so that the simulation thread makes no HDF5 calls
+    // while the writer thread is running.
+    getBodyType();
+    getBodyAuxType();
+    getShaftType();
+    getMarkerType();
+    getJointType();
+    getCoupleType();
+    getLinSpringType();
+    getRotSpringType();
+    getBodyLoadType();
+
+    m_writer = std::thread(&ChVehicleOutputHDF5::WriterLoop, this);
 }
 
 ChVehicleOutputHDF5::~ChVehicleOutputHDF5() {
+    if (m_mode == Mode::CHANNELS) {
+        // Hand over the last (partial) buffer and wait for the writer thread to finish.
+        if (!m_front->frames.empty())
+            SwapBuffers();
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_done = true;
+        }
+        m_cv.notify_all();
+        m_writer.join();
+
+        m_channels.clear();
+        m_time_dataset.close();
+        m_frame_dataset.close();
+    }
+
     if (m_section_group)
         m_section_group->close();
     if (m_frame_group)
@@ -295,15 +343,8 @@ ChVehicleOutputHDF5::~ChVehicleOutputHDF5() {
     delete m_section_group;
     delete m_frame_group;
     delete m_fileHDF5;
-    
-    delete m_body_type;
-    delete m_bodyaux_type;
-    delete m_shaft_type;
-    delete m_marker_type;
-    delete m_joint_type;
-    delete m_couple_type;
-    delete m_linspring_type;
-    delete m_rotspring_type;
+
+    // Note: the data types are shared by all output databases and are created only once.
 
     GetLog() << "Closing output HDF5 file.\n";
 }
@@ -319,6 +360,14 @@ std::string format_number(int num, int precision) {
 // -----------------------------------------------------------------------------
 
 void ChVehicleOutputHDF5::WriteTime(int frame, double time) {
+    if (m_mode == Mode::CHANNELS) {
+        if (m_front->frames.size() >= (size_t)m_buffer_frames)
+            SwapBuffers();
+        m_front->frames.push_back(frame);
+        m_front->times.push_back(time);
+        return;
+    }
+
     // Close the currently open section group
     if (m_section_group) {
         m_section_group->close();
@@ -347,6 +396,11 @@ void ChVehicleOutputHDF5::WriteTime(int frame, double time) {
 }
 
 void ChVehicleOutputHDF5::WriteSection(const std::string& name) {
+    if (m_mode == Mode::CHANNELS) {
+        m_section = name;
+        return;
+    }
+
     // Close the currently open section group
     if (m_section_group) {
         m_section_group->close();
@@ -358,13 +412,177 @@ void ChVehicleOutputHDF5::WriteSection(const std::string& name) {
     m_section_group = new H5::Group(m_frame_group->createGroup(name));
 }
 
+// -----------------------------------------------------------------------------
+// In FRAMES mode, the records are written immediately to a new dataset in the
+// current section group. In CHANNELS mode, they are appended to the staging
+// buffer of the channel with the same section and dataset name.
+// -----------------------------------------------------------------------------
+void ChVehicleOutputHDF5::WriteDataSet(const std::string& name,
+                                       const H5::CompType& type,
+                                       const void* data,
+                                       size_t count,
+                                       size_t size) {
+    if (m_mode == Mode::FRAMES) {
+        hsize_t dim[] = {count};
+        H5::DataSpace dataspace(1, dim);
+        H5::DataSet set = m_section_group->createDataSet(name, type, dataspace);
+        set.write(data, type);
+        return;
+    }
+
+    std::string path = "/Channels/" + m_section + "/" + name;
+    size_t nbytes = count * size;
+
+    int id;
+    auto it = m_channel_ids.find(path);
+    if (it == m_channel_ids.end()) {
+        id = (int)m_channel_sizes.size();
+        m_channel_ids[path] = id;
+        m_channel_sizes.push_back(nbytes);
+        m_front->new_channels.push_back({path, &type, count, m_front->frames.back()});
+    } else {
+        id = it->second;
+        if (m_channel_sizes[id] != nbytes)
+            throw ChException("ChVehicleOutputHDF5: number of records changed in channel " + path);
+    }
+
+    if (m_front->data.size() <= (size_t)id)
+        m_front->data.resize(id + 1);
+    auto bytes = static_cast<const char*>(data);
+    m_front->data[id].insert(m_front->data[id].end(), bytes, bytes + nbytes);
+}
+
+// -----------------------------------------------------------------------------
+// Double buffering: the simulation thread fills the front buffer while the
+// writer thread appends the back buffer to the file. When the front buffer is
+// full, the two are swapped, waiting if the writer has not finished yet.
+// -----------------------------------------------------------------------------
+void ChVehicleOutputHDF5::SwapBuffers() {
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this]() { return !m_back_ready; });
+        std::swap(m_front, m_back);
+        m_back_ready = true;
+    }
+    m_cv.notify_all();
+}
+
+void ChVehicleOutputHDF5::WriterLoop() {
+    while (true) {
+        Buffer* buffer;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]() { return m_back_ready || m_done; });
+            if (!m_back_ready)
+                break;
+            buffer = m_back;
+        }
+
+        try {
+            WriteBuffer(*buffer);
+        } catch (const H5::Exception& e) {
+            GetLog() << "ChVehicleOutputHDF5: " << e.getDetailMsg() << "\n";
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_back_ready = false;
+        }
+        m_cv.notify_all();
+    }
+}
+
+void ChVehicleOutputHDF5::WriteBuffer(Buffer& buffer) {
+    // Create the datasets of new channels.
+    for (const auto& nc : buffer.new_channels) {
+        std::string group = nc.path.substr(0, nc.path.rfind('/'));
+        if (H5Lexists(m_fileHDF5->getId(), group.c_str(), H5P_DEFAULT) <= 0)
+            m_fileHDF5->createGroup(group);
+
+        Channel channel;
+        channel.dataset = CreateExtensible(*m_fileHDF5, nc.path, *nc.type, nc.count, m_buffer_frames);
+        channel.type = nc.type;
+        channel.count = nc.count;
+        channel.rows = 0;
+
+        H5::DataSpace dataspace(H5S_SCALAR);
+        H5::Attribute att = channel.dataset.createAttribute("FirstFrame", H5::PredType::NATIVE_INT, dataspace);
+        att.write(H5::PredType::NATIVE_INT, &nc.first_frame);
+
+        m_channels.push_back(channel);
+    }
+
+    // Append the frame times and the channel records.
+    hsize_t nframes = buffer.frames.size();
+    hsize_t rows = m_num_frames;
+    AppendRows(m_time_dataset, H5::PredType::NATIVE_DOUBLE, buffer.times.data(), rows, nframes);
+    AppendRows(m_frame_dataset, H5::PredType::NATIVE_INT, buffer.frames.data(), m_num_frames, nframes);
+
+    for (size_t i = 0; i < buffer.data.size(); i++) {
+        auto& data = buffer.data[i];
+        if (data.empty())
+            continue;
+        Channel& channel = m_channels[i];
+        hsize_t nrows = data.size() / (channel.count * channel.type->getSize());
+        AppendRows(channel.dataset, *channel.type, data.data(), channel.rows, nrows);
+        data.clear();
+    }
+
+    // Empty the buffer, keeping its storage for reuse.
+    buffer.frames.clear();
+    buffer.times.clear();
+    buffer.new_channels.clear();
+}
+
+H5::DataSet ChVehicleOutputHDF5::CreateExtensible(H5::H5File& file,
+                                                  const std::string& path,
+                                                  const H5::DataType& type,
+                                                  hsize_t count,
+                                                  hsize_t chunk_rows) {
+    int rank = (count == 0) ? 1 : 2;
+    hsize_t dims[] = {0, count};
+    hsize_t max_dims[] = {H5S_UNLIMITED, count};
+    hsize_t chunk_dims[] = {chunk_rows, count};
+
+    H5::DSetCreatPropList plist;
+    plist.setChunk(rank, chunk_dims);
+    if (H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0) {
+        plist.setShuffle();
+        plist.setDeflate(4);
+    }
+
+    H5::DataSpace dataspace(rank, dims, max_dims);
+    return file.createDataSet(path, type, dataspace, plist);
+}
+
+void ChVehicleOutputHDF5::AppendRows(H5::DataSet& dataset,
+                                     const H5::DataType& type,
+                                     const void* data,
+                                     hsize_t& rows,
+                                     hsize_t nrows) {
+    if (nrows == 0)
+        return;
+
+    hsize_t dims[] = {0, 0};
+    int rank = dataset.getSpace().getSimpleExtentDims(dims);
+    dims[0] = rows + nrows;
+    dataset.extend(dims);
+
+    hsize_t offset[] = {rows, 0};
+    hsize_t block[] = {nrows, dims[1]};
+    H5::DataSpace filespace = dataset.getSpace();
+    filespace.selectHyperslab(H5S_SELECT_SET, block, offset);
+    H5::DataSpace memspace(rank, block);
+    dataset.write(data, type, memspace, filespace);
+
+    rows += nrows;
+}
+
 void ChVehicleOutputHDF5::WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
     if (bodies.empty())
         return;
 
     auto nbodies = bodies.size();
-    hsize_t dim[] = {nbodies};
-    H5::DataSpace dataspace(1, dim);
     std::vector<body_info> info(nbodies);
     for (auto i = 0; i < nbodies; i++) {
         const ChVector<>& p = bodies[i]->GetPos();
@@ -372,8 +590,7 @@ void ChVehicleOutputHDF5::WriteBodies(const std::vector<std::shared_ptr<ChBody>>
         info[i] = {bodies[i]->GetIdentifier(), p.x(), p.y(), p.z(), q.e0(), q.e1(), q.e2(), q.e3()};
     }
 
-    H5::DataSet set = m_section_group->createDataSet("Bodies", getBodyType(), dataspace);
-    set.write(info.data(), getBodyType());
+    WriteDataSet("Bodies", getBodyType(), info.data(), nbodies, sizeof(body_info));
 }
 
 void ChVehicleOutputHDF5::WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) {
@@ -381,8 +598,6 @@ void ChVehicleOutputHDF5::WriteAuxRefBodies(const std::vector<std::shared_ptr<Ch
         return;
 
     auto nbodies = bodies.size();
-    hsize_t dim[] = { nbodies };
-    H5::DataSpace dataspace(1, dim);
     std::vector<bodyaux_info> info(nbodies);
     for (auto i = 0; i < nbodies; i++) {
         const ChVector<>& p = bodies[i]->GetPos();
@@ -390,8 +605,7 @@ void ChVehicleOutputHDF5::WriteAuxRefBodies(const std::vector<std::shared_ptr<Ch
         info[i] = { bodies[i]->GetIdentifier(), p.x(), p.y(), p.z(), q.e0(), q.e1(), q.e2(), q.e3() };
     }
 
-    H5::DataSet set = m_section_group->createDataSet("Bodies AuxRef", getBodyAuxType(), dataspace);
-    set.write(info.data(), getBodyAuxType());
+    WriteDataSet("Bodies AuxRef", getBodyAuxType(), info.data(), nbodies, sizeof(bodyaux_info));
 }
 
 void ChVehicleOutputHDF5::WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) {
@@ -399,8 +613,6 @@ void ChVehicleOutputHDF5::WriteMarkers(const std::vector<std::shared_ptr<ChMarke
         return;
 
     auto nmarkers = markers.size();
-    hsize_t dim[] = {nmarkers};
-    H5::DataSpace dataspace(1, dim);
     std::vector<marker_info> info(nmarkers);
     for (auto i = 0; i < nmarkers; i++) {
         const ChVector<>& p = markers[i]->GetAbsCoord().pos;
@@ -409,8 +621,7 @@ void ChVehicleOutputHDF5::WriteMarkers(const std::vector<std::shared_ptr<ChMarke
         info[i] = {markers[i]->GetIdentifier(), p.x(), p.y(), p.z(), pd.x(), pd.y(), pd.z(), pdd.x(), pdd.y(), pdd.z()};
     }
 
-    H5::DataSet set = m_section_group->createDataSet("Markers", getMarkerType(), dataspace);
-    set.write(info.data(), getMarkerType());
+    WriteDataSet("Markers", getMarkerType(), info.data(), nmarkers, sizeof(marker_info));
 }
 
 void ChVehicleOutputHDF5::WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) {
@@ -418,16 +629,13 @@ void ChVehicleOutputHDF5::WriteShafts(const std::vector<std::shared_ptr<ChShaft>
         return;
 
     auto nshafts = shafts.size();
-    hsize_t dim[] = {nshafts};
-    H5::DataSpace dataspace(1, dim);
     std::vector<shaft_info> info(nshafts);
     for (auto i = 0; i < nshafts; i++) {
         info[i] = {shafts[i]->GetIdentifier(), shafts[i]->GetPos(), shafts[i]->GetPos_dt(), shafts[i]->GetPos_dtdt(),
                    shafts[i]->GetAppliedTorque()};
     }
 
-    H5::DataSet set = m_section_group->createDataSet("Shafts", getShaftType(), dataspace);
-    set.write(info.data(), getShaftType());
+    WriteDataSet("Shafts", getShaftType(), info.data(), nshafts, sizeof(shaft_info));
 }
 
 void ChVehicleOutputHDF5::WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) {
@@ -435,8 +643,6 @@ void ChVehicleOutputHDF5::WriteJoints(const std::vector<std::shared_ptr<ChLink>>
         return;
 
     auto njoints = joints.size();
-    hsize_t dim[] = { njoints };
-    H5::DataSpace dataspace(1, dim);
     std::vector<joint_info> info(njoints);
     for (auto i = 0; i < njoints; i++) {
         const ChVector<>& f = joints[i]->Get_react_force();
@@ -444,8 +650,7 @@ void ChVehicleOutputHDF5::WriteJoints(const std::vector<std::shared_ptr<ChLink>>
         info[i] = { joints[i]->GetIdentifier(), f.x(), f.y(), f.z(), t.x(), t.y(), t.z() };
     }
 
-    H5::DataSet set = m_section_group->createDataSet("Joints", getJointType(), dataspace);
-    set.write(info.data(), getJointType());
+    WriteDataSet("Joints", getJointType(), info.data(), njoints, sizeof(joint_info));
 }
 
 void ChVehicleOutputHDF5::WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) {
@@ -453,8 +658,6 @@ void ChVehicleOutputHDF5::WriteCouples(const std::vector<std::shared_ptr<ChShaft
         return;
 
     auto ncouples = couples.size();
-    hsize_t dim[] = {ncouples};
-    H5::DataSpace dataspace(1, dim);
     std::vector<couple_info> info(ncouples);
     for (auto i = 0; i < ncouples; i++) {
         info[i] = {couples[i]->GetIdentifier(),          couples[i]->GetRelativeRotation(),
@@ -462,8 +665,7 @@ void ChVehicleOutputHDF5::WriteCouples(const std::vector<std::shared_ptr<ChShaft
                    couples[i]->GetTorqueReactionOn1(),   couples[i]->GetTorqueReactionOn2()};
     }
 
-    H5::DataSet set = m_section_group->createDataSet("Couples", getCoupleType(), dataspace);
-    set.write(info.data(), getCoupleType());
+    WriteDataSet("Couples", getCoupleType(), info.data(), ncouples, sizeof(couple_info));
 }
 
 void ChVehicleOutputHDF5::WriteLinSprings(const std::vector<std::shared_ptr<ChLinkSpringCB>>& springs) {
@@ -471,16 +673,13 @@ void ChVehicleOutputHDF5::WriteLinSprings(const std::vector<std::shared_ptr<ChLi
         return;
 
     auto nsprings = springs.size();
-    hsize_t dim[] = {nsprings};
-    H5::DataSpace dataspace(1, dim);
     std::vector<linspring_info> info(nsprings);
     for (auto i = 0; i < nsprings; i++) {
         info[i] = {springs[i]->GetIdentifier(), springs[i]->GetSpringLength(), springs[i]->GetSpringVelocity(),
                    springs[i]->GetSpringReact()};
     }
 
-    H5::DataSet set = m_section_group->createDataSet("Lin Springs", getLinSpringType(), dataspace);
-    set.write(info.data(), getLinSpringType());
+    WriteDataSet("Lin Springs", getLinSpringType(), info.data(), nsprings, sizeof(linspring_info));
 }
 
 void ChVehicleOutputHDF5::WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRotSpringCB>>& springs) {
@@ -488,16 +687,13 @@ void ChVehicleOutputHDF5::WriteRotSprings(const std::vector<std::shared_ptr<ChLi
         return;
 
     auto nsprings = springs.size();
-    hsize_t dim[] = {nsprings};
-    H5::DataSpace dataspace(1, dim);
     std::vector<rotspring_info> info(nsprings);
     for (auto i = 0; i < nsprings; i++) {
         info[i] = {springs[i]->GetIdentifier(), springs[i]->GetRotSpringAngle(), springs[i]->GetRotSpringSpeed(),
                    springs[i]->GetRotSpringTorque()};
     }
 
-    H5::DataSet set = m_section_group->createDataSet("Rot Springs", getRotSpringType(), dataspace);
-    set.write(info.data(), getRotSpringType());
+    WriteDataSet("Rot Springs", getRotSpringType(), info.data(), nsprings, sizeof(rotspring_info));
 }
 
 void ChVehicleOutputHDF5::WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) {
@@ -505,8 +701,6 @@ void ChVehicleOutputHDF5::WriteBodyLoads(const std::vector<std::shared_ptr<ChLoa
         return;
 
     auto nloads = loads.size();
-    hsize_t dim[] = { nloads };
-    H5::DataSpace dataspace(1, dim);
     std::vector<bodyload_info> info(nloads);
     for (auto i = 0; i < nloads; i++) {
         ChVector<> f = loads[i]->GetForce();
@@ -514,8 +708,7 @@ void ChVehicleOutputHDF5::WriteBodyLoads(const std::vector<std::shared_ptr<ChLoa
         info[i] = { loads[i]->GetIdentifier(), f.x(), f.y(), f.z(), t.x(), t.y(), t.z() };
     }
 
-    H5::DataSet set = m_section_group->createDataSet("Body-body Loads", getBodyLoadType(), dataspace);
-    set.write(info.data(), getBodyLoadType());
+    WriteDataSet("Body-body Loads", getBodyLoadType(), info.data(), nloads, sizeof(bodyload_info));
 }
 
 }  // end namespace vehicle
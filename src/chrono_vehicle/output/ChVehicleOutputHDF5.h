@@ -12,15 +12,19 @@
 // Authors: Radu Serban
 // =============================================================================
 //
-// ASCII text vehicle output database.
+// HDF5 vehicle output database.
 //
 // =============================================================================
 
 #ifndef CH_VEHICLE_OUTPUT_HDF5_H
 #define CH_VEHICLE_OUTPUT_HDF5_H
 
+#include <condition_variable>
+#include <map>
+#include <mutex>
 #include <string>
 #include <fstream>
+#include <thread>
 
 #include "chrono_vehicle/ChVehicleOutput.h"
 
@@ -33,12 +37,76 @@ namespace vehicle {
 /// @{
 
 /// HDF5 vehicle output database.
+/// Two file layouts are supported:
+/// - FRAMES: one group per output frame, with one small dataset per section and record kind,
+///   written directly from the simulation thread.
+/// - CHANNELS: one chunked, extensible, compressed dataset per channel (section and record kind),
+///   with one row per output frame (e.g. /Channels/<section>/Bodies), and the frame times in /Time.
+///   Records are staged in memory (double buffered) and appended to the file by a dedicated writer
+///   thread, so that output at every step has little impact on the simulation.
+///   The number of records in a channel must be the same at all frames.
+///   Since the HDF5 library is not necessarily thread-safe, no other HDF5 file should be accessed
+///   concurrently while the output database exists.
 class CH_VEHICLE_API ChVehicleOutputHDF5 : public ChVehicleOutput {
   public:
-    ChVehicleOutputHDF5(const std::string& filename);
+    enum class Mode {
+        FRAMES,   ///< one group per frame, written by the simulation thread
+        CHANNELS  ///< one dataset per channel, written by a background thread
+    };
+
+    ChVehicleOutputHDF5(const std::string& filename,  ///< [in] name of the output file
+                        Mode mode = Mode::FRAMES,      ///< [in] file layout
+                        int buffer_frames = 256        ///< [in] frames per staging buffer and per chunk (CHANNELS)
+                        );
     ~ChVehicleOutputHDF5();
 
   private:
+    /// Description of a channel created on the simulation thread.
+    struct NewChannel {
+        std::string path;           ///< dataset path
+        const H5::CompType* type;   ///< record data type
+        hsize_t count;              ///< records per frame
+        int first_frame;            ///< first frame with data in this channel
+    };
+
+    /// Channel data staged for the writer thread.
+    struct Buffer {
+        std::vector<int> frames;                  ///< staged frame numbers
+        std::vector<double> times;                ///< staged frame times
+        std::vector<std::vector<char>> data;      ///< staged records, per channel
+        std::vector<NewChannel> new_channels;     ///< channels created since the previous buffer
+    };
+
+    /// Writer-side state of a channel.
+    struct Channel {
+        H5::DataSet dataset;
+        const H5::CompType* type;
+        hsize_t count;  ///< records per frame
+        hsize_t rows;   ///< frames written so far
+    };
+
+    /// Write (FRAMES) or stage (CHANNELS) the records of the current section.
+    void WriteDataSet(const std::string& name, const H5::CompType& type, const void* data, size_t count, size_t size);
+
+    /// Hand the staging buffer over to the writer thread (waiting until it has finished the previous one).
+    void SwapBuffers();
+
+    /// Writer thread function.
+    void WriterLoop();
+
+    /// Append the contents of a staging buffer to the file (writer thread).
+    void WriteBuffer(Buffer& buffer);
+
+    /// Create a chunked, extensible, compressed dataset with rows of 'count' records (1-D if count = 0).
+    static H5::DataSet CreateExtensible(H5::H5File& file,
+                                        const std::string& path,
+                                        const H5::DataType& type,
+                                        hsize_t count,
+                                        hsize_t chunk_rows);
+
+    /// Append 'nrows' rows to an extensible dataset currently holding 'rows' rows.
+    static void AppendRows(H5::DataSet& dataset, const H5::DataType& type, const void* data, hsize_t& rows, hsize_t nrows);
+
     virtual void WriteTime(int frame, double time) override;
     virtual void WriteSection(const std::string& name) override;
 
@@ -56,6 +124,26 @@ class CH_VEHICLE_API ChVehicleOutputHDF5 : public ChVehicleOutput {
     H5::Group* m_frame_group;
     H5::Group* m_section_group;
 
+    Mode m_mode;
+    int m_buffer_frames;
+    std::string m_section;                      ///< name of the current section (CHANNELS)
+    std::map<std::string, int> m_channel_ids;   ///< channel index, by path (simulation thread)
+    std::vector<size_t> m_channel_sizes;        ///< bytes per frame of each channel (simulation thread)
+
+    Buffer m_buffers[2];          ///< staging buffers
+    Buffer* m_front;              ///< buffer filled by the simulation thread
+    Buffer* m_back;               ///< buffer written by the writer thread
+    bool m_back_ready;            ///< back buffer holds data not yet written
+    bool m_done;                  ///< writer thread should exit
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::thread m_writer;
+
+    std::vector<Channel> m_channels;  ///< writer-side channel state
+    H5::DataSet m_time_dataset;
+    H5::DataSet m_frame_dataset;
+    hsize_t m_num_frames;             ///< frames written so far
+
     static H5::CompType* m_body_type;
     static H5::CompType* m_bodyaux_type;
     static H5::CompType* m_shaft_type;
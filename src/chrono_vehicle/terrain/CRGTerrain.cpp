@@ -32,6 +32,8 @@
 //==============================================================================
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 
 #include "chrono/assets/ChPathShape.h"
 #include "chrono/physics/ChBodyEasy.h"
@@ -54,7 +56,17 @@ namespace chrono {
 namespace vehicle {
 
 CRGTerrain::CRGTerrain(ChSystem* system)
-    : m_use_vis_mesh(true), m_friction(0.8f), m_dataSetId(0), m_cpId(0), m_isClosed(false) {
+    : m_use_vis_mesh(true),
+      m_friction(0.8f),
+      m_dataSetId(0),
+      m_cpId(0),
+      m_isClosed(false),
+      m_use_table(false),
+      m_table_du(0),
+      m_table_dv(0),
+      m_table_error(0),
+      m_nu(0),
+      m_nv(0) {
     m_ground = std::shared_ptr<ChBody>(system->NewBody());
     m_ground->SetName("ground");
     m_ground->SetPos(ChVector<>(0, 0, 0));
@@ -135,6 +147,10 @@ void CRGTerrain::Initialize(const std::string& crg_file) {
         m_isClosed = (uIsClosed != 0);
     }
 
+    if (m_use_table) {
+        SetupLookupTable();
+    }
+
     if (m_use_vis_mesh) {
         SetupMeshGraphics();
     } else {
@@ -148,6 +164,13 @@ float CRGTerrain::GetCoefficientFriction(double x, double y) const {
 
 double CRGTerrain::GetHeight(double x, double y) const {
     double u, v, z;
+
+    if (m_use_table && LookupUV(x, y, u, v)) {
+        ChClampValue(u, m_ubeg, m_uend);
+        ChClampValue(v, m_vbeg, m_vend);
+        return LookupHeight(u, v);
+    }
+
     int uv_ok = crgEvalxy2uv(m_cpId, x, y, &u, &v);
     if (uv_ok != 1) {
         std::cout << "CRGTerrain::GetHeight(): error during xy -> uv coordinate transformation" << std::endl;
@@ -185,6 +208,221 @@ ChVector<> CRGTerrain::GetNormal(double x, double y) const {
     return normal;
 }
 
+// -----------------------------------------------------------------------------
+// Lookup table
+//
+// The road heights are sampled at the nodes of a regular (u,v) grid and stored
+// in square tiles of m_tile_size x m_tile_size nodes, so that the 4 nodes used
+// by a bilinear interpolation (and those of nearby queries from the same wheel)
+// are close in memory.
+// The reference line (v = 0) is sampled at the grid u values and approximated
+// by a polyline. Each polyline segment, expanded by the road half-width, is
+// registered in the cells of a uniform grid in the (x,y) plane it overlaps, as
+// part of a run of consecutive segments, so that the xy -> uv mapping only
+// considers a few candidate runs.
+// -----------------------------------------------------------------------------
+
+// Index of grid node (i,j) in the tiled height array.
+static inline size_t TileIndex(int i, int j, int ntv, int tile_size) {
+    size_t tile = (size_t)(i / tile_size) * ntv + (j / tile_size);
+    return (tile * tile_size + (i % tile_size)) * tile_size + (j % tile_size);
+}
+
+void CRGTerrain::SetupLookupTable() {
+    double du = (m_table_du > 0) ? m_table_du : m_uinc;
+    double dv = (m_table_dv > 0) ? m_table_dv : m_vinc;
+    m_nu = std::max(2, static_cast<int>(std::ceil((m_uend - m_ubeg) / du - 1e-6)) + 1);
+    m_nv = std::max(2, static_cast<int>(std::ceil((m_vend - m_vbeg) / dv - 1e-6)) + 1);
+    m_du = (m_uend - m_ubeg) / (m_nu - 1);
+    m_dv = (m_vend - m_vbeg) / (m_nv - 1);
+
+    // Sample the road heights.
+    int ntu = (m_nu + m_tile_size - 1) / m_tile_size;
+    m_ntv = (m_nv + m_tile_size - 1) / m_tile_size;
+    m_z.assign((size_t)ntu * m_ntv * m_tile_size * m_tile_size, 0.0f);
+    for (int i = 0; i < m_nu; i++) {
+        double u = m_ubeg + m_du * i;
+        for (int j = 0; j < m_nv; j++) {
+            double v = m_vbeg + m_dv * j;
+            double z;
+            int z_ok = crgEvaluv2z(m_cpId, u, v, &z);
+            if (z_ok != 1) {
+                std::cout << "CRGTerrain::SetupLookupTable(): error during uv -> z coordinate transformation"
+                          << std::endl;
+            }
+            m_z[TileIndex(i, j, m_ntv, m_tile_size)] = static_cast<float>(z);
+        }
+    }
+
+    // Sample the reference line.
+    m_ref_x.resize(m_nu);
+    m_ref_y.resize(m_nu);
+    for (int i = 0; i < m_nu; i++) {
+        int xy_ok = crgEvaluv2xy(m_cpId, m_ubeg + m_du * i, 0.0, &m_ref_x[i], &m_ref_y[i]);
+        if (xy_ok != 1) {
+            std::cout << "CRGTerrain::SetupLookupTable(): error during uv -> xy coordinate transformation"
+                      << std::endl;
+        }
+    }
+    m_ref_vmax = std::max(std::abs(m_vbeg), std::abs(m_vend));
+
+    // Index the reference-line segments. The cell size is at least the road width,
+    // with about 4 segments per cell on average for roads with large extents.
+    double xmin = *std::min_element(m_ref_x.begin(), m_ref_x.end()) - m_ref_vmax;
+    double xmax = *std::max_element(m_ref_x.begin(), m_ref_x.end()) + m_ref_vmax;
+    double ymin = *std::min_element(m_ref_y.begin(), m_ref_y.end()) - m_ref_vmax;
+    double ymax = *std::max_element(m_ref_y.begin(), m_ref_y.end()) + m_ref_vmax;
+    int nseg = m_nu - 1;
+    m_cell_size = std::max(2 * m_ref_vmax, std::sqrt((xmax - xmin) * (ymax - ymin) / (4.0 * nseg)));
+    m_cell_size = std::max(m_cell_size, 1e-3);
+    m_cell_x0 = xmin;
+    m_cell_y0 = ymin;
+    m_ncx = static_cast<int>((xmax - xmin) / m_cell_size) + 1;
+    m_ncy = static_cast<int>((ymax - ymin) / m_cell_size) + 1;
+
+    auto cellRange = [this](int k, int& cx0, int& cx1, int& cy0, int& cy1) {
+        double x0 = std::min(m_ref_x[k], m_ref_x[k + 1]) - m_ref_vmax - m_cell_x0;
+        double x1 = std::max(m_ref_x[k], m_ref_x[k + 1]) + m_ref_vmax - m_cell_x0;
+        double y0 = std::min(m_ref_y[k], m_ref_y[k + 1]) - m_ref_vmax - m_cell_y0;
+        double y1 = std::max(m_ref_y[k], m_ref_y[k + 1]) + m_ref_vmax - m_cell_y0;
+        cx0 = std::max(0, static_cast<int>(x0 / m_cell_size));
+        cx1 = std::min(m_ncx - 1, static_cast<int>(x1 / m_cell_size));
+        cy0 = std::max(0, static_cast<int>(y0 / m_cell_size));
+        cy1 = std::min(m_ncy - 1, static_cast<int>(y1 / m_cell_size));
+    };
+
+    m_cell_start.assign((size_t)m_ncx * m_ncy + 1, 0);
+    for (int k = 0; k < nseg; k++) {
+        int cx0, cx1, cy0, cy1;
+        cellRange(k, cx0, cx1, cy0, cy1);
+        for (int cy = cy0; cy <= cy1; cy++)
+            for (int cx = cx0; cx <= cx1; cx++)
+                m_cell_start[cy * m_ncx + cx + 1]++;
+    }
+    for (size_t c = 1; c < m_cell_start.size(); c++)
+        m_cell_start[c] += m_cell_start[c - 1];
+
+    std::vector<int> segments(m_cell_start.back());
+    std::vector<int> fill(m_cell_start.begin(), m_cell_start.end() - 1);
+    for (int k = 0; k < nseg; k++) {
+        int cx0, cx1, cy0, cy1;
+        cellRange(k, cx0, cx1, cy0, cy1);
+        for (int cy = cy0; cy <= cy1; cy++)
+            for (int cx = cx0; cx <= cx1; cx++)
+                segments[fill[cy * m_ncx + cx]++] = k;
+    }
+
+    // Compress the (increasing) segment lists of each cell into runs of consecutive segments.
+    m_cell_runs.clear();
+    std::vector<int> run_start(m_cell_start.size(), 0);
+    for (size_t c = 0; c + 1 < m_cell_start.size(); c++) {
+        run_start[c] = static_cast<int>(m_cell_runs.size() / 2);
+        for (int n = m_cell_start[c]; n < m_cell_start[c + 1]; n++) {
+            if (n > m_cell_start[c] && segments[n] == m_cell_runs.back() + 1) {
+                m_cell_runs.back() = segments[n];
+            } else {
+                m_cell_runs.push_back(segments[n]);
+                m_cell_runs.push_back(segments[n]);
+            }
+        }
+    }
+    run_start.back() = static_cast<int>(m_cell_runs.size() / 2);
+    m_cell_start = run_start;
+
+    // Measure the height difference from the OpenCRG evaluator at sample points
+    // spread over the road surface.
+    const int num_samples = 1000;
+    m_table_error = 0;
+    for (int k = 0; k < num_samples; k++) {
+        double u = m_ubeg + (k + 0.5) / num_samples * (m_uend - m_ubeg);
+        double v = m_vbeg + std::fmod(0.5 + k * 0.618033988749895, 1.0) * (m_vend - m_vbeg);
+        double x, y, z;
+        if (crgEvaluv2xy(m_cpId, u, v, &x, &y) != 1 || crgEvaluv2z(m_cpId, u, v, &z) != 1)
+            continue;
+        m_table_error = std::max(m_table_error, std::abs(GetHeight(x, y) - z));
+    }
+}
+
+bool CRGTerrain::LookupUV(double x, double y, double& u, double& v) const {
+    int cx = static_cast<int>(std::floor((x - m_cell_x0) / m_cell_size));
+    int cy = static_cast<int>(std::floor((y - m_cell_y0) / m_cell_size));
+    if (cx < 0 || cx >= m_ncx || cy < 0 || cy >= m_ncy)
+        return false;
+
+    // Find the closest point on the candidate reference-line segments. Within a run
+    // of consecutive segments, the projection of the location on the segment directions
+    // changes sign only once (at the foot of the perpendicular), so a bisection locates
+    // the segment to check.
+    auto proj = [&](int k) {
+        return (x - m_ref_x[k]) * (m_ref_x[k + 1] - m_ref_x[k]) + (y - m_ref_y[k]) * (m_ref_y[k + 1] - m_ref_y[k]);
+    };
+
+    int cell = cy * m_ncx + cx;
+    int best_k = -1;
+    double best_t = 0;
+    double best_d2 = std::numeric_limits<double>::max();
+    double best_cross = 0;
+    for (int r = m_cell_start[cell]; r < m_cell_start[cell + 1]; r++) {
+        int lo = m_cell_runs[2 * r];
+        int hi = m_cell_runs[2 * r + 1];
+        int first = lo;
+        int last = hi;
+        while (lo < hi) {
+            int mid = (lo + hi + 1) / 2;
+            if (proj(mid) >= 0)
+                lo = mid;
+            else
+                hi = mid - 1;
+        }
+
+        for (int k = std::max(first, lo - 1); k <= std::min(last, lo + 1); k++) {
+            double ex = m_ref_x[k + 1] - m_ref_x[k];
+            double ey = m_ref_y[k + 1] - m_ref_y[k];
+            double dx = x - m_ref_x[k];
+            double dy = y - m_ref_y[k];
+            double len2 = ex * ex + ey * ey;
+            double t = (len2 > 0) ? (dx * ex + dy * ey) / len2 : 0;
+            ChClampValue(t, 0.0, 1.0);
+            double px = dx - t * ex;
+            double py = dy - t * ey;
+            double d2 = px * px + py * py;
+            if (d2 < best_d2) {
+                best_k = k;
+                best_t = t;
+                best_d2 = d2;
+                best_cross = ex * dy - ey * dx;
+            }
+        }
+    }
+
+    // Off the road or beyond its ends: defer to the OpenCRG evaluator.
+    if (best_k < 0 || best_d2 > m_ref_vmax * m_ref_vmax)
+        return false;
+    if ((best_k == 0 && best_t == 0) || (best_k == m_nu - 2 && best_t == 1))
+        return false;
+
+    // The lateral coordinate is positive to the left of the reference line.
+    u = m_ubeg + (best_k + best_t) * m_du;
+    v = (best_cross >= 0) ? std::sqrt(best_d2) : -std::sqrt(best_d2);
+    return true;
+}
+
+double CRGTerrain::LookupHeight(double u, double v) const {
+    double gu = (u - m_ubeg) / m_du;
+    double gv = (v - m_vbeg) / m_dv;
+    int i = std::min(static_cast<int>(gu), m_nu - 2);
+    int j = std::min(static_cast<int>(gv), m_nv - 2);
+    double a = gu - i;
+    double b = gv - j;
+
+    double z00 = m_z[TileIndex(i, j, m_ntv, m_tile_size)];
+    double z01 = m_z[TileIndex(i, j + 1, m_ntv, m_tile_size)];
+    double z10 = m_z[TileIndex(i + 1, j, m_ntv, m_tile_size)];
+    double z11 = m_z[TileIndex(i + 1, j + 1, m_ntv, m_tile_size)];
+
+    return (1 - a) * ((1 - b) * z00 + b * z01) + a * ((1 - b) * z10 + b * z11);
+}
+
 std::shared_ptr<ChBezierCurve> CRGTerrain::GetPath() {
     std::vector<ChVector<>> pathpoints;
 
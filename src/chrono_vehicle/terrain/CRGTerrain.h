@@ -62,6 +62,29 @@ class CH_VEHICLE_API CRGTerrain : public ChTerrain {
     /// The default value is 0.8
     void SetContactFrictionCoefficient(float friction_coefficient) { m_friction = friction_coefficient; }
 
+    /// Enable evaluation of the road surface from a lookup table compiled at initialization.
+    /// The road heights are sampled on a regular (u,v) grid with the specified spacing (by default,
+    /// the increments of the CRG file) and stored in cache-friendly tiles; the xy -> uv mapping uses
+    /// a polyline approximation of the reference line, indexed by a uniform grid of cells.
+    /// The reference line is assumed to have a radius of curvature larger than the road half-width.
+    /// Queries that cannot be resolved from the table (e.g. beyond the ends of the road) are
+    /// passed to the OpenCRG evaluator.
+    /// With du, dv equal to the CRG increments, the difference from the OpenCRG evaluator is bounded
+    /// by |grad z| * k * du^2 / 8 (polyline approximation of a reference line with curvature k)
+    /// plus single precision rounding of the heights. For a coarser grid, add the bilinear
+    /// interpolation error (du^2 * |z_uu| + dv^2 * |z_vv|) / 8.
+    /// See GetLookupTableError for the difference measured at initialization.
+    /// Default: false.
+    void UseLookupTable(bool val, double du = 0, double dv = 0) {
+        m_use_table = val;
+        m_table_du = du;
+        m_table_dv = dv;
+    }
+
+    /// Get the maximum height difference between the lookup table and the OpenCRG evaluator,
+    /// measured at initialization on a set of sample points over the road (0 if no lookup table).
+    double GetLookupTableError() const { return m_table_error; }
+
     /// Initialize the CRGTerrain from the specified OpenCRG file.
     void Initialize(const std::string& crg_file  ///< [in] OpenCRG road specification file
     );
@@ -100,6 +123,16 @@ class CH_VEHICLE_API CRGTerrain : public ChTerrain {
     void SetupLineGraphics();
     void SetupMeshGraphics();
 
+    /// Compile the lookup table of road heights and the reference-line index.
+    void SetupLookupTable();
+
+    /// Map (x,y) to (u,v) using the reference-line index.
+    /// Return false if the location is not covered by the index.
+    bool LookupUV(double x, double y, double& u, double& v) const;
+
+    /// Evaluate the tabulated height at (u,v).
+    double LookupHeight(double u, double v) const;
+
     std::shared_ptr<ChBody> m_ground;  ///< ground body
     bool m_use_vis_mesh;               ///< mesh or boundary visual asset?
     float m_friction;                  ///< contact coefficient of friction
@@ -112,8 +145,26 @@ class CH_VEHICLE_API CRGTerrain : public ChTerrain {
     double m_uinc, m_ubeg, m_uend;  // increment, begin , end of longitudinal road coordinates
     double m_vinc, m_vbeg, m_vend;  // increment, begin , end of lateral road coordinates
 
-
     std::vector<double> m_v;  // vector with distinct v values, if m_vinc <= 0.01 m
+
+    // Lookup table
+    bool m_use_table;                     ///< evaluate heights from the lookup table?
+    double m_table_du, m_table_dv;        ///< requested grid spacing (0: CRG increments)
+    double m_table_error;                 ///< height difference measured at initialization
+    int m_nu, m_nv;                       ///< number of grid nodes in u and v directions
+    double m_du, m_dv;                    ///< actual grid spacing
+    int m_ntv;                            ///< number of tiles in v direction
+    std::vector<float> m_z;               ///< tiled grid heights
+    std::vector<double> m_ref_x;          ///< x coordinates of reference-line nodes (at grid u values)
+    std::vector<double> m_ref_y;          ///< y coordinates of reference-line nodes
+    double m_ref_vmax;                    ///< maximum lateral distance from the reference line
+    double m_cell_size;                   ///< size of the reference-line index cells
+    double m_cell_x0, m_cell_y0;          ///< lower-left corner of the reference-line index
+    int m_ncx, m_ncy;                     ///< number of index cells in x and y directions
+    std::vector<int> m_cell_start;        ///< start of the list of each cell in m_cell_runs
+    std::vector<int> m_cell_runs;         ///< runs (first, last) of consecutive segments overlapping each cell
+
+    static const int m_tile_size = 8;     ///< number of grid nodes per tile side
 };
 
 /// @} vehicle_terrain
@@ -37,8 +37,10 @@
 //
 // =============================================================================
 
+#include <algorithm>
 #include <cstdio>
 #include <cmath>
+#include <random>
 
 #include "chrono/assets/ChBoxShape.h"
 #include "chrono/utils/ChUtilsGenerators.h"
@@ -71,6 +73,8 @@ GranularTerrain::GranularTerrain(ChSystem* system)
       m_vis_enabled(false),
       m_moving_patch(false),
       m_moved(false),
+      m_reloc_layer_height(0),
+      m_verbose(false),
       m_envelope(-1) {
     // Create the ground body and add it to the system.
     m_ground = std::shared_ptr<ChBody>(system->NewBody());
@@ -160,6 +164,7 @@ void GranularTerrain::EnableMovingPatch(std::shared_ptr<ChBody> body,
     m_buffer_distance = buffer_distance;
     m_shift_distance = shift_distance;
     m_init_part_vel = init_vel;
+    m_reloc_points.clear();
 
     // Enable moving patch
     m_moving_patch = true;
@@ -463,6 +468,13 @@ void GranularTerrain::Initialize(const ChVector<>& center,
         layer++;
     }
 
+    // Cache the particle bodies.
+    m_particles.clear();
+    for (auto body : m_ground->GetSystem()->Get_bodylist()) {
+        if (body->GetIdentifier() > m_start_id)
+            m_particles.push_back(body);
+    }
+
     // If enabled, create visualization assets for the boundaries.
     if (m_vis_enabled) {
         auto box = std::make_shared<ChBoxShape>();
@@ -494,33 +506,46 @@ void GranularTerrain::Synchronize(double time) {
     // Shift rear boundary.
     m_rear += m_shift_distance;
 
-    // Count particles that must be relocated.
-    unsigned int num_moved_particles = 0;
-    for (auto body : m_ground->GetSystem()->Get_bodylist()) {
-        if (body->GetIdentifier() > m_start_id && body->GetPos().x() - m_radius < m_rear) {
-            num_moved_particles++;
-        }
+    // Collect particles that must be relocated.
+    m_reloc_particles.clear();
+    for (const auto& particle : m_particles) {
+        if (particle->GetPos().x() - m_radius < m_rear)
+            m_reloc_particles.push_back(particle.get());
     }
-
-    // Create a Poisson Disk sampler and generate points in layers within the relocation volume.
-    std::vector<ChVector<>> new_points;
-    double r = safety_factor * m_radius;
-    utils::PDSampler<> sampler(2 * r);
-    ChVector<> layer_hdims(m_shift_distance / 2 - r, m_width / 2 - r, 0);
-    ChVector<> layer_center(m_front + m_shift_distance / 2, (m_left + m_right) / 2, m_bottom + offset_factor * r);
-    while (new_points.size() < num_moved_particles) {
-        auto points = sampler.SampleBox(layer_center, layer_hdims);
-        new_points.insert(new_points.end(), points.begin(), points.end());
-        layer_center.z() += 2 * r;
+    size_t num_moved_particles = m_reloc_particles.size();
+
+    // Relocate all particles at once, in the volume ahead of the front boundary, at the cached relocation points.
+    // The particles are only teleported (the bodies stay in the system, with the same collision models) and
+    // their velocities are reset.
+    GenerateRelocationPoints(num_moved_particles);
+
+    // Vary the pattern of relocated particles from one move to the next. The cached points are used from the bottom
+    // up: the points of the highest (partially used) layer are picked at random, and the whole pattern is mirrored at
+    // random in X and Y (the mirrored points remain inside the relocated volume).
+    if (num_moved_particles > 0 && num_moved_particles < m_reloc_points.size()) {
+        double top = m_reloc_points[num_moved_particles - 1].z();
+        auto layer_begin = std::find_if(m_reloc_points.begin(), m_reloc_points.end(),
+                                        [top](const ChVector<>& point) { return point.z() == top; });
+        auto layer_end = std::find_if(layer_begin, m_reloc_points.end(),
+                                      [top](const ChVector<>& point) { return point.z() != top; });
+        std::shuffle(layer_begin, layer_end, utils::rengine());
     }
-
-    // Relocate particles at their new locations.
-    size_t ip = 0;
-    for (auto body : m_ground->GetSystem()->Get_bodylist()) {
-        if (body->GetIdentifier() > m_start_id && body->GetPos().x() - m_radius < m_rear) {
-            body->SetPos(new_points[ip++]);
-            body->SetPos_dt(m_init_part_vel);
-        }
+    std::bernoulli_distribution flip;
+    bool flip_x = flip(utils::rengine());
+    bool flip_y = flip(utils::rengine());
+
+    ChVector<> origin(m_front, (m_left + m_right) / 2, m_bottom);
+    for (size_t ip = 0; ip < num_moved_particles; ip++) {
+        ChBody* body = m_reloc_particles[ip];
+        ChVector<> point = m_reloc_points[ip];
+        if (flip_x)
+            point.x() = m_shift_distance - point.x();
+        if (flip_y)
+            point.y() = -point.y();
+        body->SetPos(origin + point);
+        body->SetRot(QUNIT);
+        body->SetPos_dt(m_init_part_vel);
+        body->SetWvel_par(VNULL);
     }
 
     // Shift front boundary.
@@ -535,11 +560,59 @@ void GranularTerrain::Synchronize(double time) {
     }
 }
 
+// Extend the cache of relocation points, relative to the rear-bottom-center of the relocated volume.
+// The cache starts with the settled bed (if any), sorted by height, followed by Poisson Disk layers created as
+// needed. The same points are reused for all relocations, so that no sampling is done in steady state.
+void GranularTerrain::GenerateRelocationPoints(size_t num_points) {
+    double r = safety_factor * m_radius;
+
+    if (m_reloc_points.empty()) {
+        m_reloc_points = m_bed;
+        std::stable_sort(m_reloc_points.begin(), m_reloc_points.end(),
+                         [](const ChVector<>& a, const ChVector<>& b) { return a.z() < b.z(); });
+        m_reloc_layer_height = offset_factor * r;
+        for (const auto& point : m_bed)
+            m_reloc_layer_height = std::max(m_reloc_layer_height, point.z() + 2 * r);
+    }
+
+    if (m_reloc_points.size() >= num_points)
+        return;
+
+    utils::PDSampler<> sampler(2 * r);
+    ChVector<> layer_hdims(m_shift_distance / 2 - r, m_width / 2 - r, 0);
+    while (m_reloc_points.size() < num_points) {
+        auto points = sampler.SampleBox(ChVector<>(m_shift_distance / 2, 0, m_reloc_layer_height), layer_hdims);
+        m_reloc_points.insert(m_reloc_points.end(), points.begin(), points.end());
+        m_reloc_layer_height += 2 * r;
+    }
+}
+
+void GranularTerrain::SetMovingPatchBed(const std::vector<ChVector<>>& points) {
+    m_bed = points;
+    m_reloc_points.clear();
+}
+
+std::vector<ChVector<>> GranularTerrain::CaptureMovingPatchBed() const {
+    std::vector<ChVector<>> points;
+    ChVector<> origin(m_rear, (m_left + m_right) / 2, m_bottom);
+    for (const auto& particle : m_particles) {
+        // Only particles entirely inside the slab, so that consecutive relocated slabs do not overlap
+        // (particles in contact with the rear boundary may penetrate it slightly)
+        const ChVector<>& pos = particle->GetPos();
+        if (pos.x() < m_rear || pos.x() + m_radius > m_rear + m_shift_distance)
+            continue;
+        ChVector<> point = pos - origin;
+        point.x() = std::max(point.x(), m_radius);
+        points.push_back(point);
+    }
+    return points;
+}
+
 double GranularTerrain::GetHeight(double x, double y) const {
     double highest = m_bottom;
-    for (auto body : m_ground->GetSystem()->Get_bodylist()) {
-        if (body->GetIdentifier() > m_start_id && body->GetPos().z() > highest)
-            highest = body->GetPos().z();
+    for (const auto& particle : m_particles) {
+        if (particle->GetPos().z() > highest)
+            highest = particle->GetPos().z();
     }
     return highest + m_radius;
 }
@@ -117,6 +117,20 @@ class CH_VEHICLE_API GranularTerrain : public ChTerrain {
                            const ChVector<>& init_vel = ChVector<>()  ///< initial particle velocity
                            );
 
+    /// Set a settled particle bed for the moving patch.
+    /// The points, expressed relative to the rear-bottom-center of the relocated volume (X in [0, shift_distance],
+    /// Y in [-width/2, width/2], Z above the bottom boundary), are used from the bottom up as new locations of the
+    /// relocated particles, so that the new front of the patch is already compacted. If more particles must be
+    /// relocated, the remaining ones are placed above the bed in Poisson Disk layers (as without a bed).
+    /// The pattern of relocated particles is mirrored at random from one relocation to the next.
+    void SetMovingPatchBed(const std::vector<ChVector<>>& points);
+
+    /// Extract a settled particle bed from the current particle locations.
+    /// Return the locations of the particles entirely inside the rear slab of the patch, of length equal to the
+    /// moving patch shift distance, expressed relative to the rear-bottom-center of the slab (see SetMovingPatchBed).
+    /// Typically called after an initial settling phase.
+    std::vector<ChVector<>> CaptureMovingPatchBed() const;
+
     /// Set start value for body identifiers of generated particles (default: 1000000).
     /// It is assumed that all bodies with a larger identifier are granular material particles.
     void SetStartIdentifier(int id) { m_start_id = id; }
@@ -202,6 +216,9 @@ class CH_VEHICLE_API GranularTerrain : public ChTerrain {
     virtual float GetCoefficientFriction(double x, double y) const override;
 
   private:
+    /// Make sure that at least the specified number of relocation points are cached.
+    void GenerateRelocationPoints(size_t num_points);
+
     unsigned int m_min_num_particles;  ///< requested minimum number of particles
     unsigned int m_num_particles;      ///< actual number of particles
     int m_start_id;                    ///< start body identifier for particles
@@ -226,6 +243,13 @@ class CH_VEHICLE_API GranularTerrain : public ChTerrain {
     double m_shift_distance;         ///< size (X direction) of relocated volume
     ChVector<> m_init_part_vel;      ///< initial particle velocity
 
+    // Particle relocation data (reused from one relocation to the next)
+    std::vector<std::shared_ptr<ChBody>> m_particles;  ///< granular material particles
+    std::vector<ChBody*> m_reloc_particles;            ///< particles relocated during the last move
+    std::vector<ChVector<>> m_bed;                     ///< settled bed (relative to relocated volume)
+    std::vector<ChVector<>> m_reloc_points;            ///< cached locations of relocated particles (relative)
+    double m_reloc_layer_height;                       ///< height of next Poisson Disk layer of relocation points
+
     // Rough surface (ground-fixed spheres)
     bool m_rough_surface;  ///< rough surface feature enabled?
     int m_nx;              ///< number of fixed spheres in X direction
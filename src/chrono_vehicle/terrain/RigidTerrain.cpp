@@ -16,6 +16,7 @@
 //
 // =============================================================================
 
+#include <algorithm>
 #include <cmath>
 #include <cstdio>
 
@@ -29,10 +30,10 @@
 #include "chrono_vehicle/ChVehicleModelData.h"
 #include "chrono_vehicle/terrain/RigidTerrain.h"
 
+#include "chrono_vehicle/utils/ChInputCache.h"
 #include "chrono_vehicle/utils/ChUtilsJSON.h"
 
 #include "chrono_thirdparty/Easy_BMP/EasyBMP.h"
-#include "chrono_thirdparty/rapidjson/filereadstream.h"
 
 using namespace rapidjson;
 
@@ -42,22 +43,15 @@ namespace vehicle {
 // -----------------------------------------------------------------------------
 // Default constructor.
 // -----------------------------------------------------------------------------
-RigidTerrain::RigidTerrain(ChSystem* system) : m_system(system), m_num_patches(0) {}
+RigidTerrain::RigidTerrain(ChSystem* system) : m_system(system), m_num_patches(0), m_initialized(false) {}
 
 // -----------------------------------------------------------------------------
 // Constructor from JSON file
 // -----------------------------------------------------------------------------
-RigidTerrain::RigidTerrain(ChSystem* system, const std::string& filename) : m_system(system), m_num_patches(0) {
+RigidTerrain::RigidTerrain(ChSystem* system, const std::string& filename) : m_system(system), m_num_patches(0), m_initialized(false) {
     // Open the JSON file and read data
-    FILE* fp = fopen(filename.c_str(), "r");
-
-    char readBuffer[65536];
-    FileReadStream is(fp, readBuffer, sizeof(readBuffer));
-
-    fclose(fp);
-
     Document d;
-    d.ParseStream<ParseFlag::kParseCommentsFlag>(is);
+    ReadFileJSON(filename, d);
 
     // Read top-level data
     assert(d.HasMember("Type"));
@@ -151,6 +145,7 @@ void RigidTerrain::LoadPatch(const rapidjson::Value& d) {
 // -----------------------------------------------------------------------------
 std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(const ChCoordsys<>& position) {
     m_num_patches++;
+    m_initialized = false;
     auto patch = std::make_shared<Patch>();
 
     // Create the rigid body for this patch (fixed)
@@ -224,12 +219,21 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(const ChCoordsys<>&
         patch->m_body->AddAsset(box);
     }
 
+    patch->m_box_size = size;
     patch->m_type = BOX;
 
     return patch;
 }
 
 // -----------------------------------------------------------------------------
+// Load a Wavefront mesh. If the input cache is enabled, meshes already read
+// from the same file are reused (terrain meshes are immutable once loaded).
+// -----------------------------------------------------------------------------
+static std::shared_ptr<geometry::ChTriangleMeshConnected> LoadMesh(const std::string& mesh_file) {
+    auto mesh = std::make_shared<geometry::ChTriangleMeshConnected>();
+    mesh->LoadWavefrontMesh(mesh_file, true, true);
+    return mesh;
+}
 
 std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(const ChCoordsys<>& position,
                                                             const std::string& mesh_file,
@@ -239,7 +243,7 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(const ChCoordsys<>&
     auto patch = AddPatch(position);
 
     // Load mesh from file
-    patch->m_trimesh.LoadWavefrontMesh(mesh_file, true, true);
+    patch->m_trimesh = *ChInputCache::Get<geometry::ChTriangleMeshConnected>(mesh_file, LoadMesh);
 
     // Create the collision model
     patch->m_body->GetCollisionModel()->ClearModel();
@@ -483,14 +487,182 @@ std::shared_ptr<ChBody> RigidTerrain::Patch::GetGroundBody() const {
 // Initialize all terrain patches
 // -----------------------------------------------------------------------------
 void RigidTerrain::Initialize() {
-    // Nothing to do here.
-    // Kept for consistency and possible future extensions.
+    for (auto patch : m_patches) {
+        patch->BuildGrid();
+    }
+    m_initialized = true;
+}
+
+// -----------------------------------------------------------------------------
+// Build the 2D grid used for height queries on a patch.
+// All patches (including boxes) are represented by triangles in the absolute
+// frame. Each triangle is binned in all grid cells overlapped by its bounding
+// box in the (x,y) plane. Vertical triangles are discarded, as a vertical ray
+// cannot hit them.
+// -----------------------------------------------------------------------------
+void RigidTerrain::Patch::BuildGrid() {
+    m_grid_vertices.clear();
+    m_grid_normals.clear();
+
+    auto AddTriangle = [this](const ChVector<>& v0, const ChVector<>& v1, const ChVector<>& v2) {
+        ChVector<> nrm = Vcross(v1 - v0, v2 - v0);
+        double len = nrm.Length();
+        if (len == 0 || std::abs(nrm.z()) < 1e-12 * len)
+            return;
+        nrm /= (nrm.z() > 0) ? len : -len;
+        m_grid_vertices.push_back(v0);
+        m_grid_vertices.push_back(v1);
+        m_grid_vertices.push_back(v2);
+        m_grid_normals.push_back(nrm);
+    };
+
+    if (m_type == BOX) {
+        ChVector<> corners[8];
+        for (int i = 0; i < 8; i++) {
+            ChVector<> loc(((i & 1) - 0.5) * m_box_size.x(), (((i >> 1) & 1) - 0.5) * m_box_size.y(),
+                           (((i >> 2) & 1) - 0.5) * m_box_size.z());
+            corners[i] = m_body->TransformPointLocalToParent(loc);
+        }
+        // Two triangles per face, corners indexed by bits (x,y,z)
+        int faces[6][4] = {{0, 1, 3, 2}, {4, 5, 7, 6}, {0, 1, 5, 4}, {2, 3, 7, 6}, {0, 2, 6, 4}, {1, 3, 7, 5}};
+        for (int i = 0; i < 6; i++) {
+            AddTriangle(corners[faces[i][0]], corners[faces[i][1]], corners[faces[i][2]]);
+            AddTriangle(corners[faces[i][0]], corners[faces[i][2]], corners[faces[i][3]]);
+        }
+    } else {
+        const std::vector<ChVector<>>& vertices = m_trimesh.getCoordsVertices();
+        const std::vector<ChVector<int>>& indices = m_trimesh.getIndicesVertexes();
+        std::vector<ChVector<>> abs_vertices(vertices.size());
+        for (size_t i = 0; i < vertices.size(); i++) {
+            abs_vertices[i] = m_body->TransformPointLocalToParent(vertices[i]);
+        }
+        for (size_t i = 0; i < indices.size(); i++) {
+            AddTriangle(abs_vertices[indices[i][0]], abs_vertices[indices[i][1]], abs_vertices[indices[i][2]]);
+        }
+    }
+
+    int num_tri = (int)m_grid_normals.size();
+    if (num_tri == 0) {
+        m_grid_nx = 0;
+        m_grid_ny = 0;
+        m_grid_cell_start.assign(1, 0);
+        m_grid_cell_tri.clear();
+        return;
+    }
+
+    // Bounding box of the patch in the (x,y) plane and average triangle size
+    double xmin = m_grid_vertices[0].x();
+    double xmax = xmin;
+    double ymin = m_grid_vertices[0].y();
+    double ymax = ymin;
+    double tri_size = 0;
+    for (int it = 0; it < num_tri; it++) {
+        const ChVector<>* v = &m_grid_vertices[3 * it];
+        double txmin = std::min(std::min(v[0].x(), v[1].x()), v[2].x());
+        double txmax = std::max(std::max(v[0].x(), v[1].x()), v[2].x());
+        double tymin = std::min(std::min(v[0].y(), v[1].y()), v[2].y());
+        double tymax = std::max(std::max(v[0].y(), v[1].y()), v[2].y());
+        xmin = std::min(xmin, txmin);
+        xmax = std::max(xmax, txmax);
+        ymin = std::min(ymin, tymin);
+        ymax = std::max(ymax, tymax);
+        tri_size += std::max(txmax - txmin, tymax - tymin);
+    }
+    tri_size /= num_tri;
+
+    // Cells of the size of an average triangle, with at most 4 cells per triangle
+    double len_x = xmax - xmin;
+    double len_y = ymax - ymin;
+    double delta = std::max(tri_size, 1e-6 * std::max(len_x, len_y));
+    if (delta <= 0)
+        delta = 1;
+    double num_cells = (len_x / delta + 1) * (len_y / delta + 1);
+    if (num_cells > 4.0 * num_tri)
+        delta *= std::sqrt(num_cells / (4.0 * num_tri));
+
+    m_grid_x0 = xmin;
+    m_grid_y0 = ymin;
+    m_grid_delta = delta;
+    m_grid_nx = (int)(len_x / delta) + 1;
+    m_grid_ny = (int)(len_y / delta) + 1;
+
+    auto CellRange = [this](const ChVector<>* v, int& ix0, int& ix1, int& iy0, int& iy1) {
+        double txmin = std::min(std::min(v[0].x(), v[1].x()), v[2].x());
+        double txmax = std::max(std::max(v[0].x(), v[1].x()), v[2].x());
+        double tymin = std::min(std::min(v[0].y(), v[1].y()), v[2].y());
+        double tymax = std::max(std::max(v[0].y(), v[1].y()), v[2].y());
+        ix0 = std::max((int)((txmin - m_grid_x0) / m_grid_delta), 0);
+        ix1 = std::min((int)((txmax - m_grid_x0) / m_grid_delta), m_grid_nx - 1);
+        iy0 = std::max((int)((tymin - m_grid_y0) / m_grid_delta), 0);
+        iy1 = std::min((int)((tymax - m_grid_y0) / m_grid_delta), m_grid_ny - 1);
+    };
+
+    // Count the triangles in each cell, then fill the cells
+    m_grid_cell_start.assign(m_grid_nx * m_grid_ny + 1, 0);
+    for (int it = 0; it < num_tri; it++) {
+        int ix0, ix1, iy0, iy1;
+        CellRange(&m_grid_vertices[3 * it], ix0, ix1, iy0, iy1);
+        for (int iy = iy0; iy <= iy1; iy++)
+            for (int ix = ix0; ix <= ix1; ix++)
+                m_grid_cell_start[iy * m_grid_nx + ix + 1]++;
+    }
+    for (int ic = 0; ic < m_grid_nx * m_grid_ny; ic++) {
+        m_grid_cell_start[ic + 1] += m_grid_cell_start[ic];
+    }
+    m_grid_cell_tri.resize(m_grid_cell_start.back());
+    std::vector<int> fill(m_grid_cell_start.begin(), m_grid_cell_start.end() - 1);
+    for (int it = 0; it < num_tri; it++) {
+        int ix0, ix1, iy0, iy1;
+        CellRange(&m_grid_vertices[3 * it], ix0, ix1, iy0, iy1);
+        for (int iy = iy0; iy <= iy1; iy++)
+            for (int ix = ix0; ix <= ix1; ix++)
+                m_grid_cell_tri[fill[iy * m_grid_nx + ix]++] = it;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Find the highest triangle of the patch containing the (x,y) location, in
+// the range of heights of the vertical rays used for the collision models.
+// -----------------------------------------------------------------------------
+bool RigidTerrain::Patch::FindPoint(double x, double y, double& height, ChVector<>& normal) const {
+    if (m_grid_nx == 0)
+        return false;
+
+    double fx = (x - m_grid_x0) / m_grid_delta;
+    double fy = (y - m_grid_y0) / m_grid_delta;
+    if (fx < 0 || fy < 0 || fx >= m_grid_nx || fy >= m_grid_ny)
+        return false;
+    int ic = (int)fy * m_grid_nx + (int)fx;
+
+    bool hit = false;
+    for (int k = m_grid_cell_start[ic]; k < m_grid_cell_start[ic + 1]; k++) {
+        int it = m_grid_cell_tri[k];
+        const ChVector<>* v = &m_grid_vertices[3 * it];
+
+        // Barycentric coordinates of the location in the triangle projected on the (x,y) plane
+        double det = (v[1].x() - v[0].x()) * (v[2].y() - v[0].y()) - (v[2].x() - v[0].x()) * (v[1].y() - v[0].y());
+        double s = ((x - v[0].x()) * (v[2].y() - v[0].y()) - (v[2].x() - v[0].x()) * (y - v[0].y())) / det;
+        double t = ((v[1].x() - v[0].x()) * (y - v[0].y()) - (x - v[0].x()) * (v[1].y() - v[0].y())) / det;
+        const double tol = 1e-10;
+        if (s < -tol || t < -tol || s + t > 1 + tol)
+            continue;
+
+        double z = v[0].z() + s * (v[1].z() - v[0].z()) + t * (v[2].z() - v[0].z());
+        if (z > height && z <= 1000) {
+            hit = true;
+            height = z;
+            normal = m_grid_normals[it];
+        }
+    }
+
+    return hit;
 }
 
 // -----------------------------------------------------------------------------
 // Functions for obtaining the terrain height, normal, and coefficient of
 // friction  at the specified location.
-// This is done by casting vertical rays into each patch collision model.
+// Once the terrain is initialized, this is done with the 2D grid of each patch.
+// Otherwise, vertical rays are cast into each patch collision model.
 // -----------------------------------------------------------------------------
 bool RigidTerrain::FindPoint(double x, double y, double& height, ChVector<>& normal, float& friction) const {
     bool hit = false;
@@ -498,6 +670,16 @@ bool RigidTerrain::FindPoint(double x, double y, double& height, ChVector<>& nor
     normal = ChVector<>(0, 0, 1);
     friction = 0.8f;
 
+    if (m_initialized) {
+        for (auto& patch : m_patches) {
+            if (patch->FindPoint(x, y, height, normal)) {
+                hit = true;
+                friction = patch->m_friction;
+            }
+        }
+        return hit;
+    }
+
     ChVector<> from(x, y, 1000);
     ChVector<> to(x, y, -1000);
 
@@ -535,6 +717,16 @@ ChVector<> RigidTerrain::GetNormal(double x, double y) const {
     return normal;
 }
 
+void RigidTerrain::GetProperties(double x, double y, double& height, ChVector<>& normal, float& friction) const {
+    bool hit = FindPoint(x, y, height, normal, friction);
+
+    if (!hit)
+        height = 0.0;
+
+    if (m_friction_fun)
+        friction = (*m_friction_fun)(x, y);
+}
+
 float RigidTerrain::GetCoefficientFriction(double x, double y) const {
     if (m_friction_fun)
         return (*m_friction_fun)(x, y);
@@ -44,6 +44,9 @@ namespace vehicle {
 /// through contact and friction with any other bodies whose contact flag is
 /// enabled. In particular, this type of terrain can be used in conjunction with
 /// a ChRigidTire.
+/// Height, normal, and friction queries are answered by casting vertical rays into
+/// the patch collision models until Initialize is called; after that, they use a
+/// 2D grid of the patch triangles built at initialization.
 class CH_VEHICLE_API RigidTerrain : public ChTerrain {
   public:
     enum Type { BOX, MESH, HEIGHT_MAP };
@@ -98,8 +101,27 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         std::shared_ptr<ChBody> m_body;
         geometry::ChTriangleMeshConnected m_trimesh;
         std::string m_mesh_name;
+        ChVector<> m_box_size;
         float m_friction;
 
+        // 2D grid for height queries: triangles of the patch (in absolute frame) binned into
+        // the cells of a regular grid in the (x,y) plane, in compressed row format.
+        std::vector<ChVector<>> m_grid_vertices;  ///< vertices of all triangles, 3 per triangle
+        std::vector<ChVector<>> m_grid_normals;   ///< upward normals of all triangles
+        std::vector<int> m_grid_cell_start;       ///< start of each cell in m_grid_cell_tri
+        std::vector<int> m_grid_cell_tri;         ///< indices of the triangles overlapping each cell
+        double m_grid_x0;                         ///< x coordinate of the grid origin
+        double m_grid_y0;                         ///< y coordinate of the grid origin
+        double m_grid_delta;                      ///< size of a grid cell
+        int m_grid_nx;                            ///< number of grid cells in x direction
+        int m_grid_ny;                            ///< number of grid cells in y direction
+
+        /// Build the 2D grid of the patch triangles.
+        void BuildGrid();
+
+        /// Find the highest patch point at the specified (x,y) location, using the 2D grid.
+        bool FindPoint(double x, double y, double& height, ChVector<>& normal) const;
+
         friend class RigidTerrain;
     };
 
@@ -149,6 +171,8 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     );
 
     /// Initialize all defined terrain patches.
+    /// This builds the data structures used for height, normal, and friction queries.
+    /// Must be called again if patches are added later.
     void Initialize();
 
     /// Get the terrain height at the specified (x,y) location.
@@ -166,6 +190,12 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     /// value from the appropriate patch, as specified through SetContactFrictionCoefficient.
     virtual float GetCoefficientFriction(double x, double y) const override;
 
+    /// Get the terrain height, normal, and coefficient of friction at the specified (x,y) location,
+    /// with a single search through the terrain patches.
+    virtual void GetProperties(double x, double y, double& height, ChVector<>& normal, float& friction) const override;
+
+    using ChTerrain::GetProperties;
+
     /// Export all patch meshes as macros in PovRay include files.
     void ExportMeshPovray(const std::string& out_dir  ///< [in] output directory
     );
@@ -174,6 +204,7 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     ChSystem* m_system;
     int m_num_patches;
     std::vector<std::shared_ptr<Patch>> m_patches;
+    bool m_initialized;
 
     std::shared_ptr<Patch> AddPatch(const ChCoordsys<>& position);
     void LoadPatch(const rapidjson::Value& a);
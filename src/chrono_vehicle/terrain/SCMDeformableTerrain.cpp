@@ -17,15 +17,19 @@
 //
 // =============================================================================
 
+#include <algorithm>
 #include <cstdio>
 #include <cmath>
+#include <functional>
 #include <queue>
 
 #include "chrono/physics/ChMaterialSurfaceNSC.h"
 #include "chrono/physics/ChMaterialSurfaceSMC.h"
 #include "chrono/assets/ChTexture.h"
 #include "chrono/assets/ChBoxShape.h"
+#include "chrono/parallel/ChTaskScheduler.h"
 #include "chrono/utils/ChConvexHull.h"
+#include "chrono/utils/ChTraceProfiler.h"
 
 #include "chrono_vehicle/ChVehicleModelData.h"
 #include "chrono_vehicle/terrain/SCMDeformableTerrain.h"
@@ -95,6 +99,15 @@ bool SCMDeformableTerrain::GetBulldozingFlow() const {
     return m_ground->do_bulldozing;
 }
 
+// Enable ray casting restricted to body bounding boxes.
+void SCMDeformableTerrain::SetBoundingBoxRayCasting(bool val) {
+    m_ground->do_bbox_ray_casting = val;
+}
+
+bool SCMDeformableTerrain::GetBoundingBoxRayCasting() const {
+    return m_ground->do_bbox_ray_casting;
+}
+
 // Set properties of the SCM soil model
 void SCMDeformableTerrain::SetSoilParametersSCM(
     double mBekker_Kphi,    // Kphi, frictional modulus in Bekker model
@@ -189,6 +202,24 @@ void SCMDeformableTerrain::Initialize(const std::string& heightmap_file,
     m_ground->Initialize(heightmap_file, mesh_name, sizeX, sizeY, hMin, hMax);
 }
 
+// Initialize the terrain as a sparse, unbounded flat grid.
+void SCMDeformableTerrain::InitializeSparse(double height, double delta, int tile_size) {
+    m_ground->InitializeSparse(height, delta, tile_size);
+}
+
+// Set the distance for freezing the tiles of a sparse terrain.
+void SCMDeformableTerrain::SetTileFreezeDistance(double dist) {
+    m_ground->m_freeze_distance = dist;
+}
+
+int SCMDeformableTerrain::GetNumActiveTiles() const {
+    return (int)m_ground->m_tiles.size();
+}
+
+int SCMDeformableTerrain::GetNumFrozenTiles() const {
+    return (int)m_ground->m_frozen_tiles.size();
+}
+
 TerrainForce SCMDeformableTerrain::GetContactForce(std::shared_ptr<ChBody> body) const {
     auto itr = m_ground->m_contact_forces.find(body.get());
     if (itr != m_ground->m_contact_forces.end())
@@ -217,6 +248,10 @@ void SCMDeformableTerrain::PrintStepStatistics(std::ostream& os) const {
     os << "   Number faces:            " << m_ground->m_num_faces << std::endl;
     if (m_ground->do_refinement)
         os << "   Number faces refinement: " << m_ground->m_num_marked_faces << std::endl;
+    if (m_ground->m_sparse) {
+        os << "   Number tiles:            " << m_ground->m_tiles.size() << std::endl;
+        os << "   Number frozen tiles:     " << m_ground->m_frozen_tiles.size() << std::endl;
+    }
 }
 
 // -----------------------------------------------------------------------------
@@ -254,6 +289,11 @@ SCMDeformableSoil::SCMDeformableSoil(ChSystem* system) {
     Janosi_shear = 0.01;
     elastic_K = 50000000;
 
+    m_sparse_height = 0;
+    m_sparse_delta = 0.1;
+    m_tile_size = 32;
+    m_freeze_distance = 0;
+
     Initialize(0,3,3,10,10);
     
     plot_type = SCMDeformableTerrain::PLOT_NONE;
@@ -266,10 +306,17 @@ SCMDeformableSoil::SCMDeformableSoil(ChSystem* system) {
     last_t = 0;
 
     m_moving_patch = false;
+    do_bbox_ray_casting = false;
+    grid_nx = 0;
+    grid_nz = 0;
 }
 
 // Initialize the terrain as a flat grid
 void SCMDeformableSoil::Initialize(double height, double sizeX, double sizeY, int nX, int nY) {
+    m_sparse = false;
+    m_tiles.clear();
+    m_frozen_tiles.clear();
+
     m_trimesh_shape->GetMesh().Clear();
     // Readability aliases
     std::vector<ChVector<> >& vertices = m_trimesh_shape->GetMesh().getCoordsVertices();
@@ -333,6 +380,10 @@ void SCMDeformableSoil::Initialize(double height, double sizeX, double sizeY, in
 
 // Initialize the terrain from a specified .obj mesh file.
 void SCMDeformableSoil::Initialize(const std::string& mesh_file) {
+    m_sparse = false;
+    m_tiles.clear();
+    m_frozen_tiles.clear();
+
     m_trimesh_shape->GetMesh().Clear();
     m_trimesh_shape->GetMesh().LoadWavefrontMesh(mesh_file, true, true);
 }
@@ -344,6 +395,10 @@ void SCMDeformableSoil::Initialize(const std::string& heightmap_file,
                               double sizeY,
                               double hMin,
                               double hMax) {
+    m_sparse = false;
+    m_tiles.clear();
+    m_frozen_tiles.clear();
+
     m_trimesh_shape->GetMesh().Clear();
 
     // Read the BMP file nd extract number of pixels.
@@ -458,6 +513,254 @@ void SCMDeformableSoil::Initialize(const std::string& heightmap_file,
     SetupAuxData();
 }
 
+// Initialize the terrain as a sparse, unbounded flat grid.
+// The mesh starts empty: tiles are added at each step, as needed (see UpdateTiles).
+void SCMDeformableSoil::InitializeSparse(double height, double delta, int tile_size) {
+    if (delta <= 0 || tile_size < 2)
+        throw ChException("Invalid grid spacing or tile size for sparse SCM terrain");
+
+    m_sparse = true;
+    m_sparse_height = height;
+    m_sparse_delta = delta;
+    m_tile_size = tile_size;
+    m_tiles.clear();
+    m_frozen_tiles.clear();
+
+    m_trimesh_shape->GetMesh().Clear();
+
+    SetupAuxData();
+}
+
+// Index of the tile containing the grid point of index i (rounding towards negative infinity).
+static int TileIndex(int i, int tile_size) {
+    return i >= 0 ? i / tile_size : -((-i - 1) / tile_size) - 1;
+}
+
+// Reorder per-vertex data after a change of the tiles of a sparse terrain.
+// Element k of the new data is the element old_index[k] of the old data, or the given value if old_index[k] < 0.
+template <typename T>
+static void ReorderVertexData(std::vector<T>& data, const std::vector<int>& old_index, const T& value) {
+    std::vector<T> reordered(old_index.size(), value);
+    for (size_t k = 0; k < old_index.size(); ++k) {
+        if (old_index[k] >= 0)
+            reordered[k] = data[old_index[k]];
+    }
+    data.swap(reordered);
+}
+
+int SCMDeformableSoil::GetTileVertex(int i, int j) const {
+    auto tile = m_tiles.find(TileKey(TileIndex(i, m_tile_size), TileIndex(j, m_tile_size)));
+    if (tile == m_tiles.end())
+        return -1;
+    return tile->second + (j - tile->first.second * m_tile_size) * m_tile_size + (i - tile->first.first * m_tile_size);
+}
+
+// Create the tiles of a sparse terrain which are close to the bodies, and freeze the ones which are far.
+void SCMDeformableSoil::UpdateTiles() {
+    // Bounding boxes of the moving bodies with collision enabled, in the plane reference
+    // (where X and Z are the longitude and latitude, Y the height)
+    struct BodyBox {
+        ChVector<> min;
+        ChVector<> max;
+    };
+    std::vector<BodyBox> boxes;
+    for (auto body : GetSystem()->Get_bodylist()) {
+        if (body->GetBodyFixed() || !body->GetCollide() || !body->GetCollisionModel())
+            continue;
+        ChVector<> aabb_min;
+        ChVector<> aabb_max;
+        body->GetCollisionModel()->GetAABB(aabb_min, aabb_max);
+        BodyBox box = {ChVector<>(1e30), ChVector<>(-1e30)};
+        for (int k = 0; k < 8; ++k) {
+            ChVector<> corner((k & 1) ? aabb_max.x() : aabb_min.x(), (k & 2) ? aabb_max.y() : aabb_min.y(),
+                              (k & 4) ? aabb_max.z() : aabb_min.z());
+            ChVector<> local = plane.TransformParentToLocal(corner);
+            box.min = ChVector<>(ChMin(box.min.x(), local.x()), ChMin(box.min.y(), local.y()), ChMin(box.min.z(), local.z()));
+            box.max = ChVector<>(ChMax(box.max.x(), local.x()), ChMax(box.max.y(), local.y()), ChMax(box.max.z(), local.z()));
+        }
+        boxes.push_back(box);
+    }
+
+    // Tiles below the boxes which reach the soil, i.e. which can be hit by the rays. The boxes are enlarged
+    // to contain the bulldozing domain, i.e. the erosion front dilated 10 times around the contact islands.
+    double margin = (do_bulldozing ? 12 : 1) * m_sparse_delta;
+    std::set<TileKey> tiles;
+    for (const auto& box : boxes) {
+        if (box.min.y() > m_sparse_height + test_high_offset)
+            continue;
+        int ti_min = TileIndex((int)std::floor((box.min.x() - margin) / m_sparse_delta), m_tile_size);
+        int ti_max = TileIndex((int)std::ceil((box.max.x() + margin) / m_sparse_delta), m_tile_size);
+        int tj_min = TileIndex((int)std::floor((box.min.z() - margin) / m_sparse_delta), m_tile_size);
+        int tj_max = TileIndex((int)std::ceil((box.max.z() + margin) / m_sparse_delta), m_tile_size);
+        for (int tj = tj_min; tj <= tj_max; ++tj) {
+            for (int ti = ti_min; ti <= ti_max; ++ti)
+                tiles.insert(TileKey(ti, tj));
+        }
+    }
+
+    // Keep the other tiles already in the mesh, unless they are farther than the freeze distance from all boxes
+    double tile_length = (m_tile_size - 1) * m_sparse_delta;
+    for (const auto& tile : m_tiles) {
+        if (tiles.count(tile.first))
+            continue;
+        bool far = m_freeze_distance > 0;
+        if (far) {
+            double x_min = tile.first.first * m_tile_size * m_sparse_delta;
+            double z_min = tile.first.second * m_tile_size * m_sparse_delta;
+            for (const auto& box : boxes) {
+                double dx = ChMax(0.0, ChMax(box.min.x() - (x_min + tile_length), x_min - box.max.x()));
+                double dz = ChMax(0.0, ChMax(box.min.z() - (z_min + tile_length), z_min - box.max.z()));
+                if (dx * dx + dz * dz <= m_freeze_distance * m_freeze_distance) {
+                    far = false;
+                    break;
+                }
+            }
+        }
+        if (!far)
+            tiles.insert(tile.first);
+    }
+
+    bool changed = tiles.size() != m_tiles.size();
+    if (!changed) {
+        auto itr = m_tiles.begin();
+        for (const auto& key : tiles) {
+            if (key != (itr++)->first) {
+                changed = true;
+                break;
+            }
+        }
+    }
+
+    if (changed)
+        RebuildTileMesh(tiles);
+}
+
+// Rebuild the mesh of a sparse terrain for the given set of tiles.
+// The vertex data of the tiles already in the mesh is kept, the tiles removed from the mesh are frozen
+// (only if deformed), and the new tiles are either restored from their frozen state or created undeformed.
+void SCMDeformableSoil::RebuildTileMesh(const std::set<TileKey>& tiles) {
+    // Readability aliases
+    std::vector<ChVector<> >& vertices = m_trimesh_shape->GetMesh().getCoordsVertices();
+    std::vector<ChVector<> >& normals = m_trimesh_shape->GetMesh().getCoordsNormals();
+    std::vector<ChVector<> >& uv_coords = m_trimesh_shape->GetMesh().getCoordsUV();
+    std::vector<ChVector<int> >& idx_vertices = m_trimesh_shape->GetMesh().getIndicesVertexes();
+    std::vector<ChVector<int> >& idx_normals = m_trimesh_shape->GetMesh().getIndicesNormals();
+
+    ChVector<> N = plane.TransformDirectionLocalToParent(ChVector<>(0, 1, 0));
+    int tile_vertices = m_tile_size * m_tile_size;
+
+    // Freeze the deformed tiles which are removed from the mesh
+    for (const auto& tile : m_tiles) {
+        if (tiles.count(tile.first))
+            continue;
+        std::vector<FrozenVertex> frozen(tile_vertices);
+        bool deformed = false;
+        for (int k = 0; k < tile_vertices; ++k) {
+            int iv = tile.second + k;
+            FrozenVertex& fv = frozen[k];
+            fv.level_initial = (float)(p_level_initial[iv] - m_sparse_height);
+            fv.sinkage = (float)p_sinkage[iv];
+            fv.sinkage_plastic = (float)p_sinkage_plastic[iv];
+            fv.sigma_yeld = (float)p_sigma_yeld[iv];
+            fv.kshear = (float)p_kshear[iv];
+            fv.massremainder = (float)p_massremainder[iv];
+            deformed = deformed || fv.level_initial != 0 || fv.sinkage != 0 || fv.sinkage_plastic != 0 ||
+                       fv.sigma_yeld != 0 || fv.kshear != 0 || fv.massremainder != 0;
+        }
+        if (deformed)
+            m_frozen_tiles[tile.first].swap(frozen);
+    }
+
+    // Assign consecutive vertices to the new tiles, and find the old index of each vertex
+    std::map<TileKey, int> new_tiles;
+    std::vector<int> old_index(tiles.size() * tile_vertices, -1);
+    int first_vertex = 0;
+    for (const auto& key : tiles) {
+        auto old_tile = m_tiles.find(key);
+        if (old_tile != m_tiles.end()) {
+            for (int k = 0; k < tile_vertices; ++k)
+                old_index[first_vertex + k] = old_tile->second + k;
+        }
+        new_tiles[key] = first_vertex;
+        first_vertex += tile_vertices;
+    }
+    m_tiles.swap(new_tiles);
+
+    ReorderVertexData(vertices, old_index, VNULL);
+    ReorderVertexData(normals, old_index, N);
+    ReorderVertexData(uv_coords, old_index, VNULL);
+    m_trimesh_shape->GetMesh().getCoordsColors().clear();
+
+    ReorderVertexData(p_vertices_initial, old_index, VNULL);
+    ReorderVertexData(p_speeds, old_index, VNULL);
+    ReorderVertexData(p_level, old_index, m_sparse_height);
+    ReorderVertexData(p_level_initial, old_index, m_sparse_height);
+    ReorderVertexData(p_hit_level, old_index, 1e9);
+    ReorderVertexData(p_sinkage, old_index, 0.0);
+    ReorderVertexData(p_sinkage_plastic, old_index, 0.0);
+    ReorderVertexData(p_sinkage_elastic, old_index, 0.0);
+    ReorderVertexData(p_step_plastic_flow, old_index, 0.0);
+    ReorderVertexData(p_kshear, old_index, 0.0);
+    ReorderVertexData(p_area, old_index, 0.0);
+    ReorderVertexData(p_sigma, old_index, 0.0);
+    ReorderVertexData(p_sigma_yeld, old_index, 0.0);
+    ReorderVertexData(p_tau, old_index, 0.0);
+    ReorderVertexData(p_massremainder, old_index, 0.0);
+    ReorderVertexData(p_id_island, old_index, 0);
+    ReorderVertexData(p_erosion, old_index, false);
+
+    // Set the vertices of the new tiles
+    for (const auto& tile : m_tiles) {
+        if (old_index[tile.second] >= 0)
+            continue;
+        auto frozen = m_frozen_tiles.find(tile.first);
+        for (int k = 0; k < tile_vertices; ++k) {
+            int iv = tile.second + k;
+            int i = tile.first.first * m_tile_size + k % m_tile_size;
+            int j = tile.first.second * m_tile_size + k / m_tile_size;
+            if (frozen != m_frozen_tiles.end()) {
+                const FrozenVertex& fv = frozen->second[k];
+                p_level_initial[iv] = m_sparse_height + fv.level_initial;
+                p_sinkage[iv] = fv.sinkage;
+                p_sinkage_plastic[iv] = fv.sinkage_plastic;
+                p_sigma_yeld[iv] = fv.sigma_yeld;
+                p_kshear[iv] = fv.kshear;
+                p_massremainder[iv] = fv.massremainder;
+            }
+            p_level[iv] = p_level_initial[iv] - p_sinkage[iv];
+            p_vertices_initial[iv] = plane * ChVector<>(i * m_sparse_delta, p_level_initial[iv], j * m_sparse_delta);
+            vertices[iv] = p_vertices_initial[iv] - N * p_sinkage[iv];
+            // UV coordinates in meters
+            uv_coords[iv] = ChVector<>(i * m_sparse_delta, j * m_sparse_delta, 0);
+        }
+        if (frozen != m_frozen_tiles.end())
+            m_frozen_tiles.erase(frozen);
+    }
+
+    // Two faces per grid cell, if all its corners are in the mesh
+    idx_vertices.clear();
+    for (const auto& tile : m_tiles) {
+        for (int k = 0; k < tile_vertices; ++k) {
+            int i = tile.first.first * m_tile_size + k % m_tile_size;
+            int j = tile.first.second * m_tile_size + k / m_tile_size;
+            int v0 = tile.second + k;
+            int v1 = GetTileVertex(i + 1, j);
+            int v2 = GetTileVertex(i + 1, j + 1);
+            int v3 = GetTileVertex(i, j + 1);
+            if (v1 < 0 || v2 < 0 || v3 < 0)
+                continue;
+            idx_vertices.push_back(ChVector<int>(v0, v2, v3));
+            idx_vertices.push_back(ChVector<int>(v0, v1, v2));
+        }
+    }
+    idx_normals = idx_vertices;
+
+    ComputeConnectivity();
+    ComputeVertexGrid();
+
+    m_trimesh_shape->GetMesh().ComputeNeighbouringTriangleMap(this->tri_map);
+}
+
 // Set up auxiliary data structures.
 void SCMDeformableSoil::SetupAuxData() {
     // better readability:
@@ -489,21 +792,106 @@ void SCMDeformableSoil::SetupAuxData() {
         p_level_initial[i] = p_level[i];
     }
 
-    connected_vertexes.resize( vertices.size() );
+    ComputeConnectivity();
+    ComputeVertexGrid();
+
+    m_trimesh_shape->GetMesh().ComputeNeighbouringTriangleMap(this->tri_map);
+}
+
+void SCMDeformableSoil::ComputeConnectivity() {
+    std::vector<ChVector<int> >& idx_vertices = m_trimesh_shape->GetMesh().getIndicesVertexes();
+    size_t num_vertices = m_trimesh_shape->GetMesh().getCoordsVertices().size();
+
+    // Each face adds its two other vertices to each of its vertices (with duplicates)
+    connected_start.assign(num_vertices + 1, 0);
     for (unsigned int iface = 0; iface < idx_vertices.size(); ++iface) {
-        connected_vertexes[idx_vertices[iface][0]].insert(idx_vertices[iface][1]);
-        connected_vertexes[idx_vertices[iface][0]].insert(idx_vertices[iface][2]);
-        connected_vertexes[idx_vertices[iface][1]].insert(idx_vertices[iface][0]);
-        connected_vertexes[idx_vertices[iface][1]].insert(idx_vertices[iface][2]);
-        connected_vertexes[idx_vertices[iface][2]].insert(idx_vertices[iface][0]);
-        connected_vertexes[idx_vertices[iface][2]].insert(idx_vertices[iface][1]);
+        for (int k = 0; k < 3; k++)
+            connected_start[idx_vertices[iface][k] + 1] += 2;
+    }
+    for (size_t iv = 0; iv < num_vertices; ++iv) {
+        connected_start[iv + 1] += connected_start[iv];
+    }
+    connected_index.resize(connected_start[num_vertices]);
+    std::vector<int> fill(connected_start.begin(), connected_start.end() - 1);
+    for (unsigned int iface = 0; iface < idx_vertices.size(); ++iface) {
+        for (int k = 0; k < 3; k++) {
+            int iv = idx_vertices[iface][k];
+            connected_index[fill[iv]++] = idx_vertices[iface][(k + 1) % 3];
+            connected_index[fill[iv]++] = idx_vertices[iface][(k + 2) % 3];
+        }
     }
 
-    m_trimesh_shape->GetMesh().ComputeNeighbouringTriangleMap(this->tri_map);
+    // Sort the neighbors of each vertex and remove duplicates, compacting the arrays in place
+    int num_connected = 0;
+    for (size_t iv = 0; iv < num_vertices; ++iv) {
+        auto first = connected_index.begin() + connected_start[iv];
+        auto last = connected_index.begin() + connected_start[iv + 1];
+        std::sort(first, last);
+        last = std::unique(first, last);
+        connected_start[iv] = num_connected;
+        num_connected = (int)(std::copy(first, last, connected_index.begin() + num_connected) - connected_index.begin());
+    }
+    connected_start[num_vertices] = num_connected;
+    connected_index.resize(num_connected);
+}
+
+void SCMDeformableSoil::ComputeVertexGrid() {
+    std::vector<ChVector<> >& vertices = m_trimesh_shape->GetMesh().getCoordsVertices();
+    int num_vertices = (int)vertices.size();
+
+    grid_nx = 0;
+    grid_nz = 0;
+    grid_cell_start.assign(1, 0);
+    grid_vertex.clear();
+    if (num_vertices == 0)
+        return;
+
+    // Coordinates of the vertices in the reference plane
+    std::vector<ChVector2<>> loc(num_vertices);
+    ChVector2<> loc_min(1e30, 1e30);
+    ChVector2<> loc_max(-1e30, -1e30);
+    for (int i = 0; i < num_vertices; ++i) {
+        ChVector<> v = plane.TransformParentToLocal(vertices[i]);
+        loc[i] = ChVector2<>(v.x(), v.z());
+        loc_min.x() = std::min(loc_min.x(), v.x());
+        loc_min.y() = std::min(loc_min.y(), v.z());
+        loc_max.x() = std::max(loc_max.x(), v.x());
+        loc_max.y() = std::max(loc_max.y(), v.z());
+    }
+
+    // Cells holding about 4 vertices on average
+    double area = (loc_max.x() - loc_min.x()) * (loc_max.y() - loc_min.y());
+    grid_delta = std::sqrt(4 * area / num_vertices);
+    if (grid_delta <= 0)
+        grid_delta = 1;
+    grid_x0 = loc_min.x();
+    grid_z0 = loc_min.y();
+    grid_nx = (int)((loc_max.x() - loc_min.x()) / grid_delta) + 1;
+    grid_nz = (int)((loc_max.y() - loc_min.y()) / grid_delta) + 1;
+
+    // Counting sort of the vertices by cell
+    std::vector<int> cell(num_vertices);
+    grid_cell_start.assign(grid_nx * grid_nz + 1, 0);
+    for (int i = 0; i < num_vertices; ++i) {
+        int ix = std::min((int)((loc[i].x() - grid_x0) / grid_delta), grid_nx - 1);
+        int iz = std::min((int)((loc[i].y() - grid_z0) / grid_delta), grid_nz - 1);
+        cell[i] = iz * grid_nx + ix;
+        grid_cell_start[cell[i] + 1]++;
+    }
+    for (int c = 0; c < grid_nx * grid_nz; ++c) {
+        grid_cell_start[c + 1] += grid_cell_start[c];
+    }
+    grid_vertex.resize(num_vertices);
+    std::vector<int> fill(grid_cell_start.begin(), grid_cell_start.end() - 1);
+    for (int i = 0; i < num_vertices; ++i) {
+        grid_vertex[fill[cell[i]]++] = i;
+    }
 }
 
 // Reset the list of forces, and fills it with forces from a soil contact model.
 void SCMDeformableSoil::ComputeInternalForces() {
+    CH_TRACE("SCMDeformableSoil::ComputeInternalForces");
+
     m_timer_calc_areas.reset();
     m_timer_ray_casting.reset();
     m_timer_refinement.reset();
@@ -524,6 +912,13 @@ void SCMDeformableSoil::ComputeInternalForces() {
     this->GetLoadList().clear();
     m_contact_forces.clear();
 
+    //
+    // Update the tiles of a sparse terrain
+    //
+
+    if (m_sparse)
+        UpdateTiles();
+
     //
     // Compute (pseudo)areas per node
     //
@@ -584,37 +979,163 @@ void SCMDeformableSoil::ComputeInternalForces() {
     };
     std::unordered_map<int, HitRecord> hits;
 
-    for (int i = 0; i < vertices.size(); ++i) {
-        // Initialize SCM quantities at current vertex
-        p_sigma[i] = 0;
-        p_sinkage_elastic[i] = 0;
-        p_step_plastic_flow[i] = 0;
-        p_erosion[i] = false;
-        p_level[i] = plane.TransformParentToLocal(vertices[i]).y();
-        p_hit_level[i] = 1e9;
-
-        // Skip vertices outside moving patch
-        if (m_moving_patch) {
-            if (vertices[i].x() < patch_min.x() || vertices[i].x() > patch_max.x() || vertices[i].y() < patch_min.y() ||
-                vertices[i].y() > patch_max.y()) {
+    if (do_bbox_ray_casting) {
+        // The ray of vertex v goes from v + d_from to v + d_to. Its bounding box overlaps that of a body
+        // if and only if v lies in the body box shifted by the ray extent, [min - d_max, max - d_min].
+        ChVector<> d_from = N * (test_high_offset - test_low_offset);
+        ChVector<> d_to = N * test_high_offset;
+        ChVector<> d_min(std::min(d_from.x(), d_to.x()), std::min(d_from.y(), d_to.y()), std::min(d_from.z(), d_to.z()));
+        ChVector<> d_max(std::max(d_from.x(), d_to.x()), std::max(d_from.y(), d_to.y()), std::max(d_from.z(), d_to.z()));
+
+        // Collect the vertex ranges of all bodies which can collide with the soil
+        struct BodyBox {
+            collision::ChCollisionModel* model;
+            ChVector<> v_min;
+            ChVector<> v_max;
+        };
+        std::vector<BodyBox> boxes;
+        for (auto body : GetSystem()->Get_bodylist()) {
+            if (!body->GetCollide() || !body->GetCollisionModel())
                 continue;
+            BodyBox box;
+            box.model = body->GetCollisionModel().get();
+            box.model->GetAABB(box.v_min, box.v_max);
+            box.v_min -= d_max;
+            box.v_max -= d_min;
+            boxes.push_back(box);
+        }
+
+        // Initialize SCM quantities at all vertices
+        int num_vertices = (int)vertices.size();
+        for (int i = 0; i < num_vertices; ++i) {
+            p_sigma[i] = 0;
+            p_sinkage_elastic[i] = 0;
+            p_step_plastic_flow[i] = 0;
+            p_erosion[i] = false;
+            p_level[i] = plane.TransformParentToLocal(vertices[i]).y();
+            p_hit_level[i] = 1e9;
+        }
+
+        // Collect the vertices in the grid cells below each vertex range. A vertex moves only along the
+        // plane normal, so its cell is that of its projection on the reference plane.
+        std::vector<int> candidates;
+        std::vector<char> is_candidate(num_vertices, 0);
+        for (const auto& box : boxes) {
+            double x_min = 1e30, x_max = -1e30, z_min = 1e30, z_max = -1e30;
+            for (int corner = 0; corner < 8; corner++) {
+                ChVector<> c((corner & 1) ? box.v_max.x() : box.v_min.x(), (corner & 2) ? box.v_max.y() : box.v_min.y(),
+                             (corner & 4) ? box.v_max.z() : box.v_min.z());
+                ChVector<> c_loc = plane.TransformParentToLocal(c);
+                x_min = std::min(x_min, c_loc.x());
+                x_max = std::max(x_max, c_loc.x());
+                z_min = std::min(z_min, c_loc.z());
+                z_max = std::max(z_max, c_loc.z());
+            }
+            int ix_min = std::max((int)std::floor((x_min - grid_x0) / grid_delta), 0);
+            int ix_max = std::min((int)std::floor((x_max - grid_x0) / grid_delta), grid_nx - 1);
+            int iz_min = std::max((int)std::floor((z_min - grid_z0) / grid_delta), 0);
+            int iz_max = std::min((int)std::floor((z_max - grid_z0) / grid_delta), grid_nz - 1);
+            for (int iz = iz_min; iz <= iz_max; iz++) {
+                for (int ix = ix_min; ix <= ix_max; ix++) {
+                    int c = iz * grid_nx + ix;
+                    for (int k = grid_cell_start[c]; k < grid_cell_start[c + 1]; k++) {
+                        int i = grid_vertex[k];
+                        if (!is_candidate[i]) {
+                            is_candidate[i] = 1;
+                            candidates.push_back(i);
+                        }
+                    }
+                }
             }
         }
 
-        // Perform ray casting from current vertex
-        collision::ChCollisionSystem::ChRayhitResult mrayhit_result;
-        ChVector<> to = vertices[i] + N * test_high_offset;
-        ChVector<> from = to - N * test_low_offset;
-        this->GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
-        m_num_ray_casts++;
-        if (mrayhit_result.hit) {
-            HitRecord record = { mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1 };
-            hits.insert(std::make_pair(i, record));
+        // Keep the vertex order of the default ray casting, which sets the order of the contact patches
+        std::sort(candidates.begin(), candidates.end());
+
+        // Cast rays from the candidate vertices which lie in a vertex range, only against the collision
+        // models of the corresponding bodies. These ray tests are independent, so they are done in parallel,
+        // recording the closest hit of each vertex.
+        int num_candidates = (int)candidates.size();
+        std::vector<collision::ChCollisionSystem::ChRayhitResult> candidate_hits(num_candidates);
+
+        auto cast_rays = [&](int first, int last) {
+            size_t count = 0;
+            for (int k = first; k < last; ++k) {
+                int i = candidates[k];
+                candidate_hits[k].hit = false;
+
+                // Skip vertices outside moving patch
+                if (m_moving_patch) {
+                    if (vertices[i].x() < patch_min.x() || vertices[i].x() > patch_max.x() ||
+                        vertices[i].y() < patch_min.y() || vertices[i].y() > patch_max.y()) {
+                        continue;
+                    }
+                }
+
+                ChVector<> to = vertices[i] + d_to;
+                ChVector<> from = to - N * test_low_offset;
+
+                for (const auto& box : boxes) {
+                    if (vertices[i].x() < box.v_min.x() || vertices[i].x() > box.v_max.x() ||
+                        vertices[i].y() < box.v_min.y() || vertices[i].y() > box.v_max.y() ||
+                        vertices[i].z() < box.v_min.z() || vertices[i].z() > box.v_max.z())
+                        continue;
+
+                    collision::ChCollisionSystem::ChRayhitResult mrayhit_result;
+                    GetSystem()->GetCollisionSystem()->RayHit(from, to, box.model, mrayhit_result);
+                    count++;
+                    if (mrayhit_result.hit &&
+                        (!candidate_hits[k].hit || mrayhit_result.dist_factor < candidate_hits[k].dist_factor)) {
+                        candidate_hits[k] = mrayhit_result;
+                    }
+                }
+            }
+            return count;
+        };
+        size_t num_ray_casts =
+            ChTaskScheduler::GetInstance().ParallelReduce(0, num_candidates, size_t(0), cast_rays, std::plus<size_t>(),
+                                                          0, GetSystem()->GetParallelThreadNumber());
+
+        m_num_ray_casts = num_ray_casts;
+        for (int k = 0; k < num_candidates; ++k) {
+            if (candidate_hits[k].hit) {
+                HitRecord record = {candidate_hits[k].hitModel->GetContactable(), candidate_hits[k].abs_hitPoint, -1};
+                hits.insert(std::make_pair(candidates[k], record));
+            }
+        }
+    } else {
+        for (int i = 0; i < vertices.size(); ++i) {
+            // Initialize SCM quantities at current vertex
+            p_sigma[i] = 0;
+            p_sinkage_elastic[i] = 0;
+            p_step_plastic_flow[i] = 0;
+            p_erosion[i] = false;
+            p_level[i] = plane.TransformParentToLocal(vertices[i]).y();
+            p_hit_level[i] = 1e9;
+
+            // Skip vertices outside moving patch
+            if (m_moving_patch) {
+                if (vertices[i].x() < patch_min.x() || vertices[i].x() > patch_max.x() ||
+                    vertices[i].y() < patch_min.y() || vertices[i].y() > patch_max.y()) {
+                    continue;
+                }
+            }
+
+            // Perform ray casting from current vertex
+            collision::ChCollisionSystem::ChRayhitResult mrayhit_result;
+            ChVector<> to = vertices[i] + N * test_high_offset;
+            ChVector<> from = to - N * test_low_offset;
+            this->GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
+            m_num_ray_casts++;
+            if (mrayhit_result.hit) {
+                HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
+                hits.insert(std::make_pair(i, record));
+            }
         }
     }
 
     // Loop through all hit vertices and determine to which contact patch they belong.
-    // We use here the connected_vertexes map (from a vertex to its adjacent vertices) which is
+    // We use here the vertex adjacency (from a vertex to its adjacent vertices) which is
     // set up at initialization and updated when the mesh is refined (if refinement is enabled).
     // Use a queue-based flood-filling algorithm.
     int num_patches = 0;
@@ -630,7 +1151,8 @@ void SCMDeformableSoil::ComputeInternalForces() {
             todo.pop();                                            // remove first element of queue
             auto crt_i = crt->first;                               //
             auto crt_patch = crt->second.patch_id;                 //
-            for (const auto& nbr_i : connected_vertexes[crt_i]) {  // loop over all neighbors
+            for (int k = connected_start[crt_i]; k < connected_start[crt_i + 1]; k++) {  // loop over all neighbors
+                int nbr_i = connected_index[k];                    //
                 auto nbr = hits.find(nbr_i);                       // look for neighbor in list of hit vertices
                 if (nbr == hits.end())                             // move on if neighbor is not a hit vertex
                     continue;                                      //
@@ -798,7 +1320,7 @@ void SCMDeformableSoil::ComputeInternalForces() {
     m_num_marked_faces = 0;
     m_timer_refinement.start();
 
-    if (do_refinement) {
+    if (do_refinement && !m_sparse) {
 
         std::vector<std::vector<double>*> aux_data_double;
         aux_data_double.push_back(&p_level);
@@ -863,16 +1385,8 @@ void SCMDeformableSoil::ComputeInternalForces() {
         }
         // TO DO adjust this incrementally
 
-        connected_vertexes.clear();
-        connected_vertexes.resize(vertices.size());
-        for (unsigned int iface = 0; iface < idx_vertices.size(); ++iface) {
-            connected_vertexes[idx_vertices[iface][0]].insert(idx_vertices[iface][1]);
-            connected_vertexes[idx_vertices[iface][0]].insert(idx_vertices[iface][2]);
-            connected_vertexes[idx_vertices[iface][1]].insert(idx_vertices[iface][0]);
-            connected_vertexes[idx_vertices[iface][1]].insert(idx_vertices[iface][2]);
-            connected_vertexes[idx_vertices[iface][2]].insert(idx_vertices[iface][0]);
-            connected_vertexes[idx_vertices[iface][2]].insert(idx_vertices[iface][1]);
-        }
+        ComputeConnectivity();
+        ComputeVertexGrid();
 
         // Recompute areas (could be optimized)
         for (unsigned int iv = 0; iv < vertices.size(); ++iv) {
@@ -932,7 +1446,8 @@ void SCMDeformableSoil::ComputeInternalForces() {
                 // fill next front
                 std::set<int> fill_front_2;
                 for (const auto& ifront : fill_front) {
-                    for (const auto& ivconnect : connected_vertexes[ifront]) {
+                    for (int k = connected_start[ifront]; k < connected_start[ifront + 1]; k++) {
+                        int ivconnect = connected_index[k];
                         if ((p_sigma[ivconnect]>0) && (p_id_island[ivconnect]==0)) {
                             ++n_vert_island;
                             tot_step_flow_island += p_area[ivconnect] * p_step_plastic_flow[ivconnect] * this->GetSystem()->GetStep();
@@ -988,7 +1503,8 @@ void SCMDeformableSoil::ComputeInternalForces() {
         for (int iloop = 0; iloop <10; ++iloop) {
             std::set<int> front_erosion2;
             for(const auto& is : front_erosion) {
-                for (const auto& ivconnect : connected_vertexes[is]) {
+                for (int k = connected_start[is]; k < connected_start[is + 1]; k++) {
+                    int ivconnect = connected_index[k];
                     if ((p_id_island[ivconnect]==0) && (p_erosion[ivconnect]==0)) {
                         front_erosion2.insert(ivconnect);
                         p_erosion[ivconnect] = true;
@@ -1001,7 +1517,9 @@ void SCMDeformableSoil::ComputeInternalForces() {
         // Erosion smoothing algorithm on domain
         for (int ismo = 0; ismo <3; ++ismo) {
             for (const auto& is : domain_erosion) {
-                for (const auto& ivc : connected_vertexes[is]) {
+                double num_connected = (double)(connected_start[is + 1] - connected_start[is]);
+                for (int k = connected_start[is]; k < connected_start[is + 1]; k++) {
+                    int ivc = connected_index[k];
                     ChVector<> vis = this->plane.TransformParentToLocal(vertices[is]);
                     // flow remainder material 
                     if (true) {
@@ -1011,7 +1529,7 @@ void SCMDeformableSoil::ComputeInternalForces() {
  
                             // if i higher than c: clamp c upward correction as it might invalidate 
                             // the ceiling constraint, if collision is nearby
-                            double d_y_c = (p_massremainder[is]-p_massremainder[ivc])* (1/(double)connected_vertexes[is].size()) *  p_area[is]/(p_area[is]+p_area[ivc]);
+                            double d_y_c = (p_massremainder[is]-p_massremainder[ivc])* (1/num_connected) *  p_area[is]/(p_area[is]+p_area[ivc]);
                             clamped_d_y_c = d_y_c; 
                             if (d_y_c > p_hit_level[ivc]-p_level[ivc]) {
                                 p_massremainder[ivc] += d_y_c - (p_hit_level[ivc]-p_level[ivc]);
@@ -1054,7 +1572,7 @@ void SCMDeformableSoil::ComputeInternalForces() {
                             if (dy > 0) { 
                                 // if i higher than c: clamp c upward correction as it might invalidate 
                                 // the ceiling constraint, if collision is nearby
-                                double d_y_c = (fabs(dy)-dy_lim)* (1/(double)connected_vertexes[is].size()) *  p_area[is]/(p_area[is]+p_area[ivc]);
+                                double d_y_c = (fabs(dy)-dy_lim)* (1/num_connected) *  p_area[is]/(p_area[is]+p_area[ivc]);
                                 clamped_d_y_c = d_y_c; //clamped_d_y_c = ChMin(d_y_c, p_hit_level[ivc]-p_level[ivc] );
                                 if (d_y_c > p_hit_level[ivc]-p_level[ivc]) {
                                     p_massremainder[ivc] += d_y_c - (p_hit_level[ivc]-p_level[ivc]);
@@ -1073,7 +1591,7 @@ void SCMDeformableSoil::ComputeInternalForces() {
                             } else {
                                 // if c higher than i: clamp i upward correction as it might invalidate 
                                 // the ceiling constraint, if collision is nearby
-                                double d_y_i = (fabs(dy)-dy_lim)* (1/(double)connected_vertexes[is].size()) *  p_area[is]/(p_area[is]+p_area[ivc]);
+                                double d_y_i = (fabs(dy)-dy_lim)* (1/num_connected) *  p_area[is]/(p_area[is]+p_area[ivc]);
                                 clamped_d_y_i = d_y_i; 
                                 if (d_y_i > p_hit_level[is]-p_level[is]) {
                                     p_massremainder[is] += d_y_i - (p_hit_level[is]-p_level[is]);
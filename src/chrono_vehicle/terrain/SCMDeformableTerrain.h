@@ -20,6 +20,7 @@
 #ifndef SCM_DEFORMABLE_TERRAIN_H
 #define SCM_DEFORMABLE_TERRAIN_H
 
+#include <map>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -181,6 +182,14 @@ class CH_VEHICLE_API SCMDeformableTerrain : public ChTerrain {
                            double dimY                       ///< [in] patch Y dimension
     );
 
+    /// Enable ray casting restricted to the bounding boxes of the bodies (default: disabled).
+    /// If enabled, ray-casting is performed only for the SCM vertices whose rays cross the bounding box
+    /// of a body with collision enabled, and only against the collision models of such bodies. The ray tests
+    /// are then performed in parallel. Only ChBody objects are considered: other contactables (e.g., FEA
+    /// contact surfaces) do not interact with the terrain in this mode.
+    void SetBoundingBoxRayCasting(bool val);
+    bool GetBoundingBoxRayCasting() const;
+
     /// Initialize the terrain system (flat).
     /// This version creates a flat array of points.
     void Initialize(double height,  ///< [in] terrain height
@@ -205,6 +214,29 @@ class CH_VEHICLE_API SCMDeformableTerrain : public ChTerrain {
                     double hMax                         ///< [in] maximum height (white level)
                     );
 
+    /// Initialize the terrain system (sparse, unbounded and flat).
+    /// The terrain is a flat grid of points with given spacing, with no bounds. The grid is split in square
+    /// tiles of tile_size x tile_size points, and a tile is added to the mesh only when the bounding box of a
+    /// (non-fixed) body with collision enabled gets close to it, so that the memory scales with the area
+    /// traversed by the vehicle rather than with the terrain area.
+    /// Automatic mesh refinement is not available with this storage.
+    void InitializeSparse(double height,      ///< [in] terrain height
+                          double delta,       ///< [in] grid spacing
+                          int tile_size = 32  ///< [in] number of grid points per tile side
+                          );
+
+    /// Set the distance beyond which tiles of a sparse terrain are frozen (default: 0, never freeze).
+    /// A tile farther than this distance from the bounding boxes of all bodies is removed from the mesh and
+    /// its soil state, if ever deformed, is stored in compressed form; the tile is restored when a body gets
+    /// close again. Frozen tiles are not visualized.
+    void SetTileFreezeDistance(double dist);
+
+    /// Get the number of tiles currently in the mesh (sparse terrain only).
+    int GetNumActiveTiles() const;
+
+    /// Get the number of frozen tiles, i.e. deformed tiles currently stored in compressed form.
+    int GetNumFrozenTiles() const;
+
     TerrainForce GetContactForce(std::shared_ptr<ChBody> body) const;
 
     /// Print timing and counter information for last step.
@@ -245,7 +277,26 @@ class CH_VEHICLE_API SCMDeformableSoil : public ChLoadContainer {
                     double hMax                         ///< [in] maximum height (white level)
                     );
 
+    /// Initialize the terrain system (sparse, unbounded and flat).
+    /// Tiles of the grid are created on demand, see SCMDeformableTerrain::InitializeSparse.
+    void InitializeSparse(double height,      ///< [in] terrain height
+                          double delta,       ///< [in] grid spacing
+                          int tile_size = 32  ///< [in] number of grid points per tile side
+                          );
+
   private:
+    typedef std::pair<int, int> TileKey;  ///< indices (X,Y) of a tile of the sparse grid
+
+    /// Soil state of a grid point of a frozen tile, relative to the undeformed soil.
+    struct FrozenVertex {
+        float level_initial;
+        float sinkage;
+        float sinkage_plastic;
+        float sigma_yeld;
+        float kshear;
+        float massremainder;
+    };
+
     // Updates the forces and the geometry, at the beginning of each timestep
     virtual void Setup() override {
         // GetLog() << " Setup update soil t= "<< this->ChTime << "\n";
@@ -283,6 +334,21 @@ class CH_VEHICLE_API SCMDeformableSoil : public ChLoadContainer {
     // data structures for the mesh, aux. material data, etc.
     void SetupAuxData();
 
+    // Compute the vertex adjacency (connected_start, connected_index) from the mesh faces.
+    void ComputeConnectivity();
+
+    // Bin the vertices in a 2D grid of the reference plane (used for bounding box ray casting).
+    void ComputeVertexGrid();
+
+    // Sparse terrain: create the tiles close to the bodies and freeze the far ones.
+    void UpdateTiles();
+
+    // Sparse terrain: rebuild the mesh and the vertex data for a new set of tiles.
+    void RebuildTileMesh(const std::set<TileKey>& tiles);
+
+    // Sparse terrain: index of the vertex at grid point (i,j), or -1 if its tile is not in the mesh.
+    int GetTileVertex(int i, int j) const;
+
     std::shared_ptr<ChColorAsset> m_color;
     std::shared_ptr<ChTriangleMeshShape> m_trimesh_shape;
     double m_height;
@@ -321,7 +387,10 @@ class CH_VEHICLE_API SCMDeformableSoil : public ChLoadContainer {
     ChCoordsys<> plane;
 
     // aux. topology data
-    std::vector<std::set<int>> connected_vertexes;
+    // The vertices connected to vertex i are connected_index[k], connected_start[i] <= k < connected_start[i+1],
+    // in increasing order.
+    std::vector<int> connected_start;
+    std::vector<int> connected_index;
     std::vector<std::array<int, 4>> tri_map;
 
     bool do_bulldozing;
@@ -338,6 +407,28 @@ class CH_VEHICLE_API SCMDeformableSoil : public ChLoadContainer {
 
     double last_t;  // for optimization
 
+    bool do_bbox_ray_casting;  ///< ray casting restricted to body bounding boxes?
+
+    // 2D grid of the vertices in the X-Z plane of the reference frame. Vertices only move along the plane
+    // normal, so the grid changes only with the mesh. The vertices in cell c are grid_vertex[k],
+    // grid_cell_start[c] <= k < grid_cell_start[c+1].
+    std::vector<int> grid_cell_start;
+    std::vector<int> grid_vertex;
+    double grid_x0;     ///< X coordinate of the grid origin, in the reference frame
+    double grid_z0;     ///< Z coordinate of the grid origin, in the reference frame
+    double grid_delta;  ///< size of a grid cell
+    int grid_nx;        ///< number of grid cells in X direction
+    int grid_nz;        ///< number of grid cells in Z direction
+
+    // Sparse terrain parameters
+    bool m_sparse;                                                ///< sparse tiled grid?
+    double m_sparse_height;                                       ///< height of the undeformed grid
+    double m_sparse_delta;                                        ///< grid spacing
+    int m_tile_size;                                              ///< number of grid points per tile side
+    double m_freeze_distance;                                     ///< distance for freezing tiles (0: never)
+    std::map<TileKey, int> m_tiles;                               ///< tiles in the mesh, with their first vertex
+    std::map<TileKey, std::vector<FrozenVertex>> m_frozen_tiles;  ///< compressed state of frozen tiles
+
     // Moving patch parameters
     bool m_moving_patch;             ///< moving patch feature enabled?
     std::shared_ptr<ChBody> m_body;  ///< tracked body
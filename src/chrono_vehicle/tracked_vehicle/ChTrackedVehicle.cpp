@@ -19,6 +19,8 @@
 //
 // =============================================================================
 
+#include "chrono/utils/ChTraceProfiler.h"
+
 #include "chrono_vehicle/ChSubsysDefs.h"
 #include "chrono_vehicle/tracked_vehicle/ChTrackedVehicle.h"
 
@@ -72,6 +74,8 @@ void ChTrackedVehicle::Synchronize(double time,
                                    double powertrain_torque,
                                    const TerrainForces& shoe_forces_left,
                                    const TerrainForces& shoe_forces_right) {
+    CH_TRACE("ChTrackedVehicle::Synchronize");
+
     // Apply powertrain torque to the driveline's input shaft.
     m_driveline->Synchronize(steering, powertrain_torque);
 
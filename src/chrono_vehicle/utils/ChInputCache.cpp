@@ -0,0 +1,117 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Opt-in cache of immutable input data read from files.
+//
+// =============================================================================
+
+#include <sys/stat.h>
+
+#include <mutex>
+#include <unordered_map>
+
+#include "chrono_vehicle/utils/ChInputCache.h"
+
+namespace chrono {
+namespace vehicle {
+
+namespace {
+
+struct CacheEntry {
+    long long mtime;
+    std::shared_ptr<const void> data;
+};
+
+std::mutex cache_mutex;
+std::unordered_map<std::string, CacheEntry> cache;
+bool cache_enabled = false;
+int cache_scopes = 0;
+
+}  // end anonymous namespace
+
+void ChInputCache::Enable(bool val) {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    cache_enabled = val;
+    if (!cache_enabled && cache_scopes == 0)
+        cache.clear();
+}
+
+bool ChInputCache::IsEnabled() {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    return cache_enabled || cache_scopes > 0;
+}
+
+void ChInputCache::Clear() {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    cache.clear();
+}
+
+int ChInputCache::GetNumEntries() {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    return (int)cache.size();
+}
+
+void ChInputCache::BeginScope() {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    cache_scopes++;
+}
+
+void ChInputCache::EndScope() {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    cache_scopes--;
+    if (!cache_enabled && cache_scopes == 0)
+        cache.clear();
+}
+
+// Modification time of the file (in nanoseconds where available), or -1 if the file cannot be accessed.
+long long ChInputCache::GetModificationTime(const std::string& filename) {
+    struct stat sb;
+    if (stat(filename.c_str(), &sb) != 0)
+        return -1;
+#if defined(__APPLE__)
+    return (long long)sb.st_mtimespec.tv_sec * 1000000000LL + sb.st_mtimespec.tv_nsec;
+#elif defined(_WIN32)
+    return (long long)sb.st_mtime * 1000000000LL;
+#else
+    return (long long)sb.st_mtim.tv_sec * 1000000000LL + sb.st_mtim.tv_nsec;
+#endif
+}
+
+std::shared_ptr<const void> ChInputCache::Find(const std::string& key, long long mtime) {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    auto itr = cache.find(key);
+    if (itr == cache.end())
+        return nullptr;
+    if (itr->second.mtime != mtime) {
+        cache.erase(itr);
+        return nullptr;
+    }
+    return itr->second.data;
+}
+
+// The file is loaded outside the lock. If another thread loaded the same file in the meantime, the data inserted
+// first is the one returned. Nothing is cached if the cache was disabled during the load.
+std::shared_ptr<const void> ChInputCache::Insert(const std::string& key,
+                                                 long long mtime,
+                                                 std::shared_ptr<const void> data) {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    if (!cache_enabled && cache_scopes == 0)
+        return data;
+    auto itr = cache.find(key);
+    if (itr != cache.end() && itr->second.mtime == mtime)
+        return itr->second.data;
+    cache[key] = CacheEntry{mtime, data};
+    return data;
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
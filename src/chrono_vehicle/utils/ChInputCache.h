@@ -0,0 +1,95 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Opt-in cache of immutable input data read from files (parsed JSON
+// specification files, terrain meshes), shared by the systems of a process.
+//
+// =============================================================================
+
+#ifndef CH_INPUT_CACHE_H
+#define CH_INPUT_CACHE_H
+
+#include <memory>
+#include <string>
+#include <typeinfo>
+
+#include "chrono_vehicle/ChApiVehicle.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_utils
+/// @{
+
+/// Process-wide cache of the data loaded from input files.
+/// Caching is disabled by default, in which case every request loads the file. While enabled (e.g. for the
+/// duration of a ChVehicleEnsemble run, see ChInputCacheScope), each file is loaded once and the cached data is
+/// shared (read-only) by all subsequent requests, from any thread. A cached entry is discarded if the file was
+/// modified since it was loaded.
+class CH_VEHICLE_API ChInputCache {
+  public:
+    /// Enable or disable caching (default: disabled).
+    /// Once caching is neither enabled nor used by an active ChInputCacheScope, all cached data is removed.
+    static void Enable(bool val);
+
+    /// Return true if caching is enabled, explicitly or by an active ChInputCacheScope.
+    static bool IsEnabled();
+
+    /// Remove all cached data.
+    static void Clear();
+
+    /// Return the number of cached entries.
+    static int GetNumEntries();
+
+    /// Return the data of the specified file, as returned by load(filename) (a shared pointer to T).
+    /// The loader is called if caching is disabled, if the file is not in the cache, or if it was modified since
+    /// it was cached. Exceptions thrown by the loader are propagated and nothing is cached.
+    template <typename T, typename LOADER>
+    static std::shared_ptr<const T> Get(const std::string& filename, const LOADER& load) {
+        if (!IsEnabled())
+            return load(filename);
+        std::string key = std::string(typeid(T).name()) + ":" + filename;
+        long long mtime = GetModificationTime(filename);
+        auto cached = Find(key, mtime);
+        if (!cached)
+            cached = Insert(key, mtime, std::shared_ptr<const T>(load(filename)));
+        return std::static_pointer_cast<const T>(cached);
+    }
+
+  private:
+    static void BeginScope();
+    static void EndScope();
+    static long long GetModificationTime(const std::string& filename);
+    static std::shared_ptr<const void> Find(const std::string& key, long long mtime);
+    static std::shared_ptr<const void> Insert(const std::string& key, long long mtime, std::shared_ptr<const void> data);
+
+    friend class ChInputCacheScope;
+};
+
+/// Enable the input cache for the lifetime of this object.
+/// Scopes can be nested or used concurrently from several threads; the cached data is removed once the last
+/// scope ends, unless caching was explicitly enabled.
+class CH_VEHICLE_API ChInputCacheScope {
+  public:
+    ChInputCacheScope() { ChInputCache::BeginScope(); }
+    ~ChInputCacheScope() { ChInputCache::EndScope(); }
+
+    ChInputCacheScope(const ChInputCacheScope&) = delete;
+    ChInputCacheScope& operator=(const ChInputCacheScope&) = delete;
+};
+
+/// @} vehicle_utils
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
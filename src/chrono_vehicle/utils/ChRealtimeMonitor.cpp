@@ -0,0 +1,184 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Timing instrumentation for real-time vehicle simulation.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+
+#include "chrono/core/ChLog.h"
+
+#include "chrono_vehicle/utils/ChRealtimeMonitor.h"
+
+namespace chrono {
+namespace vehicle {
+
+ChRealtimeMonitor::ChRealtimeMonitor(double budget, double hist_max, int num_bins)
+    : m_budget(budget), m_verbose(false), m_max_records(1000) {
+    if (hist_max <= 0)
+        hist_max = 2 * budget;
+    num_bins = std::max(num_bins, 1);
+    m_histogram.resize(num_bins);
+    m_bin_width = hist_max / num_bins;
+    Reset();
+}
+
+void ChRealtimeMonitor::Reset() {
+    for (int i = 0; i < NUM_SECTIONS; i++) {
+        m_timers[i].reset();
+        m_running[i] = false;
+        m_current[i] = 0;
+        m_last[i] = 0;
+        m_total[i] = 0;
+    }
+    m_num_frames = 0;
+    m_num_overruns = 0;
+    m_last_latency = 0;
+    m_max_latency = 0;
+    m_sum_latency = 0;
+    std::fill(m_histogram.begin(), m_histogram.end(), 0);
+    m_overruns.clear();
+}
+
+// -----------------------------------------------------------------------------
+
+void ChRealtimeMonitor::Start(Section section) {
+    m_timers[section].reset();
+    m_timers[section].start();
+    m_running[section] = true;
+}
+
+void ChRealtimeMonitor::Stop(Section section) {
+    if (!m_running[section])
+        return;
+    m_timers[section].stop();
+    m_running[section] = false;
+    m_current[section] += m_timers[section].GetTimeSeconds();
+}
+
+double ChRealtimeMonitor::GetFrameTime() const {
+    double time = 0;
+    for (int i = 0; i < NUM_SECTIONS; i++) {
+        time += m_current[i];
+        if (m_running[i])
+            time += m_timers[i].GetTimeSecondsIntermediate();
+    }
+    return time;
+}
+
+void ChRealtimeMonitor::EndFrame(double time) {
+    double latency = 0;
+    for (int i = 0; i < NUM_SECTIONS; i++) {
+        latency += m_current[i];
+        m_last[i] = m_current[i];
+        m_total[i] += m_current[i];
+        m_current[i] = 0;
+    }
+
+    m_num_frames++;
+    m_last_latency = latency;
+    m_max_latency = std::max(m_max_latency, latency);
+    m_sum_latency += latency;
+
+    int bin = std::min(static_cast<int>(latency / m_bin_width), static_cast<int>(m_histogram.size()) - 1);
+    m_histogram[bin]++;
+
+    if (latency <= m_budget)
+        return;
+
+    m_num_overruns++;
+
+    if (m_overruns.size() < m_max_records) {
+        Overrun overrun;
+        overrun.time = time;
+        overrun.latency = latency;
+        for (int i = 0; i < NUM_SECTIONS; i++)
+            overrun.sections[i] = m_last[i];
+        m_overruns.push_back(overrun);
+    }
+
+    if (m_verbose) {
+        GetLog() << "Real-time overrun at t = " << time << ": " << 1e3 * latency << " ms (budget " << 1e3 * m_budget
+                 << " ms) |";
+        for (int i = 0; i < NUM_SECTIONS; i++)
+            GetLog() << " " << GetSectionName(Section(i)) << " " << 1e3 * m_last[i];
+        GetLog() << "\n";
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+double ChRealtimeMonitor::GetLatencyPercentile(double fraction) const {
+    if (m_num_frames == 0)
+        return 0;
+
+    int target = static_cast<int>(std::ceil(fraction * m_num_frames));
+    int count = 0;
+    for (size_t i = 0; i < m_histogram.size(); i++) {
+        count += m_histogram[i];
+        if (count >= target)
+            return (i + 1 == m_histogram.size()) ? m_max_latency : (i + 1) * m_bin_width;
+    }
+    return m_max_latency;
+}
+
+const char* ChRealtimeMonitor::GetSectionName(Section section) {
+    switch (section) {
+        case CHASSIS:
+            return "chassis";
+        case SUSPENSIONS:
+            return "suspensions";
+        case TIRES:
+            return "tires";
+        case POWERTRAIN:
+            return "powertrain";
+        case TERRAIN:
+            return "terrain";
+        case DYNAMICS:
+            return "dynamics";
+        default:
+            return "unknown";
+    }
+}
+
+void ChRealtimeMonitor::WriteReport(std::ostream& os) const {
+    os << "Real-time budget:  " << 1e3 * m_budget << " ms" << std::endl;
+    os << "Frames:            " << m_num_frames << std::endl;
+    os << "Overruns:          " << m_num_overruns << std::endl;
+    os << "Latency [ms]:      mean " << 1e3 * GetMeanLatency() << "  p99 " << 1e3 * GetLatencyPercentile(0.99)
+       << "  max " << 1e3 * m_max_latency << std::endl;
+
+    os << "Mean section times [ms]:" << std::endl;
+    for (int i = 0; i < NUM_SECTIONS; i++) {
+        double mean = m_num_frames ? m_total[i] / m_num_frames : 0;
+        os << "  " << std::left << std::setw(12) << GetSectionName(Section(i)) << std::right << 1e3 * mean
+           << std::endl;
+    }
+
+    os << "Latency histogram [ms]:" << std::endl;
+    for (size_t i = 0; i < m_histogram.size(); i++) {
+        if (m_histogram[i] == 0)
+            continue;
+        os << "  " << std::setw(8) << 1e3 * i * m_bin_width << " - ";
+        if (i + 1 == m_histogram.size())
+            os << std::setw(8) << "inf";
+        else
+            os << std::setw(8) << 1e3 * (i + 1) * m_bin_width;
+        os << "  " << m_histogram[i] << std::endl;
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
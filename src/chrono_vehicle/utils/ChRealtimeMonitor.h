@@ -0,0 +1,183 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Timing instrumentation for real-time vehicle simulation.
+//
+// A frame is the work done for one call to ChVehicle::Advance, from the end of
+// the previous call: synchronization and advance of the vehicle subsystems,
+// tires, powertrain, and terrain, and the integration of the multibody system.
+// The monitor accumulates the wall-clock time spent in each instrumented
+// section during a frame, records a histogram of the frame latency (the sum of
+// all section times), and keeps a record of the frames that exceeded the
+// real-time budget.
+//
+// =============================================================================
+
+#ifndef CH_REALTIME_MONITOR_H
+#define CH_REALTIME_MONITOR_H
+
+#include <ostream>
+#include <vector>
+
+#include "chrono/core/ChTimer.h"
+
+#include "chrono_vehicle/ChApiVehicle.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_utils
+/// @{
+
+/// Wall-clock timing of the sections of a real-time vehicle simulation frame.
+class CH_VEHICLE_API ChRealtimeMonitor {
+  public:
+    /// Instrumented sections of a simulation frame.
+    enum Section {
+        CHASSIS,      ///< chassis synchronization
+        SUSPENSIONS,  ///< suspension, steering, brake, and driveline synchronization
+        TIRES,        ///< tire synchronization and advance
+        POWERTRAIN,   ///< powertrain synchronization and advance
+        TERRAIN,      ///< terrain synchronization and advance
+        DYNAMICS,     ///< integration of the multibody system
+        NUM_SECTIONS
+    };
+
+    /// Record of a frame which exceeded the budget.
+    struct Overrun {
+        double time;                     ///< simulation time at the end of the frame
+        double latency;                  ///< frame latency [s]
+        double sections[NUM_SECTIONS];   ///< time spent in each section [s]
+    };
+
+    /// Construct a monitor for the specified frame budget [s].
+    /// The latency histogram has the specified number of bins, uniformly covering the
+    /// interval [0, hist_max]; larger latencies are counted in the last bin.
+    /// If hist_max is not positive, twice the budget is used.
+    ChRealtimeMonitor(double budget, double hist_max = 0, int num_bins = 50);
+
+    ~ChRealtimeMonitor() {}
+
+    /// Get the frame budget [s].
+    double GetBudget() const { return m_budget; }
+
+    /// Enable/disable logging of each overrun as it occurs (default: false).
+    void SetVerbose(bool val) { m_verbose = val; }
+
+    /// Set the maximum number of overrun records kept (default: 1000).
+    /// Overruns are still counted once this number is reached.
+    void SetMaxOverrunRecords(size_t val) { m_max_records = val; }
+
+    /// Start timing the specified section.
+    void Start(Section section);
+
+    /// Stop timing the specified section and add the elapsed time to the current frame.
+    void Stop(Section section);
+
+    /// Get the time spent so far in the current frame [s], including a section being timed.
+    double GetFrameTime() const;
+
+    /// End the current frame: record its latency and check it against the budget.
+    void EndFrame(double time);
+
+    /// Reset all statistics.
+    void Reset();
+
+    /// Get the number of completed frames.
+    int GetNumFrames() const { return m_num_frames; }
+
+    /// Get the number of frames which exceeded the budget.
+    int GetNumOverruns() const { return m_num_overruns; }
+
+    /// Get the records of the frames which exceeded the budget.
+    const std::vector<Overrun>& GetOverruns() const { return m_overruns; }
+
+    /// Get the latency of the last completed frame [s].
+    double GetLastLatency() const { return m_last_latency; }
+
+    /// Get the maximum frame latency [s].
+    double GetMaxLatency() const { return m_max_latency; }
+
+    /// Get the mean frame latency [s].
+    double GetMeanLatency() const { return m_num_frames ? m_sum_latency / m_num_frames : 0; }
+
+    /// Get the frame latency below which the specified fraction (in [0,1]) of frames completed [s].
+    /// The value is estimated from the histogram, at the upper edge of a bin.
+    double GetLatencyPercentile(double fraction) const;
+
+    /// Get the latency histogram (number of frames in each bin).
+    const std::vector<int>& GetHistogram() const { return m_histogram; }
+
+    /// Get the width of a histogram bin [s].
+    double GetBinWidth() const { return m_bin_width; }
+
+    /// Get the time spent in the specified section during the last completed frame [s].
+    double GetLastSectionTime(Section section) const { return m_last[section]; }
+
+    /// Get the total time spent in the specified section over all frames [s].
+    double GetTotalSectionTime(Section section) const { return m_total[section]; }
+
+    /// Get the name of the specified section.
+    static const char* GetSectionName(Section section);
+
+    /// Write a summary of the timing statistics, including the latency histogram.
+    void WriteReport(std::ostream& os) const;
+
+  private:
+    double m_budget;
+    bool m_verbose;
+    size_t m_max_records;
+
+    ChTimer<double> m_timers[NUM_SECTIONS];
+    bool m_running[NUM_SECTIONS];
+    double m_current[NUM_SECTIONS];  ///< section times in the current frame
+    double m_last[NUM_SECTIONS];     ///< section times in the last completed frame
+    double m_total[NUM_SECTIONS];    ///< section times over all frames
+
+    int m_num_frames;
+    int m_num_overruns;
+    double m_last_latency;
+    double m_max_latency;
+    double m_sum_latency;
+
+    std::vector<int> m_histogram;
+    double m_bin_width;
+
+    std::vector<Overrun> m_overruns;
+};
+
+/// Utility class for timing a section of a real-time frame over the scope of a block.
+/// A null monitor is allowed, in which case nothing is timed.
+class CH_VEHICLE_API ChRealtimeSection {
+  public:
+    ChRealtimeSection(ChRealtimeMonitor* monitor, ChRealtimeMonitor::Section section)
+        : m_monitor(monitor), m_section(section) {
+        if (m_monitor)
+            m_monitor->Start(m_section);
+    }
+
+    ~ChRealtimeSection() {
+        if (m_monitor)
+            m_monitor->Stop(m_section);
+    }
+
+  private:
+    ChRealtimeMonitor* m_monitor;
+    ChRealtimeMonitor::Section m_section;
+};
+
+/// @} vehicle_utils
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
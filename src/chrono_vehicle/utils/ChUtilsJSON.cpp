@@ -16,6 +16,13 @@
 //
 // =============================================================================
 
+#include <fstream>
+#include <memory>
+#include <sstream>
+
+#include "chrono/core/ChException.h"
+
+#include "chrono_vehicle/utils/ChInputCache.h"
 #include "chrono_vehicle/utils/ChUtilsJSON.h"
 
 using namespace rapidjson;
@@ -23,6 +30,26 @@ using namespace rapidjson;
 namespace chrono {
 namespace vehicle {
 
+// Read and parse the specified file.
+static std::shared_ptr<Document> ParseFileJSON(const std::string& filename) {
+    std::ifstream ifs(filename);
+    if (!ifs.good())
+        throw ChException("Cannot open JSON file " + filename);
+    std::stringstream buffer;
+    buffer << ifs.rdbuf();
+
+    auto doc = std::make_shared<Document>();
+    doc->Parse<kParseCommentsFlag>(buffer.str().c_str());
+    if (doc->HasParseError())
+        throw ChException("Cannot parse JSON file " + filename);
+    return doc;
+}
+
+void ReadFileJSON(const std::string& filename, Document& d) {
+    auto doc = ChInputCache::Get<Document>(filename, ParseFileJSON);
+    d.CopyFrom(*doc, d.GetAllocator());
+}
+
 ChVector<> LoadVectorJSON(const Value& a) {
     assert(a.IsArray());
     assert(a.Size() == 3);
@@ -19,6 +19,8 @@
 #ifndef CH_JSON_UTILS_H
 #define CH_JSON_UTILS_H
 
+#include <string>
+
 #include "chrono/core/ChVector.h"
 #include "chrono/core/ChQuaternion.h"
 #include "chrono/assets/ChColor.h"
@@ -29,6 +31,12 @@
 namespace chrono {
 namespace vehicle {
 
+/// Load and parse the specified JSON file (comments allowed) into the given document.
+/// If the input cache is enabled (see ChInputCache), each file is read and parsed only once and the subsequent
+/// calls return a copy of the cached document.
+/// An exception is thrown if the file cannot be opened or parsed.
+CH_VEHICLE_API void ReadFileJSON(const std::string& filename, rapidjson::Document& d);
+
 /// Load and return a ChVector from the specified JSON array
 CH_VEHICLE_API ChVector<> LoadVectorJSON(const rapidjson::Value& a);
 
@@ -0,0 +1,105 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Batch simulation of many independent vehicle runs in a single process.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+
+#include "chrono/core/ChTimer.h"
+#include "chrono/parallel/ChOpenMP.h"
+#include "chrono/parallel/ChTaskScheduler.h"
+
+#include "chrono_vehicle/utils/ChInputCache.h"
+#include "chrono_vehicle/utils/ChVehicleEnsemble.h"
+
+namespace chrono {
+namespace vehicle {
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------------------
+ChVehicleEnsemble::ChVehicleEnsemble(int num_threads) : m_num_threads(num_threads), m_wall_time(0) {
+    if (m_num_threads <= 0)
+        m_num_threads = ChTaskScheduler::GetInstance().GetNumThreads();
+}
+
+void ChVehicleEnsemble::AddRun(std::shared_ptr<ChVehicleEnsembleRun> run) {
+    m_runs.push_back(run);
+}
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------------------
+void ChVehicleEnsemble::Run() {
+    int num_runs = GetNumRuns();
+    m_info.assign(num_runs, RunInfo());
+
+    if (num_runs == 0)
+        return;
+
+    // Advance one run to completion on the calling thread. Exceptions terminate the run and are reported.
+    auto execute = [this](int run) {
+        // Each run is advanced serially; the parallelism is across runs.
+        int omp_threads = CHOMPfunctions::GetMaxThreads();
+        int concurrency = ChTaskScheduler::GetLocalConcurrency();
+        CHOMPfunctions::SetNumThreads(1);
+        ChTaskScheduler::SetLocalConcurrency(1);
+
+        RunInfo& info = m_info[run];
+        auto& sim = m_runs[run];
+
+        ChTimer<double> timer;
+        timer.reset();
+        timer.start();
+        try {
+            sim->Initialize();
+            while (sim->Advance())
+                info.num_tasks++;
+            info.num_tasks++;
+            sim->Finalize();
+            info.completed = true;
+        } catch (const std::exception& e) {
+            info.error = e.what();
+        } catch (...) {
+            info.error = "unknown exception";
+        }
+        timer.stop();
+        info.wall_time = timer.GetTimeSeconds();
+
+        CHOMPfunctions::SetNumThreads(omp_threads);
+        ChTaskScheduler::SetLocalConcurrency(concurrency);
+    };
+
+    ChTimer<double> timer;
+    timer.reset();
+    timer.start();
+
+    // The immutable input data is read once for all runs.
+    ChInputCacheScope cache;
+
+    // The runs are handed out one at a time to at most m_num_threads tasks of the task scheduler,
+    // so that runs of very different lengths keep all threads busy.
+    ChTaskScheduler::GetInstance().ParallelFor(0, num_runs,
+                                               [&](int first, int last) {
+                                                   for (int run = first; run < last; run++)
+                                                       execute(run);
+                                               },
+                                               1, m_num_threads);
+
+    timer.stop();
+    m_wall_time = timer.GetTimeSeconds();
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
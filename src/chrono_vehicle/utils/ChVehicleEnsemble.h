@@ -0,0 +1,122 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Batch simulation of many independent vehicle runs in a single process.
+//
+// Each run owns its own Chrono system. Runs are executed concurrently by the
+// tasks of the ChTaskScheduler thread pool, which pick the next pending run as
+// soon as they complete one, so runs of very different lengths keep all
+// threads busy.
+//
+// While the ensemble runs, the input cache is enabled: immutable input data
+// (JSON specification files, terrain meshes) is read once and shared by all
+// runs (see ChInputCache).
+//
+// =============================================================================
+
+#ifndef CH_VEHICLE_ENSEMBLE_H
+#define CH_VEHICLE_ENSEMBLE_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "chrono_vehicle/ChApiVehicle.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_utils
+/// @{
+
+/// Base class for a single run of a vehicle ensemble.
+/// A derived class constructs its own system, vehicle, terrain, and driver in
+/// Initialize, advances them in Advance, and collects its outputs in Finalize.
+/// The three functions of a given run are called in sequence from the same thread.
+class CH_VEHICLE_API ChVehicleEnsembleRun {
+  public:
+    ChVehicleEnsembleRun(const std::string& name = "") : m_name(name) {}
+    virtual ~ChVehicleEnsembleRun() {}
+
+    /// Get the name of this run.
+    const std::string& GetName() const { return m_name; }
+
+    /// Construct the system(s) for this run.
+    virtual void Initialize() {}
+
+    /// Advance this run (typically by one or a few steps).
+    /// Return false when the run is complete.
+    virtual bool Advance() = 0;
+
+    /// Collect the outputs of this run (e.g. write results, release the system).
+    virtual void Finalize() {}
+
+  protected:
+    std::string m_name;
+};
+
+/// Runner for an ensemble of independent vehicle simulations.
+class CH_VEHICLE_API ChVehicleEnsemble {
+  public:
+    /// Execution report for one run.
+    struct RunInfo {
+        RunInfo() : completed(false), num_tasks(0), wall_time(0) {}
+        bool completed;     ///< run finished without error
+        std::string error;  ///< message of the exception thrown by the run, if any
+        int num_tasks;      ///< number of calls to Advance
+        double wall_time;   ///< total time spent in this run's callbacks [s]
+    };
+
+    /// Construct an ensemble runner executing at most the specified number of runs concurrently.
+    /// If num_threads is not positive, use the number of threads of the task scheduler. The actual
+    /// concurrency is also limited by the task scheduler threads (see ChTaskScheduler::SetNumThreads).
+    ChVehicleEnsemble(int num_threads = 0);
+
+    ~ChVehicleEnsemble() {}
+
+    /// Add a run to the ensemble.
+    void AddRun(std::shared_ptr<ChVehicleEnsembleRun> run);
+
+    /// Get the number of runs in the ensemble.
+    int GetNumRuns() const { return (int)m_runs.size(); }
+
+    /// Get the specified run.
+    std::shared_ptr<ChVehicleEnsembleRun> GetRun(int i) const { return m_runs[i]; }
+
+    /// Get the execution report of the specified run (valid after Run).
+    const RunInfo& GetRunInfo(int i) const { return m_info[i]; }
+
+    /// Get the maximum number of concurrent runs.
+    int GetNumThreads() const { return m_num_threads; }
+
+    /// Get the wall clock time of the last call to Run [s].
+    double GetWallTime() const { return m_wall_time; }
+
+    /// Execute all runs and return when they are all complete.
+    /// Internal OpenMP and task scheduler parallelism is disabled within the
+    /// runs, as concurrency is obtained across runs. Exceptions thrown by a run
+    /// are reported in its RunInfo and terminate that run only.
+    void Run();
+
+  private:
+    int m_num_threads;
+    std::vector<std::shared_ptr<ChVehicleEnsembleRun>> m_runs;
+    std::vector<RunInfo> m_info;
+    double m_wall_time;
+};
+
+/// @} vehicle_utils
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
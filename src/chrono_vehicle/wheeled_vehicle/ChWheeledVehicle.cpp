@@ -18,6 +18,8 @@
 
 #include <fstream>
 
+#include "chrono/utils/ChTraceProfiler.h"
+
 #include "chrono_vehicle/wheeled_vehicle/ChWheeledVehicle.h"
 
 #include "chrono_thirdparty/rapidjson/document.h"
@@ -58,23 +60,30 @@ void ChWheeledVehicle::Synchronize(double time,
                                    double braking,
                                    double powertrain_torque,
                                    const TerrainForces& tire_forces) {
-    // Apply powertrain torque to the driveline's input shaft.
-    m_driveline->Synchronize(powertrain_torque);
+    CH_TRACE("ChWheeledVehicle::Synchronize");
 
-    // Let the steering subsystems process the steering input.
-    for (unsigned int i = 0; i < m_steerings.size(); i++) {
-        m_steerings[i]->Synchronize(time, steering);
-    }
+    {
+        ChRealtimeSection section(GetRealtimeMonitor(), ChRealtimeMonitor::SUSPENSIONS);
 
-    // Apply tire forces to spindle bodies and apply braking.
-    for (unsigned int i = 0; i < m_suspensions.size(); i++) {
-        m_suspensions[i]->Synchronize(LEFT, tire_forces[2 * i]);
-        m_suspensions[i]->Synchronize(RIGHT, tire_forces[2 * i + 1]);
+        // Apply powertrain torque to the driveline's input shaft.
+        m_driveline->Synchronize(powertrain_torque);
 
-        m_brakes[2 * i]->Synchronize(braking);
-        m_brakes[2 * i + 1]->Synchronize(braking);
+        // Let the steering subsystems process the steering input.
+        for (unsigned int i = 0; i < m_steerings.size(); i++) {
+            m_steerings[i]->Synchronize(time, steering);
+        }
+
+        // Apply tire forces to spindle bodies and apply braking.
+        for (unsigned int i = 0; i < m_suspensions.size(); i++) {
+            m_suspensions[i]->Synchronize(LEFT, tire_forces[2 * i]);
+            m_suspensions[i]->Synchronize(RIGHT, tire_forces[2 * i + 1]);
+
+            m_brakes[2 * i]->Synchronize(braking);
+            m_brakes[2 * i + 1]->Synchronize(braking);
+        }
     }
 
+    ChRealtimeSection section(GetRealtimeMonitor(), ChRealtimeMonitor::CHASSIS);
     m_chassis->Synchronize(time);
 }
 
@@ -35,6 +35,13 @@ namespace vehicle {
 #define TERRAIN_NODE_RANK 1
 #define TIRE_NODE_RANK(i) (i+2)
 
+// Sizes (in doubles) of the data exchanged between tire and terrain nodes at each co-simulation step:
+// tire mesh data (for each vertex in the contact region: index, position, velocity), and contact forces
+// (contact region: flag, min and max corners; then, for each vertex with a force: index, force).
+#define TIRE_VERTEX_DATA 7
+#define TERRAIN_REGION_DATA 7
+#define TERRAIN_FORCE_DATA 4
+
 class CH_VEHICLE_API ChCosimManager {
   public:
     ChCosimManager(int num_tires);
@@ -57,11 +64,24 @@ class CH_VEHICLE_API ChCosimManager {
     virtual ChTerrain* GetTerrain() = 0;
     virtual double GetTerrainStepsize() = 0;
     virtual void OnReceiveTireInfo(int which, unsigned int num_vert, unsigned int num_tri) = 0;
+
+    // Region of the terrain where contact with the tires can occur, as an axis-aligned box (it should
+    // include a margin for the motion of the tires over a co-simulation step). Only the tire mesh
+    // vertices inside this region are exchanged. Queried at initialization and at each co-simulation
+    // step. Return false to exchange all tire mesh vertices.
+    virtual bool GetTerrainContactRegion(ChVector<>& min, ChVector<>& max) { return false; }
+
+    // Receive the part of a tire mesh in the contact region: the vertices inside the region and the
+    // triangles with all vertices inside (indexing into 'vert_pos'). The received data of the different
+    // tires are processed in order of arrival.
     virtual void OnReceiveTireData(int which,
                                    const std::vector<ChVector<>>& vert_pos,
                                    const std::vector<ChVector<>>& vert_vel,
                                    const std::vector<ChVector<int>>& triangles) = 0;
-    virtual void OnSendTireForces(int which, std::vector<ChVector<>>& vert_forces, std::vector<int> vert_indeces) = 0;
+
+    // Produce the contact forces on a tire, at the vertices of the mesh received with OnReceiveTireData
+    // (indexes into 'vert_pos').
+    virtual void OnSendTireForces(int which, std::vector<ChVector<>>& vert_forces, std::vector<int>& vert_indeces) = 0;
     virtual void OnAdvanceTerrain() {}
 
     // Functions invoked only on a TIRE node
@@ -19,6 +19,8 @@
 #ifndef CH_COSIM_NODE_H
 #define CH_COSIM_NODE_H
 
+#include <algorithm>
+
 #include "mpi.h"
 
 #include "chrono_vehicle/ChApiVehicle.h"
@@ -29,7 +31,8 @@ namespace vehicle {
 
 class CH_VEHICLE_API ChCosimNode {
   public:
-    ChCosimNode(int rank, ChSystem* system) : m_rank(rank), m_system(system), m_verbose(false) {}
+    ChCosimNode(int rank, ChSystem* system)
+        : m_rank(rank), m_system(system), m_stepsize(1e-3), m_pending(0), m_verbose(false) {}
 
     virtual void SetStepsize(double stepsize) { m_stepsize = stepsize; }
     double GetStepsize() const { return m_stepsize; }
@@ -37,9 +40,32 @@ class CH_VEHICLE_API ChCosimNode {
     void SetVerbose(bool val) { m_verbose = val; }
 
   protected:
+    /// Advance the node's system over a co-simulation step, with steps of the node's own step size.
+    /// If the node step size is smaller than the co-simulation step, the last step is shortened so that
+    /// the node stays synchronized. Otherwise (multi-rate co-simulation), the node is advanced only once
+    /// the co-simulation steps accumulated reach its step size. Returns the time actually advanced.
+    double AdvanceSystem(double step) {
+        if (m_stepsize <= step) {
+            double t = 0;
+            while (t < step) {
+                double h = std::min<>(m_stepsize, step - t);
+                m_system->DoStepDynamics(h);
+                t += h;
+            }
+            return step;
+        }
+        m_pending += step;
+        if (m_pending < m_stepsize * (1 - 1e-6))
+            return 0;
+        m_system->DoStepDynamics(m_stepsize);
+        m_pending = std::max<>(0.0, m_pending - m_stepsize);
+        return m_stepsize;
+    }
+
     int m_rank;
     ChSystem* m_system;
     double m_stepsize;
+    double m_pending;  ///< co-simulation time not yet simulated (multi-rate)
     bool m_verbose;
 };
 
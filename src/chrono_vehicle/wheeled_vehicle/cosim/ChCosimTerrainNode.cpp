@@ -17,6 +17,7 @@
 // =============================================================================
 
 #include <algorithm>
+#include <cstdio>
 
 #include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimManager.h"
 #include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimTerrainNode.h"
@@ -27,7 +28,22 @@ namespace vehicle {
 ChCosimTerrainNode::ChCosimTerrainNode(int rank, ChSystem* system, ChTerrain* terrain, int num_tires)
     : ChCosimNode(rank, system), m_terrain(terrain), m_num_tires(num_tires) {}
 
+ChCosimTerrainNode::~ChCosimTerrainNode() {
+    // The send buffers must outlive the sends (no requests if the node was never initialized)
+    MPI_Waitall((int)m_send_requests.size(), m_send_requests.data(), MPI_STATUSES_IGNORE);
+}
+
 void ChCosimTerrainNode::Initialize() {
+    m_triangles.resize(m_num_tires);
+    m_local_index.resize(m_num_tires);
+    m_recv_data.resize(m_num_tires);
+    m_send_data.resize(m_num_tires);
+    m_recv_requests.resize(m_num_tires, MPI_REQUEST_NULL);
+    m_send_requests.resize(m_num_tires, MPI_REQUEST_NULL);
+
+    double region[TERRAIN_REGION_DATA];
+    PackRegion(region);
+
     // Receive contact specification from tire nodes
     for (int it = 0; it < m_num_tires; it++) {
         unsigned int props[2];
@@ -39,36 +55,88 @@ void ChCosimTerrainNode::Initialize() {
             printf("Terrain node %d.  Recv from %d props = %d %d\n", m_rank, TIRE_NODE_RANK(it), props[0], props[1]);
         }
 
+        // The mesh connectivity does not change: receive it only once
+        std::vector<int> tri_data(3 * props[1]);
+        MPI_Recv(tri_data.data(), 3 * props[1], MPI_INT, TIRE_NODE_RANK(it), it, MPI_COMM_WORLD, &status);
+        for (unsigned int i = 0; i < props[1]; i++) {
+            m_triangles[it].push_back(ChVector<int>(tri_data[3 * i + 0], tri_data[3 * i + 1], tri_data[3 * i + 2]));
+        }
+
+        m_local_index[it].resize(props[0], -1);
+        m_recv_data[it].resize(TIRE_VERTEX_DATA * props[0]);
+
         m_manager->OnReceiveTireInfo(it, props[0], props[1]);
+
+        // Send the initial contact region to the tire node
+        MPI_Send(region, TERRAIN_REGION_DATA, MPI_DOUBLE, TIRE_NODE_RANK(it), it, MPI_COMM_WORLD);
     }
 }
 
+void ChCosimTerrainNode::PackRegion(double* data) {
+    ChVector<> min;
+    ChVector<> max;
+    bool has_region = m_manager->GetTerrainContactRegion(min, max);
+    data[0] = has_region ? 1 : 0;
+    data[1] = min.x();
+    data[2] = min.y();
+    data[3] = min.z();
+    data[4] = max.x();
+    data[5] = max.y();
+    data[6] = max.z();
+}
+
 void ChCosimTerrainNode::Synchronize(double time) {
+    // Complete the sends of the previous step (their buffers are reused)
+    MPI_Waitall(m_num_tires, m_send_requests.data(), MPI_STATUSES_IGNORE);
+
+    // Post the receives of tire mesh data from all tire nodes
     for (int it = 0; it < m_num_tires; it++) {
-        // Receive tire mesh vertex locations and velocities from the tire node
+        MPI_Irecv(m_recv_data[it].data(), (int)m_recv_data[it].size(), MPI_DOUBLE, TIRE_NODE_RANK(it), it,
+                  MPI_COMM_WORLD, &m_recv_requests[it]);
+    }
+
+    double region[TERRAIN_REGION_DATA];
+    PackRegion(region);
+
+    // Process the tires in order of arrival of their data
+    for (int k = 0; k < m_num_tires; k++) {
+        int it;
         MPI_Status status;
-        unsigned int num_vert = m_num_vertices[it];
-        unsigned int num_tri = m_num_triangles[it];
-        double* vert_data = new double[2 * 3 * num_vert];
-        int* tri_data = new int[3 * num_tri];
-        MPI_Recv(vert_data, 2 * 3 * num_vert, MPI_DOUBLE, TIRE_NODE_RANK(it), it, MPI_COMM_WORLD, &status);
-        MPI_Recv(tri_data, 3 * num_tri, MPI_INT, TIRE_NODE_RANK(it), it, MPI_COMM_WORLD, &status);
-
-        // Unpack received data
-        std::vector<ChVector<>> vert_pos;
-        std::vector<ChVector<>> vert_vel;
+        MPI_Waitany(m_num_tires, m_recv_requests.data(), &it, &status);
+        int count;
+        MPI_Get_count(&status, MPI_DOUBLE, &count);
+        unsigned int num_vert = count / TIRE_VERTEX_DATA;
+
+        // Unpack received data: vertices in the contact region (with their tire mesh indices), and
+        // triangles with all vertices among them.
+        const double* vert_data = m_recv_data[it].data();
+        std::vector<int>& local_index = m_local_index[it];
+        std::vector<int> tire_index(num_vert);
+        std::vector<ChVector<>> vert_pos(num_vert);
+        std::vector<ChVector<>> vert_vel(num_vert);
         std::vector<ChVector<int>> triangles;
         for (unsigned int i = 0; i < num_vert; i++) {
-            vert_pos.push_back(ChVector<>(vert_data[3 * i + 0], vert_data[3 * i + 1], vert_data[3 * i + 2]));
-            vert_vel.push_back(ChVector<>(vert_data[3 * num_vert + 3 * i + 0], vert_data[3 * num_vert + 3 * i + 1],
-                                          vert_data[3 * num_vert + 3 * i + 2]));
+            const double* v = vert_data + TIRE_VERTEX_DATA * i;
+            tire_index[i] = (int)v[0];
+            vert_pos[i] = ChVector<>(v[1], v[2], v[3]);
+            vert_vel[i] = ChVector<>(v[4], v[5], v[6]);
+            local_index[tire_index[i]] = i;
         }
-        for (unsigned int i = 0; i < num_tri; i++) {
-            triangles.push_back(ChVector<int>(tri_data[3 * i + 0], tri_data[3 * i + 1], tri_data[3 * i + 2]));
+        for (auto& tri : m_triangles[it]) {
+            int i0 = local_index[tri.x()];
+            int i1 = local_index[tri.y()];
+            int i2 = local_index[tri.z()];
+            if (i0 >= 0 && i1 >= 0 && i2 >= 0)
+                triangles.push_back(ChVector<int>(i0, i1, i2));
+        }
+        for (unsigned int i = 0; i < num_vert; i++) {
+            local_index[tire_index[i]] = -1;
         }
 
-        delete[] vert_data;
-        delete[] tri_data;
+        if (m_verbose) {
+            printf("Terrain node %d.  Recv from %d: %d vertices, %d triangles\n", m_rank, TIRE_NODE_RANK(it),
+                   num_vert, (int)triangles.size());
+        }
 
         // Let derived class process received data
         m_manager->OnReceiveTireData(it, vert_pos, vert_vel, triangles);
@@ -77,33 +145,30 @@ void ChCosimTerrainNode::Synchronize(double time) {
         std::vector<ChVector<>> vert_forces;
         std::vector<int> vert_indeces;
         m_manager->OnSendTireForces(it, vert_forces, vert_indeces);
-        num_vert = (unsigned int)vert_indeces.size();
-
-        // Send vertex indeces and forces to the tire node
-        //// TODO: use custom derived MPI types?
-        double* force_data = new double[3 * num_vert];
-        for (unsigned int i = 0; i < num_vert; i++) {
-            force_data[3 * i + 0] = vert_forces[i].x;
-            force_data[3 * i + 1] = vert_forces[i].y;
-            force_data[3 * i + 2] = vert_forces[i].z;
+        unsigned int num_forces = (unsigned int)vert_indeces.size();
+
+        // Send the contact region and the forces (with tire mesh vertex indices) to the tire node
+        std::vector<double>& force_data = m_send_data[it];
+        force_data.resize(TERRAIN_REGION_DATA + TERRAIN_FORCE_DATA * num_forces);
+        std::copy(region, region + TERRAIN_REGION_DATA, force_data.begin());
+        for (unsigned int i = 0; i < num_forces; i++) {
+            double* f = force_data.data() + TERRAIN_REGION_DATA + TERRAIN_FORCE_DATA * i;
+            f[0] = tire_index[vert_indeces[i]];
+            f[1] = vert_forces[i].x();
+            f[2] = vert_forces[i].y();
+            f[3] = vert_forces[i].z();
         }
-        MPI_Send(vert_indeces.data(), num_vert, MPI_INT, TIRE_NODE_RANK(it), it, MPI_COMM_WORLD);
-        MPI_Send(force_data, 3 * num_vert, MPI_DOUBLE, TIRE_NODE_RANK(it), it, MPI_COMM_WORLD);
-
-        delete[] force_data;
+        MPI_Isend(force_data.data(), (int)force_data.size(), MPI_DOUBLE, TIRE_NODE_RANK(it), it, MPI_COMM_WORLD,
+                  &m_send_requests[it]);
     }
 
     m_terrain->Synchronize(time);
 }
 
 void ChCosimTerrainNode::Advance(double step) {
-    double t = 0;
-    while (t < step) {
-        double h = std::min<>(m_stepsize, step - t);
-        m_system->DoStepDynamics(h);
-        t += h;
-    }
-    m_terrain->Advance(step);
+    double advanced = AdvanceSystem(step);
+    if (advanced > 0)
+        m_terrain->Advance(advanced);
 }
 
 }  // end namespace vehicle
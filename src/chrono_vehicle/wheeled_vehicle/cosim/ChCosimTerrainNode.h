@@ -36,17 +36,30 @@ class CH_VEHICLE_API ChCosimTerrainNode : public ChCosimNode {
   public:
     ChCosimTerrainNode(int rank, ChSystem* system, ChTerrain* terrain, int num_tires);
 
+    /// Complete the sends of contact forces posted during the last step.
+    /// Must be called before MPI_Finalize (the manager destroys its nodes first).
+    ~ChCosimTerrainNode();
+
     void Initialize();
     void Synchronize(double time);
     void Advance(double step);
 
   private:
+    void PackRegion(double* data);
+
     ChCosimManager* m_manager;                  // back-pointer to the cosimulation manager
     ChTerrain* m_terrain;                       // underlying terrain object
     int m_num_tires;                            // number of tires
     std::vector<unsigned int> m_num_vertices;   // number of contact vertices received from each tire
     std::vector<unsigned int> m_num_triangles;  // number of contact triangles received from each tire
 
+    std::vector<std::vector<ChVector<int>>> m_triangles;  // contact triangles of each tire (received once)
+    std::vector<std::vector<int>> m_local_index;          // index of each tire vertex in the received part (or -1)
+    std::vector<std::vector<double>> m_recv_data;         // buffers for the tire mesh data
+    std::vector<std::vector<double>> m_send_data;         // buffers for the contact forces
+    std::vector<MPI_Request> m_recv_requests;             // pending receives of tire mesh data
+    std::vector<MPI_Request> m_send_requests;             // pending sends of contact forces
+
     friend class ChCosimManager;
 };
 
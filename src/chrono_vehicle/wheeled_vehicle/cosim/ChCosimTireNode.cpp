@@ -28,7 +28,7 @@ namespace chrono {
 namespace vehicle {
 
 ChCosimTireNode::ChCosimTireNode(int rank, ChSystem* system, ChDeformableTire* tire, WheelID id)
-    : ChCosimNode(rank, system), m_tire(tire), m_id(id) {}
+    : ChCosimNode(rank, system), m_tire(tire), m_id(id), m_has_region(false) {}
 
 void ChCosimTireNode::Initialize() {
     // Ghost wheel body (driven kinematically through messages from vehicle node)
@@ -76,9 +76,65 @@ void ChCosimTireNode::Initialize() {
             printf("Tire node %d. Send to %d props = %d %d\n", m_rank, TERRAIN_NODE_RANK, props[0], props[1]);
         }
     }
+
+    // Send the mesh connectivity (it does not change, so only the vertices are sent afterwards)
+    {
+        std::vector<ChVector<>> vert_pos;
+        std::vector<ChVector<>> vert_vel;
+        std::vector<ChVector<int>> triangles;
+        m_contact_load->OutputSimpleMesh(vert_pos, vert_vel, triangles);
+        std::vector<int> tri_data(3 * triangles.size());
+        for (size_t it = 0; it < triangles.size(); it++) {
+            tri_data[3 * it + 0] = triangles[it].x();
+            tri_data[3 * it + 1] = triangles[it].y();
+            tri_data[3 * it + 2] = triangles[it].z();
+        }
+        MPI_Send(tri_data.data(), (int)tri_data.size(), MPI_INT, TERRAIN_NODE_RANK, m_id.id(), MPI_COMM_WORLD);
+    }
+
+    // Receive the initial contact region from the terrain node
+    {
+        double region[TERRAIN_REGION_DATA];
+        MPI_Status status;
+        MPI_Recv(region, TERRAIN_REGION_DATA, MPI_DOUBLE, TERRAIN_NODE_RANK, m_id.id(), MPI_COMM_WORLD, &status);
+        m_has_region = region[0] != 0;
+        m_region_min = ChVector<>(region[1], region[2], region[3]);
+        m_region_max = ChVector<>(region[4], region[5], region[6]);
+    }
 }
 
 void ChCosimTireNode::Synchronize(double time) {
+    // Extract tire mesh vertex locations and velocities
+    std::vector<ChVector<>> vert_pos;
+    std::vector<ChVector<>> vert_vel;
+    std::vector<ChVector<int>> triangles;
+    m_contact_load->OutputSimpleMesh(vert_pos, vert_vel, triangles);
+    unsigned int num_vert = (unsigned int)vert_pos.size();
+
+    // Post the receive of the terrain forces (at most one per vertex)
+    std::vector<double> force_data(TERRAIN_REGION_DATA + TERRAIN_FORCE_DATA * num_vert);
+    MPI_Request recv_request;
+    MPI_Irecv(force_data.data(), (int)force_data.size(), MPI_DOUBLE, TERRAIN_NODE_RANK, m_id.id(), MPI_COMM_WORLD,
+              &recv_request);
+
+    // Send the locations and velocities of the vertices in the contact region (with their indices)
+    // to the terrain node
+    std::vector<double> vert_data;
+    vert_data.reserve(TIRE_VERTEX_DATA * num_vert);
+    for (unsigned int iv = 0; iv < num_vert; iv++) {
+        const ChVector<>& p = vert_pos[iv];
+        if (m_has_region && (p.x() < m_region_min.x() || p.y() < m_region_min.y() || p.z() < m_region_min.z() ||
+                             p.x() > m_region_max.x() || p.y() > m_region_max.y() || p.z() > m_region_max.z()))
+            continue;
+        const ChVector<>& v = vert_vel[iv];
+        double data[TIRE_VERTEX_DATA] = {(double)iv, p.x(), p.y(), p.z(), v.x(), v.y(), v.z()};
+        vert_data.insert(vert_data.end(), data, data + TIRE_VERTEX_DATA);
+    }
+    MPI_Request send_request;
+    MPI_Isend(vert_data.data(), (int)vert_data.size(), MPI_DOUBLE, TERRAIN_NODE_RANK, m_id.id(), MPI_COMM_WORLD,
+              &send_request);
+
+    // While the terrain node processes the mesh data, exchange data with the vehicle node.
     // Send tire force to the vehicle node
     TireForce tire_force = m_tire->GetTireForce(true);
     double bufTF[9];
@@ -104,62 +160,28 @@ void ChCosimTireNode::Synchronize(double time) {
     wheel_state.ang_vel = ChVector<>(bufWS[10], bufWS[11], bufWS[12]);
     wheel_state.omega = bufWS[13];
 
-    // Extract tire mesh vertex locations and velocities
-    std::vector<ChVector<>> vert_pos;
-    std::vector<ChVector<>> vert_vel;
-    std::vector<ChVector<int>> triangles;
-    m_contact_load->OutputSimpleMesh(vert_pos, vert_vel, triangles);
-    unsigned int num_vert = (unsigned int)vert_pos.size();
-    unsigned int num_tri = (unsigned int)triangles.size();
-
-    // Send tire mesh vertex locations and velocities to the terrain node
-    //// TODO: use custom derived MPI types?
-    double* vert_data = new double[2 * 3 * num_vert];
-    int* tri_data = new int[3 * num_tri];
-    for (unsigned int iv = 0; iv < num_vert; iv++) {
-        vert_data[3 * iv + 0] = vert_pos[iv].x;
-        vert_data[3 * iv + 1] = vert_pos[iv].y;
-        vert_data[3 * iv + 2] = vert_pos[iv].z;
-    }
-    for (unsigned int iv = 0; iv < num_vert; iv++) {
-        vert_data[3 * num_vert + 3 * iv + 0] = vert_vel[iv].x;
-        vert_data[3 * num_vert + 3 * iv + 1] = vert_vel[iv].y;
-        vert_data[3 * num_vert + 3 * iv + 2] = vert_vel[iv].z;
-    }
-    for (unsigned int it = 0; it < num_tri; it++) {
-        tri_data[3 * it + 0] = triangles[it].x;
-        tri_data[3 * it + 1] = triangles[it].y;
-        tri_data[3 * it + 2] = triangles[it].z;
-    }
-    MPI_Send(vert_data, 2 * 3 * num_vert, MPI_DOUBLE, TERRAIN_NODE_RANK, m_id.id(), MPI_COMM_WORLD);
-    MPI_Send(tri_data, 3 * num_tri, MPI_INT, TERRAIN_NODE_RANK, m_id.id(), MPI_COMM_WORLD);
-
-    delete[] vert_data;
-    delete[] tri_data;
-
-    // Receive terrain force(s) from the terrain node
-    // Note that we use MPI_Probe to figure out the number of indeces and forces received.
+    // Receive the contact region and the terrain force(s) from the terrain node
     MPI_Status status;
     int count;
-    MPI_Probe(TERRAIN_NODE_RANK, m_id.id(), MPI_COMM_WORLD, &status);
-    MPI_Get_count(&status, MPI_INT, &count);
-    int* index_data = new int[count];
-    double* force_data = new double[3 * count];
-    MPI_Recv(index_data, count, MPI_INT, TERRAIN_NODE_RANK, m_id.id(), MPI_COMM_WORLD, &status);
-    MPI_Recv(force_data, 3 * count, MPI_DOUBLE, TERRAIN_NODE_RANK, m_id.id(), MPI_COMM_WORLD, &status);
+    MPI_Wait(&send_request, MPI_STATUS_IGNORE);
+    MPI_Wait(&recv_request, &status);
+    MPI_Get_count(&status, MPI_DOUBLE, &count);
+    int num_forces = (count - TERRAIN_REGION_DATA) / TERRAIN_FORCE_DATA;
+
+    m_has_region = force_data[0] != 0;
+    m_region_min = ChVector<>(force_data[1], force_data[2], force_data[3]);
+    m_region_max = ChVector<>(force_data[4], force_data[5], force_data[6]);
 
     // Repack data and apply forces to the mesh vertices
     std::vector<ChVector<>> vert_forces;
     std::vector<int> vert_indeces;
-    for (int iv = 0; iv < count; iv++) {
-        vert_forces.push_back(ChVector<>(force_data[3 * iv + 0], force_data[3 * iv + 1], force_data[3 * iv + 2]));
-        vert_indeces.push_back(index_data[iv]);
+    for (int iv = 0; iv < num_forces; iv++) {
+        const double* f = force_data.data() + TERRAIN_REGION_DATA + TERRAIN_FORCE_DATA * iv;
+        vert_forces.push_back(ChVector<>(f[1], f[2], f[3]));
+        vert_indeces.push_back((int)f[0]);
     }
     m_contact_load->InputSimpleForces(vert_forces, vert_indeces);
 
-    delete[] index_data;
-    delete[] force_data;
-
     // Synchronize the ghost wheel and the tire
     m_wheel->SetPos(wheel_state.pos);
     m_wheel->SetRot(wheel_state.rot);
@@ -170,13 +192,9 @@ void ChCosimTireNode::Synchronize(double time) {
 }
 
 void ChCosimTireNode::Advance(double step) {
-    double t = 0;
-    while (t < step) {
-        double h = std::min<>(m_stepsize, step - t);
-        m_system->DoStepDynamics(h);
-        t += h;
-    }
-    m_tire->Advance(step);
+    double advanced = AdvanceSystem(step);
+    if (advanced > 0)
+        m_tire->Advance(advanced);
 }
 
 }  // end namespace vehicle
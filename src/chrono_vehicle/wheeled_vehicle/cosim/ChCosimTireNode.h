@@ -45,6 +45,10 @@ class CH_VEHICLE_API ChCosimTireNode : public ChCosimNode {
     std::shared_ptr<ChTerrain> m_terrain;
 
     std::shared_ptr<fea::ChLoadContactSurfaceMesh> m_contact_load;
+
+    bool m_has_region;        // if false, all mesh vertices are sent to the terrain node
+    ChVector<> m_region_min;  // contact region, as last received from the terrain node
+    ChVector<> m_region_max;
 };
 
 }  // end namespace vehicle
@@ -152,131 +152,144 @@ void ChFialaTire::Synchronize(double time, const WheelState& wheel_state, const
 // -----------------------------------------------------------------------------
 // -----------------------------------------------------------------------------
 void ChFialaTire::Advance(double step) {
-    if (m_data.in_contact) {
+    // Return now if no contact.  Tire force and moment are already set to 0 in Synchronize().
+    if (!m_data.in_contact)
+        return;
 
+    UpdateSlips();
 
-        ////Overwrite with steady-state alpha & kappa for debugging
-        // if (m_states.abs_vx != 0) {
-        //  m_states.kappa_l = -m_states.vsx / m_states.abs_vx;
-        //  m_states.alpha_l = std::atan2(m_states.vsy , m_states.abs_vx);
-        //}
-        // else {
-        //  m_states.kappa_l = 0;
-        //  m_states.alpha_l = 0;
-        //}
-
-        const double vnum = 0.01;
-
-        // smoothing interval for My
-        const double vx_min = 0.125;
-        const double vx_max = 0.5;
-
-        // limits for time lags
-        const double tau_min = 1.0e-4;
-        const double tau_max = 0.25;
-        
-        // lag times for relaxation
-        double tau_k;
-        double tau_a;
-        
-        if (m_states.abs_vx != 0) {
-            m_states.kappa = -m_states.vsx / m_states.abs_vx;
-            m_states.alpha = std::atan2(m_states.vsy , m_states.abs_vx);
-        } else {
-            m_states.kappa = 0;
-            m_states.alpha = 0;
-        }
-        /*
-         * Relaxation time varies with rotational tire speed. Stand still or very low speed generates
-         * unrealistic lags and causes bad  oscillations. Tau == 0 is not allowed in later calculations
-        */
-        tau_k = ChClamp(m_relax_length_x / (m_states.abs_vt + vnum), tau_min, tau_max);
-        tau_a = ChClamp(m_relax_length_y / (m_states.abs_vt + vnum), tau_min, tau_max);
-        
-        // Now calculate the new force and moment values (normal force and moment has already been accounted for in
-        // Synchronize())
-        // See reference for more detail on the calculations
-        double Fx = 0;
-        double Fy = 0;
-        double My = 0;
-        double Mz = 0;
-
-        FialaPatchForces(Fx, Fy, Mz, m_states.kappa, m_states.alpha, m_data.normal_force);
-
-        // Smoothing factor dependend on m_state.abs_vx, allows soft switching of My
-        double myStartUp = ChSineStep(m_states.abs_vx, vx_min, 0.0, vx_max, 1.0);
-        // Rolling Resistance
-        My = -myStartUp * m_rolling_resistance * m_data.normal_force * ChSignum(m_states.omega);
-
-        if(m_dynamic_mode && (m_relax_length_x > 0.0) && (m_relax_length_y > 0.0)) {
-            // Integration of the ODEs
-            double t = 0;
-            while(t < step) {
-                // Ensure we integrate exactly to 'step'
-                double h = std::min<>(m_stepsize, step - t);
-                double gain_k = 1.0 / tau_k;
-                double gain_a = 1.0 / tau_a;
-                m_states.Fx_l += h / (1.0 - h * (-gain_k)) * gain_k * (Fx - m_states.Fx_l);
-                m_states.Fy_l += h / (1.0 - h * (-gain_a)) * gain_a * (Fy - m_states.Fy_l);                
-                t += h;
-            }
-        } else {
-            m_states.Fx_l = Fx;
-            m_states.Fy_l = Fy;
-        }
+    // Now calculate the new force and moment values (normal force and moment has already been accounted for in
+    // Synchronize())
+    // See reference for more detail on the calculations
+    double Fx = 0;
+    double Fy = 0;
+    double Mz = 0;
 
-        // Smooth starting transients
-        double tr_fact = ChSineStep(m_time, 0, 0, m_time_trans, 1.0);
-        m_states.Fx_l *= tr_fact;
-        m_states.Fy_l *= tr_fact;
+    FialaPatchForces(1, &m_states.kappa, &m_states.alpha, &m_data.normal_force, &m_mu, &Fx, &Fy, &Mz);
 
-        // compile the force and moment vectors so that they can be 
-		// transformed into the global coordinate system
-        m_tireforce.force = ChVector<>(m_states.Fx_l, m_states.Fy_l, m_data.normal_force);
-        m_tireforce.moment = ChVector<>(0, My, Mz);
+    ApplyForces(step, Fx, Fy, Mz);
+}
 
-        // Rotate into global coordinates
-        m_tireforce.force = m_data.frame.TransformDirectionLocalToParent(m_tireforce.force);
-        m_tireforce.moment = m_data.frame.TransformDirectionLocalToParent(m_tireforce.moment);
+void ChFialaTire::UpdateSlips() {
+    ////Overwrite with steady-state alpha & kappa for debugging
+    // if (m_states.abs_vx != 0) {
+    //  m_states.kappa_l = -m_states.vsx / m_states.abs_vx;
+    //  m_states.alpha_l = std::atan2(m_states.vsy , m_states.abs_vx);
+    //}
+    // else {
+    //  m_states.kappa_l = 0;
+    //  m_states.alpha_l = 0;
+    //}
+
+    if (m_states.abs_vx != 0) {
+        m_states.kappa = -m_states.vsx / m_states.abs_vx;
+        m_states.alpha = std::atan2(m_states.vsy, m_states.abs_vx);
+    } else {
+        m_states.kappa = 0;
+        m_states.alpha = 0;
+    }
+}
 
-        // Move the tire forces from the contact patch to the wheel center
-        m_tireforce.moment +=
-            Vcross((m_data.frame.pos + m_data.depth*m_data.frame.rot.GetZaxis()) - m_tireforce.point, m_tireforce.force);
-            
+void ChFialaTire::ApplyForces(double step, double Fx, double Fy, double Mz) {
+    const double vnum = 0.01;
+
+    // smoothing interval for My
+    const double vx_min = 0.125;
+    const double vx_max = 0.5;
+
+    // limits for time lags
+    const double tau_min = 1.0e-4;
+    const double tau_max = 0.25;
+
+    /*
+     * Relaxation time varies with rotational tire speed. Stand still or very low speed generates
+     * unrealistic lags and causes bad  oscillations. Tau == 0 is not allowed in later calculations
+    */
+    double tau_k = ChClamp(m_relax_length_x / (m_states.abs_vt + vnum), tau_min, tau_max);
+    double tau_a = ChClamp(m_relax_length_y / (m_states.abs_vt + vnum), tau_min, tau_max);
+
+    // Smoothing factor dependend on m_state.abs_vx, allows soft switching of My
+    double myStartUp = ChSineStep(m_states.abs_vx, vx_min, 0.0, vx_max, 1.0);
+    // Rolling Resistance
+    double My = -myStartUp * m_rolling_resistance * m_data.normal_force * ChSignum(m_states.omega);
+
+    if (m_dynamic_mode && (m_relax_length_x > 0.0) && (m_relax_length_y > 0.0)) {
+        // Integration of the ODEs
+        double t = 0;
+        while (t < step) {
+            // Ensure we integrate exactly to 'step'
+            double h = std::min<>(m_stepsize, step - t);
+            double gain_k = 1.0 / tau_k;
+            double gain_a = 1.0 / tau_a;
+            m_states.Fx_l += h / (1.0 - h * (-gain_k)) * gain_k * (Fx - m_states.Fx_l);
+            m_states.Fy_l += h / (1.0 - h * (-gain_a)) * gain_a * (Fy - m_states.Fy_l);
+            t += h;
+        }
+    } else {
+        m_states.Fx_l = Fx;
+        m_states.Fy_l = Fy;
     }
-    // Else do nothing since the "m_tireForce" force and moment values are already 0 (set in Synchronize())
+
+    // Smooth starting transients
+    double tr_fact = ChSineStep(m_time, 0, 0, m_time_trans, 1.0);
+    m_states.Fx_l *= tr_fact;
+    m_states.Fy_l *= tr_fact;
+
+    // compile the force and moment vectors so that they can be
+    // transformed into the global coordinate system
+    m_tireforce.force = ChVector<>(m_states.Fx_l, m_states.Fy_l, m_data.normal_force);
+    m_tireforce.moment = ChVector<>(0, My, Mz);
+
+    // Rotate into global coordinates
+    m_tireforce.force = m_data.frame.TransformDirectionLocalToParent(m_tireforce.force);
+    m_tireforce.moment = m_data.frame.TransformDirectionLocalToParent(m_tireforce.moment);
+
+    // Move the tire forces from the contact patch to the wheel center
+    m_tireforce.moment +=
+        Vcross((m_data.frame.pos + m_data.depth * m_data.frame.rot.GetZaxis()) - m_tireforce.point, m_tireforce.force);
 }
 
 void ChFialaTire::FialaPatchForces(double &fx, double &fy, double &mz, double kappa, double alpha, double fz) {
-        double SsA            = std::min<>(1.0,std::sqrt(std::pow(kappa, 2) + std::pow(std::tan(alpha), 2)));
-        double U              = m_u_max - (m_u_max - m_u_min) * SsA;
-        double S_critical     = std::abs(U * fz / (2 * m_c_slip));
-        double Alpha_critical = std::atan(3 * U * fz / m_c_alpha);
- 
+    FialaPatchForces(1, &kappa, &alpha, &fz, &m_mu, &fx, &fy, &mz);
+}
+
+void ChFialaTire::FialaPatchForces(int n,
+                                   const double* kappa,
+                                   const double* alpha,
+                                   const double* fz,
+                                   const double* mu,
+                                   double* fx,
+                                   double* fy,
+                                   double* mz) const {
+    for (int i = 0; i < n; i++) {
+        double SsA = std::min<>(1.0, std::sqrt(std::pow(kappa[i], 2) + std::pow(std::tan(alpha[i]), 2)));
+        double U = m_u_max - (m_u_max - m_u_min) * SsA;
+        double S_critical = std::abs(U * fz[i] / (2 * m_c_slip));
+        double Alpha_critical = std::atan(3 * U * fz[i] / m_c_alpha);
+
         // modify U due to local friction
-        U *= m_mu / m_mu_0;
-        
+        U *= mu[i] / m_mu_0;
+
         // Longitudinal Force:
-        if (std::abs(kappa) < S_critical) {
-            fx = m_c_slip * kappa;
+        if (std::abs(kappa[i]) < S_critical) {
+            fx[i] = m_c_slip * kappa[i];
         } else {
-            double Fx1 = U * fz;
-            double Fx2 =
-                std::abs(std::pow((U *fz), 2) / (4 * kappa * m_c_slip));
-            fx = ChSignum(kappa) * (Fx1 - Fx2);
+            double Fx1 = U * fz[i];
+            double Fx2 = std::abs(std::pow((U * fz[i]), 2) / (4 * kappa[i] * m_c_slip));
+            fx[i] = ChSignum(kappa[i]) * (Fx1 - Fx2);
         }
 
-               // Lateral Force & Aligning Moment (Mz):
-        if (std::abs(alpha) <= Alpha_critical) {
-            double H = 1.0 - m_c_alpha * std::abs(std::tan(alpha)) / (3.0 * U * fz);
+        // Lateral Force & Aligning Moment (Mz):
+        if (std::abs(alpha[i]) <= Alpha_critical) {
+            double H = 1.0 - m_c_alpha * std::abs(std::tan(alpha[i])) / (3.0 * U * fz[i]);
 
-            fy = -U * fz * (1.0 - std::pow(H, 3)) * ChSignum(alpha);
-            mz = U * fz * m_width * (1.0 - H) * std::pow(H, 3) * ChSignum(alpha);
+            fy[i] = -U * fz[i] * (1.0 - std::pow(H, 3)) * ChSignum(alpha[i]);
+            mz[i] = U * fz[i] * m_width * (1.0 - H) * std::pow(H, 3) * ChSignum(alpha[i]);
         } else {
-            fy = -U * fz * ChSignum(alpha);
-            mz = 0;
+            fy[i] = -U * fz[i] * ChSignum(alpha[i]);
+            mz[i] = 0;
         }
-
+    }
 }
 
 void ChFialaTire::WritePlots(const std::string& plFileName, const std::string& plTireFormat) {
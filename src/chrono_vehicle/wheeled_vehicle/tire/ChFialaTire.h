@@ -108,6 +108,17 @@ class CH_VEHICLE_API ChFialaTire : public ChTire {
     
     /// Calculate Patch Forces
     void FialaPatchForces(double &fx, double &fy, double &mz, double kappa, double alpha, double fz);
+
+    /// Calculate Patch Forces for n wheels with the parameters of this tire (structure of arrays).
+    /// The friction coefficient of the road is given per wheel.
+    void FialaPatchForces(int n,
+                          const double* kappa,
+                          const double* alpha,
+                          const double* fz,
+                          const double* mu,
+                          double* fx,
+                          double* fy,
+                          double* mz) const;
     
     /// Fiala tire model parameters
     
@@ -154,6 +165,13 @@ class CH_VEHICLE_API ChFialaTire : public ChTire {
         ChVector<> disc_normal;  //(temporary for debug)
     };
 
+    // Advance is split in phases, so that ChTireBatch can evaluate the patch forces
+    // for many wheels at once with exactly the same operations as a single tire.
+    // Update the stationary slip states.
+    void UpdateSlips();
+    // Apply rolling resistance and relaxation and load the tire force (global frame).
+    void ApplyForces(double step, double Fx, double Fy, double Mz);
+
     ContactData m_data;
     TireStates m_states;
 
@@ -161,6 +179,8 @@ class CH_VEHICLE_API ChFialaTire : public ChTire {
 
     std::shared_ptr<ChCylinderShape> m_cyl_shape;  ///< visualization cylinder asset
     std::shared_ptr<ChTexture> m_texture;          ///< visualization texture asset
+
+    friend class ChTireBatch;
 };
 
 /// @} vehicle_wheeled_tire
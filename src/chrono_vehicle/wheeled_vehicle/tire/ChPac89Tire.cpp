@@ -157,6 +157,16 @@ void ChPac89Tire::Advance(double step) {
     if (!m_data.in_contact)
         return;
 
+    double Fz, gamma;
+    UpdateSlips(Fz, gamma);
+
+    double Fx, Fy, Mz;
+    Pac89Forces(1, &Fz, &m_kappa, &m_alpha, &gamma, &Fx, &Fy, &Mz);
+
+    ApplyForces(Fz, Fx, Fy, Mz);
+}
+
+void ChPac89Tire::UpdateSlips(double& Fz, double& gamma) {
     if (m_states.vx != 0) {
         m_states.cp_long_slip = -m_states.vsx / m_states.vx;        
     } else {
@@ -177,12 +187,7 @@ void ChPac89Tire::Advance(double step) {
     // Synchronize()).
     // Express Fz in kN (note that all other forces and moments are in N and Nm).
     // See reference for details on the calculations.
-    double Fx = 0;
-    double Fy = 0;
-    double Fz = m_data.normal_force / 1000;
-    double Mx = 0;
-    double My = 0;
-    double Mz = 0;
+    Fz = m_data.normal_force / 1000;
 
     // Express alpha and gamma in degrees. Express kappa as percentage.
     // Flip sign of alpha to convert to PAC89 modified SAE coordinates.
@@ -191,59 +196,73 @@ void ChPac89Tire::Advance(double step) {
     m_kappa = m_states.cp_long_slip * 100.0;
 
     // Clamp |gamma| to specified value: Limit due to tire testing, avoids erratic extrapolation.
-    double gamma = ChClamp(m_gamma, -m_gamma_limit, m_gamma_limit);
+    gamma = ChClamp(m_gamma, -m_gamma_limit, m_gamma_limit);
+}
 
+void ChPac89Tire::Pac89Forces(int n,
+                              const double* Fz,
+                              const double* kappa,
+                              const double* alpha,
+                              const double* gamma,
+                              double* Fx,
+                              double* Fy,
+                              double* Mz) const {
     // Longitudinal Force
-    {
+    for (int i = 0; i < n; i++) {
         double C = m_PacCoeff.B0;
-        double D = (m_PacCoeff.B1 * std::pow(Fz, 2) + m_PacCoeff.B2 * Fz);
-        double BCD = (m_PacCoeff.B3 * std::pow(Fz, 2) + m_PacCoeff.B4 * Fz) * std::exp(-m_PacCoeff.B5 * Fz);
+        double D = (m_PacCoeff.B1 * std::pow(Fz[i], 2) + m_PacCoeff.B2 * Fz[i]);
+        double BCD = (m_PacCoeff.B3 * std::pow(Fz[i], 2) + m_PacCoeff.B4 * Fz[i]) * std::exp(-m_PacCoeff.B5 * Fz[i]);
         double B = BCD / (C * D);
-        double Sh = m_PacCoeff.B9 * Fz + m_PacCoeff.B10;
+        double Sh = m_PacCoeff.B9 * Fz[i] + m_PacCoeff.B10;
         double Sv = 0.0;
-        double X1 = (m_kappa + Sh);
-        double E = (m_PacCoeff.B6 * std::pow(Fz, 2) + m_PacCoeff.B7 * Fz + m_PacCoeff.B8);
+        double X1 = (kappa[i] + Sh);
+        double E = (m_PacCoeff.B6 * std::pow(Fz[i], 2) + m_PacCoeff.B7 * Fz[i] + m_PacCoeff.B8);
 
-        Fx = (D * std::sin(C * std::atan(B * X1 - E * (B * X1 - std::atan(B * X1))))) + Sv;
+        Fx[i] = (D * std::sin(C * std::atan(B * X1 - E * (B * X1 - std::atan(B * X1))))) + Sv;
     }
 
     // Lateral Force
-    {
+    for (int i = 0; i < n; i++) {
         double C = m_PacCoeff.A0;
-        double D = (m_PacCoeff.A1 * std::pow(Fz, 2) + m_PacCoeff.A2 * Fz);
-        double BCD =
-            m_PacCoeff.A3 * std::sin(std::atan(Fz / m_PacCoeff.A4) * 2.0) * (1.0 - m_PacCoeff.A5 * std::abs(gamma));
+        double D = (m_PacCoeff.A1 * std::pow(Fz[i], 2) + m_PacCoeff.A2 * Fz[i]);
+        double BCD = m_PacCoeff.A3 * std::sin(std::atan(Fz[i] / m_PacCoeff.A4) * 2.0) *
+                     (1.0 - m_PacCoeff.A5 * std::abs(gamma[i]));
         double B = BCD / (C * D);
-        double Sh = m_PacCoeff.A9 * Fz + m_PacCoeff.A10 + m_PacCoeff.A8 * gamma;
-        double Sv = m_PacCoeff.A11 * Fz * gamma + m_PacCoeff.A12 * Fz + m_PacCoeff.A13;
-        double X1 = m_alpha + Sh;
-        double E = m_PacCoeff.A6 * Fz + m_PacCoeff.A7;
+        double Sh = m_PacCoeff.A9 * Fz[i] + m_PacCoeff.A10 + m_PacCoeff.A8 * gamma[i];
+        double Sv = m_PacCoeff.A11 * Fz[i] * gamma[i] + m_PacCoeff.A12 * Fz[i] + m_PacCoeff.A13;
+        double X1 = alpha[i] + Sh;
+        double E = m_PacCoeff.A6 * Fz[i] + m_PacCoeff.A7;
 
         // Ensure that X1 stays within +/-90 deg minus a little bit
         ChClampValue(X1, -89.5, 89.5);
 
-        Fy = (D * std::sin(C * std::atan(B * X1 - E * (B * X1 - std::atan(B * X1))))) + Sv;
+        Fy[i] = (D * std::sin(C * std::atan(B * X1 - E * (B * X1 - std::atan(B * X1))))) + Sv;
     }
 
     // Self-Aligning Torque
-    {
+    for (int i = 0; i < n; i++) {
         double C = m_PacCoeff.C0;
-        double D = (m_PacCoeff.C1 * std::pow(Fz, 2) + m_PacCoeff.C2 * Fz);
-        double BCD = (m_PacCoeff.C3 * std::pow(Fz, 2) + m_PacCoeff.C4 * Fz) * (1 - m_PacCoeff.C6 * std::abs(gamma)) *
-                     std::exp(-m_PacCoeff.C5 * Fz);
+        double D = (m_PacCoeff.C1 * std::pow(Fz[i], 2) + m_PacCoeff.C2 * Fz[i]);
+        double BCD = (m_PacCoeff.C3 * std::pow(Fz[i], 2) + m_PacCoeff.C4 * Fz[i]) *
+                     (1 - m_PacCoeff.C6 * std::abs(gamma[i])) * std::exp(-m_PacCoeff.C5 * Fz[i]);
         double B = BCD / (C * D);
-        double Sh = m_PacCoeff.C11 * gamma + m_PacCoeff.C12 * Fz + m_PacCoeff.C13;
-        double Sv =
-            (m_PacCoeff.C14 * std::pow(Fz, 2) + m_PacCoeff.C15 * Fz) * gamma + m_PacCoeff.C16 * Fz + m_PacCoeff.C17;
-        double X1 = m_alpha + Sh;
-        double E = (m_PacCoeff.C7 * std::pow(Fz, 2) + m_PacCoeff.C8 * Fz + m_PacCoeff.C9) *
-                   (1.0 - m_PacCoeff.C10 * std::abs(gamma));
+        double Sh = m_PacCoeff.C11 * gamma[i] + m_PacCoeff.C12 * Fz[i] + m_PacCoeff.C13;
+        double Sv = (m_PacCoeff.C14 * std::pow(Fz[i], 2) + m_PacCoeff.C15 * Fz[i]) * gamma[i] +
+                    m_PacCoeff.C16 * Fz[i] + m_PacCoeff.C17;
+        double X1 = alpha[i] + Sh;
+        double E = (m_PacCoeff.C7 * std::pow(Fz[i], 2) + m_PacCoeff.C8 * Fz[i] + m_PacCoeff.C9) *
+                   (1.0 - m_PacCoeff.C10 * std::abs(gamma[i]));
 
         // Ensure that X1 stays within +/-90 deg minus a little bit
         ChClampValue(X1, -89.5, 89.5);
 
-        Mz = (D * std::sin(C * std::atan(B * X1 - E * (B * X1 - std::atan(B * X1))))) + Sv;
+        Mz[i] = (D * std::sin(C * std::atan(B * X1 - E * (B * X1 - std::atan(B * X1))))) + Sv;
     }
+}
+
+void ChPac89Tire::ApplyForces(double Fz, double Fx, double Fy, double Mz) {
+    double Mx = 0;
+    double My = 0;
 
     // Overturning Moment
     {
@@ -264,19 +283,6 @@ void ChPac89Tire::Advance(double step) {
         My = myStartUp * m_rolling_resistance * m_data.normal_force * Lrad * ChSignum(m_states.omega);
     }
 
-    // std::cout << "Fx:" << Fx
-    //    << " Fy:" << Fy
-    //    << " Fz:" << Fz
-    //    << " Mx:" << Mx
-    //    << " My:" << My
-    //    << " Mz:" << Mz
-    //    << std::endl
-    //    << " G:" << gamma
-    //    << " A:" << alpha
-    //    << " K:" << kappa
-    //    << " O:" << m_states.omega
-    //    << std::endl;
-
     // Compile the force and moment vectors so that they can be
     // transformed into the global coordinate system.
     // Convert from SAE to ISO Coordinates at the contact patch.
@@ -199,6 +199,22 @@ class CH_VEHICLE_API ChPac89Tire : public ChTire {
         ChVector<> disc_normal;  //(temporary for debug)
     };
 
+    // Advance is split in three phases, so that ChTireBatch can evaluate the Magic Formula
+    // for many wheels at once with exactly the same operations as a single tire.
+    // Update the slip states; return the normal load (kN) and the clamped camber angle (deg).
+    void UpdateSlips(double& Fz, double& gamma);
+    // Evaluate the Magic Formula for n wheels with the coefficients of this tire (structure of arrays).
+    void Pac89Forces(int n,
+                     const double* Fz,
+                     const double* kappa,
+                     const double* alpha,
+                     const double* gamma,
+                     double* Fx,
+                     double* Fy,
+                     double* Mz) const;
+    // Add the overturning and rolling resistance moments and load the tire force (global frame).
+    void ApplyForces(double Fz, double Fx, double Fy, double Mz);
+
     ContactData m_data;
     TireStates m_states;
 
@@ -206,6 +222,8 @@ class CH_VEHICLE_API ChPac89Tire : public ChTire {
 
     std::shared_ptr<ChCylinderShape> m_cyl_shape;  ///< visualization cylinder asset
     std::shared_ptr<ChTexture> m_texture;          ///< visualization texture asset
+
+    friend class ChTireBatch;
 };
 
 /// @} vehicle_wheeled_tire
@@ -214,104 +214,153 @@ void ChTMeasyTire::Advance(double step) {
     if (!m_data.in_contact)
         return;
 
-    double sc;              // combined slip
-    double calpha, salpha;  // cos(alpha) rsp. sin(alpha), alpha = slip angle
-    double muscale;         // factor for considering local friction
+    double Fz, muscale, gamma;
+    GetPatchInputs(Fz, muscale, gamma);
 
+    double Fx, Fy, Mb, fos, levN, hsxn, hsyn;
+    TMeasyForces(1, &Fz, &muscale, &m_states.sx, &m_states.sy, &m_states.omega, &m_states.vta, &m_data.depth, &gamma,
+                 &Fx, &Fy, &Mb, &fos, &levN, &hsxn, &hsyn);
+
+    ApplyForces(step, Fz, gamma, Fx, Fy, Mb, fos, levN, hsxn, hsyn);
+}
+
+void ChTMeasyTire::GetPatchInputs(double& Fz, double& muscale, double& gamma) const {
+    // factor for considering local friction
     muscale = m_mu / m_TMeasyCoeff.mu_0;
 
     // Clamp |gamma| to specified value: Limit due to tire testing, avoids erratic extrapolation.
-    double gamma = ChClamp(GetCamberAngle(), -m_gamma_limit * CH_C_DEG_TO_RAD, m_gamma_limit * CH_C_DEG_TO_RAD);
+    gamma = ChClamp(GetCamberAngle(), -m_gamma_limit * CH_C_DEG_TO_RAD, m_gamma_limit * CH_C_DEG_TO_RAD);
 
     // Limit the effect of Fz on handling forces and torques to avoid nonsensical extrapolation of the curve coefficients
     // m_data.normal_force is nevertheless still taken as the applied vertical tire force
-    double Fz = std::min(m_data.normal_force,m_TMeasyCoeff.pn_max);
-    double Mx = 0;
-    double My = 0;
-    double Mz = 0;
-
-    // Calculate Fz dependend Curve Parameters
-    double dfx0 = InterpQ(Fz, m_TMeasyCoeff.dfx0_pn, m_TMeasyCoeff.dfx0_p2n);
-    double dfy0 = InterpQ(Fz, m_TMeasyCoeff.dfy0_pn, m_TMeasyCoeff.dfy0_p2n);
+    Fz = std::min(m_data.normal_force, m_TMeasyCoeff.pn_max);
+}
 
-    double fxm = muscale * InterpQ(Fz, m_TMeasyCoeff.fxm_pn, m_TMeasyCoeff.fxm_p2n);
-    double fym = muscale * InterpQ(Fz, m_TMeasyCoeff.fym_pn, m_TMeasyCoeff.fym_p2n);
+void ChTMeasyTire::TMeasyForces(int n,
+                                const double* Fz,
+                                const double* muscale,
+                                const double* sx,
+                                const double* sy,
+                                const double* omega,
+                                const double* vta,
+                                const double* depth,
+                                const double* gamma,
+                                double* Fx,
+                                double* Fy,
+                                double* Mb,
+                                double* fos,
+                                double* levN,
+                                double* hsxn,
+                                double* hsyn) const {
+    for (int i = 0; i < n; i++) {
+        double sc;              // combined slip
+        double calpha, salpha;  // cos(alpha) rsp. sin(alpha), alpha = slip angle
+
+        // Calculate Fz dependend Curve Parameters
+        double dfx0 = InterpQ(Fz[i], m_TMeasyCoeff.dfx0_pn, m_TMeasyCoeff.dfx0_p2n);
+        double dfy0 = InterpQ(Fz[i], m_TMeasyCoeff.dfy0_pn, m_TMeasyCoeff.dfy0_p2n);
+
+        double fxm = muscale[i] * InterpQ(Fz[i], m_TMeasyCoeff.fxm_pn, m_TMeasyCoeff.fxm_p2n);
+        double fym = muscale[i] * InterpQ(Fz[i], m_TMeasyCoeff.fym_pn, m_TMeasyCoeff.fym_p2n);
+
+        double sxm = muscale[i] * InterpL(Fz[i], m_TMeasyCoeff.sxm_pn, m_TMeasyCoeff.sxm_p2n);
+        double sym = muscale[i] * InterpL(Fz[i], m_TMeasyCoeff.sym_pn, m_TMeasyCoeff.sym_p2n);
+
+        double fxs = muscale[i] * InterpQ(Fz[i], m_TMeasyCoeff.fxs_pn, m_TMeasyCoeff.fxs_p2n);
+        double fys = muscale[i] * InterpQ(Fz[i], m_TMeasyCoeff.fys_pn, m_TMeasyCoeff.fys_p2n);
+
+        double sxs = muscale[i] * InterpL(Fz[i], m_TMeasyCoeff.sxs_pn, m_TMeasyCoeff.sxs_p2n);
+        double sys = muscale[i] * InterpL(Fz[i], m_TMeasyCoeff.sys_pn, m_TMeasyCoeff.sys_p2n);
+
+        // slip normalizing factors
+        hsxn[i] = sxm / (sxm + sym) + (fxm / dfx0) / (fxm / dfx0 + fym / dfy0);
+        hsyn[i] = sym / (sxm + sym) + (fym / dfy0) / (fxm / dfx0 + fym / dfy0);
+
+        double sxn = sx[i] / hsxn[i];
+        double syn = sy[i] / hsyn[i];
+
+        sc = hypot(sxn, syn);
+
+        if (sc > 0) {
+            calpha = sxn / sc;
+            salpha = syn / sc;
+        } else {
+            calpha = sqrt(2.0) / 2.0;
+            salpha = sqrt(2.0) / 2.0;
+        }
 
-    double sxm = muscale * InterpL(Fz, m_TMeasyCoeff.sxm_pn, m_TMeasyCoeff.sxm_p2n);
-    double sym = muscale * InterpL(Fz, m_TMeasyCoeff.sym_pn, m_TMeasyCoeff.sym_p2n);
+        double nto0 = InterpL(Fz[i], m_TMeasyCoeff.nto0_pn, m_TMeasyCoeff.nto0_p2n);
+        double synto0 = muscale[i] * InterpL(Fz[i], m_TMeasyCoeff.synto0_pn, m_TMeasyCoeff.synto0_p2n);
+        double syntoE = muscale[i] * InterpL(Fz[i], m_TMeasyCoeff.syntoE_pn, m_TMeasyCoeff.syntoE_p2n);
 
-    double fxs = muscale * InterpQ(Fz, m_TMeasyCoeff.fxs_pn, m_TMeasyCoeff.fxs_p2n);
-    double fys = muscale * InterpQ(Fz, m_TMeasyCoeff.fys_pn, m_TMeasyCoeff.fys_p2n);
+        // Calculate resultant Curve Parameters
+        double df0 = hypot(dfx0 * calpha * hsxn[i], dfy0 * salpha * hsyn[i]);
+        double fm = hypot(fxm * calpha, fym * salpha);
+        double sm = hypot(sxm * calpha / hsxn[i], sym * salpha / hsyn[i]);
+        double fs = hypot(fxs * calpha, fys * salpha);
+        double ss = hypot(sxs * calpha / hsxn[i], sys * salpha / hsyn[i]);
+        double f = 0.0;
+        fos[i] = 0.0;
 
-    double sxs = muscale * InterpL(Fz, m_TMeasyCoeff.sxs_pn, m_TMeasyCoeff.sxs_p2n);
-    double sys = muscale * InterpL(Fz, m_TMeasyCoeff.sys_pn, m_TMeasyCoeff.sys_p2n);
+        // consider camber effects
+        // Calculate length of tire contact patch
+        double plen = 2.0 * sqrt(m_unloaded_radius * depth[i]);
 
-    // slip normalizing factors
-    double hsxn = sxm / (sxm + sym) + (fxm / dfx0) / (fxm / dfx0 + fym / dfy0);
-    double hsyn = sym / (sxm + sym) + (fym / dfy0) / (fxm / dfx0 + fym / dfy0);
+        // tire bore radius  (estimated from length l and width b of contact patch)
+        double rb = 2.0 / 3.0 * 0.5 * ((plen / 2.0) + (m_width / 2.0));
 
-    double sxn = m_states.sx / hsxn;
-    double syn = m_states.sy / hsyn;
+        // bore slip due to camber
+        double sb = -rb * omega[i] * sin(gamma[i]) / vta[i];
 
-    sc = hypot(sxn, syn);
+        // generalzed slip
+        double sg = hypot(sc, sb);
 
-    if (sc > 0) {
-        calpha = sxn / sc;
-        salpha = syn / sc;
-    } else {
-        calpha = sqrt(2.0) / 2.0;
-        salpha = sqrt(2.0) / 2.0;
-    }
-
-    double nto0 = InterpL(Fz, m_TMeasyCoeff.nto0_pn, m_TMeasyCoeff.nto0_p2n);
-    double synto0 = muscale * InterpL(Fz, m_TMeasyCoeff.synto0_pn, m_TMeasyCoeff.synto0_p2n);
-    double syntoE = muscale * InterpL(Fz, m_TMeasyCoeff.syntoE_pn, m_TMeasyCoeff.syntoE_p2n);
-
-    // Calculate resultant Curve Parameters
-    double df0 = hypot(dfx0 * calpha * hsxn, dfy0 * salpha * hsyn);
-    double fm = hypot(fxm * calpha, fym * salpha);
-    double sm = hypot(sxm * calpha / hsxn, sym * salpha / hsyn);
-    double fs = hypot(fxs * calpha, fys * salpha);
-    double ss = hypot(sxs * calpha / hsxn, sys * salpha / hsyn);
-    double f = 0.0;
-    double fos = 0.0;
-
-    // consider camber effects
-    // Calculate length of tire contact patch
-    double plen = 2.0 * sqrt(m_unloaded_radius * m_data.depth);
-
-    // tire bore radius  (estimated from length l and width b of contact patch)
-    double rb = 2.0 / 3.0 * 0.5 * ((plen / 2.0) + (m_width / 2.0));
+        tmxy_combined(f, fos[i], sg, df0, sm, fm, ss, fs);
+        if (sg > 0.0) {
+            Fx[i] = f * sx[i] / sg;
+            Fy[i] = f * sy[i] / sg;
+        } else {
+            Fx[i] = 0.0;
+            Fy[i] = 0.0;
+        }
+        // Calculate dimensionless lever arm
+        levN[i] = tmy_tireoff(sy[i], nto0, synto0, syntoE);
 
-    // bore slip due to camber
-    double sb = -rb * m_states.omega * sin(gamma) / m_states.vta;
+        // Bore Torque
+        if (sg > 0.0) {
+            Mb[i] = rb * f * sb / sg;
+        } else {
+            Mb[i] = 0.0;
+        }
 
-    // generalzed slip
-    double sg = hypot(sc, sb);
+        //   camber slip and force
+        double sy_c = -0.5 * plen * omega[i] * sin(gamma[i]) / vta[i];
+        double fy_c = fos[i] / 3.0 * sy_c;
 
-    tmxy_combined(f, fos, sg, df0, sm, fm, ss, fs);
-    if (sg > 0.0) {
-        m_states.Fx = f * m_states.sx / sg;
-        m_states.Fy = f * m_states.sy / sg;
-    } else {
-        m_states.Fx = 0.0;
-        m_states.Fy = 0.0;
+        Fy[i] += fy_c;
     }
-    // Calculate dimensionless lever arm
-    double levN = tmy_tireoff(m_states.sy, nto0, synto0, syntoE);
+}
 
-    // Bore Torque
-    if (sg > 0.0) {
-        m_states.Mb = rb * f * sb / sg;
-    } else {
-        m_states.Mb = 0.0;
-    }
+void ChTMeasyTire::ApplyForces(double step,
+                               double Fz,
+                               double gamma,
+                               double Fx,
+                               double Fy,
+                               double Mb,
+                               double fos,
+                               double levN,
+                               double hsxn,
+                               double hsyn) {
+    m_states.Fx = Fx;
+    m_states.Fy = Fy;
+    m_states.Mb = Mb;
 
-    //   camber slip and force
-    double sy_c = -0.5 * plen * m_states.omega * sin(gamma) / m_states.vta;
-    double fy_c = fos / 3.0 * sy_c;
+    double Mx = 0;
+    double My = 0;
+    double Mz = 0;
 
-    m_states.Fy += fy_c;
+    // Length of tire contact patch
+    double plen = 2.0 * sqrt(m_unloaded_radius * m_data.depth);
 
     // Overturning Torque
     {
@@ -511,7 +560,7 @@ void ChTMeasyTire::tmxy_combined(double& f,
                                  double sm,
                                  double fm,
                                  double ss,
-                                 double fs) {
+                                 double fs) const {
     const double kN2N = 1000.0;
     double df0loc = 0.0;
     if (sm > 0.0) {
@@ -559,7 +608,7 @@ void ChTMeasyTire::tmxy_combined(double& f,
     fos *= kN2N;
 }
 
-double ChTMeasyTire::tmy_tireoff(double sy, double nto0, double synto0, double syntoE) {
+double ChTMeasyTire::tmy_tireoff(double sy, double nto0, double synto0, double syntoE) const {
     double nto = 0.0;
 
     double sy_a = std::abs(sy);  // absolute slip value
@@ -299,9 +299,9 @@ class CH_VEHICLE_API ChTMeasyTire : public ChTire {
     TMeasyCoeff m_TMeasyCoeff;
 
     // linear Interpolation
-    double InterpL(double fz, double w1, double w2) { return w1 + (w2 - w1) * (fz / m_TMeasyCoeff.pn - 1.0); };
+    double InterpL(double fz, double w1, double w2) const { return w1 + (w2 - w1) * (fz / m_TMeasyCoeff.pn - 1.0); };
     // quadratic Interpolation
-    double InterpQ(double fz, double w1, double w2) {
+    double InterpQ(double fz, double w1, double w2) const {
         return (fz / m_TMeasyCoeff.pn) * (2.0 * w1 - 0.5 * w2 - (w1 - 0.5 * w2) * (fz / m_TMeasyCoeff.pn));
     };
 
@@ -311,8 +311,42 @@ class CH_VEHICLE_API ChTMeasyTire : public ChTire {
     std::vector<double> m_tire_test_defl;  // set, when test data are used for vertical
     std::vector<double> m_tire_test_frc;   // stiffness calculation
 
-    void tmxy_combined(double& f, double& fos, double s, double df0, double sm, double fm, double ss, double fs);
-    double tmy_tireoff(double sy, double nto0, double synto0, double syntoE);
+    void tmxy_combined(double& f, double& fos, double s, double df0, double sm, double fm, double ss, double fs) const;
+    double tmy_tireoff(double sy, double nto0, double synto0, double syntoE) const;
+
+    // Advance is split in three phases, so that ChTireBatch can evaluate the steady-state
+    // forces for many wheels at once with exactly the same operations as a single tire.
+    // Return the load limited normal force, the friction scaling, and the clamped camber angle.
+    void GetPatchInputs(double& Fz, double& muscale, double& gamma) const;
+    // Evaluate the steady-state combined forces and bore torque for n wheels with the
+    // parameters of this tire (structure of arrays).
+    void TMeasyForces(int n,
+                      const double* Fz,
+                      const double* muscale,
+                      const double* sx,
+                      const double* sy,
+                      const double* omega,
+                      const double* vta,
+                      const double* depth,
+                      const double* gamma,
+                      double* Fx,
+                      double* Fy,
+                      double* Mb,
+                      double* fos,
+                      double* levN,
+                      double* hsxn,
+                      double* hsyn) const;
+    // Apply moments and relaxation and load the tire force (global frame).
+    void ApplyForces(double step,
+                     double Fz,
+                     double gamma,
+                     double Fx,
+                     double Fy,
+                     double Mb,
+                     double fos,
+                     double levN,
+                     double hsxn,
+                     double hsyn);
 
     struct ContactData {
         bool in_contact;      // true if disc in contact with terrain
@@ -348,6 +382,8 @@ class CH_VEHICLE_API ChTMeasyTire : public ChTire {
 
     std::shared_ptr<ChCylinderShape> m_cyl_shape;  ///< visualization cylinder asset
     std::shared_ptr<ChTexture> m_texture;          ///< visualization texture asset
+
+    friend class ChTireBatch;
 };
 
 /// @} vehicle_wheeled_tire
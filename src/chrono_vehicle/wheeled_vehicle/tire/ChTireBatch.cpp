@@ -0,0 +1,208 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Batched force evaluation for semi-empirical tires (Pac89, Fiala, TMeasy).
+//
+// =============================================================================
+
+#include <cstring>
+
+#include "chrono/utils/ChTraceProfiler.h"
+
+#include "chrono_vehicle/wheeled_vehicle/tire/ChFialaTire.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/ChPac89Tire.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/ChTMeasyTire.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/ChTireBatch.h"
+
+namespace chrono {
+namespace vehicle {
+
+// -----------------------------------------------------------------------------
+// Find the group of tires with the same force model parameters as the given tire,
+// creating a new group if needed. The formulas are evaluated with the parameters
+// of the first tire in each group.
+// -----------------------------------------------------------------------------
+template <typename TIRE, typename EQUAL>
+static void AddToGroup(std::vector<std::vector<TIRE*>>& groups, TIRE* tire, EQUAL same_parameters) {
+    for (auto& group : groups) {
+        if (same_parameters(group[0], tire)) {
+            group.push_back(tire);
+            return;
+        }
+    }
+    groups.push_back(std::vector<TIRE*>(1, tire));
+}
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------------------
+void ChTireBatch::AddTire(ChTire* tire) {
+    Entry entry;
+    entry.tire = tire;
+    if (dynamic_cast<ChPac89Tire*>(tire))
+        entry.model = Model::PAC89;
+    else if (dynamic_cast<ChFialaTire*>(tire))
+        entry.model = Model::FIALA;
+    else if (dynamic_cast<ChTMeasyTire*>(tire))
+        entry.model = Model::TMEASY;
+    else
+        entry.model = Model::OTHER;
+    m_tires.push_back(entry);
+}
+
+void ChTireBatch::ResizeColumns(int num_columns, int n) {
+    m_num_rows = n;
+    if (m_columns.size() < (size_t)(num_columns * n))
+        m_columns.resize(num_columns * n);
+}
+
+// -----------------------------------------------------------------------------
+// Tires not in contact have nothing to advance (their force was reset in
+// Synchronize), exactly as in the individual Advance functions.
+// -----------------------------------------------------------------------------
+void ChTireBatch::Advance(double step) {
+    CH_TRACE("ChTireBatch::Advance");
+
+    std::vector<std::vector<ChPac89Tire*>> pac89_groups;
+    std::vector<std::vector<ChFialaTire*>> fiala_groups;
+    std::vector<std::vector<ChTMeasyTire*>> tmeasy_groups;
+
+    for (auto& entry : m_tires) {
+        switch (entry.model) {
+            case Model::PAC89: {
+                auto tire = static_cast<ChPac89Tire*>(entry.tire);
+                if (tire->m_data.in_contact)
+                    AddToGroup(pac89_groups, tire, [](const ChPac89Tire* a, const ChPac89Tire* b) {
+                        return std::memcmp(&a->m_PacCoeff, &b->m_PacCoeff, sizeof(a->m_PacCoeff)) == 0;
+                    });
+                break;
+            }
+            case Model::FIALA: {
+                auto tire = static_cast<ChFialaTire*>(entry.tire);
+                if (tire->m_data.in_contact)
+                    AddToGroup(fiala_groups, tire, [](const ChFialaTire* a, const ChFialaTire* b) {
+                        return a->m_c_slip == b->m_c_slip && a->m_c_alpha == b->m_c_alpha &&
+                               a->m_u_min == b->m_u_min && a->m_u_max == b->m_u_max && a->m_mu_0 == b->m_mu_0 &&
+                               a->m_width == b->m_width;
+                    });
+                break;
+            }
+            case Model::TMEASY: {
+                auto tire = static_cast<ChTMeasyTire*>(entry.tire);
+                if (tire->m_data.in_contact)
+                    AddToGroup(tmeasy_groups, tire, [](const ChTMeasyTire* a, const ChTMeasyTire* b) {
+                        return a->m_unloaded_radius == b->m_unloaded_radius && a->m_width == b->m_width &&
+                               std::memcmp(&a->m_TMeasyCoeff, &b->m_TMeasyCoeff, sizeof(a->m_TMeasyCoeff)) == 0;
+                    });
+                break;
+            }
+            case Model::OTHER:
+                entry.tire->Advance(step);
+                break;
+        }
+    }
+
+    for (auto& group : pac89_groups)
+        AdvancePac89(group);
+    for (auto& group : fiala_groups)
+        AdvanceFiala(group, step);
+    for (auto& group : tmeasy_groups)
+        AdvanceTMeasy(group, step);
+
+    m_num_groups = (int)(pac89_groups.size() + fiala_groups.size() + tmeasy_groups.size());
+}
+
+// -----------------------------------------------------------------------------
+// -----------------------------------------------------------------------------
+void ChTireBatch::AdvancePac89(const std::vector<ChPac89Tire*>& group) {
+    int n = (int)group.size();
+    ResizeColumns(7, n);
+    double* Fz = Column(0);
+    double* kappa = Column(1);
+    double* alpha = Column(2);
+    double* gamma = Column(3);
+    double* Fx = Column(4);
+    double* Fy = Column(5);
+    double* Mz = Column(6);
+
+    for (int i = 0; i < n; i++) {
+        group[i]->UpdateSlips(Fz[i], gamma[i]);
+        kappa[i] = group[i]->m_kappa;
+        alpha[i] = group[i]->m_alpha;
+    }
+
+    group[0]->Pac89Forces(n, Fz, kappa, alpha, gamma, Fx, Fy, Mz);
+
+    for (int i = 0; i < n; i++)
+        group[i]->ApplyForces(Fz[i], Fx[i], Fy[i], Mz[i]);
+}
+
+void ChTireBatch::AdvanceFiala(const std::vector<ChFialaTire*>& group, double step) {
+    int n = (int)group.size();
+    ResizeColumns(7, n);
+    double* kappa = Column(0);
+    double* alpha = Column(1);
+    double* fz = Column(2);
+    double* mu = Column(3);
+    double* fx = Column(4);
+    double* fy = Column(5);
+    double* mz = Column(6);
+
+    for (int i = 0; i < n; i++) {
+        group[i]->UpdateSlips();
+        kappa[i] = group[i]->m_states.kappa;
+        alpha[i] = group[i]->m_states.alpha;
+        fz[i] = group[i]->m_data.normal_force;
+        mu[i] = group[i]->m_mu;
+    }
+
+    group[0]->FialaPatchForces(n, kappa, alpha, fz, mu, fx, fy, mz);
+
+    for (int i = 0; i < n; i++)
+        group[i]->ApplyForces(step, fx[i], fy[i], mz[i]);
+}
+
+void ChTireBatch::AdvanceTMeasy(const std::vector<ChTMeasyTire*>& group, double step) {
+    int n = (int)group.size();
+    ResizeColumns(15, n);
+    double* Fz = Column(0);
+    double* muscale = Column(1);
+    double* gamma = Column(2);
+    double* sx = Column(3);
+    double* sy = Column(4);
+    double* omega = Column(5);
+    double* vta = Column(6);
+    double* depth = Column(7);
+    double* Fx = Column(8);
+    double* Fy = Column(9);
+    double* Mb = Column(10);
+    double* fos = Column(11);
+    double* levN = Column(12);
+    double* hsxn = Column(13);
+    double* hsyn = Column(14);
+
+    for (int i = 0; i < n; i++) {
+        group[i]->GetPatchInputs(Fz[i], muscale[i], gamma[i]);
+        sx[i] = group[i]->m_states.sx;
+        sy[i] = group[i]->m_states.sy;
+        omega[i] = group[i]->m_states.omega;
+        vta[i] = group[i]->m_states.vta;
+        depth[i] = group[i]->m_data.depth;
+    }
+
+    group[0]->TMeasyForces(n, Fz, muscale, sx, sy, omega, vta, depth, gamma, Fx, Fy, Mb, fos, levN, hsxn, hsyn);
+
+    for (int i = 0; i < n; i++)
+        group[i]->ApplyForces(step, Fz[i], gamma[i], Fx[i], Fy[i], Mb[i], fos[i], levN[i], hsxn[i], hsyn[i]);
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
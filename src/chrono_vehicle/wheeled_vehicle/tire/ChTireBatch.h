@@ -0,0 +1,90 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Batched force evaluation for semi-empirical tires (Pac89, Fiala, TMeasy).
+//
+// The tires in contact are grouped by model and parameter set. For each group,
+// the slip quantities are gathered into contiguous arrays (structure of arrays),
+// the force formulas are evaluated in one pass over all wheels of the group,
+// and the results are scattered back to the individual tires. The per-wheel
+// operations are exactly those of ChTire::Advance, so the results are identical
+// to advancing each tire separately.
+//
+// =============================================================================
+
+#ifndef CH_TIRE_BATCH_H
+#define CH_TIRE_BATCH_H
+
+#include <vector>
+
+#include "chrono_vehicle/ChApiVehicle.h"
+#include "chrono_vehicle/wheeled_vehicle/ChTire.h"
+
+namespace chrono {
+namespace vehicle {
+
+class ChPac89Tire;
+class ChFialaTire;
+class ChTMeasyTire;
+
+/// @addtogroup vehicle_wheeled_tire
+/// @{
+
+/// Batched advance of many tires, possibly from different vehicles.
+/// Usage: call Synchronize on each tire as usual, then a single ChTireBatch::Advance
+/// in place of the individual ChTire::Advance calls. Pac89, Fiala, and TMeasy tires
+/// are evaluated in batches; any other tire type is simply advanced on its own.
+class CH_VEHICLE_API ChTireBatch {
+  public:
+    ChTireBatch() : m_num_rows(0), m_num_groups(0) {}
+    ~ChTireBatch() {}
+
+    /// Add a tire to the batch (the batch does not take ownership).
+    void AddTire(ChTire* tire);
+
+    /// Get the number of tires in the batch.
+    int GetNumTires() const { return (int)m_tires.size(); }
+
+    /// Get the number of groups (model and parameter set) evaluated at the last call to Advance.
+    int GetNumGroups() const { return m_num_groups; }
+
+    /// Advance the state of all tires by the specified time step.
+    void Advance(double step);
+
+  private:
+    enum class Model { PAC89, FIALA, TMEASY, OTHER };
+
+    struct Entry {
+        ChTire* tire;
+        Model model;
+    };
+
+    // Resize the column storage for n wheels and return the start of the specified column.
+    void ResizeColumns(int num_columns, int n);
+    double* Column(int c) { return m_columns.data() + c * m_num_rows; }
+
+    void AdvancePac89(const std::vector<ChPac89Tire*>& group);
+    void AdvanceFiala(const std::vector<ChFialaTire*>& group, double step);
+    void AdvanceTMeasy(const std::vector<ChTMeasyTire*>& group, double step);
+
+    std::vector<Entry> m_tires;
+    std::vector<double> m_columns;  ///< structure of arrays, one column per quantity
+    int m_num_rows;
+    int m_num_groups;
+};
+
+/// @} vehicle_wheeled_tire
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
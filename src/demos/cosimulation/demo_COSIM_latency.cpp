@@ -0,0 +1,98 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Demo on the latency of the data exchange between two co-simulation interfaces
+// on the same host: a server and a client (here, two threads of this program)
+// exchange vectors of values back and forth, first through the TCP connection,
+// then through shared memory.
+//
+// =============================================================================
+
+#include <chrono>
+#include <thread>
+
+#include "chrono/core/ChLog.h"
+#include "chrono/core/ChMatrixDynamic.h"
+
+#include "chrono_cosimulation/ChCosimulation.h"
+#include "chrono_cosimulation/ChExceptionSocket.h"
+
+using namespace chrono;
+using namespace chrono::cosimul;
+
+const int num_values = 32;
+const int num_exchanges = 20000;
+
+// Server side: receive a vector, send it back with the values incremented.
+void RunServer(ChSocketFramework* socket_tools, int port, bool use_shm) {
+    try {
+        ChCosimulation cosimul_interface(*socket_tools, num_values, num_values);
+        cosimul_interface.SetUseSharedMemory(use_shm);
+        cosimul_interface.WaitConnection(port);
+
+        ChMatrixDynamic<double> data(num_values, 1);
+        double time;
+        for (int k = 0; k < num_exchanges; k++) {
+            cosimul_interface.ReceiveData(time, &data);
+            for (int i = 0; i < num_values; i++)
+                data(i) += 1;
+            cosimul_interface.SendData(time, &data);
+        }
+    } catch (ChExceptionSocket exception) {
+        GetLog() << " ERROR with socket system (server): \n" << exception.what() << "\n";
+    }
+}
+
+// Client side: measure the mean time of a round trip.
+void RunClient(ChSocketFramework* socket_tools, int port, bool use_shm) {
+    std::thread server(RunServer, socket_tools, port, use_shm);
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+    try {
+        ChCosimulation cosimul_interface(*socket_tools, num_values, num_values);
+        cosimul_interface.SetUseSharedMemory(use_shm);
+        cosimul_interface.ConnectToServer("localhost", port);
+        GetLog() << (cosimul_interface.IsUsingSharedMemory() ? "Shared memory" : "TCP") << ": ";
+
+        ChMatrixDynamic<double> data(num_values, 1);
+        double time = 0;
+        bool valid = true;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int k = 0; k < num_exchanges; k++) {
+            cosimul_interface.SendData(k * 1e-3, &data);
+            cosimul_interface.ReceiveData(time, &data);
+            valid &= (time == k * 1e-3) && (data(num_values - 1) == k + 1);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+
+        double mean = std::chrono::duration<double, std::micro>(end - start).count() / num_exchanges;
+        GetLog() << num_exchanges << " round trips of " << num_values << " values, mean time " << mean << " us"
+                 << (valid ? "" : "  (INVALID DATA)") << "\n";
+    } catch (ChExceptionSocket exception) {
+        GetLog() << " ERROR with socket system (client): \n" << exception.what() << "\n";
+    }
+
+    server.join();
+}
+
+int main(int argc, char* argv[]) {
+    GetLog() << "Copyright (c) 2017 projectchrono.org\nChrono version: " << CHRONO_VERSION << "\n\n";
+
+    GetLog() << "CHRONO demo about cosimulation latency \n\n";
+
+    ChSocketFramework socket_tools;
+
+    RunClient(&socket_tools, 50010, false);
+    RunClient(&socket_tools, 50011, true);
+
+    return 0;
+}
@@ -54,6 +54,9 @@ std::string crg_road_file = "terrain/crg_roads/Barber.crg";
 // Road visualization (mesh or boundary lines)
 bool useMesh = false;
 
+// Evaluate the road surface from a lookup table compiled at initialization
+bool useLookupTable = false;
+
 // Desired vehicle speed (m/s)
 double target_speed = 12;
 
@@ -97,7 +100,10 @@ int main(int argc, char* argv[]) {
     CRGTerrain terrain(my_hmmwv.GetSystem());
     terrain.UseMeshVisualization(useMesh);
     terrain.SetContactFrictionCoefficient(0.8f);
+    terrain.UseLookupTable(useLookupTable);
     terrain.Initialize(vehicle::GetDataFile(crg_road_file));
+    if (useLookupTable)
+        std::cout << "Lookup table height error: " << terrain.GetLookupTableError() << " m" << std::endl;
 
     // Get the vehicle path (middle of the road)
     auto path = terrain.GetPath();
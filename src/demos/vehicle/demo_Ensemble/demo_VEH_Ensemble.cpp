@@ -0,0 +1,176 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Batch simulation of an ensemble of independent JSON vehicles, each in its own
+// system, advanced concurrently by a ChVehicleEnsemble. The runs differ in the
+// throttle and steering inputs; the final position of each vehicle is reported.
+//
+// The vehicle reference frame has Z up, X towards the front of the vehicle, and
+// Y pointing to the left.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "chrono_vehicle/ChConfigVehicle.h"
+#include "chrono_vehicle/ChVehicleModelData.h"
+
+#include "chrono_vehicle/powertrain/SimplePowertrain.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+#include "chrono_vehicle/utils/ChVehicleEnsemble.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/RigidTire.h"
+#include "chrono_vehicle/wheeled_vehicle/vehicle/WheeledVehicle.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// =============================================================================
+
+// JSON files for vehicle, terrain, powertrain, and tire models
+std::string vehicle_file("hmmwv/vehicle/HMMWV_Vehicle.json");
+std::string rigidterrain_file("terrain/RigidPlane.json");
+std::string simplepowertrain_file("generic/powertrain/SimplePowertrain.json");
+std::string rigidtire_file("hmmwv/tire/HMMWV_RigidTire.json");
+
+// Number of runs in the ensemble
+int num_runs = 16;
+
+// Maximum number of concurrent runs (0: all task scheduler threads)
+int num_threads = 0;
+
+// Simulation step size, steps per call to Advance, and simulation length
+double step_size = 2e-3;
+int steps_per_task = 50;
+double tend = 5.0;
+
+// =============================================================================
+
+// One vehicle simulation with constant driver inputs.
+class VehicleRun : public ChVehicleEnsembleRun {
+  public:
+    VehicleRun(const std::string& name, double throttle, double steering)
+        : ChVehicleEnsembleRun(name), m_throttle(throttle), m_steering(steering) {}
+
+    virtual void Initialize() override {
+        m_vehicle = std::make_shared<WheeledVehicle>(vehicle::GetDataFile(vehicle_file), ChMaterialSurface::NSC);
+        m_vehicle->Initialize(ChCoordsys<>(ChVector<>(0, 0, 1.6), QUNIT));
+        m_vehicle->SetStepsize(step_size);
+
+        m_terrain = std::make_shared<RigidTerrain>(m_vehicle->GetSystem(), vehicle::GetDataFile(rigidterrain_file));
+
+        m_powertrain = std::make_shared<SimplePowertrain>(vehicle::GetDataFile(simplepowertrain_file));
+        m_powertrain->Initialize(m_vehicle->GetChassisBody(), m_vehicle->GetDriveshaft());
+
+        int num_wheels = 2 * m_vehicle->GetNumberAxles();
+        for (int i = 0; i < num_wheels; i++) {
+            auto tire = std::make_shared<RigidTire>(vehicle::GetDataFile(rigidtire_file));
+            tire->Initialize(m_vehicle->GetWheelBody(i), VehicleSide(i % 2));
+            m_tires.push_back(tire);
+        }
+    }
+
+    virtual bool Advance() override {
+        int num_wheels = (int)m_tires.size();
+        TerrainForces tire_forces(num_wheels);
+        WheelStates wheel_states(num_wheels);
+
+        for (int k = 0; k < steps_per_task; k++) {
+            double time = m_vehicle->GetSystem()->GetChTime();
+            if (time >= tend)
+                return false;
+
+            // Ramp the inputs during the first second
+            double ramp = std::min(time, 1.0);
+            double powertrain_torque = m_powertrain->GetOutputTorque();
+            double driveshaft_speed = m_vehicle->GetDriveshaftSpeed();
+            for (int i = 0; i < num_wheels; i++) {
+                tire_forces[i] = m_tires[i]->GetTireForce();
+                wheel_states[i] = m_vehicle->GetWheelState(i);
+            }
+
+            m_powertrain->Synchronize(time, ramp * m_throttle, driveshaft_speed);
+            m_vehicle->Synchronize(time, ramp * m_steering, 0, powertrain_torque, tire_forces);
+            m_terrain->Synchronize(time);
+            for (int i = 0; i < num_wheels; i++)
+                m_tires[i]->Synchronize(time, wheel_states[i], *m_terrain);
+
+            m_powertrain->Advance(step_size);
+            m_vehicle->Advance(step_size);
+            m_terrain->Advance(step_size);
+            for (int i = 0; i < num_wheels; i++)
+                m_tires[i]->Advance(step_size);
+        }
+
+        return true;
+    }
+
+    virtual void Finalize() override {
+        m_final_pos = m_vehicle->GetVehiclePos();
+        m_final_speed = m_vehicle->GetVehicleSpeed();
+
+        // Release the system; only the outputs are kept.
+        m_tires.clear();
+        m_powertrain.reset();
+        m_terrain.reset();
+        m_vehicle.reset();
+    }
+
+    double m_throttle;
+    double m_steering;
+    ChVector<> m_final_pos;
+    double m_final_speed;
+
+  private:
+    std::shared_ptr<WheeledVehicle> m_vehicle;
+    std::shared_ptr<RigidTerrain> m_terrain;
+    std::shared_ptr<SimplePowertrain> m_powertrain;
+    std::vector<std::shared_ptr<RigidTire>> m_tires;
+};
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    GetLog() << "Copyright (c) 2017 projectchrono.org\nChrono version: " << CHRONO_VERSION << "\n\n";
+
+    ChVehicleEnsemble ensemble(num_threads);
+
+    std::vector<std::shared_ptr<VehicleRun>> runs;
+    for (int i = 0; i < num_runs; i++) {
+        double throttle = 0.2 + 0.6 * (i % 4) / 3.0;
+        double steering = -0.3 + 0.6 * (i / 4) / 3.0;
+        auto run = std::make_shared<VehicleRun>("run_" + std::to_string(i), throttle, steering);
+        runs.push_back(run);
+        ensemble.AddRun(run);
+    }
+
+    ensemble.Run();
+
+    for (int i = 0; i < num_runs; i++) {
+        const auto& info = ensemble.GetRunInfo(i);
+        if (!info.completed) {
+            std::printf("%-8s  FAILED: %s\n", runs[i]->GetName().c_str(), info.error.c_str());
+            continue;
+        }
+        const auto& pos = runs[i]->m_final_pos;
+        std::printf("%-8s  throttle %4.2f  steering %5.2f  |  pos (%7.2f, %7.2f)  speed %5.2f  |  %5.2f s\n",
+                    runs[i]->GetName().c_str(), runs[i]->m_throttle, runs[i]->m_steering, pos.x(), pos.y(),
+                    runs[i]->m_final_speed, info.wall_time);
+    }
+
+    std::printf("\n%d runs on %d threads: %.2f s wall clock\n", num_runs, ensemble.GetNumThreads(),
+                ensemble.GetWallTime());
+
+    return 0;
+}
@@ -0,0 +1,239 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmarks for frictional contact: piles of spheres and boxes in a container
+// (NSC and SMC, core and, if available, Chrono::Parallel systems) and Bullet
+// narrow phase with triangle meshes.
+//
+// =============================================================================
+
+#include <random>
+
+#include "chrono/ChConfig.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/utils/ChBenchmark.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#ifdef CHRONO_PARALLEL
+#include "chrono_parallel/physics/ChSystemParallel.h"
+#endif
+
+using namespace chrono;
+
+// -----------------------------------------------------------------------------
+// System-specific settings
+// -----------------------------------------------------------------------------
+
+std::shared_ptr<ChMaterialSurface> CreateMaterial(ChSystem* system) {
+    if (system->GetContactMethod() == ChMaterialSurface::SMC) {
+        auto mat = std::make_shared<ChMaterialSurfaceSMC>();
+        mat->SetYoungModulus(1e7f);
+        mat->SetFriction(0.4f);
+        mat->SetRestitution(0.1f);
+        return mat;
+    }
+    auto mat = std::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.4f);
+    return mat;
+}
+
+double GetStepSize(ChSystem* system) {
+    return system->GetContactMethod() == ChMaterialSurface::SMC ? 1e-4 : 1e-3;
+}
+
+void SetSolver(ChSystemNSC& system) {
+    system.SetSolverType(ChSolver::Type::SOR);
+    system.SetMaxItersSolverSpeed(50);
+    system.SetMaxPenetrationRecoverySpeed(1.0);
+}
+
+void SetSolver(ChSystemSMC& system) {}
+
+#ifdef CHRONO_PARALLEL
+void SetSolver(ChSystemParallelNSC& system) {
+    system.GetSettings()->solver.solver_mode = SolverMode::SLIDING;
+    system.GetSettings()->solver.max_iteration_normal = 0;
+    system.GetSettings()->solver.max_iteration_sliding = 50;
+    system.GetSettings()->solver.max_iteration_spinning = 0;
+    system.GetSettings()->solver.contact_recovery_speed = 1.0;
+    system.GetSettings()->collision.bins_per_axis = vec3(10, 10, 10);
+    system.ChangeSolverType(SolverType::APGD);
+}
+
+void SetSolver(ChSystemParallelSMC& system) {
+    system.GetSettings()->solver.contact_force_model = ChSystemSMC::Hertz;
+    system.GetSettings()->collision.bins_per_axis = vec3(10, 10, 10);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+// Pile of NUM_BODIES spheres and boxes dropped in a container.
+// The bodies start in a regular arrangement (with reproducible random offsets)
+// just above the container floor and moving down, so that contacts develop
+// within a few steps (also with the smaller SMC step size).
+// -----------------------------------------------------------------------------
+
+template <typename SYSTEM, int NUM_BODIES>
+class PileTest : public utils::ChBenchmarkTest {
+  public:
+    PileTest();
+
+    virtual void ExecuteStep() override {
+        m_system.DoStepDynamics(m_step);
+        m_counters["contacts"] = m_system.GetNcontacts();
+    }
+    virtual ChSystem* GetSystem() override { return &m_system; }
+
+  private:
+    SYSTEM m_system;
+    double m_step;
+};
+
+template <typename SYSTEM, int NUM_BODIES>
+PileTest<SYSTEM, NUM_BODIES>::PileTest() {
+    m_system.Set_G_acc(ChVector<>(0, 0, -9.81));
+    SetSolver(m_system);
+    m_step = GetStepSize(&m_system);
+
+    auto mat = CreateMaterial(&m_system);
+
+    const double radius = 0.1;
+    const double spacing = 2.2 * radius;
+    const int num_xy = 10;
+    const double hdim = 0.5 * num_xy * spacing;
+
+    utils::CreateBoxContainer(&m_system, -1, mat, ChVector<>(hdim, hdim, 2 * hdim), 0.1);
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> offset(-0.05 * radius, 0.05 * radius);
+
+    for (int i = 0; i < NUM_BODIES; i++) {
+        int ix = i % num_xy;
+        int iy = (i / num_xy) % num_xy;
+        int iz = i / (num_xy * num_xy);
+        ChVector<> pos(-hdim + (ix + 0.5) * spacing + offset(generator),
+                       -hdim + (iy + 0.5) * spacing + offset(generator), iz * spacing + 1.1 * radius);
+
+        auto body = std::shared_ptr<ChBody>(m_system.NewBody());
+        body->SetIdentifier(i);
+        body->SetMaterialSurface(mat);
+        body->SetPos(pos);
+        body->SetPos_dt(ChVector<>(0, 0, -1));
+        body->SetCollide(true);
+
+        body->GetCollisionModel()->ClearModel();
+        if (i % 2 == 0) {
+            double mass = 1000 * (4.0 / 3.0) * CH_C_PI * radius * radius * radius;
+            body->SetMass(mass);
+            body->SetInertiaXX(0.4 * mass * radius * radius * ChVector<>(1, 1, 1));
+            utils::AddSphereGeometry(body.get(), radius);
+        } else {
+            double hlen = 0.8 * radius;
+            double mass = 1000 * 8 * hlen * hlen * hlen;
+            body->SetMass(mass);
+            body->SetInertiaXX((2.0 / 3.0) * mass * hlen * hlen * ChVector<>(1, 1, 1));
+            utils::AddBoxGeometry(body.get(), ChVector<>(hlen, hlen, hlen));
+        }
+        body->GetCollisionModel()->BuildModel();
+
+        m_system.AddBody(body);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// NUM_BODIES bodies with triangle mesh collision shapes falling on a box, to
+// exercise the Bullet narrow phase with concave (GImpact) meshes.
+// -----------------------------------------------------------------------------
+
+template <int NUM_BODIES>
+class MeshTest : public utils::ChBenchmarkTest {
+  public:
+    MeshTest();
+
+    virtual void ExecuteStep() override {
+        m_system.DoStepDynamics(1e-3);
+        m_counters["contacts"] = m_system.GetNcontacts();
+    }
+    virtual ChSystem* GetSystem() override { return &m_system; }
+
+  private:
+    ChSystemNSC m_system;
+};
+
+template <int NUM_BODIES>
+MeshTest<NUM_BODIES>::MeshTest() {
+    m_system.Set_G_acc(ChVector<>(0, 0, -9.81));
+    SetSolver(m_system);
+
+    auto mat = std::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.4f);
+
+    auto ground = std::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->SetMaterialSurface(mat);
+    ground->GetCollisionModel()->ClearModel();
+    utils::AddBoxGeometry(ground.get(), ChVector<>(10, 10, 0.5), ChVector<>(0, 0, -0.5));
+    ground->GetCollisionModel()->BuildModel();
+    m_system.AddBody(ground);
+
+    // The cylinder mesh has unit radius and height 2 along its Y axis.
+    std::string mesh_file = GetChronoDataFile("cylinder.obj");
+    ChQuaternion<> rot = Q_from_AngX(CH_C_PI_2);
+    const int num_xy = 4;
+    for (int i = 0; i < NUM_BODIES; i++) {
+        int ix = i % num_xy;
+        int iy = (i / num_xy) % num_xy;
+        int iz = i / (num_xy * num_xy);
+
+        auto body = std::make_shared<ChBody>();
+        body->SetMaterialSurface(mat);
+        body->SetPos(ChVector<>(2.5 * (ix - 1.5), 2.5 * (iy - 1.5), 1.05 + 2.1 * iz));
+        body->SetRot(Q_from_AngZ(0.3 * i));
+        body->SetMass(100);
+        body->SetInertiaXX(ChVector<>(35, 35, 50));
+        body->SetCollide(true);
+        body->GetCollisionModel()->ClearModel();
+        utils::AddTriangleMeshGeometry(body.get(), mesh_file, "cylinder", ChVector<>(0, 0, 0), rot, false);
+        body->GetCollisionModel()->BuildModel();
+        m_system.AddBody(body);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+typedef PileTest<ChSystemNSC, 200> PileNSC200;
+typedef PileTest<ChSystemNSC, 1000> PileNSC1000;
+typedef PileTest<ChSystemSMC, 200> PileSMC200;
+typedef PileTest<ChSystemSMC, 1000> PileSMC1000;
+typedef MeshTest<16> Mesh16;
+
+CH_BM_SIMULATION(ContactPile_NSC_200, PileNSC200, 200, 3);
+CH_BM_SIMULATION(ContactPile_NSC_1000, PileNSC1000, 100, 3);
+CH_BM_SIMULATION(ContactPile_SMC_200, PileSMC200, 500, 3);
+CH_BM_SIMULATION(ContactPile_SMC_1000, PileSMC1000, 200, 3);
+CH_BM_SIMULATION(MeshNarrowPhase_16, Mesh16, 300, 3);
+
+#ifdef CHRONO_PARALLEL
+typedef PileTest<ChSystemParallelNSC, 200> PileParallelNSC200;
+typedef PileTest<ChSystemParallelNSC, 1000> PileParallelNSC1000;
+typedef PileTest<ChSystemParallelSMC, 200> PileParallelSMC200;
+typedef PileTest<ChSystemParallelSMC, 1000> PileParallelSMC1000;
+
+CH_BM_SIMULATION(ContactPile_ParallelNSC_200, PileParallelNSC200, 200, 3);
+CH_BM_SIMULATION(ContactPile_ParallelNSC_1000, PileParallelNSC1000, 100, 3);
+CH_BM_SIMULATION(ContactPile_ParallelSMC_200, PileParallelSMC200, 500, 3);
+CH_BM_SIMULATION(ContactPile_ParallelSMC_1000, PileParallelSMC1000, 200, 3);
+#endif
+
+CH_BM_MAIN()
@@ -0,0 +1,364 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmarks for FEA: evaluation of the internal forces and of the stiffness,
+// damping, and mass (KRM) matrices for each of several element types, dynamics
+// of an ANCF shell plate with the HHT integrator, and steps of a mixed FEA and
+// rigid contact scene with and without pipelining.
+//
+// =============================================================================
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLoadContainer.h"
+#include "chrono/physics/ChLoaderUVW.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverMINRES.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono/utils/ChBenchmark.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "chrono_fea/ChBuilderBeam.h"
+#include "chrono_fea/ChElementHexa_8.h"
+#include "chrono_fea/ChElementShellANCF.h"
+#include "chrono_fea/ChElementShellReissner4.h"
+#include "chrono_fea/ChElementTetra_4.h"
+#include "chrono_fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// -----------------------------------------------------------------------------
+// Mesh construction, one function per element type
+// -----------------------------------------------------------------------------
+
+// Cantilever ANCF cable with the specified number of elements.
+void BuildCableANCF(std::shared_ptr<ChMesh> mesh, int n) {
+    auto section = std::make_shared<ChBeamSectionCable>();
+    section->SetDiameter(0.015);
+    section->SetYoungModulus(0.01e9);
+    section->SetBeamRaleyghDamping(0.000);
+    ChBuilderBeamANCF builder;
+    builder.BuildBeam(mesh, section, n, ChVector<>(0, 0, 0), ChVector<>(1, 0, 0));
+}
+
+// Cantilever Euler-Bernoulli beam with the specified number of elements.
+void BuildBeamEuler(std::shared_ptr<ChMesh> mesh, int n) {
+    auto section = std::make_shared<ChBeamSectionAdvanced>();
+    section->SetAsRectangularSection(0.012, 0.025);
+    section->SetYoungModulus(0.02e10);
+    section->SetGshearModulus(0.02e10 * 0.3);
+    section->SetBeamRaleyghDamping(0.000);
+    ChBuilderBeam builder;
+    builder.BuildBeam(mesh, section, n, ChVector<>(0, 0, 0), ChVector<>(1, 0, 0), ChVector<>(0, 1, 0));
+}
+
+// Square ANCF shell plate with n x n elements.
+void BuildShellANCF(std::shared_ptr<ChMesh> mesh, int n) {
+    double dx = 1.0 / n;
+    for (int j = 0; j <= n; j++) {
+        for (int i = 0; i <= n; i++) {
+            auto node = std::make_shared<ChNodeFEAxyzD>(ChVector<>(i * dx, j * dx, 0), ChVector<>(0, 0, 1));
+            node->SetMass(0);
+            node->SetFixed(i == 0);
+            mesh->AddNode(node);
+        }
+    }
+
+    auto mat = std::make_shared<ChMaterialShellANCF>(500, 2.1e7, 0.3);
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < n; i++) {
+            int node0 = j * (n + 1) + i;
+            auto element = std::make_shared<ChElementShellANCF>();
+            element->SetNodes(std::dynamic_pointer_cast<ChNodeFEAxyzD>(mesh->GetNode(node0)),
+                              std::dynamic_pointer_cast<ChNodeFEAxyzD>(mesh->GetNode(node0 + 1)),
+                              std::dynamic_pointer_cast<ChNodeFEAxyzD>(mesh->GetNode(node0 + n + 2)),
+                              std::dynamic_pointer_cast<ChNodeFEAxyzD>(mesh->GetNode(node0 + n + 1)));
+            element->SetDimensions(dx, dx);
+            element->AddLayer(0.01, 0, mat);
+            element->SetAlphaDamp(0.08);
+            element->SetGravityOn(false);
+            mesh->AddElement(element);
+        }
+    }
+}
+
+// Square Reissner shell plate with n x n elements.
+void BuildShellReissner(std::shared_ptr<ChMesh> mesh, int n) {
+    double dx = 1.0 / n;
+    for (int j = 0; j <= n; j++) {
+        for (int i = 0; i <= n; i++) {
+            auto node = std::make_shared<ChNodeFEAxyzrot>(ChFrame<>(ChVector<>(i * dx, j * dx, 0)));
+            node->SetFixed(i == 0);
+            mesh->AddNode(node);
+        }
+    }
+
+    auto mat = std::make_shared<ChMaterialShellReissnerIsothropic>(500, 2.1e7, 0.3);
+    for (int j = 0; j < n; j++) {
+        for (int i = 0; i < n; i++) {
+            int node0 = j * (n + 1) + i;
+            auto element = std::make_shared<ChElementShellReissner4>();
+            element->SetNodes(std::dynamic_pointer_cast<ChNodeFEAxyzrot>(mesh->GetNode(node0)),
+                              std::dynamic_pointer_cast<ChNodeFEAxyzrot>(mesh->GetNode(node0 + 1)),
+                              std::dynamic_pointer_cast<ChNodeFEAxyzrot>(mesh->GetNode(node0 + n + 2)),
+                              std::dynamic_pointer_cast<ChNodeFEAxyzrot>(mesh->GetNode(node0 + n + 1)));
+            element->AddLayer(0.01, 0, mat);
+            mesh->AddElement(element);
+        }
+    }
+}
+
+// Nodes of a block of n x n x n hexahedral cells, fixed at the bottom face.
+void AddBlockNodes(std::shared_ptr<ChMesh> mesh, int n) {
+    double dx = 0.1;
+    for (int k = 0; k <= n; k++) {
+        for (int j = 0; j <= n; j++) {
+            for (int i = 0; i <= n; i++) {
+                auto node = std::make_shared<ChNodeFEAxyz>(ChVector<>(i * dx, j * dx, k * dx));
+                node->SetFixed(k == 0);
+                mesh->AddNode(node);
+            }
+        }
+    }
+}
+
+std::shared_ptr<ChNodeFEAxyz> BlockNode(std::shared_ptr<ChMesh> mesh, int n, int i, int j, int k) {
+    return std::dynamic_pointer_cast<ChNodeFEAxyz>(mesh->GetNode((k * (n + 1) + j) * (n + 1) + i));
+}
+
+// Block of n x n x n corotational hexahedra.
+void BuildHexa8(std::shared_ptr<ChMesh> mesh, int n) {
+    AddBlockNodes(mesh, n);
+    auto mat = std::make_shared<ChContinuumElastic>(1e7, 0.3, 1000);
+    for (int k = 0; k < n; k++) {
+        for (int j = 0; j < n; j++) {
+            for (int i = 0; i < n; i++) {
+                auto element = std::make_shared<ChElementHexa_8>();
+                element->SetNodes(BlockNode(mesh, n, i, j, k), BlockNode(mesh, n, i + 1, j, k),
+                                  BlockNode(mesh, n, i + 1, j + 1, k), BlockNode(mesh, n, i, j + 1, k),
+                                  BlockNode(mesh, n, i, j, k + 1), BlockNode(mesh, n, i + 1, j, k + 1),
+                                  BlockNode(mesh, n, i + 1, j + 1, k + 1), BlockNode(mesh, n, i, j + 1, k + 1));
+                element->SetMaterial(mat);
+                mesh->AddElement(element);
+            }
+        }
+    }
+}
+
+// Block of n x n x n cells, each split into 6 corotational tetrahedra around its main diagonal.
+void BuildTetra4(std::shared_ptr<ChMesh> mesh, int n) {
+    AddBlockNodes(mesh, n);
+    auto mat = std::make_shared<ChContinuumElastic>(1e7, 0.3, 1000);
+    const int tets[6][4] = {{0, 1, 2, 6}, {0, 2, 3, 6}, {0, 3, 7, 6}, {0, 7, 4, 6}, {0, 4, 5, 6}, {0, 5, 1, 6}};
+    for (int k = 0; k < n; k++) {
+        for (int j = 0; j < n; j++) {
+            for (int i = 0; i < n; i++) {
+                std::shared_ptr<ChNodeFEAxyz> c[8] = {
+                    BlockNode(mesh, n, i, j, k),         BlockNode(mesh, n, i + 1, j, k),
+                    BlockNode(mesh, n, i + 1, j + 1, k), BlockNode(mesh, n, i, j + 1, k),
+                    BlockNode(mesh, n, i, j, k + 1),     BlockNode(mesh, n, i + 1, j, k + 1),
+                    BlockNode(mesh, n, i + 1, j + 1, k + 1), BlockNode(mesh, n, i, j + 1, k + 1)};
+                for (int t = 0; t < 6; t++) {
+                    auto n0 = c[tets[t][0]];
+                    auto n1 = c[tets[t][1]];
+                    auto n2 = c[tets[t][2]];
+                    auto n3 = c[tets[t][3]];
+                    // Ensure a positive orientation.
+                    ChVector<> p0 = n0->GetPos();
+                    if (Vdot(Vcross(n1->GetPos() - p0, n2->GetPos() - p0), n3->GetPos() - p0) < 0)
+                        std::swap(n1, n2);
+                    auto element = std::make_shared<ChElementTetra_4>();
+                    element->SetNodes(n0, n1, n2, n3);
+                    element->SetMaterial(mat);
+                    mesh->AddElement(element);
+                }
+            }
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Evaluation of the internal forces or of the KRM matrices of all elements of
+// a mesh built with BUILD(mesh, SIZE).
+// -----------------------------------------------------------------------------
+
+enum class ElementKernel { FORCES, KRM };
+
+template <void (*BUILD)(std::shared_ptr<ChMesh>, int), int SIZE, ElementKernel KERNEL>
+class ElementTest : public utils::ChBenchmarkTest {
+  public:
+    ElementTest() {
+        m_mesh = std::make_shared<ChMesh>();
+        BUILD(m_mesh, SIZE);
+        m_system.Add(m_mesh);
+        m_system.SetupInitial();
+        m_system.Update();
+
+        m_counters["elements"] = m_mesh->GetNelements();
+        m_counters["dofs"] = m_mesh->GetDOF_w();
+    }
+
+    virtual void ExecuteStep() override {
+        for (unsigned int ie = 0; ie < m_mesh->GetNelements(); ie++) {
+            auto element = m_mesh->GetElement(ie);
+            if (KERNEL == ElementKernel::FORCES) {
+                m_F.Reset(element->GetNdofs(), 1);
+                element->ComputeInternalForces(m_F);
+            } else {
+                m_H.Reset(element->GetNdofs(), element->GetNdofs());
+                element->ComputeKRMmatricesGlobal(m_H, 1.0, 0.1, 1.0);
+            }
+        }
+    }
+
+    // Only the elements are exercised; there are no system phase timers.
+    virtual ChSystem* GetSystem() override { return nullptr; }
+
+  private:
+    ChSystemNSC m_system;
+    std::shared_ptr<ChMesh> m_mesh;
+    ChMatrixDynamic<> m_F;
+    ChMatrixDynamic<> m_H;
+};
+
+typedef ElementTest<BuildCableANCF, 400, ElementKernel::FORCES> CableANCF_Forces;
+typedef ElementTest<BuildCableANCF, 400, ElementKernel::KRM> CableANCF_KRM;
+typedef ElementTest<BuildBeamEuler, 400, ElementKernel::FORCES> BeamEuler_Forces;
+typedef ElementTest<BuildBeamEuler, 400, ElementKernel::KRM> BeamEuler_KRM;
+typedef ElementTest<BuildShellANCF, 16, ElementKernel::FORCES> ShellANCF_Forces;
+typedef ElementTest<BuildShellANCF, 16, ElementKernel::KRM> ShellANCF_KRM;
+typedef ElementTest<BuildShellReissner, 16, ElementKernel::FORCES> ShellReissner_Forces;
+typedef ElementTest<BuildShellReissner, 16, ElementKernel::KRM> ShellReissner_KRM;
+typedef ElementTest<BuildHexa8, 8, ElementKernel::FORCES> Hexa8_Forces;
+typedef ElementTest<BuildHexa8, 8, ElementKernel::KRM> Hexa8_KRM;
+typedef ElementTest<BuildTetra4, 8, ElementKernel::FORCES> Tetra4_Forces;
+typedef ElementTest<BuildTetra4, 8, ElementKernel::KRM> Tetra4_KRM;
+
+CH_BM_SIMULATION(ElementForces_CableANCF_400, CableANCF_Forces, 200, 3);
+CH_BM_SIMULATION(ElementKRM_CableANCF_400, CableANCF_KRM, 50, 3);
+CH_BM_SIMULATION(ElementForces_BeamEuler_400, BeamEuler_Forces, 200, 3);
+CH_BM_SIMULATION(ElementKRM_BeamEuler_400, BeamEuler_KRM, 50, 3);
+CH_BM_SIMULATION(ElementForces_ShellANCF_256, ShellANCF_Forces, 20, 3);
+CH_BM_SIMULATION(ElementKRM_ShellANCF_256, ShellANCF_KRM, 5, 3);
+CH_BM_SIMULATION(ElementForces_ShellReissner_256, ShellReissner_Forces, 50, 3);
+CH_BM_SIMULATION(ElementKRM_ShellReissner_256, ShellReissner_KRM, 20, 3);
+CH_BM_SIMULATION(ElementForces_Hexa8_512, Hexa8_Forces, 200, 3);
+CH_BM_SIMULATION(ElementKRM_Hexa8_512, Hexa8_KRM, 50, 3);
+CH_BM_SIMULATION(ElementForces_Tetra4_3072, Tetra4_Forces, 200, 3);
+CH_BM_SIMULATION(ElementKRM_Tetra4_3072, Tetra4_KRM, 50, 3);
+
+// -----------------------------------------------------------------------------
+// Dynamics of a cantilever ANCF shell plate under gravity, integrated with HHT.
+// The Newton systems are solved with MINRES (no direct sparse solver is
+// available without the MKL or MUMPS modules).
+// -----------------------------------------------------------------------------
+
+class ShellHHTTest : public utils::ChBenchmarkTest {
+  public:
+    ShellHHTTest() {
+        auto mesh = std::make_shared<ChMesh>();
+        BuildShellANCF(mesh, 8);
+        m_system.Add(mesh);
+        m_system.Set_G_acc(ChVector<>(0, 0, -9.81));
+        m_system.SetupInitial();
+
+        auto solver = std::make_shared<ChSolverMINRES>();
+        solver->SetMaxIterations(100);
+        solver->SetTolerance(1e-10);
+        solver->SetDiagonalPreconditioning(true);
+        m_system.SetSolver(solver);
+
+        m_system.SetTimestepperType(ChTimestepper::Type::HHT);
+        auto integrator = std::static_pointer_cast<ChTimestepperHHT>(m_system.GetTimestepper());
+        integrator->SetAlpha(-0.2);
+        integrator->SetMaxiters(20);
+        integrator->SetAbsTolerances(1e-5);
+        integrator->SetMode(ChTimestepperHHT::POSITION);
+        integrator->SetScaling(true);
+
+        m_counters["dofs"] = mesh->GetDOF_w();
+    }
+
+    virtual void ExecuteStep() override { m_system.DoStepDynamics(1e-3); }
+    virtual ChSystem* GetSystem() override { return &m_system; }
+
+  private:
+    ChSystemNSC m_system;
+};
+
+CH_BM_SIMULATION(HHT_ShellANCF_64, ShellHHTTest, 20, 3);
+
+// -----------------------------------------------------------------------------
+// Mixed scene: a block of corotational tetrahedra under explicit gravity loads
+// next to a pile of rigid spheres in a container. With pipelining, the collision
+// detection of the pile overlaps the update of the mesh and of the loads.
+// -----------------------------------------------------------------------------
+
+template <bool PIPELINED>
+class MixedTest : public utils::ChBenchmarkTest {
+  public:
+    MixedTest();
+
+    virtual void ExecuteStep() override {
+        m_system.DoStepDynamics(1e-3);
+        m_counters["contacts"] = m_system.GetNcontacts();
+    }
+    virtual ChSystem* GetSystem() override { return &m_system; }
+
+  private:
+    ChSystemNSC m_system;
+};
+
+template <bool PIPELINED>
+MixedTest<PIPELINED>::MixedTest() {
+    m_system.Set_G_acc(ChVector<>(0, 0, -9.81));
+    m_system.SetUsePipelining(PIPELINED);
+
+    auto mesh = std::make_shared<ChMesh>();
+    BuildTetra4(mesh, 6);
+    mesh->SetAutomaticGravity(false);
+    m_system.Add(mesh);
+
+    auto loads = std::make_shared<ChLoadContainer>();
+    for (unsigned int i = 0; i < mesh->GetNelements(); i++) {
+        auto element = std::dynamic_pointer_cast<ChLoadableUVW>(mesh->GetElement(i));
+        auto gravity = std::make_shared<ChLoad<ChLoaderGravity>>(element);
+        gravity->loader.Set_G_acc(m_system.Get_G_acc());
+        loads->Add(gravity);
+    }
+    m_system.Add(loads);
+
+    auto mat = std::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.4f);
+    utils::CreateBoxContainer(&m_system, -1, mat, ChVector<>(1, 1, 1), 0.1, ChVector<>(3, 0, 0));
+    for (int i = 0; i < 200; i++) {
+        auto ball = std::make_shared<ChBodyEasySphere>(0.05, 1000, true);
+        ball->SetMaterialSurface(mat);
+        ball->SetPos(ChVector<>(3 - 0.9 + 0.2 * (i % 10), -0.9 + 0.2 * ((i / 10) % 10), 0.06 + 0.11 * (i / 100)));
+        m_system.AddBody(ball);
+    }
+
+    auto solver = std::make_shared<ChSolverMINRES>();
+    solver->SetMaxIterations(100);
+    m_system.SetSolver(solver);
+    m_system.SetupInitial();
+
+    m_counters["elements"] = mesh->GetNelements();
+}
+
+typedef MixedTest<false> Mixed_Sequential;
+typedef MixedTest<true> Mixed_Pipelined;
+
+CH_BM_SIMULATION(MixedStep_Sequential, Mixed_Sequential, 20, 3);
+CH_BM_SIMULATION(MixedStep_Pipelined, Mixed_Pipelined, 20, 3);
+
+CH_BM_MAIN()
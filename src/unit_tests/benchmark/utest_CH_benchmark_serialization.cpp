@@ -0,0 +1,130 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmarks for serialization throughput: a chain of bodies connected by
+// revolute joints is written with the binary and JSON archives, and saved and
+// restored with binary checkpoint files. Each step serializes the whole system.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <fstream>
+
+#include "chrono/core/ChTimer.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/serialization/ChArchiveBinary.h"
+#include "chrono/serialization/ChArchiveJSON.h"
+#include "chrono/utils/ChBenchmark.h"
+#include "chrono/utils/ChUtilsInputOutput.h"
+
+using namespace chrono;
+
+enum class SerializationType { ARCHIVE_BINARY, ARCHIVE_JSON, CHECKPOINT };
+
+template <SerializationType TYPE, int NUM_BODIES>
+class SerializationTest : public utils::ChBenchmarkTest {
+  public:
+    SerializationTest();
+    ~SerializationTest() { std::remove(m_filename.c_str()); }
+
+    virtual void ExecuteStep() override;
+
+    // The system is not advanced; there are no system phase timers.
+    virtual ChSystem* GetSystem() override { return nullptr; }
+
+  private:
+    // Account for one serialization of the specified size and report the throughput.
+    void Record(size_t bytes) {
+        m_bytes += bytes;
+        m_counters["bytes"] = (double)bytes;
+        m_counters["MB_per_second"] = m_bytes / m_timer() / (1 << 20);
+    }
+
+    ChSystemNSC m_system;
+    std::string m_filename;
+    std::vector<char> m_buffer;
+    ChTimer<double> m_timer;
+    double m_bytes;
+};
+
+template <SerializationType TYPE, int NUM_BODIES>
+SerializationTest<TYPE, NUM_BODIES>::SerializationTest() : m_filename("benchmark_serialization.tmp"), m_bytes(0) {
+    std::shared_ptr<ChBody> prev;
+    for (int i = 0; i < NUM_BODIES; i++) {
+        auto body = std::make_shared<ChBody>();
+        body->SetPos(ChVector<>(i, 0, 0));
+        body->SetPos_dt(ChVector<>(0, 0.1 * i, 0));
+        m_system.AddBody(body);
+        if (prev) {
+            auto joint = std::make_shared<ChLinkLockRevolute>();
+            joint->Initialize(prev, body, ChCoordsys<>(ChVector<>(i - 0.5, 0, 0), QUNIT));
+            m_system.AddLink(joint);
+        }
+        prev = body;
+    }
+    m_system.Setup();
+    m_system.Update();
+    m_timer.reset();
+}
+
+template <SerializationType TYPE, int NUM_BODIES>
+void SerializationTest<TYPE, NUM_BODIES>::ExecuteStep() {
+    switch (TYPE) {
+        case SerializationType::ARCHIVE_BINARY: {
+            m_buffer.clear();
+            m_timer.start();
+            {
+                ChStreamOutBinaryVector stream(&m_buffer);
+                ChArchiveOutBinary archive(stream);
+                archive << CHNVP(m_system);
+            }
+            m_timer.stop();
+            Record(m_buffer.size());
+            break;
+        }
+        case SerializationType::ARCHIVE_JSON: {
+            m_timer.start();
+            {
+                ChStreamOutAsciiFile stream(m_filename.c_str());
+                ChArchiveOutJSON archive(stream);
+                archive << CHNVP(m_system);
+            }
+            m_timer.stop();
+            std::ifstream file(m_filename, std::ios::binary | std::ios::ate);
+            Record((size_t)file.tellg());
+            break;
+        }
+        case SerializationType::CHECKPOINT: {
+            // Write and read back a checkpoint (two transfers of the file).
+            m_timer.start();
+            utils::WriteBinaryCheckpoint(&m_system, m_filename);
+            utils::ReadBinaryCheckpoint(&m_system, m_filename);
+            m_timer.stop();
+            std::ifstream file(m_filename, std::ios::binary | std::ios::ate);
+            Record(2 * (size_t)file.tellg());
+            break;
+        }
+    }
+}
+
+typedef SerializationTest<SerializationType::ARCHIVE_BINARY, 1000> ArchiveBinary1000;
+typedef SerializationTest<SerializationType::ARCHIVE_JSON, 1000> ArchiveJSON1000;
+typedef SerializationTest<SerializationType::CHECKPOINT, 1000> Checkpoint1000;
+typedef SerializationTest<SerializationType::CHECKPOINT, 10000> Checkpoint10000;
+
+CH_BM_SIMULATION(Serialize_ArchiveBinary_1000, ArchiveBinary1000, 5, 3);
+CH_BM_SIMULATION(Serialize_ArchiveJSON_1000, ArchiveJSON1000, 5, 3);
+CH_BM_SIMULATION(Serialize_Checkpoint_1000, Checkpoint1000, 50, 3);
+CH_BM_SIMULATION(Serialize_Checkpoint_10000, Checkpoint10000, 10, 3);
+
+CH_BM_MAIN()
@@ -0,0 +1,129 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Benchmarks for Chrono::Vehicle: a full HMMWV model accelerating on rigid
+// terrain (TMeasy tires) and on SCM deformable terrain (rigid tires).
+// Each step synchronizes and advances the terrain and the vehicle.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <type_traits>
+
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+#include "chrono_vehicle/terrain/SCMDeformableTerrain.h"
+
+#include "chrono_models/vehicle/hmmwv/HMMWV.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+using namespace chrono::vehicle::hmmwv;
+
+// -----------------------------------------------------------------------------
+
+template <typename TERRAIN>
+class HMMWVTest : public utils::ChBenchmarkTest {
+  public:
+    HMMWVTest();
+    ~HMMWVTest() { delete m_terrain; }
+
+    virtual void ExecuteStep() override {
+        double time = m_hmmwv.GetSystem()->GetChTime();
+        double throttle = std::min(time / 0.5, 0.8);
+        m_terrain->Synchronize(time);
+        m_hmmwv.Synchronize(time, 0, 0, throttle, *m_terrain);
+        m_terrain->Advance(m_step);
+        m_hmmwv.Advance(m_step);
+    }
+
+    virtual ChSystem* GetSystem() override { return m_hmmwv.GetSystem(); }
+
+  private:
+    void CreateTerrain();
+
+    HMMWV_Full m_hmmwv;
+    TERRAIN* m_terrain;
+    double m_step;
+};
+
+template <typename TERRAIN>
+HMMWVTest<TERRAIN>::HMMWVTest() : m_step(2e-3) {
+    bool deformable = std::is_same<TERRAIN, SCMDeformableTerrain>::value;
+
+    m_hmmwv.SetContactMethod(deformable ? ChMaterialSurface::SMC : ChMaterialSurface::NSC);
+    m_hmmwv.SetChassisFixed(false);
+    m_hmmwv.SetInitPosition(ChCoordsys<>(ChVector<>(-5, 0, deformable ? 0.6 : 1.0), QUNIT));
+    m_hmmwv.SetPowertrainType(PowertrainModelType::SHAFTS);
+    m_hmmwv.SetDriveType(DrivelineType::AWD);
+    m_hmmwv.SetTireType(deformable ? TireModelType::RIGID : TireModelType::TMEASY);
+    m_hmmwv.SetVehicleStepSize(m_step);
+    m_hmmwv.Initialize();
+
+    m_hmmwv.SetChassisVisualizationType(VisualizationType::NONE);
+    m_hmmwv.SetSuspensionVisualizationType(VisualizationType::NONE);
+    m_hmmwv.SetSteeringVisualizationType(VisualizationType::NONE);
+    m_hmmwv.SetWheelVisualizationType(VisualizationType::NONE);
+    m_hmmwv.SetTireVisualizationType(VisualizationType::NONE);
+
+    CreateTerrain();
+    m_hmmwv.GetSystem()->SetupInitial();
+    m_hmmwv.GetSystem()->SetMaxItersSolverSpeed(50);
+    m_hmmwv.GetSystem()->SetMaxItersSolverStab(50);
+}
+
+template <>
+void HMMWVTest<RigidTerrain>::CreateTerrain() {
+    m_terrain = new RigidTerrain(m_hmmwv.GetSystem());
+    auto patch = m_terrain->AddPatch(ChCoordsys<>(ChVector<>(0, 0, -5), QUNIT), ChVector<>(100, 20, 10));
+    patch->SetContactFrictionCoefficient(0.9f);
+    patch->SetContactRestitutionCoefficient(0.01f);
+    patch->SetContactMaterialProperties(2e7f, 0.3f);
+    m_terrain->Initialize();
+}
+
+template <>
+void HMMWVTest<SCMDeformableTerrain>::CreateTerrain() {
+    for (int i = 0; i < 4; i++) {
+        auto wheel = m_hmmwv.GetVehicle().GetWheelBody(i);
+        wheel->GetMaterialSurfaceSMC()->SetFriction(0.8f);
+        wheel->GetMaterialSurfaceSMC()->SetYoungModulus(1e6f);
+        wheel->GetMaterialSurfaceSMC()->SetRestitution(0.1f);
+    }
+
+    m_terrain = new SCMDeformableTerrain(m_hmmwv.GetSystem());
+    m_terrain->SetPlane(ChCoordsys<>(VNULL, Q_from_AngX(CH_C_PI_2)));
+    m_terrain->SetSoilParametersSCM(2e6,   // Bekker Kphi
+                                    0,     // Bekker Kc
+                                    1.1,   // Bekker n exponent
+                                    0,     // Mohr cohesive limit (Pa)
+                                    30,    // Mohr friction limit (degrees)
+                                    0.01,  // Janosi shear coefficient (m)
+                                    2e8,   // Elastic stiffness (Pa/m), before plastic yield
+                                    3e4    // Damping (Pa s/m), proportional to negative vertical speed
+                                    );
+    m_terrain->SetAutomaticRefinement(true);
+    m_terrain->SetAutomaticRefinementResolution(0.04);
+    m_terrain->Initialize(0, 16, 8, 128, 64);
+}
+
+// -----------------------------------------------------------------------------
+
+typedef HMMWVTest<RigidTerrain> HMMWV_Rigid;
+typedef HMMWVTest<SCMDeformableTerrain> HMMWV_SCM;
+
+CH_BM_SIMULATION(HMMWV_RigidTerrain, HMMWV_Rigid, 500, 3);
+CH_BM_SIMULATION(HMMWV_SCMTerrain, HMMWV_SCM, 200, 3);
+
+CH_BM_MAIN()
@@ -0,0 +1,151 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for global closest-point queries and arc-length parameterization
+// of ChBezierCurve, including on an empty curve.
+//
+// =============================================================================
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "chrono/core/ChBezierCurve.h"
+
+using namespace chrono;
+
+// Spiral path with many intervals, revisiting the neighborhood of earlier parts of the path.
+std::shared_ptr<ChBezierCurve> CreatePath(int num_points) {
+    std::vector<ChVector<> > points;
+    for (int i = 0; i < num_points; i++) {
+        double a = 0.1 * i;
+        double r = 20 + 0.05 * i;
+        points.push_back(ChVector<>(r * std::cos(a), r * std::sin(a), 0.01 * i));
+    }
+    return std::make_shared<ChBezierCurve>(points);
+}
+
+// Closest point by dense sampling of all intervals.
+double BruteForceDistance(const ChBezierCurve& path, const ChVector<>& loc) {
+    double d2min = 1e30;
+    for (size_t i = 0; i < path.getNumPoints() - 1; i++) {
+        for (int j = 0; j <= 200; j++) {
+            double d2 = (path.eval(i, j / 200.0) - loc).Length2();
+            d2min = std::min(d2min, d2);
+        }
+    }
+    return std::sqrt(d2min);
+}
+
+bool TestClosestPoint(const ChBezierCurve& path) {
+    srand(1);
+    for (int k = 0; k < 200; k++) {
+        ChVector<> loc(60.0 * rand() / RAND_MAX - 30, 60.0 * rand() / RAND_MAX - 30, 10.0 * rand() / RAND_MAX - 5);
+        size_t i;
+        double t;
+        ChVector<> Q = path.findClosestPoint(loc, i, t);
+        double dist = (Q - loc).Length();
+        double dist_ref = BruteForceDistance(path, loc);
+        if ((Q - path.eval(i, t)).Length() > 1e-10 || dist > dist_ref + 1e-3) {
+            std::cout << "findClosestPoint failed at " << loc.x() << " " << loc.y() << " " << loc.z() << ": distance "
+                      << dist << "  (expected " << dist_ref << ")" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TestArcLength(const ChBezierCurve& path) {
+    // Compare the total length with that of a fine polyline.
+    double length_ref = 0;
+    for (size_t i = 0; i < path.getNumPoints() - 1; i++) {
+        for (int j = 0; j < 1000; j++)
+            length_ref += (path.eval(i, (j + 1) / 1000.0) - path.eval(i, j / 1000.0)).Length();
+    }
+    if (std::abs(path.getLength() - length_ref) > 1e-6 * length_ref) {
+        std::cout << "getLength failed: " << path.getLength() << "  (expected " << length_ref << ")" << std::endl;
+        return false;
+    }
+
+    // Round trip between arc length and curve parameter.
+    for (int k = 0; k <= 100; k++) {
+        double s = path.getLength() * k / 100.0;
+        size_t i;
+        double t;
+        path.calcParameter(s, i, t);
+        double s1 = path.calcArcLength(i, t);
+        if (std::abs(s1 - s) > 1e-8 * path.getLength()) {
+            std::cout << "calcParameter failed: s = " << s << "  s(t) = " << s1 << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TestTrackerReset(std::shared_ptr<ChBezierCurve> path) {
+    ChBezierCurveTracker tracker(path);
+
+    // Jump to locations just off the path, far from the previous one.
+    size_t intervals[] = {5, 150, 20, 310, 77};
+    for (auto i : intervals) {
+        ChVector<> P = path->eval(i, 0.3);
+        ChVector<> N = Vcross(path->evalD(i, 0.3), ChVector<>(0, 0, 1)).GetNormalized();
+        ChVector<> loc = P + 0.2 * N;
+
+        tracker.reset(loc);
+        ChVector<> Q;
+        tracker.calcClosestPoint(loc, Q);
+        if ((Q - P).Length() > 1e-3) {
+            std::cout << "tracker reset failed at interval " << i << std::endl;
+            return false;
+        }
+        if (std::abs(tracker.getArcLength() - path->calcArcLength(i, 0.3)) > 1e-3) {
+            std::cout << "tracker arc length failed at interval " << i << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// Queries on a curve without intervals (default constructed) must not fail.
+bool TestEmptyCurve() {
+    ChBezierCurve path;
+    ChVector<> loc(1, 2, 3);
+    size_t i = 1;
+    double t = 1;
+    ChVector<> Q = path.findClosestPoint(loc, i, t);
+    if (!(Q == loc) || i != 0 || t != 0) {
+        std::cout << "closest point on empty curve failed" << std::endl;
+        return false;
+    }
+    path.calcParameter(1.0, i, t);
+    if (i != 0 || t != 0 || path.getLength() != 0) {
+        std::cout << "arc length parameter on empty curve failed" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    auto path = CreatePath(400);
+
+    bool passed = true;
+    passed &= TestClosestPoint(*path);
+    passed &= TestArcLength(*path);
+    passed &= TestTrackerReset(path);
+    passed &= TestEmptyCurve();
+
+    std::cout << (passed ? "PASSED" : "FAILED") << std::endl;
+    return passed ? 0 : 1;
+}
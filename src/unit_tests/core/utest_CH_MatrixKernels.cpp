@@ -0,0 +1,156 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the fixed-size products of ChMatrixNM and ChMatrix33
+// (MatrMultiply, MatrMultiplyT, MatrTMultiply and operator*), compared with the
+// products of the same matrices as ChMatrixDynamic.
+//
+// =============================================================================
+
+#include "chrono/core/ChLog.h"
+#include "chrono/core/ChMatrix33.h"
+#include "chrono/core/ChMatrixDynamic.h"
+#include "chrono/core/ChMatrixNM.h"
+
+using namespace chrono;
+
+bool Compare(const char* label, const ChMatrix<double>& res, const ChMatrix<double>& ref, double tolerance) {
+    if (res.Equals(ref, tolerance))
+        return true;
+
+    GetLog() << label << " FAILED\n";
+    GetLog() << "\nfixed-size - ref";
+    ChMatrixDynamic<double> diff(res.GetRows(), res.GetColumns());
+    diff.MatrSub(res, ref);
+    diff.StreamOUT(GetLog());
+
+    return false;
+}
+
+// Check the products with result (MxN) and inner dimension K of random matrices.
+template <int M, int K, int N>
+bool CheckProducts(double tolerance) {
+    GetLog() << "(" << M << "x" << K << ") * (" << K << "x" << N << ")   ... ";
+
+    ChMatrixNM<double, M, K> A;
+    ChMatrixNM<double, K, N> B;
+    ChMatrixNM<double, N, K> Bt;
+    ChMatrixNM<double, K, M> At;
+    A.FillRandom(10, -10);
+    B.FillRandom(10, -10);
+    Bt.FillRandom(10, -10);
+    At.FillRandom(10, -10);
+
+    ChMatrixDynamic<double> Ad(A), Bd(B), Btd(Bt), Atd(At);
+    ChMatrixDynamic<double> ref(M, N);
+    ChMatrixNM<double, M, N> res;
+    bool passed = true;
+
+    ref.MatrMultiply(Ad, Bd);
+    res.MatrMultiply(A, B);
+    passed &= Compare("A*B", res, ref, tolerance);
+    passed &= Compare("operator*", A * B, ref, tolerance);
+
+    ref.MatrMultiplyT(Ad, Btd);
+    res.MatrMultiplyT(A, Bt);
+    passed &= Compare("A*B'", res, ref, tolerance);
+
+    ref.MatrTMultiply(Atd, Bd);
+    res.MatrTMultiply(At, B);
+    passed &= Compare("A'*B", res, ref, tolerance);
+
+    GetLog() << (passed ? "OK\n" : "\n");
+    return passed;
+}
+
+// Check the products of 3x3 matrices, through the ChMatrix33 interface.
+bool CheckMatrix33(double tolerance) {
+    GetLog() << "ChMatrix33   ... ";
+
+    ChMatrix33<> A;
+    ChMatrix33<> B;
+    A.FillRandom(10, -10);
+    B.FillRandom(10, -10);
+
+    ChMatrixDynamic<double> Ad(A), Bd(B);
+    ChMatrixDynamic<double> ref(3, 3);
+    ChMatrix33<> res;
+    bool passed = true;
+
+    ref.MatrMultiply(Ad, Bd);
+    res.MatrMultiply(A, B);
+    passed &= Compare("A*B", res, ref, tolerance);
+    passed &= Compare("operator*", A * B, ref, tolerance);
+
+    ref.MatrMultiplyT(Ad, Bd);
+    res.MatrMultiplyT(A, B);
+    passed &= Compare("A*B'", res, ref, tolerance);
+
+    ref.MatrTMultiply(Ad, Bd);
+    res.MatrTMultiply(A, B);
+    passed &= Compare("A'*B", res, ref, tolerance);
+
+    // Products with a 3xN matrix and a vector
+    ChMatrixNM<double, 3, 8> C;
+    C.FillRandom(10, -10);
+    ChMatrixDynamic<double> Cd(C);
+    ChMatrixDynamic<double> ref38(3, 8);
+    ref38.MatrMultiply(Ad, Cd);
+    passed &= Compare("A*C", A * C, ref38, tolerance);
+
+    ChVector<> v(1.5, -2, 0.25);
+    ChMatrixNM<double, 3, 1> vm;
+    vm.PasteVector(v, 0, 0);
+    ChMatrixDynamic<double> refv(3, 1);
+    refv.MatrMultiply(Ad, ChMatrixDynamic<double>(vm));
+    passed &= std::abs((A * v - refv.ClipVector(0, 0)).Length()) < tolerance;
+
+    GetLog() << (passed ? "OK\n" : "\n");
+    return passed;
+}
+
+int main(int argc, char* argv[]) {
+    // Tolerance for comparing matrices (the summation order may differ)
+    double tolerance = 1e-10;
+
+    // Result of unit tests
+    bool passed = true;
+
+    // Initialize seed for rand()
+    srand(static_cast<unsigned int>(time(nullptr)));
+
+    // Small sizes
+    passed &= CheckProducts<1, 3, 1>(tolerance);
+    passed &= CheckProducts<3, 3, 3>(tolerance);
+    passed &= CheckProducts<3, 1, 3>(tolerance);
+    passed &= CheckProducts<4, 4, 4>(tolerance);
+    passed &= CheckProducts<6, 6, 6>(tolerance);
+    passed &= CheckProducts<3, 9, 24>(tolerance);
+
+    // Mid sizes, with all remainders of the blocked kernels
+    passed &= CheckProducts<6, 24, 24>(tolerance);
+    passed &= CheckProducts<24, 24, 24>(tolerance);
+    passed &= CheckProducts<24, 6, 24>(tolerance);
+    passed &= CheckProducts<9, 11, 13>(tolerance);
+    passed &= CheckProducts<7, 10, 5>(tolerance);
+    passed &= CheckProducts<27, 27, 27>(tolerance);
+    passed &= CheckProducts<33, 33, 33>(tolerance);
+    passed &= CheckProducts<54, 54, 54>(tolerance);
+    passed &= CheckProducts<24, 72, 1>(tolerance);
+
+    passed &= CheckMatrix33(tolerance);
+
+    GetLog() << (passed ? "\nPASSED\n" : "\nFAILED\n");
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
@@ -0,0 +1,227 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the task scheduler: parallel loops (also nested), deterministic
+// reductions, exception propagation, per-thread concurrency limit, and task
+// graphs with dependencies, for several pool sizes.
+//
+// =============================================================================
+
+#include <atomic>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "chrono/parallel/ChTaskScheduler.h"
+
+using namespace chrono;
+
+const int num_items = 10000;
+
+bool TestParallelFor() {
+    auto& scheduler = ChTaskScheduler::GetInstance();
+    std::vector<std::atomic<int>> visits(num_items);
+    for (auto& v : visits)
+        v = 0;
+
+    for (int grain : {0, 1, 7, 20000}) {
+        scheduler.ParallelFor(0, num_items, [&](int first, int last) {
+            for (int i = first; i < last; i++)
+                visits[i]++;
+        }, grain);
+    }
+
+    for (int i = 0; i < num_items; i++) {
+        if (visits[i] != 4) {
+            std::cout << "ParallelFor: index " << i << " visited " << visits[i] << " times" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool TestNested() {
+    auto& scheduler = ChTaskScheduler::GetInstance();
+    std::atomic<int> count(0);
+    scheduler.ParallelFor(0, 16, [&](int first, int last) {
+        for (int i = first; i < last; i++) {
+            scheduler.ParallelFor(0, 100, [&](int f, int l) { count += l - f; }, 3);
+        }
+    }, 1);
+
+    if (count != 1600) {
+        std::cout << "nested ParallelFor: count = " << count << std::endl;
+        return false;
+    }
+    return true;
+}
+
+double Sum(int max_tasks) {
+    return ChTaskScheduler::GetInstance().ParallelReduce(
+        0, num_items, 0.0,
+        [](int first, int last) {
+            double s = 0;
+            for (int i = first; i < last; i++)
+                s += std::sin(0.1 * i);
+            return s;
+        },
+        [](double a, double b) { return a + b; }, 16, max_tasks);
+}
+
+bool TestReduce(double& reference) {
+    double serial = Sum(1);
+    double parallel = Sum(0);
+    if (reference == 0)
+        reference = serial;
+
+    // Same grain: bitwise identical results, regardless of the number of threads.
+    if (serial != reference || parallel != reference) {
+        std::cout << "ParallelReduce: " << serial << " " << parallel << " " << reference << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool TestException() {
+    auto& scheduler = ChTaskScheduler::GetInstance();
+    std::atomic<int> count(0);
+    bool caught = false;
+    try {
+        scheduler.ParallelFor(0, 100, [&](int first, int last) {
+            count++;
+            if (first <= 50 && 50 < last)
+                throw std::runtime_error("task failure");
+        }, 1);
+    } catch (const std::runtime_error&) {
+        caught = true;
+    }
+
+    if (!caught || count == 0) {
+        std::cout << "exception not propagated" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool TestLocalConcurrency() {
+    auto& scheduler = ChTaskScheduler::GetInstance();
+    bool passed = true;
+
+    // A limit of 1 runs the whole range on the calling thread, in a single call.
+    std::thread t([&]() {
+        ChTaskScheduler::SetLocalConcurrency(1);
+        int calls = 0;
+        std::thread::id id = std::this_thread::get_id();
+        scheduler.ParallelFor(0, num_items, [&](int first, int last) {
+            calls++;
+            passed &= (first == 0 && last == num_items && std::this_thread::get_id() == id);
+        }, 1);
+        passed &= (calls == 1);
+    });
+    t.join();
+
+    // The limit is per thread.
+    passed &= (ChTaskScheduler::GetLocalConcurrency() == 0);
+
+    if (!passed)
+        std::cout << "local concurrency limit not respected" << std::endl;
+    return passed;
+}
+
+bool TestGraph() {
+    // Diamond patterns: each level depends on all tasks of the previous level.
+    const int num_levels = 5;
+    const int width = 8;
+    std::vector<std::atomic<int>> level_done(num_levels);
+    for (auto& l : level_done)
+        l = 0;
+    std::atomic<bool> order_ok(true);
+
+    ChTaskGraph graph;
+    std::vector<int> previous;
+    for (int l = 0; l < num_levels; l++) {
+        std::vector<int> current;
+        for (int k = 0; k < width; k++) {
+            current.push_back(graph.AddTask(
+                [&, l]() {
+                    if (l > 0 && level_done[l - 1] != width)
+                        order_ok = false;
+                    level_done[l]++;
+                },
+                previous));
+        }
+        previous = current;
+    }
+
+    for (int run = 0; run < 3; run++) {
+        for (auto& l : level_done)
+            l = 0;
+        graph.Run();
+        for (int l = 0; l < num_levels; l++) {
+            if (level_done[l] != width) {
+                std::cout << "task graph: level " << l << " incomplete" << std::endl;
+                return false;
+            }
+        }
+    }
+    if (!order_ok) {
+        std::cout << "task graph: dependency violated" << std::endl;
+        return false;
+    }
+
+    // Invalid dependency.
+    try {
+        graph.AddTask([]() {}, {graph.GetNumTasks()});
+        std::cout << "task graph: invalid dependency accepted" << std::endl;
+        return false;
+    } catch (const std::exception&) {
+    }
+
+    // A failing task: the exception is rethrown, its successors still run.
+    ChTaskGraph failing;
+    std::atomic<int> count(0);
+    int a = failing.AddTask([]() { throw std::runtime_error("task failure"); });
+    failing.AddTask([&]() { count++; }, {a});
+    try {
+        failing.Run();
+        std::cout << "task graph: exception not propagated" << std::endl;
+        return false;
+    } catch (const std::runtime_error&) {
+    }
+    if (count != 1) {
+        std::cout << "task graph: successor of failing task not run" << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+    double reference = 0;
+
+    for (int num_threads : {1, 2, 4}) {
+        ChTaskScheduler::GetInstance().SetNumThreads(num_threads);
+        std::cout << "Threads: " << ChTaskScheduler::GetInstance().GetNumThreads() << std::endl;
+        passed &= TestParallelFor();
+        passed &= TestNested();
+        passed &= TestReduce(reference);
+        passed &= TestException();
+        passed &= TestLocalConcurrency();
+        passed &= TestGraph();
+    }
+
+    std::cout << (passed ? "PASSED" : "FAILED") << std::endl;
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,168 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the per-thread trace profiler: recording from several threads,
+// exclusive-time aggregation, ring buffer overflow, and Chrome trace export.
+//
+// =============================================================================
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "chrono/utils/ChTraceProfiler.h"
+
+using namespace chrono;
+using namespace chrono::utils;
+
+const int num_threads = 4;
+const int num_outer = 20;
+const int num_inner = 3;
+
+void BusyWait(double seconds) {
+    auto start = std::chrono::steady_clock::now();
+    while (std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() < seconds) {
+    }
+}
+
+void Work() {
+    for (int i = 0; i < num_outer; i++) {
+        CH_TRACE("outer");
+        BusyWait(50e-6);
+        for (int j = 0; j < num_inner; j++) {
+            CH_TRACE("inner");
+            BusyWait(100e-6);
+        }
+    }
+}
+
+void RunThreads() {
+    std::vector<std::thread> threads;
+    for (int k = 0; k < num_threads; k++)
+        threads.push_back(std::thread(Work));
+    for (auto& t : threads)
+        t.join();
+}
+
+int CountOccurrences(const std::string& str, const std::string& sub) {
+    int count = 0;
+    for (size_t pos = str.find(sub); pos != std::string::npos; pos = str.find(sub, pos + sub.size()))
+        count++;
+    return count;
+}
+
+bool TestDisabled() {
+    ChTraceProfiler::Clear();
+    RunThreads();
+    if (ChTraceProfiler::GetNumEvents() != 0) {
+        std::cout << "events recorded while disabled" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool TestThreads() {
+    ChTraceProfiler::Enable();
+    RunThreads();
+    ChTraceProfiler::Disable();
+
+    if (ChTraceProfiler::GetNumThreads() != num_threads) {
+        std::cout << "wrong number of threads: " << ChTraceProfiler::GetNumThreads() << std::endl;
+        return false;
+    }
+
+    auto stats = ChTraceProfiler::GetStatistics();
+    if (stats.size() != 2) {
+        std::cout << "wrong number of scopes: " << stats.size() << std::endl;
+        return false;
+    }
+
+    // Scopes are sorted by decreasing exclusive time: 'inner' first.
+    const auto& inner = stats[0];
+    const auto& outer = stats[1];
+    if (std::string(inner.name) != "inner" || std::string(outer.name) != "outer") {
+        std::cout << "wrong scope order" << std::endl;
+        return false;
+    }
+    if (outer.calls != num_threads * num_outer || inner.calls != num_threads * num_outer * num_inner) {
+        std::cout << "wrong call counts: " << outer.calls << " " << inner.calls << std::endl;
+        return false;
+    }
+    if (inner.self != inner.total) {
+        std::cout << "leaf scope exclusive time differs from inclusive time" << std::endl;
+        return false;
+    }
+    if (std::abs(outer.self - (outer.total - inner.total)) > 1e-9 * outer.total) {
+        std::cout << "wrong exclusive time: " << outer.self << "  (expected " << outer.total - inner.total << ")"
+                  << std::endl;
+        return false;
+    }
+    double expected_inner = num_threads * num_outer * num_inner * 100e-6;
+    if (inner.total < expected_inner) {
+        std::cout << "implausible inner time: " << inner.total << std::endl;
+        return false;
+    }
+
+    std::ostringstream trace;
+    ChTraceProfiler::WriteChromeTrace(trace);
+    int num_events = CountOccurrences(trace.str(), "\"ph\":\"X\"");
+    int num_names = CountOccurrences(trace.str(), "\"thread_name\"");
+    if (num_events != num_threads * num_outer * (1 + num_inner) || num_names != num_threads) {
+        std::cout << "wrong trace contents: " << num_events << " events, " << num_names << " threads" << std::endl;
+        return false;
+    }
+
+    ChTraceProfiler::WriteReport(std::cout);
+    return true;
+}
+
+bool TestOverflow() {
+    ChTraceProfiler::SetBufferSize(10);
+    ChTraceProfiler::Enable();
+    std::thread t([]() {
+        ChTraceProfiler::SetThreadName("overflow");
+        for (int i = 0; i < 25; i++) {
+            CH_TRACE("event");
+        }
+    });
+    t.join();
+    ChTraceProfiler::Disable();
+    ChTraceProfiler::SetBufferSize(65536);
+
+    auto stats = ChTraceProfiler::GetStatistics();
+    if (ChTraceProfiler::GetNumEvents() != 10 || stats.size() != 1 || stats[0].calls != 10) {
+        std::cout << "ring buffer overflow failed: " << ChTraceProfiler::GetNumEvents() << " events" << std::endl;
+        return false;
+    }
+
+    std::ostringstream trace;
+    ChTraceProfiler::WriteChromeTrace(trace);
+    if (trace.str().find("\"name\":\"overflow\"") == std::string::npos) {
+        std::cout << "thread name missing from trace" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+    passed &= TestDisabled();
+    passed &= TestThreads();
+    passed &= TestOverflow();
+
+    std::cout << (passed ? "PASSED" : "FAILED") << std::endl;
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,188 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the data exchange between two co-simulation interfaces in the
+// same process (a server thread and a client), over the loopback interface.
+// - With shared memory enabled on both ends, the shared memory channel must be
+//   negotiated, and values must round-trip in bursts longer than the capacity of
+//   its rings as well as in alternating exchanges.
+// - With shared memory disabled on either end, the TCP connection must be used,
+//   with the same results.
+//
+// =============================================================================
+
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "chrono/core/ChLog.h"
+#include "chrono/core/ChMatrixDynamic.h"
+
+#include "chrono_cosimulation/ChCosimulation.h"
+#include "chrono_cosimulation/ChExceptionSocket.h"
+
+using namespace chrono;
+using namespace chrono::cosimul;
+
+// Values sent by the client and by the server (different sizes for the two directions).
+const int num_client_values = 3;
+const int num_server_values = 2;
+
+// Number of messages sent in a row in each direction (more than the 8 slots of a shared memory ring).
+const int num_burst = 20;
+
+// Number of alternating exchanges.
+const int num_ping_pong = 50;
+
+// Value i of message k sent by the client, and the reply of the server.
+double ClientValue(int k, int i) {
+    return 1000.0 * k + i + 0.25;
+}
+
+double ServerValue(int k, int i) {
+    return -(1000.0 * k + i) - 0.5;
+}
+
+bool Check(bool condition, const std::string& message) {
+    if (!condition)
+        GetLog() << "Failed: " << message.c_str() << "\n";
+    return condition;
+}
+
+struct ServerResult {
+    bool connected = false;
+    bool shm = false;
+    bool valid = true;
+};
+
+// Server side: receive messages and check them, reply to each.
+void RunServer(ChSocketFramework* socket_tools, int port, bool use_shm, ServerResult* result) {
+    try {
+        ChCosimulation cosimul_interface(*socket_tools, num_client_values, num_server_values);
+        cosimul_interface.SetUseSharedMemory(use_shm);
+        cosimul_interface.WaitConnection(port);
+        result->connected = true;
+        result->shm = cosimul_interface.IsUsingSharedMemory();
+
+        ChMatrixDynamic<double> in(num_client_values, 1);
+        ChMatrixDynamic<double> out(num_server_values, 1);
+        double time;
+
+        // Burst: receive all messages, then send all replies
+        for (int k = 0; k < num_burst; k++) {
+            cosimul_interface.ReceiveData(time, &in);
+            result->valid &= (time == k);
+            for (int i = 0; i < num_client_values; i++)
+                result->valid &= (in(i) == ClientValue(k, i));
+        }
+        for (int k = 0; k < num_burst; k++) {
+            for (int i = 0; i < num_server_values; i++)
+                out(i) = ServerValue(k, i);
+            cosimul_interface.SendData(-k, &out);
+        }
+
+        // Ping-pong
+        for (int k = 0; k < num_ping_pong; k++) {
+            cosimul_interface.ReceiveData(time, &in);
+            result->valid &= (time == k);
+            for (int i = 0; i < num_client_values; i++)
+                result->valid &= (in(i) == ClientValue(k, i));
+            for (int i = 0; i < num_server_values; i++)
+                out(i) = ServerValue(k, i);
+            cosimul_interface.SendData(-k, &out);
+        }
+    } catch (...) {
+        result->valid = false;
+    }
+}
+
+// Client side: connect to the server, exchange messages with it.
+bool RunLoopback(ChSocketFramework* socket_tools,
+                 int port,
+                 bool server_shm,
+                 bool client_shm,
+                 bool expected_shm,
+                 const std::string& name) {
+    ServerResult server_result;
+    std::thread server(RunServer, socket_tools, port, server_shm, &server_result);
+
+    bool passed = true;
+    try {
+        // The connection cannot be retried (the process exits if it fails): let the server start listening.
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        ChCosimulation cosimul_interface(*socket_tools, num_server_values, num_client_values);
+        cosimul_interface.SetUseSharedMemory(client_shm);
+        cosimul_interface.ConnectToServer("localhost", port);
+
+        passed &= Check(cosimul_interface.IsUsingSharedMemory() == expected_shm, name + ": client channel");
+
+        ChMatrixDynamic<double> out(num_client_values, 1);
+        ChMatrixDynamic<double> in(num_server_values, 1);
+        double time;
+        bool valid = true;
+
+        // Burst: send all messages, then receive all replies
+        for (int k = 0; k < num_burst; k++) {
+            for (int i = 0; i < num_client_values; i++)
+                out(i) = ClientValue(k, i);
+            cosimul_interface.SendData(k, &out);
+        }
+        for (int k = 0; k < num_burst; k++) {
+            cosimul_interface.ReceiveData(time, &in);
+            valid &= (time == -k);
+            for (int i = 0; i < num_server_values; i++)
+                valid &= (in(i) == ServerValue(k, i));
+        }
+        passed &= Check(valid, name + ": values of the burst exchange");
+
+        // Ping-pong
+        valid = true;
+        for (int k = 0; k < num_ping_pong; k++) {
+            for (int i = 0; i < num_client_values; i++)
+                out(i) = ClientValue(k, i);
+            cosimul_interface.SendData(k, &out);
+            cosimul_interface.ReceiveData(time, &in);
+            valid &= (time == -k);
+            for (int i = 0; i < num_server_values; i++)
+                valid &= (in(i) == ServerValue(k, i));
+        }
+        passed &= Check(valid, name + ": values of the alternating exchange");
+    } catch (const ChExceptionSocket& exception) {
+        GetLog() << name.c_str() << ": " << exception.what() << "\n";
+        passed = false;
+    } catch (...) {
+        GetLog() << name.c_str() << ": socket error\n";
+        passed = false;
+    }
+
+    server.join();
+    passed &= Check(server_result.connected, name + ": server connection");
+    passed &= Check(server_result.shm == expected_shm, name + ": server channel");
+    passed &= Check(server_result.valid, name + ": values received by the server");
+
+    GetLog() << name.c_str() << ": " << (passed ? "OK" : "FAILED") << "\n";
+    return passed;
+}
+
+int main(int argc, char* argv[]) {
+    ChSocketFramework socket_tools;
+
+    bool passed = true;
+    passed &= RunLoopback(&socket_tools, 50120, true, true, ChSharedMemoryChannel::IsSupported(), "shared memory");
+    passed &= RunLoopback(&socket_tools, 50121, true, false, false, "TCP, disabled on the client");
+    passed &= RunLoopback(&socket_tools, 50122, false, true, false, "TCP, disabled on the server");
+
+    GetLog() << (passed ? "PASSED\n" : "FAILED\n");
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
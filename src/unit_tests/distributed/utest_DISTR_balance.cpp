@@ -0,0 +1,133 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2016 projectchrono.org
+// All right reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the load balancing of ChDomainDistributed.
+// All bodies start at rest in the bottom of the domain, i.e. on the first rank.
+// With BODY_COUNT balancing, the sub-domain boundaries must move towards them,
+// by at most the allowed shift per step, without losing or duplicating bodies,
+// until every rank owns about the same number of bodies.
+//
+// =============================================================================
+
+#include "chrono_distributed/collision/ChCollisionModelDistributed.h"
+#include "chrono_distributed/physics/ChDomainDistributed.h"
+#include "chrono_distributed/physics/ChSystemDistributed.h"
+
+#include <mpi.h>
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace chrono;
+using namespace chrono::collision;
+
+double dt = 1e-3;
+double ghost_layer = 1.0;
+
+// Number of bodies owned (not ghost) by this rank
+int CountOwned(ChSystemDistributed& sys) {
+    int count = 0;
+    for (int i = 0; i < sys.data_manager->num_rigid_bodies; i++) {
+        auto status = sys.ddm->comm_status[i];
+        if (status == distributed::OWNED || status == distributed::SHARED_UP || status == distributed::SHARED_DOWN)
+            count++;
+    }
+    return count;
+}
+
+// To be run on 2 or more MPI ranks
+int main(int argc, char* argv[]) {
+    MPI_Init(&argc, &argv);
+    int my_rank;
+    int num_ranks;
+    MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+    ChSystemDistributed sys(MPI_COMM_WORLD, ghost_layer, 10000);
+    sys.Set_G_acc(ChVector<double>(0, 0, 0));
+    sys.GetDomain()->SetSplitAxis(2);
+    sys.GetDomain()->SetSimDomain(0, 10, 0, 10, 0, 10.0 * num_ranks);
+    sys.GetDomain()->SetLoadBalancing(1, ChDomainDistributed::BODY_COUNT);
+
+    // Bodies at rest, without collision shapes, in the bottom 4 units of the domain
+    int num_bodies = 0;
+    for (int i = 0; i < 8; i++) {
+        for (int j = 0; j < 8; j++) {
+            for (int k = 0; k < 8; k++) {
+                auto body = std::make_shared<ChBody>(std::make_shared<ChCollisionModelDistributed>(),
+                                                     ChMaterialSurface::SMC);
+                body->SetPos(ChVector<>(0.5 + i, 0.5 + j, 0.25 + 0.5 * k));
+                body->SetCollide(false);
+                sys.AddBody(body);
+                num_bodies++;
+            }
+        }
+    }
+
+    bool passed = true;
+    double max_shift = 0.5 * ghost_layer;
+    std::vector<double> points = sys.GetDomain()->GetSplitPoints();
+
+    for (int step = 0; step < 200; step++) {
+        sys.DoStepDynamics(dt);
+
+        // Every body is owned by exactly one rank
+        int owned = CountOwned(sys);
+        int total = 0;
+        MPI_Allreduce(&owned, &total, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+        if (total != num_bodies) {
+            if (my_rank == 0)
+                GetLog() << "Step " << step << ": " << total << " owned bodies, expected " << num_bodies << "\n";
+            passed = false;
+        }
+
+        // Boundaries move by at most max_shift and keep sub-domains at least two ghost layers long
+        const std::vector<double>& new_points = sys.GetDomain()->GetSplitPoints();
+        for (int r = 1; r < num_ranks; r++) {
+            if (std::abs(new_points[r] - points[r]) > max_shift + 1e-12) {
+                GetLog() << "Step " << step << ": boundary " << r << " moved by " << new_points[r] - points[r] << "\n";
+                passed = false;
+            }
+            if (new_points[r] - new_points[r - 1] < 2 * ghost_layer - 1e-12) {
+                GetLog() << "Step " << step << ": sub-domain " << r - 1 << " too short\n";
+                passed = false;
+            }
+        }
+        points = new_points;
+        if (!passed)
+            break;
+    }
+
+    // The load is balanced within the resolution of the body layers
+    int owned = CountOwned(sys);
+    int min_owned = 0;
+    int max_owned = 0;
+    MPI_Allreduce(&owned, &min_owned, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+    MPI_Allreduce(&owned, &max_owned, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD);
+    if (my_rank == 0)
+        GetLog() << "Owned bodies per rank: " << min_owned << " to " << max_owned << "\n";
+    if (num_ranks > 1 && max_owned - min_owned > 2 * 64) {
+        if (my_rank == 0)
+            GetLog() << "Load not balanced\n";
+        passed = false;
+    }
+
+    int all_passed = 0;
+    int local_passed = passed ? 1 : 0;
+    MPI_Allreduce(&local_passed, &all_passed, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+
+    MPI_Finalize();
+
+    // Return 0 if all tests passed.
+    return !all_passed;
+}
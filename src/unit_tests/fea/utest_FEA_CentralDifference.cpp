@@ -0,0 +1,151 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the lumped mass explicit central difference timestepper.
+// A free cube of tetrahedrons, initially stretched, falls under gravity:
+// - the lumped mass must add up to the mass of the mesh;
+// - the estimated critical step must be of the order of size/wave speed;
+// - the center of mass must follow the free fall parabola exactly, while
+//   the cube vibrates, even if the step is split in substeps.
+//
+// =============================================================================
+
+#include <vector>
+#include <cmath>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/timestepper/ChTimestepper.h"
+
+#include "chrono_fea/ChElementTetra_4.h"
+#include "chrono_fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+double size = 0.2;
+double E = 1e7;
+double density = 1000;
+double gacc = 9.81;
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+
+    ChSystemSMC system;
+    system.Set_G_acc(ChVector<>(0, -gacc, 0));
+
+    auto material = std::make_shared<ChContinuumElastic>();
+    material->Set_E(E);
+    material->Set_v(0.3);
+    material->Set_density(density);
+
+    auto mesh = std::make_shared<ChMesh>();
+
+    // Corners of the cube, indexed by bits (x,y,z). The cube is stretched along x
+    // with respect to the reference configuration, so that it vibrates.
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    for (int i = 0; i < 8; i++) {
+        ChVector<> corner(size * (i & 1), size * ((i >> 1) & 1), size * ((i >> 2) & 1));
+        auto node = std::make_shared<ChNodeFEAxyz>(corner);
+        nodes.push_back(node);
+        mesh->AddNode(node);
+    }
+
+    int tets[5][4] = {{0, 1, 2, 4}, {3, 1, 2, 7}, {5, 1, 4, 7}, {6, 2, 4, 7}, {1, 2, 4, 7}};
+    for (int i = 0; i < 5; i++) {
+        auto n1 = nodes[tets[i][0]];
+        auto n2 = nodes[tets[i][1]];
+        auto n3 = nodes[tets[i][2]];
+        auto n4 = nodes[tets[i][3]];
+        if (Vdot(n2->GetPos() - n1->GetPos(), Vcross(n3->GetPos() - n1->GetPos(), n4->GetPos() - n1->GetPos())) > 0)
+            std::swap(n3, n4);
+        auto element = std::make_shared<ChElementTetra_4>();
+        element->SetNodes(n1, n2, n3, n4);
+        element->SetMaterial(material);
+        mesh->AddElement(element);
+    }
+
+    system.Add(mesh);
+
+    system.SetTimestepperType(ChTimestepper::Type::CENTRAL_DIFFERENCE);
+    auto stepper = std::dynamic_pointer_cast<ChTimestepperCentralDifference>(system.GetTimestepper());
+    if (!stepper) {
+        GetLog() << "Central difference timestepper not created\n";
+        return 1;
+    }
+
+    system.SetupInitial();
+    system.Setup();
+
+    for (int i = 0; i < 8; i++) {
+        if (i & 1)
+            nodes[i]->SetPos(nodes[i]->GetPos() + ChVector<>(0.01 * size, 0, 0));
+    }
+
+    // Lumped mass of the whole mesh
+    ChVectorDynamic<> Md(system.GetNcoords_w());
+    system.LoadLumpedMass_Md(Md, 1.0);
+    double mass = size * size * size * density;
+    double lumped_mass = 0;
+    for (int i = 0; i < Md.GetRows(); i++)
+        lumped_mass += Md(i) / 3;
+    GetLog() << "mass: " << mass << "  lumped: " << lumped_mass << "\n";
+    if (std::abs(lumped_mass - mass) > 1e-9 * mass)
+        passed = false;
+
+    // Critical step, compared with the time for a wave to cross the cube
+    double dt_crit = system.ComputeCriticalTimeStep();
+    double dt_wave = size / std::sqrt(E / density);
+    GetLog() << "critical step: " << dt_crit << "  wave crossing time: " << dt_wave << "\n";
+    if (dt_crit < 0.05 * dt_wave || dt_crit > 2 * dt_wave)
+        passed = false;
+
+    // Center of mass of the lumped masses
+    auto GetCOM = [&]() {
+        ChVector<> com(0);
+        for (unsigned int i = 0; i < nodes.size(); i++)
+            com += nodes[i]->GetPos() * Md(nodes[i]->NodeGetOffset_w());
+        return com / lumped_mass;
+    };
+    ChVector<> com0 = GetCOM();
+
+    // Take steps larger than the critical one, to force substepping
+    double time_step = 4 * dt_crit;
+    int num_steps = 100;
+    for (int i = 0; i < num_steps; i++)
+        system.DoStepDynamics(time_step);
+
+    if (stepper->GetNumSubsteps() < 5) {
+        GetLog() << "substeps: " << stepper->GetNumSubsteps() << "\n";
+        passed = false;
+    }
+
+    double t = system.GetChTime();
+    ChVector<> com_exact = com0 + ChVector<>(0, -0.5 * gacc * t * t, 0);
+    double err = (GetCOM() - com_exact).Length();
+    GetLog() << "center of mass error: " << err << "\n";
+    if (err > 1e-9)
+        passed = false;
+
+    // Mesh must still be sane (stable integration): stretch bounded by the initial one
+    for (int i = 0; i < 8; i++) {
+        ChVector<> d = nodes[i]->GetPos() - nodes[0]->GetPos();
+        if (d.Length() > 2 * size) {
+            GetLog() << "node " << i << " unstable\n";
+            passed = false;
+        }
+    }
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
@@ -0,0 +1,142 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the mesh-level BVH of ChContactSurfaceMesh.
+// A cube of tetrahedrons is dropped on a fixed box, once with one collision
+// model per triangle and once with a single collision model (refit BVH) for the
+// whole contact surface. Both runs must generate contacts and bring the cube to
+// rest in the same configuration.
+//
+// =============================================================================
+
+#include <vector>
+#include <cmath>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChSolverMINRES.h"
+
+#include "chrono_fea/ChContactSurfaceMesh.h"
+#include "chrono_fea/ChElementTetra_4.h"
+#include "chrono_fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+double time_step = 1e-3;
+int num_steps = 200;
+
+double pos_tol = 1e-3;  // validation tolerance on node positions (0.5% of the cube size)
+
+// Simulate the falling cube, storing the number of contacts at each step and the final node positions.
+void SimulateCube(bool use_bvh, std::vector<int>& num_contacts, std::vector<ChVector<>>& positions) {
+    ChSystemSMC system;
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    auto mysurfmaterial = std::make_shared<ChMaterialSurfaceSMC>();
+    mysurfmaterial->SetYoungModulus(6e4);
+    mysurfmaterial->SetFriction(0.3f);
+    mysurfmaterial->SetRestitution(0.2f);
+
+    auto floor = std::make_shared<ChBodyEasyBox>(2, 0.1, 2, 2700, true);
+    floor->SetPos(ChVector<>(0, -0.05, 0));
+    floor->SetBodyFixed(true);
+    floor->SetMaterialSurface(mysurfmaterial);
+    system.Add(floor);
+
+    auto material = std::make_shared<ChContinuumElastic>();
+    material->Set_E(0.01e9);
+    material->Set_v(0.3);
+    material->Set_RayleighDampingK(0.003);
+    material->Set_density(1000);
+
+    auto mesh = std::make_shared<ChMesh>();
+
+    // Corners of the cube, indexed by bits (x,y,z), slightly tilted so that contacts change during the fall
+    ChQuaternion<> rot = Q_from_AngAxis(0.1, ChVector<>(1, 0, 1).GetNormalized());
+    std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+    for (int i = 0; i < 8; i++) {
+        ChVector<> corner(0.2 * (i & 1), 0.2 * ((i >> 1) & 1), 0.2 * ((i >> 2) & 1));
+        auto node = std::make_shared<ChNodeFEAxyz>(ChVector<>(0, 0.05, 0) + rot.Rotate(corner));
+        nodes.push_back(node);
+        mesh->AddNode(node);
+    }
+
+    // Five tetrahedrons per cube
+    int tets[5][4] = {{0, 1, 2, 4}, {3, 1, 2, 7}, {5, 1, 4, 7}, {6, 2, 4, 7}, {1, 2, 4, 7}};
+    for (int i = 0; i < 5; i++) {
+        auto n1 = nodes[tets[i][0]];
+        auto n2 = nodes[tets[i][1]];
+        auto n3 = nodes[tets[i][2]];
+        auto n4 = nodes[tets[i][3]];
+        // same node ordering convention as in the FEA demos
+        if (Vdot(n2->GetPos() - n1->GetPos(), Vcross(n3->GetPos() - n1->GetPos(), n4->GetPos() - n1->GetPos())) > 0)
+            std::swap(n3, n4);
+        auto element = std::make_shared<ChElementTetra_4>();
+        element->SetNodes(n1, n2, n3, n4);
+        element->SetMaterial(material);
+        mesh->AddElement(element);
+    }
+
+    auto contact_surf = std::make_shared<ChContactSurfaceMesh>();
+    mesh->AddContactSurface(contact_surf);
+    contact_surf->AddFacesFromBoundary(0.002);
+    contact_surf->SetMaterialSurface(mysurfmaterial);
+    contact_surf->SetUseMeshBVH(use_bvh);
+
+    system.Add(mesh);
+
+    auto solver = std::make_shared<ChSolverMINRES>();
+    solver->SetDiagonalPreconditioning(true);
+    system.SetSolver(solver);
+    system.SetMaxItersSolverSpeed(100);
+    system.SetTolForce(1e-10);
+
+    system.SetupInitial();
+
+    for (int i = 0; i < num_steps; i++) {
+        system.DoStepDynamics(time_step);
+        num_contacts.push_back(system.GetNcontacts());
+    }
+
+    for (auto node : nodes)
+        positions.push_back(node->GetPos());
+}
+
+int main(int argc, char* argv[]) {
+    std::vector<int> contacts_tri;
+    std::vector<int> contacts_bvh;
+    std::vector<ChVector<>> pos_tri;
+    std::vector<ChVector<>> pos_bvh;
+
+    SimulateCube(false, contacts_tri, pos_tri);
+    SimulateCube(true, contacts_bvh, pos_bvh);
+
+    bool passed = true;
+
+    GetLog() << "final contacts: per-triangle " << contacts_tri.back() << "  BVH " << contacts_bvh.back() << "\n";
+    if (contacts_tri.back() == 0 || contacts_tri.back() != contacts_bvh.back())
+        passed = false;
+
+    for (size_t i = 0; i < pos_tri.size(); i++) {
+        double err = (pos_tri[i] - pos_bvh[i]).Length();
+        if (err > pos_tol) {
+            GetLog() << "node " << (int)i << ": position error " << err << "\n";
+            passed = false;
+        }
+    }
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
@@ -0,0 +1,227 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the binary mesh files of ChMeshFileLoader.
+// Small TetGen and Abaqus meshes are written to disk, converted to the binary
+// format, then loaded both from text and from binary: the two meshes must have
+// the same nodes, the same tetrahedrons (with same node ordering) and the same
+// node sets.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <fstream>
+
+#include "chrono_fea/ChContinuumThermal.h"
+#include "chrono_fea/ChElementTetra_4.h"
+#include "chrono_fea/ChMesh.h"
+#include "chrono_fea/ChMeshFileLoader.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+typedef std::map<std::string, std::vector<std::shared_ptr<ChNodeFEAbase>>> NodeSets;
+
+// Position of a node, either with 3D motion or with scalar field.
+ChVector<> NodePos(std::shared_ptr<ChNodeFEAbase> node) {
+    if (auto mnode = std::dynamic_pointer_cast<ChNodeFEAxyz>(node))
+        return mnode->GetPos();
+    return std::static_pointer_cast<ChNodeFEAxyzP>(node)->GetPos();
+}
+
+// Index of a node in the mesh.
+int NodeIndex(std::shared_ptr<ChMesh> mesh, std::shared_ptr<ChNodeFEAbase> node) {
+    for (unsigned int i = 0; i < mesh->GetNnodes(); i++)
+        if (mesh->GetNodes()[i] == node)
+            return i;
+    return -1;
+}
+
+bool CompareMeshes(std::shared_ptr<ChMesh> mesh_a,
+                   std::shared_ptr<ChMesh> mesh_b,
+                   NodeSets& sets_a,
+                   NodeSets& sets_b,
+                   const std::string& label) {
+    bool passed = true;
+    if (mesh_a->GetNnodes() != mesh_b->GetNnodes() || mesh_a->GetNelements() != mesh_b->GetNelements()) {
+        GetLog() << label << ": different number of nodes or elements\n";
+        return false;
+    }
+    for (unsigned int i = 0; i < mesh_a->GetNnodes(); i++) {
+        if ((NodePos(mesh_a->GetNodes()[i]) - NodePos(mesh_b->GetNodes()[i])).Length() > 1e-12) {
+            GetLog() << label << ": different position of node " << i << "\n";
+            passed = false;
+        }
+    }
+    for (unsigned int ie = 0; ie < mesh_a->GetNelements(); ie++) {
+        for (int in = 0; in < 4; in++) {
+            if (NodeIndex(mesh_a, mesh_a->GetElement(ie)->GetNodeN(in)) !=
+                NodeIndex(mesh_b, mesh_b->GetElement(ie)->GetNodeN(in))) {
+                GetLog() << label << ": different nodes in element " << ie << "\n";
+                passed = false;
+            }
+        }
+    }
+    if (sets_a.size() != sets_b.size()) {
+        GetLog() << label << ": different number of node sets\n";
+        return false;
+    }
+    for (auto& set : sets_a) {
+        auto& other = sets_b[set.first];
+        if (set.second.size() != other.size()) {
+            GetLog() << label << ": different size of node set " << set.first << "\n";
+            passed = false;
+            continue;
+        }
+        for (size_t i = 0; i < set.second.size(); i++)
+            if (NodeIndex(mesh_a, set.second[i]) != NodeIndex(mesh_b, other[i]))
+                passed = false;
+    }
+    return passed;
+}
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+
+    // A cube of 5 tetrahedrons
+    {
+        std::ofstream fnode("utest_binmesh.node");
+        fnode << "# cube\n8 3 0 0\n";
+        for (int i = 0; i < 8; i++)
+            fnode << i + 1 << " " << (i & 1) << " " << ((i >> 1) & 1) << " " << ((i >> 2) & 1) << "\n";
+        std::ofstream fele("utest_binmesh.ele");
+        fele << "5 4 0\n1 1 2 3 5\n2 4 2 3 8\n3 6 2 5 8\n4 7 3 5 8\n5 2 3 5 8\n";
+
+        std::ofstream finp("utest_binmesh.inp");
+        finp << "*NODE, NSET=ALLNODES\n";
+        for (int i = 0; i < 8; i++)
+            finp << i + 10 << ", " << (i & 1) << ", " << ((i >> 1) & 1) << ", " << ((i >> 2) & 1) << "\n";
+        finp << "*ELEMENT, TYPE=C3D4, ELSET=CUBE\n";
+        finp << "1, 10, 11, 12, 14\n2, 13, 11, 12, 17\n3, 15, 11, 14, 17\n4, 16, 12, 14, 17\n5, 11, 12, 14, 17\n";
+        finp << "*NSET, NSET=BOTTOM\n10, 11, 12, 13\n*NSET, NSET=TOP\n14, 15, 16, 17\n";
+    }
+
+    ChMeshFileLoader::TetGenToBinaryFile("utest_binmesh.node", "utest_binmesh.ele", "utest_binmesh_tetgen.bin");
+    ChMeshFileLoader::AbaqusToBinaryFile("utest_binmesh.inp", "utest_binmesh_abaqus.bin");
+
+    auto elastic = std::make_shared<ChContinuumElastic>();
+    auto poisson = std::make_shared<ChContinuumThermal>();
+    ChVector<> pos(1, 2, 3);
+    ChMatrix33<> rot(Q_from_AngAxis(0.3, VECT_Y));
+
+    // TetGen
+    {
+        auto mesh_txt = std::make_shared<ChMesh>();
+        auto mesh_bin = std::make_shared<ChMesh>();
+        NodeSets sets_txt;
+        NodeSets sets_bin;
+        ChMeshFileLoader::FromTetGenFile(mesh_txt, "utest_binmesh.node", "utest_binmesh.ele", elastic, pos, rot);
+        ChMeshFileLoader::FromBinaryFile(mesh_bin, "utest_binmesh_tetgen.bin", elastic, sets_bin, pos, rot);
+        passed &= CompareMeshes(mesh_txt, mesh_bin, sets_txt, sets_bin, "TetGen");
+    }
+
+    // Abaqus, elastic and thermal
+    for (int im = 0; im < 2; im++) {
+        std::shared_ptr<ChContinuumMaterial> material = im ? std::static_pointer_cast<ChContinuumMaterial>(poisson)
+                                                           : std::static_pointer_cast<ChContinuumMaterial>(elastic);
+        auto mesh_txt = std::make_shared<ChMesh>();
+        auto mesh_bin = std::make_shared<ChMesh>();
+        NodeSets sets_txt;
+        NodeSets sets_bin;
+        ChMeshFileLoader::FromAbaqusFile(mesh_txt, "utest_binmesh.inp", material, sets_txt);
+        ChMeshFileLoader::FromBinaryFile(mesh_bin, "utest_binmesh_abaqus.bin", material, sets_bin);
+        passed &= CompareMeshes(mesh_txt, mesh_bin, sets_txt, sets_bin, im ? "Abaqus thermal" : "Abaqus elastic");
+    }
+
+    // Save a mesh, then load it back
+    {
+        auto mesh_bin = std::make_shared<ChMesh>();
+        auto mesh_copy = std::make_shared<ChMesh>();
+        NodeSets sets_bin;
+        NodeSets sets_copy;
+        ChMeshFileLoader::FromBinaryFile(mesh_bin, "utest_binmesh_abaqus.bin", elastic, sets_bin);
+        ChMeshFileLoader::ToBinaryFile(mesh_bin, "utest_binmesh_copy.bin", sets_bin);
+        ChMeshFileLoader::FromBinaryFile(mesh_copy, "utest_binmesh_copy.bin", elastic, sets_copy);
+        passed &= CompareMeshes(mesh_bin, mesh_copy, sets_bin, sets_copy, "Save and load");
+    }
+
+    // Save again a thermal mesh loaded from an Abaqus binary file: the Abaqus node order must be kept,
+    // so that the copy still loads like the original with both types of material
+    {
+        auto mesh_bin = std::make_shared<ChMesh>();
+        NodeSets sets_bin;
+        bool abaqus_order = false;
+        ChMeshFileLoader::FromBinaryFile(mesh_bin, "utest_binmesh_abaqus.bin", poisson, sets_bin, VNULL,
+                                         ChMatrix33<>(1), &abaqus_order);
+        if (!abaqus_order) {
+            GetLog() << "Abaqus node order flag not read\n";
+            passed = false;
+        }
+        ChMeshFileLoader::ToBinaryFile(mesh_bin, "utest_binmesh_copy.bin", sets_bin, abaqus_order);
+
+        for (int im = 0; im < 2; im++) {
+            std::shared_ptr<ChContinuumMaterial> material =
+                im ? std::static_pointer_cast<ChContinuumMaterial>(poisson)
+                   : std::static_pointer_cast<ChContinuumMaterial>(elastic);
+            auto mesh_txt = std::make_shared<ChMesh>();
+            auto mesh_copy = std::make_shared<ChMesh>();
+            NodeSets sets_txt;
+            NodeSets sets_copy;
+            ChMeshFileLoader::FromAbaqusFile(mesh_txt, "utest_binmesh.inp", material, sets_txt);
+            ChMeshFileLoader::FromBinaryFile(mesh_copy, "utest_binmesh_copy.bin", material, sets_copy);
+            passed &= CompareMeshes(mesh_txt, mesh_copy, sets_txt, sets_copy,
+                                    im ? "Save thermal, load thermal" : "Save thermal, load elastic");
+        }
+    }
+
+    // A truncated file must be rejected
+    {
+        std::ifstream fin("utest_binmesh_tetgen.bin", std::ios::binary);
+        std::string content((std::istreambuf_iterator<char>(fin)), std::istreambuf_iterator<char>());
+        std::ofstream fout("utest_binmesh_truncated.bin", std::ios::binary);
+        fout.write(content.data(), content.size() / 2);
+    }
+    try {
+        auto mesh = std::make_shared<ChMesh>();
+        ChMeshFileLoader::FromBinaryFile(mesh, "utest_binmesh_truncated.bin", elastic);
+        GetLog() << "Truncated file not detected\n";
+        passed = false;
+    } catch (ChException&) {
+    }
+
+    // A header with a number of nodes whose size in bytes overflows must be rejected
+    {
+        std::ifstream fin("utest_binmesh_tetgen.bin", std::ios::binary);
+        std::string content((std::istreambuf_iterator<char>(fin)), std::istreambuf_iterator<char>());
+        uint64_t nnodes = 0x2000000000000001ULL;  // nnodes * 24 wraps around to 24
+        content.replace(16, sizeof(uint64_t), (const char*)&nnodes, sizeof(uint64_t));
+        std::ofstream fout("utest_binmesh_overflow.bin", std::ios::binary);
+        fout.write(content.data(), content.size());
+    }
+    try {
+        auto mesh = std::make_shared<ChMesh>();
+        ChMeshFileLoader::FromBinaryFile(mesh, "utest_binmesh_overflow.bin", elastic);
+        GetLog() << "Overflowing node count not detected\n";
+        passed = false;
+    } catch (ChException&) {
+    }
+
+    for (auto name : {"utest_binmesh.node", "utest_binmesh.ele", "utest_binmesh.inp", "utest_binmesh_tetgen.bin",
+                      "utest_binmesh_abaqus.bin", "utest_binmesh_copy.bin", "utest_binmesh_truncated.bin",
+                      "utest_binmesh_overflow.bin"})
+        std::remove(name);
+
+    GetLog() << "Test " << (passed ? "PASSED" : "FAILED") << "\n";
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
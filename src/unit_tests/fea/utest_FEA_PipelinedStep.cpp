@@ -0,0 +1,146 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the pipelined step: a mixed scene (ANCF cable hanging from a
+// pin, boxes sliding and colliding on the ground, a pendulum, body loads) is
+// simulated with and without overlapping collision detection and the update of
+// independent items, for several thread numbers. The trajectories must match.
+//
+// =============================================================================
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "chrono/parallel/ChTaskScheduler.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChLoadContainer.h"
+#include "chrono/physics/ChLoadsBody.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono_fea/ChBuilderBeam.h"
+#include "chrono_fea/ChLinkPointFrame.h"
+#include "chrono_fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+const int num_steps = 300;
+
+// Simulate the scene and return the final positions of all bodies and nodes.
+std::vector<double> Simulate(bool pipelining, int num_threads) {
+    ChSystemNSC system;
+    system.SetParallelThreadNumber(num_threads);
+    system.SetUsePipelining(pipelining);
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    system.SetSolverType(ChSolver::Type::MINRES);
+    system.SetSolverWarmStarting(true);
+    system.SetMaxItersSolverSpeed(200);
+    system.SetTolForce(1e-10);
+
+    auto ground = std::make_shared<ChBodyEasyBox>(20, 1, 20, 1000, true);
+    ground->SetBodyFixed(true);
+    ground->SetPos(ChVector<>(0, -0.5, 0));
+    system.AddBody(ground);
+
+    auto loads = std::make_shared<ChLoadContainer>();
+    system.Add(loads);
+
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    for (int i = 0; i < 6; i++) {
+        auto box = std::make_shared<ChBodyEasyBox>(0.4, 0.2, 0.4, 500, true);
+        box->SetPos(ChVector<>(0.6 * i - 2, 0.11 + 0.2 * (i % 2), 1));
+        box->SetPos_dt(ChVector<>(i % 2 ? -1.0 : 1.0, 0, 0));
+        system.AddBody(box);
+        bodies.push_back(box);
+        loads->Add(std::make_shared<ChLoadBodyForce>(box, ChVector<>(0, 0, -5.0 * i), false, box->GetPos(), false));
+    }
+
+    auto bob = std::make_shared<ChBodyEasySphere>(0.1, 1000, false);
+    bob->SetPos(ChVector<>(0.5, 2, -1));
+    system.AddBody(bob);
+    bodies.push_back(bob);
+    auto pin = std::make_shared<ChLinkLockRevolute>();
+    pin->Initialize(ground, bob, ChCoordsys<>(ChVector<>(0, 2, -1), QUNIT));
+    system.AddLink(pin);
+
+    auto mesh = std::make_shared<ChMesh>();
+    auto section = std::make_shared<ChBeamSectionCable>();
+    section->SetDiameter(0.02);
+    section->SetYoungModulus(1e7);
+    section->SetDensity(1000);
+    section->SetBeamRaleyghDamping(0.01);
+    ChBuilderBeamANCF builder;
+    builder.BuildBeam(mesh, section, 10, ChVector<>(0, 2, 2), ChVector<>(1, 2, 2));
+    system.Add(mesh);
+
+    auto hinge = std::make_shared<ChLinkPointFrame>();
+    hinge->Initialize(builder.GetLastBeamNodes().front(), ground);
+    system.Add(hinge);
+
+    system.SetupInitial();
+    for (int i = 0; i < num_steps; i++)
+        system.DoStepDynamics(1e-3);
+
+    std::vector<double> state;
+    for (auto& body : bodies) {
+        state.push_back(body->GetPos().x());
+        state.push_back(body->GetPos().y());
+        state.push_back(body->GetPos().z());
+    }
+    for (auto& node : builder.GetLastBeamNodes()) {
+        state.push_back(node->GetPos().x());
+        state.push_back(node->GetPos().y());
+        state.push_back(node->GetPos().z());
+    }
+    state.push_back(system.GetNcontacts());
+    return state;
+}
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+
+    // The shared task pool is sized explicitly; systems only limit their use of it.
+    ChTaskScheduler::GetInstance().SetNumThreads(4);
+
+    auto reference = Simulate(false, 1);
+    std::cout << "Contacts: " << reference.back() << std::endl;
+    if (reference.back() == 0) {
+        std::cout << "no contacts in the test scene" << std::endl;
+        passed = false;
+    }
+    for (auto value : reference) {
+        if (!std::isfinite(value)) {
+            std::cout << "reference simulation diverged" << std::endl;
+            passed = false;
+            break;
+        }
+    }
+
+    for (int num_threads : {1, 2, 4}) {
+        auto state = Simulate(true, num_threads);
+        double max_diff = 0;
+        for (size_t i = 0; i < state.size(); i++)
+            max_diff = std::max(max_diff, std::abs(state[i] - reference[i]));
+        std::cout << "Threads: " << num_threads << "  max difference: " << max_diff << std::endl;
+        passed &= (max_diff == 0);
+        if (ChTaskScheduler::GetInstance().GetNumThreads() != 4) {
+            std::cout << "task pool resized by the system" << std::endl;
+            passed = false;
+        }
+    }
+
+    std::cout << (passed ? "PASSED" : "FAILED") << std::endl;
+    return passed ? 0 : 1;
+}
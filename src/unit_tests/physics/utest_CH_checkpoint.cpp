@@ -0,0 +1,162 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for binary checkpoint/restart.
+//
+// A simulation is checkpointed part way; a second, identically constructed system
+// is restored from the checkpoint and both are advanced further. The test checks
+// that the restored run continues the original one exactly (pendulum chain with
+// HHT and adaptive step size) or closely (boxes sliding on the ground, as contact
+// points are regenerated by collision detection).
+//
+// =============================================================================
+
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverMINRES.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono/utils/ChUtilsInputOutput.h"
+
+using namespace chrono;
+
+// -----------------------------------------------------------------------------
+
+void CreateChain(ChSystemNSC& system) {
+    auto ground = std::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    std::shared_ptr<ChBody> prev = ground;
+    for (int i = 0; i < 5; i++) {
+        auto body = std::make_shared<ChBody>();
+        body->SetMass(1 + 0.1 * i);
+        body->SetInertiaXX(ChVector<>(0.1, 0.1, 0.1));
+        body->SetPos(ChVector<>(i + 0.5, 0, 0));
+        system.AddBody(body);
+
+        auto joint = std::make_shared<ChLinkLockRevolute>();
+        joint->Initialize(prev, body, ChCoordsys<>(ChVector<>(i, 0, 0), QUNIT));
+        system.AddLink(joint);
+        prev = body;
+    }
+
+    auto solver = std::make_shared<ChSolverMINRES>();
+    solver->SetMaxIterations(200);
+    solver->SetTolerance(1e-12);
+    system.SetSolver(solver);
+
+    system.SetTimestepperType(ChTimestepper::Type::HHT);
+    auto integrator = std::static_pointer_cast<ChTimestepperHHT>(system.GetTimestepper());
+    integrator->SetAlpha(-0.2);
+    integrator->SetMaxiters(20);
+    integrator->SetAbsTolerances(1e-6);
+    integrator->SetStepControl(true);
+}
+
+void CreateBoxes(ChSystemNSC& system) {
+    auto ground = std::make_shared<ChBodyEasyBox>(10, 1, 10, 1000, true);
+    ground->SetPos(ChVector<>(0, -0.5, 0));
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    for (int i = 0; i < 8; i++) {
+        auto box = std::make_shared<ChBodyEasyBox>(0.5, 0.5, 0.5, 1000, true);
+        box->SetPos(ChVector<>(0.8 * i - 3, 0.3 + 0.05 * i, 0));
+        box->SetPos_dt(ChVector<>(1, 0, 0.5));
+        system.AddBody(box);
+    }
+
+    system.SetSolverType(ChSolver::Type::SOR);
+    system.SetMaxItersSolverSpeed(50);
+    system.SetSolverWarmStarting(true);
+}
+
+// Maximum difference between the states of two systems.
+double StateDifference(ChSystemNSC& s1, ChSystemNSC& s2) {
+    double diff = std::abs(s1.GetChTime() - s2.GetChTime());
+    for (size_t i = 0; i < s1.Get_bodylist().size(); i++) {
+        auto b1 = s1.Get_bodylist()[i];
+        auto b2 = s2.Get_bodylist()[i];
+        diff = std::max(diff, (b1->GetPos() - b2->GetPos()).LengthInf());
+        diff = std::max(diff, (b1->GetPos_dt() - b2->GetPos_dt()).LengthInf());
+        diff = std::max(diff, (b1->GetRot() - b2->GetRot()).Length());
+    }
+    return diff;
+}
+
+bool TestRestart(void (*create)(ChSystemNSC&), double step, int num_steps, double tolerance, const char* name) {
+    const char* filename = "checkpoint_test.bin";
+
+    ChSystemNSC system1;
+    create(system1);
+    for (int i = 0; i < num_steps; i++)
+        system1.DoStepDynamics(step);
+    utils::WriteBinaryCheckpoint(&system1, filename);
+
+    ChSystemNSC system2;
+    create(system2);
+    utils::ReadBinaryCheckpoint(&system2, filename);
+    double diff0 = StateDifference(system1, system2);
+    if (system2.GetStepcount() != system1.GetStepcount()) {
+        std::cout << name << ": step count not restored" << std::endl;
+        return false;
+    }
+
+    for (int i = 0; i < num_steps; i++) {
+        system1.DoStepDynamics(step);
+        system2.DoStepDynamics(step);
+    }
+    double diff = StateDifference(system1, system2);
+    std::remove(filename);
+
+    std::cout << name << ": state difference at restart " << diff0 << ", after " << num_steps << " steps " << diff
+              << std::endl;
+    return diff0 == 0 && diff <= tolerance;
+}
+
+// Restoring into a system with a different topology must fail.
+bool TestMismatch() {
+    const char* filename = "checkpoint_test.bin";
+
+    ChSystemNSC system1;
+    CreateChain(system1);
+    utils::WriteBinaryCheckpoint(&system1, filename);
+
+    ChSystemNSC system2;
+    CreateBoxes(system2);
+    bool thrown = false;
+    try {
+        utils::ReadBinaryCheckpoint(&system2, filename);
+    } catch (const ChException&) {
+        thrown = true;
+    }
+    std::remove(filename);
+
+    if (!thrown)
+        std::cout << "topology mismatch not detected" << std::endl;
+    return thrown;
+}
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+    passed &= TestRestart(CreateChain, 1e-2, 100, 0, "chain");
+    passed &= TestRestart(CreateBoxes, 1e-3, 300, 1e-6, "boxes");
+    passed &= TestMismatch();
+
+    std::cout << (passed ? "PASSED" : "FAILED") << std::endl;
+    return passed ? 0 : 1;
+}
@@ -0,0 +1,239 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for the compact binary particle output.
+//
+// A pile of spheres settling in a container is written at each step (with a
+// body added part way). The frames read back, in sequence and in random order,
+// must match the recorded states within the quantization errors; a truncated
+// file must give the complete frames; the converted files must have the layout
+// of those written by WriteBodies and WriteShapesPovray.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "chrono/assets/ChColorAsset.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/utils/ChParticleOutput.h"
+#include "chrono/utils/ChUtilsCreators.h"
+#include "chrono/utils/ChUtilsInputOutput.h"
+
+using namespace chrono;
+using namespace chrono::utils;
+
+const double resolution = 1e-5;
+const int num_frames = 60;
+
+struct State {
+    double time;
+    std::vector<int> identifiers;
+    std::vector<ChVector<>> pos;
+    std::vector<ChQuaternion<>> rot;
+    std::vector<ChVector<>> vel;
+    std::vector<ChVector<>> wvel;
+};
+
+std::shared_ptr<ChBody> AddSphere(ChSystemNSC& system, int id, const ChVector<>& pos) {
+    auto ball = std::make_shared<ChBodyEasySphere>(0.05, 1000, true);
+    ball->SetIdentifier(id);
+    ball->SetPos(pos);
+    ball->SetRot(Q_from_AngAxis(0.1 * id, ChVector<>(1, 2, 3).GetNormalized()));
+    ball->SetWvel_loc(ChVector<>(0.3 * id, 0, 1));
+    ball->AddAsset(std::make_shared<ChColorAsset>(0.1f, 0.002f * id, 0.5f));
+    system.AddBody(ball);
+    return ball;
+}
+
+size_t CountLines(const std::string& filename) {
+    std::ifstream file(filename);
+    std::string line;
+    size_t count = 0;
+    while (std::getline(file, line))
+        count++;
+    return count;
+}
+
+bool CheckFrame(const ChParticleFrame& frame, const State& state) {
+    size_t n = state.pos.size();
+    if (frame.GetNumParticles() != n || frame.time != state.time || frame.identifiers != state.identifiers ||
+        frame.rot.size() != n || frame.vel.size() != n || frame.wvel.size() != n || frame.shapes.size() != n ||
+        frame.active.size() != n) {
+        std::cout << "frame at time " << state.time << ": invalid data" << std::endl;
+        return false;
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        double pos_err = (frame.pos[i] - state.pos[i]).LengthInf();
+        // Angle between the two rotations.
+        double dot = std::abs(frame.rot[i] ^ state.rot[i]);
+        double rot_err = 2 * std::acos(std::min(1.0, dot));
+        double vel_err = (frame.vel[i] - state.vel[i]).LengthInf() / (1 + state.vel[i].LengthInf());
+        double wvel_err = (frame.wvel[i] - state.wvel[i]).LengthInf() / (1 + state.wvel[i].LengthInf());
+        // The container (identifier -1) has box shapes, the particles a sphere and a color.
+        const ChParticleShape& shape = frame.shapes[i];
+        bool shape_ok = state.identifiers[i] < 0 ? shape.type == 2
+                                                  : shape.type == 0 && shape.dims[0] == 0.05f &&
+                                                        shape.color.G == 0.002f * state.identifiers[i];
+        if (pos_err > 0.5 * resolution * (1 + 1e-9) || rot_err > 5e-3 || vel_err > 1e-6 || wvel_err > 1e-6 ||
+            !shape_ok) {
+            std::cout << "frame at time " << state.time << ", particle " << i << ": errors " << pos_err << " "
+                      << rot_err << " " << vel_err << " " << wvel_err << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SameFrame(const ChParticleFrame& a, const ChParticleFrame& b) {
+    return a.time == b.time && a.identifiers == b.identifiers && a.active == b.active && a.pos == b.pos &&
+           a.vel == b.vel && a.wvel == b.wvel && a.rot.size() == b.rot.size() &&
+           std::equal(a.rot.begin(), a.rot.end(), b.rot.begin());
+}
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+    std::string filename = "particle_output.dat";
+
+    ChSystemNSC system;
+    system.Set_G_acc(ChVector<>(0, 0, -9.81));
+    auto mat = std::make_shared<ChMaterialSurfaceNSC>();
+    CreateBoxContainer(&system, -1, mat, ChVector<>(0.5, 0.5, 0.5), 0.05);
+    system.Get_bodylist()[0]->SetIdentifier(-1);
+    int id = 0;
+    for (int k = 0; k < 3; k++)
+        for (int i = 0; i < 8; i++)
+            for (int j = 0; j < 8; j++)
+                AddSphere(system, id++, ChVector<>(-0.4 + 0.11 * i, -0.4 + 0.11 * j, 0.1 + 0.11 * k));
+
+    // Write a frame at each step; small key frame interval and bound on pending frames.
+    std::vector<State> states;
+    size_t csv_size = 0;
+    {
+        ChParticleWriter writer(filename, PARTICLE_ALL, resolution, 16, 1 << 12);
+        for (int f = 0; f < num_frames; f++) {
+            if (f == 37)
+                AddSphere(system, id++, ChVector<>(0, 0, 0.6));
+            system.DoStepDynamics(2e-3);
+            writer.WriteFrame(&system);
+
+            State state;
+            state.time = system.GetChTime();
+            for (auto body : system.Get_bodylist()) {
+                state.identifiers.push_back(body->GetIdentifier());
+                state.pos.push_back(body->GetPos());
+                state.rot.push_back(body->GetRot());
+                state.vel.push_back(body->GetPos_dt());
+                state.wvel.push_back(body->GetWvel_loc());
+            }
+            states.push_back(state);
+
+            if (f == 0) {
+                WriteBodies(&system, "particle_output_ref.csv", false, true);
+                std::ifstream ref("particle_output_ref.csv", std::ios::binary | std::ios::ate);
+                csv_size = (size_t)ref.tellg();
+            }
+        }
+        writer.Close();
+        std::cout << "Frames: " << writer.GetNumFrames() << "  bytes: " << writer.GetNumBytes()
+                  << "  (CSV frame: " << csv_size << " bytes)" << std::endl;
+        if (writer.GetNumBytes() * 2 > csv_size * num_frames) {
+            std::cout << "output not compact" << std::endl;
+            passed = false;
+        }
+    }
+
+    // Sequential reading.
+    std::vector<ChParticleFrame> frames(num_frames);
+    {
+        ChParticleReader reader(filename);
+        if (reader.GetNumFrames() != (size_t)num_frames || reader.GetFields() != PARTICLE_ALL) {
+            std::cout << "invalid number of frames or fields" << std::endl;
+            return 1;
+        }
+        for (int f = 0; f < num_frames; f++) {
+            reader.ReadFrame(f, frames[f]);
+            passed &= CheckFrame(frames[f], states[f]);
+        }
+
+        // Random access, and selection of fields.
+        for (size_t f : {59, 3, 40, 37, 36, 36, 15, 16, 0}) {
+            ChParticleFrame frame;
+            reader.ReadFrame(f, frame);
+            if (!SameFrame(frame, frames[f])) {
+                std::cout << "random access to frame " << f << " failed" << std::endl;
+                passed = false;
+            }
+        }
+        ChParticleFrame frame;
+        reader.ReadFrame(20, frame, PARTICLE_ROTATION);
+        if (frame.pos != frames[20].pos || !frame.identifiers.empty() || !frame.vel.empty() || frame.rot.empty()) {
+            std::cout << "selection of fields failed" << std::endl;
+            passed = false;
+        }
+    }
+
+    // Truncated file: the incomplete last frame is ignored.
+    {
+        std::ifstream in(filename, std::ios::binary);
+        std::vector<char> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        std::ofstream out("particle_output_cut.dat", std::ios::binary);
+        out.write(data.data(), data.size() - 10);
+        out.close();
+
+        ChParticleReader reader("particle_output_cut.dat");
+        ChParticleFrame frame;
+        reader.ReadFrame(num_frames - 2, frame);
+        if (reader.GetNumFrames() != (size_t)num_frames - 1 || !SameFrame(frame, frames[num_frames - 2])) {
+            std::cout << "truncated file not handled" << std::endl;
+            passed = false;
+        }
+    }
+
+    // Conversion to the CSV outputs.
+    if (ConvertParticleOutput(filename, "particle_output_pov", true) != (size_t)num_frames ||
+        ConvertParticleOutput(filename, "particle_output_csv", false) != (size_t)num_frames) {
+        std::cout << "conversion failed" << std::endl;
+        passed = false;
+    }
+    size_t n = frames.back().GetNumParticles();
+    size_t pov_lines = CountLines("particle_output_pov_0059.dat");
+    size_t csv_lines = CountLines("particle_output_csv_0000.dat");
+    std::cout << "POV-Ray lines: " << pov_lines << "  CSV lines: " << csv_lines << " (reference "
+              << CountLines("particle_output_ref.csv") << ")" << std::endl;
+    // A header, then one line per body and one per shape (only the first of the container).
+    if (pov_lines != 1 + 2 * n || csv_lines != CountLines("particle_output_ref.csv")) {
+        std::cout << "converted files do not match" << std::endl;
+        passed = false;
+    }
+
+    for (int f = 0; f < num_frames; f++) {
+        char name[64];
+        std::sprintf(name, "particle_output_pov_%04d.dat", f);
+        std::remove(name);
+        std::sprintf(name, "particle_output_csv_%04d.dat", f);
+        std::remove(name);
+    }
+    std::remove("particle_output_ref.csv");
+    std::remove("particle_output_cut.dat");
+    std::remove(filename.c_str());
+
+    std::cout << (passed ? "PASSED" : "FAILED") << std::endl;
+    return passed ? 0 : 1;
+}
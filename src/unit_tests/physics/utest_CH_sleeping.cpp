@@ -0,0 +1,169 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the sleeping of islands of bodies.
+// Two stacks of boxes rest on a fixed ground and fall asleep: their bodies must
+// not be in the system descriptor and must not move. Then a ball is thrown on
+// one of the stacks: all the bodies of that stack must wake at the same step,
+// while the other stack keeps sleeping. The contacts of the woken stack are added
+// in the same step, without a second call to the custom collision callbacks and
+// without removing the contacts already collected.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <vector>
+
+#include "chrono/core/ChLog.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+
+double time_step = 1e-2;
+
+// Create a stack of 'n' unit boxes, centered in (x, 0, 0) on the ground.
+std::vector<std::shared_ptr<ChBody>> CreateStack(ChSystem& system, double x, int n) {
+    std::vector<std::shared_ptr<ChBody>> stack;
+    for (int i = 0; i < n; i++) {
+        auto box = std::make_shared<ChBodyEasyBox>(1, 1, 1, 1000, true, false);
+        box->SetPos(ChVector<>(x, 0.5 + i, 0));
+        system.AddBody(box);
+        stack.push_back(box);
+    }
+    return stack;
+}
+
+int CountSleeping(const std::vector<std::shared_ptr<ChBody>>& bodies) {
+    int n = 0;
+    for (auto& body : bodies)
+        n += body->GetSleeping() ? 1 : 0;
+    return n;
+}
+
+bool InDescriptor(ChSystem& system, const std::vector<std::shared_ptr<ChBody>>& bodies) {
+    auto& variables = system.GetSystemDescriptor()->GetVariablesList();
+    for (auto& body : bodies) {
+        if (std::find(variables.begin(), variables.end(), &body->Variables()) != variables.end())
+            return true;
+    }
+    return false;
+}
+
+// Custom collision callback counting its calls and the contacts collected when it is invoked.
+class CollisionCounter : public ChSystem::CustomCollisionCallback {
+  public:
+    CollisionCounter() : num_calls(0), num_contacts(0) {}
+    virtual void OnCustomCollision(ChSystem* msys) override {
+        num_calls++;
+        num_contacts = msys->GetContactContainer()->GetNcontacts();
+    }
+    int num_calls;
+    int num_contacts;
+};
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+
+    ChSystemNSC system;
+    system.SetUseSleeping(true);
+
+    CollisionCounter counter;
+    system.RegisterCustomCollisionCallback(&counter);
+
+    auto ground = std::make_shared<ChBodyEasyBox>(20, 1, 20, 1000, true, false);
+    ground->SetPos(ChVector<>(0, -0.5, 0));
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    auto stackA = CreateStack(system, 0, 3);
+    auto stackB = CreateStack(system, 4, 3);
+
+    // Let the stacks come to rest and fall asleep
+    while (system.GetChTime() < 2)
+        system.DoStepDynamics(time_step);
+
+    GetLog() << "Sleeping bodies: " << system.GetNbodiesSleeping() << "\n";
+    if (CountSleeping(stackA) != 3 || CountSleeping(stackB) != 3 || system.GetNbodiesSleeping() != 6) {
+        GetLog() << "The stacks did not fall asleep\n";
+        passed = false;
+    }
+    if (InDescriptor(system, stackA) || InDescriptor(system, stackB)) {
+        GetLog() << "Sleeping bodies in the system descriptor\n";
+        passed = false;
+    }
+
+    // Sleeping bodies do not move
+    ChVector<> posA = stackA[2]->GetPos();
+    for (int i = 0; i < 10; i++)
+        system.DoStepDynamics(time_step);
+    if (!(stackA[2]->GetPos() == posA)) {
+        GetLog() << "A sleeping body moved\n";
+        passed = false;
+    }
+
+    // Throw a ball on stack A
+    auto ball = std::make_shared<ChBodyEasySphere>(0.25, 1000, true, false);
+    ball->SetPos(ChVector<>(0, 4, 0));
+    ball->SetPos_dt(ChVector<>(0, -2, 0));
+    system.AddBody(ball);
+
+    bool woken = false;
+    while (system.GetChTime() < 3.5 && !woken) {
+        int num_calls = counter.num_calls;
+        system.DoStepDynamics(time_step);
+        int nsleepA = CountSleeping(stackA);
+        if (nsleepA < 3) {
+            woken = true;
+            GetLog() << "Stack A woken at time " << system.GetChTime() << ", contacts " << counter.num_contacts
+                     << " -> " << system.GetNcontacts() << "\n";
+            if (counter.num_calls != num_calls + 1) {
+                GetLog() << "Custom collision callback invoked " << counter.num_calls - num_calls
+                         << " times in the step\n";
+                passed = false;
+            }
+            if (system.GetNcontacts() <= counter.num_contacts) {
+                GetLog() << "Contacts of the woken bodies not added\n";
+                passed = false;
+            }
+            if (nsleepA != 0) {
+                GetLog() << "Stack A only partially woken (" << nsleepA << " bodies sleeping)\n";
+                passed = false;
+            }
+            if (!InDescriptor(system, stackA)) {
+                GetLog() << "Woken bodies not in the system descriptor\n";
+                passed = false;
+            }
+        }
+    }
+    if (!woken) {
+        GetLog() << "Stack A not woken by the ball\n";
+        passed = false;
+    }
+    if (CountSleeping(stackB) != 3) {
+        GetLog() << "Stack B woken\n";
+        passed = false;
+    }
+
+    // The woken stack keeps standing
+    for (int i = 0; i < 50; i++)
+        system.DoStepDynamics(time_step);
+    if (stackA[2]->GetPos().y() < 2.4) {
+        GetLog() << "Stack A collapsed: top box at " << stackA[2]->GetPos().y() << "\n";
+        passed = false;
+    }
+
+    GetLog() << (passed ? "PASSED\n" : "FAILED\n");
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
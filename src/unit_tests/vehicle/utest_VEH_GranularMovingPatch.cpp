@@ -0,0 +1,128 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the particle relocation of the GranularTerrain moving patch.
+// The patch is moved several times by advancing the monitored body. At each
+// move, the relocated particles must be inside the new front slab, without
+// overlaps, and their pattern must vary from one move to the next (instead of
+// reusing the same cached points).
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <tuple>
+#include <vector>
+
+#include "chrono/core/ChLog.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono_vehicle/terrain/GranularTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+double radius = 0.02;
+double width = 0.4;
+double shift = 0.2;
+
+typedef std::tuple<long, long, long> Point;
+
+// Pattern of the relocated particles, relative to the rear-bottom-center of the new front slab
+std::set<Point> GetPattern(const std::vector<ChVector<>>& points, double front) {
+    std::set<Point> pattern;
+    for (const auto& p : points) {
+        pattern.insert(Point(std::lround((p.x() - front) * 1e6), std::lround(p.y() * 1e6), std::lround(p.z() * 1e6)));
+    }
+    return pattern;
+}
+
+int main(int argc, char* argv[]) {
+    ChSystemNSC system;
+
+    auto body = std::make_shared<ChBody>();
+    body->SetBodyFixed(true);
+    system.AddBody(body);
+
+    GranularTerrain terrain(&system);
+    terrain.EnableMovingPatch(body, 0.3, shift);
+    terrain.Initialize(ChVector<>(0, 0, 0), 1, width, 3, radius, 2000);
+
+    // Use the particles in the rear slab as settled bed
+    terrain.SetMovingPatchBed(terrain.CaptureMovingPatchBed());
+
+    bool passed = true;
+    double eps = 1e-9;
+    std::set<Point> prev_pattern;
+    int num_repeated = 0;
+    int num_moves = 8;
+    for (int move = 0; move < num_moves; move++) {
+        double front = terrain.GetPatchFront();
+        body->SetPos(ChVector<>(front - 0.1, 0, 0));
+        terrain.Synchronize(move);
+        if (!terrain.PatchMoved()) {
+            GetLog() << "Move " << move << ": patch not moved\n";
+            return 1;
+        }
+
+        // Relocated particles are ahead of the old front
+        std::vector<ChVector<>> points;
+        for (auto b : system.Get_bodylist()) {
+            if (b->GetCollide() && b->GetPos().x() > front)
+                points.push_back(b->GetPos());
+        }
+
+        // Inside the relocated volume
+        for (const auto& p : points) {
+            if (p.x() < front + radius - eps || p.x() > front + shift - radius + eps ||
+                std::abs(p.y()) > width / 2 - radius + eps || p.z() < radius - eps) {
+                GetLog() << "Move " << move << ": particle outside the relocated volume at " << p.x() << " "
+                         << p.y() << " " << p.z() << "\n";
+                passed = false;
+            }
+        }
+
+        // No overlaps
+        for (size_t i = 0; i < points.size(); i++) {
+            for (size_t j = i + 1; j < points.size(); j++) {
+                if ((points[i] - points[j]).Length() < 2 * radius - eps) {
+                    GetLog() << "Move " << move << ": overlapping particles\n";
+                    passed = false;
+                }
+            }
+        }
+
+        // Compare with the pattern of the previous move: if the same cached points are reused, the smaller pattern
+        // is included in the larger one
+        auto pattern = GetPattern(points, front);
+        const auto& small = pattern.size() < prev_pattern.size() ? pattern : prev_pattern;
+        const auto& large = pattern.size() < prev_pattern.size() ? prev_pattern : pattern;
+        if (move > 0 && std::includes(large.begin(), large.end(), small.begin(), small.end()))
+            num_repeated++;
+        prev_pattern = pattern;
+
+        GetLog() << "Move " << move << ": relocated " << points.size() << " particles, front at "
+                 << terrain.GetPatchFront() << "\n";
+    }
+
+    GetLog() << "Repeated patterns: " << num_repeated << " out of " << num_moves - 1 << "\n";
+    if (num_repeated == num_moves - 1) {
+        GetLog() << "The relocated particles always use the same pattern\n";
+        passed = false;
+    }
+
+    GetLog() << (passed ? "PASSED\n" : "FAILED\n");
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
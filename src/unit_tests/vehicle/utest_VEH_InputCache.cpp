@@ -0,0 +1,139 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the input cache (parsed JSON files and terrain meshes).
+// - Without cache (default), every read sees the current file contents.
+// - In a cache scope, a file is read once, and read again when modified; the
+//   cache is emptied when the scope ends.
+// - The cache can be explicitly enabled, cleared, and disabled.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include <sys/stat.h>
+#include <sys/types.h>
+#ifdef _WIN32
+#include <sys/utime.h>
+#else
+#include <utime.h>
+#endif
+
+#include "chrono/core/ChLog.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+#include "chrono_vehicle/utils/ChInputCache.h"
+#include "chrono_vehicle/utils/ChUtilsJSON.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+std::string filename("utest_VEH_InputCache.json");
+
+// Write the JSON file, with the given modification time.
+void WriteFile(int value, time_t mtime) {
+    {
+        std::ofstream ofs(filename);
+        ofs << "{\n  // Test value\n  \"Value\": " << value << "\n}\n";
+    }
+    struct utimbuf times;
+    times.actime = mtime;
+    times.modtime = mtime;
+    utime(filename.c_str(), &times);
+}
+
+int ReadFile() {
+    rapidjson::Document d;
+    ReadFileJSON(filename, d);
+    return d["Value"].GetInt();
+}
+
+bool Check(bool condition, const std::string& message) {
+    if (!condition)
+        GetLog() << "Failed: " << message << "\n";
+    return condition;
+}
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+    time_t t0 = 1000000000;
+
+    // No caching by default
+    WriteFile(1, t0);
+    passed &= Check(!ChInputCache::IsEnabled(), "cache enabled by default");
+    passed &= Check(ReadFile() == 1, "read without cache");
+    WriteFile(2, t0);
+    passed &= Check(ReadFile() == 2, "file changes seen without cache");
+    passed &= Check(ChInputCache::GetNumEntries() == 0, "entries cached while disabled");
+
+    {
+        ChInputCacheScope scope;
+        passed &= Check(ChInputCache::IsEnabled(), "cache not enabled in a scope");
+        passed &= Check(ReadFile() == 2, "first read in a scope");
+        passed &= Check(ChInputCache::GetNumEntries() == 1, "file not cached");
+
+        // Same modification time: the cached document is used
+        WriteFile(3, t0);
+        passed &= Check(ReadFile() == 2, "cached document not used");
+
+        // Modified file: the file is read again
+        WriteFile(4, t0 + 10);
+        passed &= Check(ReadFile() == 4, "modified file not read again");
+        passed &= Check(ChInputCache::GetNumEntries() == 1, "stale entry kept");
+
+        // Nested scope and terrain mesh
+        {
+            ChInputCacheScope inner;
+            ChSystemNSC system;
+            RigidTerrain terrain1(&system);
+            terrain1.AddPatch(CSYSNORM, vehicle::GetDataFile("terrain/meshes/halfround_200mm.obj"), "bump");
+            RigidTerrain terrain2(&system);
+            terrain2.AddPatch(CSYSNORM, vehicle::GetDataFile("terrain/meshes/halfround_200mm.obj"), "bump");
+            passed &= Check(ChInputCache::GetNumEntries() == 2, "mesh not cached once");
+        }
+        passed &= Check(ChInputCache::IsEnabled() && ChInputCache::GetNumEntries() == 2,
+                        "cache cleared at the end of a nested scope");
+    }
+    passed &= Check(!ChInputCache::IsEnabled(), "cache still enabled after the scope");
+    passed &= Check(ChInputCache::GetNumEntries() == 0, "cache not cleared after the scope");
+
+    // Explicit control
+    ChInputCache::Enable(true);
+    WriteFile(5, t0);
+    passed &= Check(ReadFile() == 5, "first read with enabled cache");
+    WriteFile(6, t0);
+    passed &= Check(ReadFile() == 5, "cached document not used with enabled cache");
+    ChInputCache::Clear();
+    passed &= Check(ChInputCache::GetNumEntries() == 0, "cache not cleared");
+    passed &= Check(ReadFile() == 6, "file not read again after clearing the cache");
+    ChInputCache::Enable(false);
+    passed &= Check(ChInputCache::GetNumEntries() == 0, "cache not cleared when disabled");
+
+    // Missing file
+    std::remove(filename.c_str());
+    bool thrown = false;
+    try {
+        ReadFile();
+    } catch (const ChException&) {
+        thrown = true;
+    }
+    passed &= Check(thrown, "no exception for a missing file");
+
+    GetLog() << (passed ? "PASSED\n" : "FAILED\n");
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
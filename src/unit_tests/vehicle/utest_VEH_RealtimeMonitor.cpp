@@ -0,0 +1,129 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the real-time frame monitor (ChRealtimeMonitor).
+// Short frames and frames busy for a known time in two sections are recorded.
+// The latency histogram, percentiles, and overrun records must reflect them.
+// The checks only rely on lower bounds of the busy times, so that they are not
+// sensitive to the load of the machine.
+//
+// =============================================================================
+
+#include <cmath>
+#include <numeric>
+#include <string>
+
+#include "chrono/core/ChLog.h"
+#include "chrono/core/ChTimer.h"
+
+#include "chrono_vehicle/utils/ChRealtimeMonitor.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// Keep the processor busy for the specified time [s].
+void BusyWait(double duration) {
+    ChTimer<double> timer;
+    timer.start();
+    while (timer.GetTimeSecondsIntermediate() < duration) {
+    }
+}
+
+bool Check(bool condition, const std::string& message) {
+    if (!condition)
+        GetLog() << "Failed: " << message.c_str() << "\n";
+    return condition;
+}
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+
+    // 10 ms budget, 1 ms histogram bins up to 20 ms
+    double budget = 0.01;
+    ChRealtimeMonitor monitor(budget, 0.02, 20);
+    monitor.SetMaxOverrunRecords(10);
+    passed &= Check(monitor.GetHistogram().size() == 20 && std::abs(monitor.GetBinWidth() - 0.001) < 1e-15,
+                    "histogram bins");
+
+    // 80 short frames and 20 frames busy for 6 ms in each of two sections
+    int num_short = 80;
+    int num_long = 20;
+    for (int i = 0; i < num_short + num_long; i++) {
+        bool busy = i % 5 == 0;
+        {
+            ChRealtimeSection section(&monitor, ChRealtimeMonitor::TIRES);
+            if (busy)
+                BusyWait(0.006);
+        }
+        {
+            ChRealtimeSection section(&monitor, ChRealtimeMonitor::DYNAMICS);
+            if (busy)
+                BusyWait(0.006);
+        }
+        monitor.EndFrame(i * 1e-3);
+        if (busy) {
+            passed &= Check(monitor.GetLastSectionTime(ChRealtimeMonitor::TIRES) >= 0.006 &&
+                                monitor.GetLastSectionTime(ChRealtimeMonitor::DYNAMICS) >= 0.006,
+                            "section times of a busy frame");
+        }
+    }
+
+    // One frame beyond the histogram range
+    {
+        ChRealtimeSection section(&monitor, ChRealtimeMonitor::TERRAIN);
+        BusyWait(0.025);
+    }
+    monitor.EndFrame(1);
+
+    int num_frames = num_short + num_long + 1;
+    const auto& histogram = monitor.GetHistogram();
+    passed &= Check(monitor.GetNumFrames() == num_frames, "number of frames");
+    passed &= Check(std::accumulate(histogram.begin(), histogram.end(), 0) == num_frames, "histogram total");
+    passed &= Check(histogram.back() >= 1, "frame beyond the histogram range not in the last bin");
+    passed &= Check(std::accumulate(histogram.begin() + 12, histogram.end(), 0) >= num_long + 1,
+                    "busy frames not in the histogram bins above 12 ms");
+
+    // Percentiles: the median is a short frame, the 90th percentile a busy frame, the maximum the last frame
+    double p50 = monitor.GetLatencyPercentile(0.5);
+    double p90 = monitor.GetLatencyPercentile(0.9);
+    double p100 = monitor.GetLatencyPercentile(1.0);
+    GetLog() << "Latency percentiles [ms]: p50 " << 1e3 * p50 << ", p90 " << 1e3 * p90 << ", p100 " << 1e3 * p100
+             << ", max " << 1e3 * monitor.GetMaxLatency() << "\n";
+    passed &= Check(p50 < 0.012, "median latency");
+    passed &= Check(p90 >= 0.012, "90th percentile latency");
+    passed &= Check(p50 <= p90 && p90 <= p100, "percentiles not increasing");
+    passed &= Check(p100 == monitor.GetMaxLatency() && p100 >= 0.025, "maximum latency");
+    passed &= Check(monitor.GetMeanLatency() <= monitor.GetMaxLatency(), "mean latency");
+
+    // Overruns: counted for all frames above the budget, recorded up to the maximum number of records
+    passed &= Check(monitor.GetNumOverruns() >= num_long + 1, "number of overruns");
+    passed &= Check(monitor.GetOverruns().size() == 10, "number of overrun records");
+    for (const auto& overrun : monitor.GetOverruns()) {
+        double sum = 0;
+        for (int i = 0; i < ChRealtimeMonitor::NUM_SECTIONS; i++)
+            sum += overrun.sections[i];
+        passed &= Check(overrun.latency > budget && std::abs(sum - overrun.latency) < 1e-12, "overrun record");
+    }
+
+    // No timing with a null monitor; no statistics after a reset
+    { ChRealtimeSection section(nullptr, ChRealtimeMonitor::TIRES); }
+    monitor.Reset();
+    passed &= Check(monitor.GetNumFrames() == 0 && monitor.GetNumOverruns() == 0 && monitor.GetOverruns().empty() &&
+                        std::accumulate(histogram.begin(), histogram.end(), 0) == 0 &&
+                        monitor.GetLatencyPercentile(0.5) == 0,
+                    "reset");
+
+    GetLog() << (passed ? "PASSED\n" : "FAILED\n");
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
@@ -0,0 +1,151 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the height queries of RigidTerrain.
+// Before Initialize, the terrain height and normal are obtained by casting
+// vertical rays into the patch collision models; after Initialize, they are
+// looked up in the 2D grid of the patch triangles. Both must agree on a box, a
+// tilted box, a height map, and a mesh lying on top of another patch.
+//
+// =============================================================================
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "chrono/collision/ChCCollisionModel.h"
+#include "chrono/core/ChLog.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+struct Query {
+    double x;
+    double y;
+    double height;
+    ChVector<> normal;
+    float friction;
+};
+
+int main(int argc, char* argv[]) {
+    ChSystemNSC system;
+
+    // Without collision envelope and margin (set by the system constructor), the ray casts see the patch geometry
+    collision::ChCollisionModel::SetDefaultSuggestedEnvelope(0);
+    collision::ChCollisionModel::SetDefaultSuggestedMargin(0);
+
+    RigidTerrain terrain(&system);
+
+    // Flat box with its top face at z = 0
+    auto flat = terrain.AddPatch(ChCoordsys<>(ChVector<>(0, 0, -1), QUNIT), ChVector<>(40, 40, 2), false, 1, false);
+    flat->SetContactFrictionCoefficient(0.5f);
+
+    // Box tilted about the x axis
+    auto tilted = terrain.AddPatch(ChCoordsys<>(ChVector<>(60, 0, -1), Q_from_AngX(0.2)), ChVector<>(30, 30, 2),
+                                   false, 1, false);
+    tilted->SetContactFrictionCoefficient(0.6f);
+
+    // Height map
+    auto hmap = terrain.AddPatch(ChCoordsys<>(ChVector<>(0, 60, 0), QUNIT),
+                                 vehicle::GetDataFile("terrain/height_maps/test64.bmp"), "test64", 30, 30, 0, 3, false);
+    hmap->SetContactFrictionCoefficient(0.7f);
+
+    // Mesh bump just above the flat box
+    auto bump = terrain.AddPatch(ChCoordsys<>(ChVector<>(-15, -10, 0.05), QUNIT),
+                                 vehicle::GetDataFile("terrain/meshes/halfround_200mm.obj"), "bump", 0, false);
+    bump->SetContactFrictionCoefficient(0.9f);
+
+    // Position the collision models of the patch bodies
+    system.DoStepDynamics(1e-3);
+
+    // Query locations inside each patch, away from the edges
+    std::mt19937 generator(12345);
+    std::uniform_real_distribution<double> unif(-1, 1);
+    std::vector<ChVector2<>> locations;
+    for (int i = 0; i < 500; i++) {
+        locations.push_back(ChVector2<>(19 * unif(generator), 19 * unif(generator)));
+        locations.push_back(ChVector2<>(60 + 14 * unif(generator), 14 * unif(generator)));
+        locations.push_back(ChVector2<>(14 * unif(generator), 60 + 14 * unif(generator)));
+        locations.push_back(ChVector2<>(10 * unif(generator), -10 + 2.5 * unif(generator)));
+    }
+
+    // Ray casting
+    std::vector<Query> rays;
+    for (auto& loc : locations) {
+        Query q = {loc.x(), loc.y()};
+        terrain.GetProperties(q.x, q.y, q.height, q.normal, q.friction);
+        rays.push_back(q);
+    }
+
+    // 2D grid
+    terrain.Initialize();
+    std::vector<Query> grid;
+    for (auto& loc : locations) {
+        Query q = {loc.x(), loc.y()};
+        terrain.GetProperties(q.x, q.y, q.height, q.normal, q.friction);
+        grid.push_back(q);
+    }
+
+    // The batched queries return the same values as the single ones
+    std::vector<double> heights;
+    std::vector<ChVector<>> normals;
+    std::vector<float> frictions;
+    terrain.GetProperties(locations, heights, normals, frictions);
+
+    // The ray casts are done in single precision over a 2000 m long ray, and the Bullet convex casts against mesh
+    // triangles are only accurate to a few centimeters. The grid is exact, so the ray cast results are only
+    // expected to be close on average, with the same patch (friction) found everywhere.
+    bool passed = true;
+    double max_dh = 0;
+    double sum_dh = 0;
+    double sum_dn_box = 0;
+    for (size_t i = 0; i < locations.size(); i++) {
+        const Query& r = rays[i];
+        const Query& g = grid[i];
+        double dh = std::abs(g.height - r.height);
+        max_dh = std::max(max_dh, dh);
+        sum_dh += dh;
+        if (dh > 0.03 || g.friction != r.friction) {
+            GetLog() << "Mismatch at (" << r.x << ", " << r.y << "): ray " << r.height << " " << r.friction
+                     << ", grid " << g.height << " " << g.friction << "\n";
+            passed = false;
+        }
+
+        // Box patches: the normals are those of the box faces
+        if (i % 4 < 2)
+            sum_dn_box += (g.normal - r.normal).Length();
+
+        if (heights[i] != g.height || !(normals[i] == g.normal) || frictions[i] != g.friction) {
+            GetLog() << "Batched query differs at (" << r.x << ", " << r.y << ")\n";
+            passed = false;
+        }
+        if (terrain.GetHeight(g.x, g.y) != g.height || !(terrain.GetNormal(g.x, g.y) == g.normal)) {
+            GetLog() << "GetHeight/GetNormal differ from GetProperties at (" << r.x << ", " << r.y << ")\n";
+            passed = false;
+        }
+    }
+    double mean_dh = sum_dh / locations.size();
+    double mean_dn_box = sum_dn_box / (locations.size() / 2);
+    if (mean_dh > 1e-3 || mean_dn_box > 1e-3)
+        passed = false;
+
+    GetLog() << "Height difference: max " << max_dh << ", mean " << mean_dh << "\n";
+    GetLog() << "Box normal difference: mean " << mean_dn_box << "\n";
+    GetLog() << (passed ? "PASSED\n" : "FAILED\n");
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
@@ -0,0 +1,153 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the bounding box ray casting of SCMDeformableTerrain.
+// A rolling wheel and a falling ball interact with the same soil twice: once
+// with the default ray casting (one ray per vertex against the whole collision
+// system) and once with bounding box ray casting. The deformed soil, the soil
+// forces and the body states must be identical, with far fewer ray casts in
+// the latter. This is checked on a tilted Z-up plane, with and without mesh
+// refinement.
+//
+// =============================================================================
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "chrono/core/ChLog.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono_vehicle/terrain/SCMDeformableTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+double step_size = 2e-3;
+int num_steps = 100;
+
+class SoilTest {
+  public:
+    SoilTest(bool bbox, bool refine) : m_terrain(&m_system) {
+        m_system.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+        // Soil in the Z-up plane, slightly tilted about the Y axis
+        m_terrain.SetPlane(ChCoordsys<>(VNULL, Q_from_AngY(0.05) * Q_from_AngX(CH_C_PI_2)));
+        m_terrain.SetSoilParametersSCM(0.2e6, 0, 1.1, 0, 30, 0.01, 4e7, 3e4);
+        m_terrain.SetAutomaticRefinement(refine);
+        m_terrain.SetAutomaticRefinementResolution(0.02);
+        m_terrain.SetBoundingBoxRayCasting(bbox);
+        m_terrain.Initialize(0, 2, 2, 60, 60);
+
+        // Wheel rolling in the X direction
+        m_wheel = std::make_shared<ChBodyEasyCylinder>(0.2, 0.1, 1000, true, false);
+        m_wheel->SetPos(ChVector<>(-0.6, 0, 0.21));
+        m_wheel->SetPos_dt(ChVector<>(1, 0, 0));
+        m_wheel->SetWvel_par(ChVector<>(0, 5, 0));
+        m_system.AddBody(m_wheel);
+
+        // Ball falling on the soil
+        m_ball = std::make_shared<ChBodyEasySphere>(0.15, 1000, true, false);
+        m_ball->SetPos(ChVector<>(0.4, 0.5, 0.3));
+        m_system.AddBody(m_ball);
+
+        // Box far above the soil
+        auto box = std::make_shared<ChBodyEasyBox>(0.2, 0.2, 0.2, 1000, true, false);
+        box->SetPos(ChVector<>(0, -0.5, 2));
+        box->SetBodyFixed(true);
+        m_system.AddBody(box);
+    }
+
+    void Advance() { m_system.DoStepDynamics(step_size); }
+
+    size_t GetNumRayCasts() const {
+        std::stringstream ss;
+        m_terrain.PrintStepStatistics(ss);
+        std::string line;
+        while (std::getline(ss, line)) {
+            auto pos = line.find("Number ray-casts:");
+            if (pos != std::string::npos)
+                return std::stoul(line.substr(pos + 17));
+        }
+        return 0;
+    }
+
+    ChSystemNSC m_system;
+    SCMDeformableTerrain m_terrain;
+    std::shared_ptr<ChBody> m_wheel;
+    std::shared_ptr<ChBody> m_ball;
+};
+
+bool SameForce(const TerrainForce& a, const TerrainForce& b) {
+    return a.force == b.force && a.moment == b.moment && a.point == b.point;
+}
+
+bool CheckMode(bool refine) {
+    GetLog() << "Refinement " << (refine ? "enabled" : "disabled") << "\n";
+
+    SoilTest dense(false, refine);
+    SoilTest bbox(true, refine);
+
+    size_t dense_casts = 0;
+    size_t bbox_casts = 0;
+    for (int i = 0; i < num_steps; i++) {
+        dense.Advance();
+        bbox.Advance();
+        dense_casts += dense.GetNumRayCasts();
+        bbox_casts += bbox.GetNumRayCasts();
+
+        auto& dense_vertices = dense.m_terrain.GetMesh()->GetMesh().getCoordsVertices();
+        auto& bbox_vertices = bbox.m_terrain.GetMesh()->GetMesh().getCoordsVertices();
+        if (dense_vertices != bbox_vertices) {
+            GetLog() << "Step " << i << ": different soil meshes\n";
+            return false;
+        }
+        if (!SameForce(dense.m_terrain.GetContactForce(dense.m_wheel), bbox.m_terrain.GetContactForce(bbox.m_wheel)) ||
+            !SameForce(dense.m_terrain.GetContactForce(dense.m_ball), bbox.m_terrain.GetContactForce(bbox.m_ball))) {
+            GetLog() << "Step " << i << ": different soil forces\n";
+            return false;
+        }
+        if (!(dense.m_wheel->GetPos() == bbox.m_wheel->GetPos()) || !(dense.m_ball->GetPos() == bbox.m_ball->GetPos())) {
+            GetLog() << "Step " << i << ": different body positions\n";
+            return false;
+        }
+    }
+
+    double sinkage = 0.21 - dense.m_wheel->GetPos().z();
+    GetLog() << "  vertices: " << dense.m_terrain.GetMesh()->GetMesh().getCoordsVertices().size()
+             << ", wheel sinkage: " << sinkage << "\n";
+    GetLog() << "  ray casts: " << dense_casts << " (default), " << bbox_casts << " (bounding box)\n";
+
+    // The wheel must have reached the soil, and the bounding box ray casting must be selective
+    if (dense.m_terrain.GetContactForce(dense.m_wheel).force.Length() == 0) {
+        GetLog() << "No soil force on the wheel\n";
+        return false;
+    }
+    if (bbox_casts * 5 > dense_casts) {
+        GetLog() << "Too many ray casts\n";
+        return false;
+    }
+
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+    passed &= CheckMode(false);
+    passed &= CheckMode(true);
+
+    GetLog() << (passed ? "PASSED\n" : "FAILED\n");
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
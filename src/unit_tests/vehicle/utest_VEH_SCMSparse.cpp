@@ -0,0 +1,178 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the sparse tiled storage of SCMDeformableTerrain.
+// - A wheel rolling on a sparse terrain must follow the same trajectory as on
+//   a dense grid with the same spacing, with fewer vertices.
+// - With tile freezing, the ruts left by the wheel must be removed from the
+//   mesh when the wheel moves away, and restored when it comes back.
+//
+// =============================================================================
+
+#include <cmath>
+#include <map>
+#include <memory>
+#include <utility>
+
+#include "chrono/core/ChLog.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono_vehicle/terrain/SCMDeformableTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+double step_size = 2e-3;
+double delta = 0.02;
+
+class SoilTest {
+  public:
+    SoilTest(bool sparse) : m_terrain(&m_system) {
+        m_system.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+        m_terrain.SetPlane(ChCoordsys<>(VNULL, Q_from_AngX(CH_C_PI_2)));
+        m_terrain.SetSoilParametersSCM(0.2e6, 0, 1.1, 0, 30, 0.01, 4e7, 3e4);
+        if (sparse)
+            m_terrain.InitializeSparse(0, delta, 16);
+        else
+            m_terrain.Initialize(0, 100 * delta, 40 * delta, 100, 40);
+
+        m_wheel = std::make_shared<ChBodyEasyCylinder>(0.2, 0.1, 1000, true, false);
+        m_wheel->SetPos(ChVector<>(-0.6, 0, 0.21));
+        m_wheel->SetPos_dt(ChVector<>(1, 0, 0));
+        m_wheel->SetWvel_par(ChVector<>(0, 5, 0));
+        m_system.AddBody(m_wheel);
+    }
+
+    void Advance() { m_system.DoStepDynamics(step_size); }
+
+    const std::vector<ChVector<>>& GetVertices() const { return m_terrain.GetMesh()->GetMesh().getCoordsVertices(); }
+
+    // Heights of the deformed vertices, by grid point
+    std::map<std::pair<int, int>, double> GetRuts() const {
+        std::map<std::pair<int, int>, double> ruts;
+        for (const auto& v : GetVertices()) {
+            if (v.z() < -1e-6)
+                ruts[std::make_pair((int)std::round(v.x() / delta), (int)std::round(v.y() / delta))] = v.z();
+        }
+        return ruts;
+    }
+
+    ChSystemNSC m_system;
+    SCMDeformableTerrain m_terrain;
+    std::shared_ptr<ChBody> m_wheel;
+};
+
+bool CheckDense() {
+    SoilTest dense(false);
+    SoilTest sparse(true);
+
+    double max_diff = 0;
+    for (int i = 0; i < 300; i++) {
+        dense.Advance();
+        sparse.Advance();
+        max_diff = std::max(max_diff, (dense.m_wheel->GetPos() - sparse.m_wheel->GetPos()).Length());
+    }
+
+    GetLog() << "Dense vs sparse\n";
+    GetLog() << "  vertices: " << dense.GetVertices().size() << " (dense), " << sparse.GetVertices().size()
+             << " (sparse, " << sparse.m_terrain.GetNumActiveTiles() << " tiles)\n";
+    GetLog() << "  wheel position: " << sparse.m_wheel->GetPos().x() << " " << sparse.m_wheel->GetPos().z()
+             << ", max difference " << max_diff << "\n";
+
+    bool passed = true;
+    if (sparse.m_wheel->GetPos().z() > 0.2 || dense.m_terrain.GetContactForce(dense.m_wheel).force.Length() == 0) {
+        GetLog() << "The wheel does not sink in the soil\n";
+        passed = false;
+    }
+    if (max_diff > 1e-4) {
+        GetLog() << "Different wheel trajectories\n";
+        passed = false;
+    }
+    if (sparse.GetVertices().size() >= dense.GetVertices().size()) {
+        GetLog() << "Sparse terrain not smaller than the dense one\n";
+        passed = false;
+    }
+    return passed;
+}
+
+bool CheckFreeze() {
+    SoilTest sparse(true);
+    sparse.m_terrain.SetTileFreezeDistance(0.5);
+
+    for (int i = 0; i < 300; i++)
+        sparse.Advance();
+
+    // Lift the wheel above the rut and let the elastic sinkage recover. The wheel is kept floating rather than
+    // fixed, since the tiles are only created and kept around moving bodies.
+    ChVector<> pos = sparse.m_wheel->GetPos();
+    sparse.m_system.Set_G_acc(VNULL);
+    sparse.m_wheel->SetPos_dt(VNULL);
+    sparse.m_wheel->SetWvel_par(VNULL);
+    sparse.m_wheel->SetPos(pos + ChVector<>(0, 0, 0.5));
+    for (int i = 0; i < 5; i++)
+        sparse.Advance();
+    auto ruts = sparse.GetRuts();
+
+    // Move the wheel away: the tiles with the ruts are frozen
+    sparse.m_wheel->SetPos(pos + ChVector<>(5, 0, 0.5));
+    sparse.Advance();
+    int num_frozen = sparse.m_terrain.GetNumFrozenTiles();
+    auto ruts_away = sparse.GetRuts();
+
+    // Bring the wheel back just above the rut: the tiles are restored
+    sparse.m_wheel->SetPos(pos + ChVector<>(0, 0, 0.05));
+    sparse.Advance();
+    auto ruts_back = sparse.GetRuts();
+
+    GetLog() << "Tile freezing\n";
+    GetLog() << "  rut vertices: " << ruts.size() << ", frozen tiles: " << num_frozen
+             << ", rut vertices after return: " << ruts_back.size() << "\n";
+
+    bool passed = true;
+    if (ruts.empty() || num_frozen == 0 || !ruts_away.empty()) {
+        GetLog() << "The ruts were not frozen\n";
+        passed = false;
+    }
+    if (ruts_back.size() != ruts.size()) {
+        GetLog() << "The ruts were not restored\n";
+        passed = false;
+    }
+    double max_diff = 0;
+    for (const auto& rut : ruts) {
+        auto back = ruts_back.find(rut.first);
+        if (back == ruts_back.end()) {
+            passed = false;
+            continue;
+        }
+        max_diff = std::max(max_diff, std::abs(back->second - rut.second));
+    }
+    GetLog() << "  max height difference: " << max_diff << "\n";
+    // Frozen tiles are stored in single precision
+    if (max_diff > 1e-6) {
+        GetLog() << "Different restored ruts\n";
+        passed = false;
+    }
+    return passed;
+}
+
+int main(int argc, char* argv[]) {
+    bool passed = true;
+    passed &= CheckDense();
+    passed &= CheckFreeze();
+
+    GetLog() << (passed ? "PASSED\n" : "FAILED\n");
+
+    // Return 0 if all tests passed.
+    return !passed;
+}
@@ -0,0 +1,176 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Unit test for the batched advance of semi-empirical tires (ChTireBatch).
+// Two identical sets of Pac89, Fiala and TMeasy tires are driven with the same
+// prescribed wheel states on a flat terrain: one set is advanced tire by tire,
+// the other with a ChTireBatch. The tire forces must be identical. For each
+// model, some tires use modified coefficients: they must form a separate group,
+// as evaluating them with the original coefficients would change their forces.
+//
+// =============================================================================
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "chrono/core/ChLog.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/ChTireBatch.h"
+
+#include "chrono_models/vehicle/hmmwv/HMMWV_FialaTire.h"
+#include "chrono_models/vehicle/hmmwv/HMMWV_Pac89Tire.h"
+#include "chrono_models/vehicle/hmmwv/HMMWV_TMeasyTire.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+using namespace chrono::vehicle::hmmwv;
+
+double step_size = 1e-3;
+int num_steps = 500;
+int num_tires_per_group = 3;
+
+// Tires with modified coefficients
+class ModifiedPac89Tire : public HMMWV_Pac89Tire {
+  public:
+    ModifiedPac89Tire(const std::string& name) : HMMWV_Pac89Tire(name) {}
+    virtual void SetPac89Params() override {
+        HMMWV_Pac89Tire::SetPac89Params();
+        m_PacCoeff.A2 *= 1.2;
+    }
+};
+
+class ModifiedFialaTire : public HMMWV_FialaTire {
+  public:
+    ModifiedFialaTire(const std::string& name) : HMMWV_FialaTire(name) {}
+    virtual void SetFialaParams() override {
+        HMMWV_FialaTire::SetFialaParams();
+        m_mu_0 *= 0.8;
+    }
+};
+
+class ModifiedTMeasyTire : public HMMWV_TMeasyTire {
+  public:
+    ModifiedTMeasyTire(const std::string& name) : HMMWV_TMeasyTire(name) {}
+    virtual void SetTMeasyParams() override {
+        HMMWV_TMeasyTire::SetTMeasyParams();
+        m_TMeasyCoeff.dfy0_pn *= 1.2;
+    }
+};
+
+// Create all tires, with their wheel bodies.
+std::vector<std::shared_ptr<ChTire>> CreateTires(ChSystem& system, const ChTerrain& terrain) {
+    std::vector<std::shared_ptr<ChTire>> tires;
+    for (int i = 0; i < num_tires_per_group; i++) {
+        tires.push_back(std::make_shared<HMMWV_Pac89Tire>("Pac89"));
+        tires.push_back(std::make_shared<ModifiedPac89Tire>("Pac89_mod"));
+        tires.push_back(std::make_shared<HMMWV_FialaTire>("Fiala"));
+        tires.push_back(std::make_shared<ModifiedFialaTire>("Fiala_mod"));
+        tires.push_back(std::make_shared<HMMWV_TMeasyTire>("TMeasy"));
+        tires.push_back(std::make_shared<ModifiedTMeasyTire>("TMeasy_mod"));
+    }
+    for (auto& tire : tires) {
+        auto wheel = std::shared_ptr<ChBody>(system.NewBody());
+        system.AddBody(wheel);
+        tire->SetStepsize(step_size);
+        tire->Initialize(wheel, LEFT);
+
+        // Out of contact, the tire radius is the unloaded radius
+        WheelState state = {ChVector<>(0, 0, 10), QUNIT, VNULL, VNULL, 0};
+        tire->Synchronize(0, state, terrain);
+        tire->Advance(step_size);
+    }
+    return tires;
+}
+
+// Prescribed state of the i-th wheel at the given time: the wheels roll on the terrain at different speeds,
+// with different slips, steering and camber angles, and vertical oscillations.
+WheelState GetWheelState(int i, double time, double radius) {
+    double speed = 5 + 0.5 * i;
+    double slip = 0.1 * std::sin(3 * time + i);
+    double steer = 0.05 * std::sin(2 * time + 0.5 * i);
+    double camber = 0.01 * (i % 3 - 1);
+    double deflection = 0.02 + 0.005 * std::sin(10 * time + i);
+
+    WheelState state;
+    state.rot = Q_from_AngZ(steer) * Q_from_AngX(camber);
+    state.pos = ChVector<>(speed * time, 3.0 * i, radius - deflection);
+    state.lin_vel = ChVector<>(speed, 0, 0.05 * std::cos(10 * time + i));
+    state.omega = speed * (1 + slip) / radius;
+    state.ang_vel = state.rot.GetYaxis() * state.omega;
+    return state;
+}
+
+bool SameForce(const TerrainForce& a, const TerrainForce& b) {
+    return a.force == b.force && a.moment == b.moment && a.point == b.point;
+}
+
+int main(int argc, char* argv[]) {
+    ChSystemNSC system;
+
+    RigidTerrain terrain(&system);
+    terrain.AddPatch(ChCoordsys<>(ChVector<>(0, 0, -5), QUNIT), ChVector<>(200, 200, 10));
+    terrain.Initialize();
+
+    // Tires advanced one by one, and tires advanced in a batch
+    auto single = CreateTires(system, terrain);
+    auto batched = CreateTires(system, terrain);
+    std::vector<double> radius;
+    for (auto& tire : single)
+        radius.push_back(tire->GetRadius());
+    ChTireBatch batch;
+    for (auto& tire : batched)
+        batch.AddTire(tire.get());
+
+    bool passed = true;
+    bool in_contact = false;
+    for (int step = 0; step < num_steps && passed; step++) {
+        double time = step * step_size;
+        for (int i = 0; i < (int)single.size(); i++) {
+            WheelState state = GetWheelState(i, time, radius[i]);
+            single[i]->Synchronize(time, state, terrain);
+            batched[i]->Synchronize(time, state, terrain);
+        }
+
+        for (auto& tire : single)
+            tire->Advance(step_size);
+        batch.Advance(step_size);
+
+        // Original and modified coefficients of each model form distinct groups
+        if (batch.GetNumGroups() != 6) {
+            GetLog() << "Step " << step << ": " << batch.GetNumGroups() << " tire groups instead of 6\n";
+            passed = false;
+        }
+
+        for (int i = 0; i < (int)single.size(); i++) {
+            TerrainForce force = single[i]->GetTireForce();
+            in_contact = in_contact || force.force.Length() > 0;
+            if (!SameForce(force, batched[i]->GetTireForce())) {
+                GetLog() << "Step " << step << ": different forces for tire " << i << " ("
+                         << single[i]->GetName() << ")\n";
+                passed = false;
+            }
+        }
+    }
+
+    if (!in_contact) {
+        GetLog() << "No tire forces\n";
+        passed = false;
+    }
+
+    GetLog() << (passed ? "PASSED\n" : "FAILED\n");
+
+    // Return 0 if all tests passed.
+    return !passed;
+}